@@ -15,7 +15,14 @@ include $(CLEAR_VARS)
 LOCAL_MODULE		:= libCodeGen
 LOCAL_SRC_FILES		:=	$(PROJECT_PATH)/src/AArch32Assembler.cpp \
 						$(PROJECT_PATH)/src/AArch64Assembler.cpp \
+						$(PROJECT_PATH)/src/AotCompiler.cpp \
+						$(PROJECT_PATH)/src/CodeCache.cpp \
+						$(PROJECT_PATH)/src/CompileService.cpp \
+						$(PROJECT_PATH)/src/CompileTraceWriter.cpp \
+						$(PROJECT_PATH)/src/ElfObjectFile.cpp \
+						$(PROJECT_PATH)/src/GdbJitRegistrar.cpp \
 						$(PROJECT_PATH)/src/Jitter.cpp \
+						$(PROJECT_PATH)/src/Jitter_CodeCache.cpp \
 						$(PROJECT_PATH)/src/Jitter_CodeGen.cpp \
 						$(PROJECT_PATH)/src/Jitter_CodeGen_AArch32.cpp \
 						$(PROJECT_PATH)/src/Jitter_CodeGen_AArch32_64.cpp \
@@ -31,13 +38,18 @@ LOCAL_SRC_FILES		:=	$(PROJECT_PATH)/src/AArch32Assembler.cpp \
 						$(PROJECT_PATH)/src/Jitter_CodeGen_x86_Fpu.cpp \
 						$(PROJECT_PATH)/src/Jitter_CodeGen_x86_Md.cpp \
 						$(PROJECT_PATH)/src/Jitter_CodeGenFactory.cpp \
+						$(PROJECT_PATH)/src/Jitter_Ir.cpp \
 						$(PROJECT_PATH)/src/Jitter_Optimize.cpp \
 						$(PROJECT_PATH)/src/Jitter_RegAlloc.cpp \
 						$(PROJECT_PATH)/src/Jitter_Statement.cpp \
 						$(PROJECT_PATH)/src/Jitter_SymbolTable.cpp \
+						$(PROJECT_PATH)/src/LazyFunction.cpp \
 						$(PROJECT_PATH)/src/MemoryFunction.cpp \
 						$(PROJECT_PATH)/src/ObjectFile.cpp \
+						$(PROJECT_PATH)/src/PerfJitWriter.cpp \
+						$(PROJECT_PATH)/src/TieredFunction.cpp \
 						$(PROJECT_PATH)/src/X86Assembler.cpp \
+						$(PROJECT_PATH)/src/X86Assembler_Avx.cpp \
 						$(PROJECT_PATH)/src/X86Assembler_Fpu.cpp \
 						$(PROJECT_PATH)/src/X86Assembler_Sse.cpp
 LOCAL_CFLAGS		:= -Wno-extern-c-compat
@@ -52,19 +64,33 @@ LOCAL_MODULE			:= libCodeGenTestSuite
 LOCAL_SRC_FILES			:=	$(PROJECT_PATH)/tests/AliasTest.cpp \
 							$(PROJECT_PATH)/tests/AliasTest2.cpp \
 							$(PROJECT_PATH)/tests/Alu64Test.cpp \
+							$(PROJECT_PATH)/tests/AotCompilerTest.cpp \
+							$(PROJECT_PATH)/tests/BitManipTest.cpp \
+							$(PROJECT_PATH)/tests/BranchHintTest.cpp \
 							$(PROJECT_PATH)/tests/Call64Test.cpp \
+							$(PROJECT_PATH)/tests/CodeCacheTest.cpp \
+							$(PROJECT_PATH)/tests/CodeFoldingTest.cpp \
+							$(PROJECT_PATH)/tests/CompileServiceTest.cpp \
+							$(PROJECT_PATH)/tests/CompileStatsTest.cpp \
 							$(PROJECT_PATH)/tests/ConditionTest.cpp \
 							$(PROJECT_PATH)/tests/Cmp64Test.cpp \
 							$(PROJECT_PATH)/tests/CompareTest.cpp \
 							$(PROJECT_PATH)/tests/Crc32Test.cpp \
 							$(PROJECT_PATH)/tests/DivTest.cpp \
+							$(PROJECT_PATH)/tests/ElfObjectFileTest.cpp \
+							$(PROJECT_PATH)/tests/ExtTest.cpp \
+							$(PROJECT_PATH)/tests/FpuDoubleTest.cpp \
 							$(PROJECT_PATH)/tests/FpuTest.cpp \
 							$(PROJECT_PATH)/tests/FpIntMixTest.cpp \
+							$(PROJECT_PATH)/tests/GdbJitRegistrarTest.cpp \
 							$(PROJECT_PATH)/tests/HugeJumpTest.cpp \
+							$(PROJECT_PATH)/tests/IrCaptureTest.cpp \
+							$(PROJECT_PATH)/tests/LazyFunctionTest.cpp \
 							$(PROJECT_PATH)/tests/LogicTest.cpp \
 							$(PROJECT_PATH)/tests/Logic64Test.cpp \
 							$(PROJECT_PATH)/tests/LzcTest.cpp \
 							$(PROJECT_PATH)/tests/Main.cpp \
+							$(PROJECT_PATH)/tests/Md256Test.cpp \
 							$(PROJECT_PATH)/tests/MdAddTest.cpp \
 							$(PROJECT_PATH)/tests/MdCallTest.cpp \
 							$(PROJECT_PATH)/tests/MdCmpTest.cpp \
@@ -74,21 +100,30 @@ LOCAL_SRC_FILES			:=	$(PROJECT_PATH)/tests/AliasTest.cpp \
 							$(PROJECT_PATH)/tests/MdManipTest.cpp \
 							$(PROJECT_PATH)/tests/MdMemAccessTest.cpp \
 							$(PROJECT_PATH)/tests/MdMinMaxTest.cpp \
+							$(PROJECT_PATH)/tests/MdMulTest.cpp \
 							$(PROJECT_PATH)/tests/MdShiftTest.cpp \
 							$(PROJECT_PATH)/tests/MdSubTest.cpp \
 							$(PROJECT_PATH)/tests/MdTest.cpp \
 							$(PROJECT_PATH)/tests/MdUnpackTest.cpp \
 							$(PROJECT_PATH)/tests/MemAccessTest.cpp \
 							$(PROJECT_PATH)/tests/Merge64Test.cpp \
+							$(PROJECT_PATH)/tests/MulAddTest.cpp \
 							$(PROJECT_PATH)/tests/MultTest.cpp \
 							$(PROJECT_PATH)/tests/NestedIfTest.cpp \
+							$(PROJECT_PATH)/tests/OptimizationPipelineTest.cpp \
+							$(PROJECT_PATH)/tests/PerfJitWriterTest.cpp \
+							$(PROJECT_PATH)/tests/ProfileTest.cpp \
 							$(PROJECT_PATH)/tests/RandomAluTest.cpp \
 							$(PROJECT_PATH)/tests/RandomAluTest2.cpp \
 							$(PROJECT_PATH)/tests/RandomAluTest3.cpp \
 							$(PROJECT_PATH)/tests/RegAllocTest.cpp \
+							$(PROJECT_PATH)/tests/RoundingModeTest.cpp \
 							$(PROJECT_PATH)/tests/ShiftTest.cpp \
 							$(PROJECT_PATH)/tests/Shift64Test.cpp \
-							$(PROJECT_PATH)/tests/SimpleMdTest.cpp
+							$(PROJECT_PATH)/tests/SimpleMdTest.cpp \
+							$(PROJECT_PATH)/tests/SizedMemAccessTest.cpp \
+							$(PROJECT_PATH)/tests/TieredCompilationTest.cpp \
+							$(PROJECT_PATH)/tests/TlbLoadTest.cpp
 LOCAL_CFLAGS			:= -Wno-extern-c-compat
 LOCAL_C_INCLUDES		:= $(FRAMEWORK_PATH)/include $(PROJECT_PATH)/include
 LOCAL_CPP_FEATURES		:= exceptions rtti
@@ -216,53 +216,78 @@ public:
 	void									Eor(REGISTER, REGISTER, const ImmediateAluOperand&);
 	void									Ldmia(REGISTER, uint16);
 	void									Ldr(REGISTER, REGISTER, const LdrAddress&);
+	void									Ldrb(REGISTER, REGISTER, const LdrAddress&);
 	void									Ldrd(REGISTER, REGISTER, const LdrAddress&);
+	void									Ldrh(REGISTER, REGISTER, const LdrAddress&);
+	void									Ldrsb(REGISTER, REGISTER, const LdrAddress&);
+	void									Ldrsh(REGISTER, REGISTER, const LdrAddress&);
 	void									Mov(REGISTER, REGISTER);
 	void									Mov(REGISTER, const RegisterAluOperand&);
 	void									Mov(REGISTER, const ImmediateAluOperand&);
 	void									MovCc(CONDITION, REGISTER, const ImmediateAluOperand&);
 	void									Movw(REGISTER, uint16);
 	void									Movt(REGISTER, uint16);
+	void									Mla(REGISTER, REGISTER, REGISTER, REGISTER);
+	void									Mul(REGISTER, REGISTER, REGISTER);
 	void									Mvn(REGISTER, REGISTER);
 	void									Mvn(REGISTER, const ImmediateAluOperand&);	
 	void									Or(REGISTER, REGISTER, REGISTER);
 	void									Or(REGISTER, REGISTER, const ImmediateAluOperand&);
 	void									Or(CONDITION, REGISTER, REGISTER, const ImmediateAluOperand&);
+	void									Rbit(REGISTER, REGISTER);
+	void									Rev(REGISTER, REGISTER);
 	void									Rsb(REGISTER, REGISTER, const ImmediateAluOperand&);
 	void									Sbc(REGISTER, REGISTER, REGISTER);
 	void									Sdiv(REGISTER, REGISTER, REGISTER);
 	void									Smull(REGISTER, REGISTER, REGISTER, REGISTER);
 	void									Stmdb(REGISTER, uint16);
 	void									Str(REGISTER, REGISTER, const LdrAddress&);
+	void									Strb(REGISTER, REGISTER, const LdrAddress&);
 	void									Strd(REGISTER, REGISTER, const LdrAddress&);
+	void									Strh(REGISTER, REGISTER, const LdrAddress&);
 	void									Sub(REGISTER, REGISTER, REGISTER);
 	void									Sub(REGISTER, REGISTER, const ImmediateAluOperand&);
 	void									Subs(REGISTER, REGISTER, REGISTER);
+	void									Sxtb(REGISTER, REGISTER);
+	void									Sxth(REGISTER, REGISTER);
 	void									Teq(REGISTER, const ImmediateAluOperand&);
 	void									Tst(REGISTER, REGISTER);
 	void									Udiv(REGISTER, REGISTER, REGISTER);
 	void									Umull(REGISTER, REGISTER, REGISTER, REGISTER);
+	void									Uxtb(REGISTER, REGISTER);
+	void									Uxth(REGISTER, REGISTER);
 
 	//VFP/NEON
 	void									Vldr(SINGLE_REGISTER, REGISTER, const LdrAddress&);
+	void									Vldr(DOUBLE_REGISTER, REGISTER, const LdrAddress&);
 	void									Vld1_32x2(DOUBLE_REGISTER, REGISTER);
 	void									Vld1_32x4(QUAD_REGISTER, REGISTER);
 	void									Vld1_32x4_u(QUAD_REGISTER, REGISTER);
 	void									Vstr(SINGLE_REGISTER, REGISTER, const LdrAddress&);
+	void									Vstr(DOUBLE_REGISTER, REGISTER, const LdrAddress&);
 	void									Vst1_32x4(QUAD_REGISTER, REGISTER);
 	void									Vmov(DOUBLE_REGISTER, REGISTER, uint8);
 	void									Vmov(REGISTER, DOUBLE_REGISTER, uint8);
+	void									Vmov(SINGLE_REGISTER, REGISTER);
+	void									Vmov(REGISTER, SINGLE_REGISTER);
+	void									VmovCc_F64(CONDITION, DOUBLE_REGISTER, DOUBLE_REGISTER);
 	void									Vmovn_I16(DOUBLE_REGISTER, QUAD_REGISTER);
 	void									Vmovn_I32(DOUBLE_REGISTER, QUAD_REGISTER);
+	void									Vmovn_I64(DOUBLE_REGISTER, QUAD_REGISTER);
 	void									Vdup(QUAD_REGISTER, REGISTER);
 	void									Vzip_I8(DOUBLE_REGISTER, DOUBLE_REGISTER);
 	void									Vzip_I16(DOUBLE_REGISTER, DOUBLE_REGISTER);
 	void									Vzip_I32(QUAD_REGISTER, QUAD_REGISTER);
 	void									Vadd_F32(SINGLE_REGISTER, SINGLE_REGISTER, SINGLE_REGISTER);
 	void									Vadd_F32(QUAD_REGISTER, QUAD_REGISTER, QUAD_REGISTER);
+	void									Vadd_F64(DOUBLE_REGISTER, DOUBLE_REGISTER, DOUBLE_REGISTER);
 	void									Vadd_I8(QUAD_REGISTER, QUAD_REGISTER, QUAD_REGISTER);
 	void									Vadd_I16(QUAD_REGISTER, QUAD_REGISTER, QUAD_REGISTER);
 	void									Vadd_I32(QUAD_REGISTER, QUAD_REGISTER, QUAD_REGISTER);
+	void									Vpadd_I32(DOUBLE_REGISTER, DOUBLE_REGISTER, DOUBLE_REGISTER);
+	void									Vpaddl_U8(DOUBLE_REGISTER, DOUBLE_REGISTER);
+	void									Vpaddl_U16(DOUBLE_REGISTER, DOUBLE_REGISTER);
+	void									Vcnt_I8(DOUBLE_REGISTER, DOUBLE_REGISTER);
 	void									Vqadd_U8(QUAD_REGISTER, QUAD_REGISTER, QUAD_REGISTER);
 	void									Vqadd_U16(QUAD_REGISTER, QUAD_REGISTER, QUAD_REGISTER);
 	void									Vqadd_U32(QUAD_REGISTER, QUAD_REGISTER, QUAD_REGISTER);
@@ -270,6 +295,7 @@ public:
 	void									Vqadd_I32(QUAD_REGISTER, QUAD_REGISTER, QUAD_REGISTER);
 	void									Vsub_F32(SINGLE_REGISTER, SINGLE_REGISTER, SINGLE_REGISTER);
 	void									Vsub_F32(QUAD_REGISTER, QUAD_REGISTER, QUAD_REGISTER);
+	void									Vsub_F64(DOUBLE_REGISTER, DOUBLE_REGISTER, DOUBLE_REGISTER);
 	void									Vsub_I8(QUAD_REGISTER, QUAD_REGISTER, QUAD_REGISTER);
 	void									Vsub_I16(QUAD_REGISTER, QUAD_REGISTER, QUAD_REGISTER);
 	void									Vsub_I32(QUAD_REGISTER, QUAD_REGISTER, QUAD_REGISTER);
@@ -279,7 +305,13 @@ public:
 	void									Vqsub_I32(QUAD_REGISTER, QUAD_REGISTER, QUAD_REGISTER);
 	void									Vmul_F32(SINGLE_REGISTER, SINGLE_REGISTER, SINGLE_REGISTER);
 	void									Vmul_F32(QUAD_REGISTER, QUAD_REGISTER, QUAD_REGISTER);
+	void									Vmul_F64(DOUBLE_REGISTER, DOUBLE_REGISTER, DOUBLE_REGISTER);
+	void									Vmul_I16(QUAD_REGISTER, QUAD_REGISTER, QUAD_REGISTER);
+	void									Vmul_I32(QUAD_REGISTER, QUAD_REGISTER, QUAD_REGISTER);
+	void									Vmull_I16(QUAD_REGISTER, DOUBLE_REGISTER, DOUBLE_REGISTER);
+	void									Vmull_U32(QUAD_REGISTER, DOUBLE_REGISTER, DOUBLE_REGISTER);
 	void									Vdiv_F32(SINGLE_REGISTER, SINGLE_REGISTER, SINGLE_REGISTER);
+	void									Vdiv_F64(DOUBLE_REGISTER, DOUBLE_REGISTER, DOUBLE_REGISTER);
 	void									Vand(QUAD_REGISTER, QUAD_REGISTER, QUAD_REGISTER);
 	void									Vorn(QUAD_REGISTER, QUAD_REGISTER, QUAD_REGISTER);
 	void									Vorr(QUAD_REGISTER, QUAD_REGISTER, QUAD_REGISTER);
@@ -290,10 +322,14 @@ public:
 	void									Vshr_U32(QUAD_REGISTER, QUAD_REGISTER, uint8);
 	void									Vshr_I16(QUAD_REGISTER, QUAD_REGISTER, uint8);
 	void									Vshr_I32(QUAD_REGISTER, QUAD_REGISTER, uint8);
+	void									Vshrn_I32(DOUBLE_REGISTER, QUAD_REGISTER, uint8);
 	void									Vabs_F32(SINGLE_REGISTER, SINGLE_REGISTER);
 	void									Vabs_F32(QUAD_REGISTER, QUAD_REGISTER);
 	void									Vneg_F32(SINGLE_REGISTER, SINGLE_REGISTER);
 	void									Vsqrt_F32(SINGLE_REGISTER, SINGLE_REGISTER);
+	void									Vabs_F64(DOUBLE_REGISTER, DOUBLE_REGISTER);
+	void									Vneg_F64(DOUBLE_REGISTER, DOUBLE_REGISTER);
+	void									Vsqrt_F64(DOUBLE_REGISTER, DOUBLE_REGISTER);
 	void									Vceq_I8(QUAD_REGISTER, QUAD_REGISTER, QUAD_REGISTER);
 	void									Vceq_I16(QUAD_REGISTER, QUAD_REGISTER, QUAD_REGISTER);
 	void									Vceq_I32(QUAD_REGISTER, QUAD_REGISTER, QUAD_REGISTER);
@@ -305,7 +341,14 @@ public:
 	void									Vcvt_F32_S32(QUAD_REGISTER, QUAD_REGISTER);
 	void									Vcvt_S32_F32(SINGLE_REGISTER, SINGLE_REGISTER);
 	void									Vcvt_S32_F32(QUAD_REGISTER, QUAD_REGISTER);
+	void									Vcvtr_S32_F32(SINGLE_REGISTER, SINGLE_REGISTER);
+	void									Vcmp_F64(DOUBLE_REGISTER, DOUBLE_REGISTER);
+	void									Vcvt_F64_S32(DOUBLE_REGISTER, SINGLE_REGISTER);
+	void									Vcvt_S32_F64(SINGLE_REGISTER, DOUBLE_REGISTER);
+	void									Vcvt_F64_F32(DOUBLE_REGISTER, SINGLE_REGISTER);
+	void									Vcvt_F32_F64(SINGLE_REGISTER, DOUBLE_REGISTER);
 	void									Vmrs(REGISTER);
+	void									Vmsr(REGISTER);
 
 	void									Vrecpe_F32(QUAD_REGISTER, QUAD_REGISTER);
 	void									Vrecps_F32(QUAD_REGISTER, QUAD_REGISTER, QUAD_REGISTER);
@@ -319,6 +362,7 @@ public:
 	void									Vmax_I32(QUAD_REGISTER, QUAD_REGISTER, QUAD_REGISTER);
 
 	static LdrAddress						MakeImmediateLdrAddress(int32);
+	static LdrAddress						MakeRegisterLdrAddress(CAArch32Assembler::REGISTER, const AluLdrShift&);
 	static ImmediateAluOperand				MakeImmediateAluOperand(uint8, uint8);
 	static RegisterAluOperand				MakeRegisterAluOperand(CAArch32Assembler::REGISTER, const AluLdrShift&);
 	
@@ -87,6 +87,8 @@ public:
 	void    Add_4s(REGISTERMD, REGISTERMD, REGISTERMD);
 	void    Add_8h(REGISTERMD, REGISTERMD, REGISTERMD);
 	void    Add_16b(REGISTERMD, REGISTERMD, REGISTERMD);
+	void    Addp_4s(REGISTERMD, REGISTERMD, REGISTERMD);
+	void    Addv_8b(REGISTERMD, REGISTERMD);
 	void    And(REGISTER32, REGISTER32, REGISTER32);
 	void    And(REGISTER64, REGISTER64, REGISTER64);
 	void    And(REGISTER32, REGISTER32, uint8, uint8, uint8);
@@ -112,32 +114,73 @@ public:
 	void    Cmp(REGISTER64, REGISTER64);
 	void    Cmp(REGISTER32, uint16, ADDSUB_IMM_SHIFT_TYPE);
 	void    Cmp(REGISTER64, uint16, ADDSUB_IMM_SHIFT_TYPE);
+	void    Cnt_8b(REGISTERMD, REGISTERMD);
 	void    Cset(REGISTER32, CONDITION);
 	void    Dup_4s(REGISTERMD, REGISTER32);
+	void    Dup_4s(REGISTERMD, REGISTERMD, uint8);
 	void    Eor(REGISTER32, REGISTER32, REGISTER32);
+	void    Eor(REGISTER64, REGISTER64, REGISTER64);
 	void    Eor(REGISTER32, REGISTER32, uint8, uint8, uint8);
 	void    Eor_16b(REGISTERMD, REGISTERMD, REGISTERMD);
+	void    Ext_16b(REGISTERMD, REGISTERMD, REGISTERMD, uint8);
 	void    Fabs_1s(REGISTERMD, REGISTERMD);
+	void    Fabs_1d(REGISTERMD, REGISTERMD);
 	void    Fabs_4s(REGISTERMD, REGISTERMD);
 	void    Fadd_1s(REGISTERMD, REGISTERMD, REGISTERMD);
+	void    Fadd_1d(REGISTERMD, REGISTERMD, REGISTERMD);
 	void    Fadd_4s(REGISTERMD, REGISTERMD, REGISTERMD);
 	void    Fcmeq_4s(REGISTERMD, REGISTERMD);
 	void    Fcmlt_4s(REGISTERMD, REGISTERMD);
 	void    Fcmp_1s(REGISTERMD, REGISTERMD);
+	void    Fcmp_1d(REGISTERMD, REGISTERMD);
+	void    Fcvt_1d_1s(REGISTERMD, REGISTERMD);
+	void    Fcvt_1s_1d(REGISTERMD, REGISTERMD);
+	void    Fcvtms_1s(REGISTERMD, REGISTERMD);
+	void    Fcvtms_4s(REGISTERMD, REGISTERMD);
+	void    Fcvtns_1s(REGISTERMD, REGISTERMD);
+	void    Fcvtns_4s(REGISTERMD, REGISTERMD);
+	void    Fcvtps_1s(REGISTERMD, REGISTERMD);
+	void    Fcvtps_4s(REGISTERMD, REGISTERMD);
 	void    Fcvtzs_1s(REGISTERMD, REGISTERMD);
+	void    Fcvtzs_1s(REGISTER64, REGISTERMD);
+	void    Fcvtzs_1d(REGISTER32, REGISTERMD);
+	void    Fcvtzs_1d(REGISTER64, REGISTERMD);
 	void    Fcvtzs_4s(REGISTERMD, REGISTERMD);
 	void    Fdiv_1s(REGISTERMD, REGISTERMD, REGISTERMD);
+	void    Fdiv_1d(REGISTERMD, REGISTERMD, REGISTERMD);
 	void    Fdiv_4s(REGISTERMD, REGISTERMD, REGISTERMD);
 	void    Fmov_1s(REGISTERMD, uint8);
+	void    Fmov_1s(REGISTERMD, REGISTER32);
+	void    Fmov_1d(REGISTERMD, uint8);
+	void    Fmadd_1s(REGISTERMD, REGISTERMD, REGISTERMD, REGISTERMD);
+	void    Fmadd_1d(REGISTERMD, REGISTERMD, REGISTERMD, REGISTERMD);
+	void    Fmla_4s(REGISTERMD, REGISTERMD, REGISTERMD);
+	void    Fmls_4s(REGISTERMD, REGISTERMD, REGISTERMD);
+	void    Fmsub_1s(REGISTERMD, REGISTERMD, REGISTERMD, REGISTERMD);
+	void    Fmsub_1d(REGISTERMD, REGISTERMD, REGISTERMD, REGISTERMD);
 	void    Fmul_1s(REGISTERMD, REGISTERMD, REGISTERMD);
+	void    Fmul_1d(REGISTERMD, REGISTERMD, REGISTERMD);
 	void    Fmul_4s(REGISTERMD, REGISTERMD, REGISTERMD);
 	void    Fmax_1s(REGISTERMD, REGISTERMD, REGISTERMD);
+	void    Fmax_1d(REGISTERMD, REGISTERMD, REGISTERMD);
 	void    Fmax_4s(REGISTERMD, REGISTERMD, REGISTERMD);
 	void    Fneg_1s(REGISTERMD, REGISTERMD);
+	void    Fneg_1d(REGISTERMD, REGISTERMD);
 	void    Fmin_1s(REGISTERMD, REGISTERMD, REGISTERMD);
+	void    Fmin_1d(REGISTERMD, REGISTERMD, REGISTERMD);
 	void    Fmin_4s(REGISTERMD, REGISTERMD, REGISTERMD);
+	void    Frintm_1s(REGISTERMD, REGISTERMD);
+	void    Frintm_4s(REGISTERMD, REGISTERMD);
+	void    Frintn_1s(REGISTERMD, REGISTERMD);
+	void    Frintn_4s(REGISTERMD, REGISTERMD);
+	void    Frintp_1s(REGISTERMD, REGISTERMD);
+	void    Frintp_4s(REGISTERMD, REGISTERMD);
+	void    Frintz_1s(REGISTERMD, REGISTERMD);
+	void    Frintz_4s(REGISTERMD, REGISTERMD);
 	void    Fsqrt_1s(REGISTERMD, REGISTERMD);
+	void    Fsqrt_1d(REGISTERMD, REGISTERMD);
 	void    Fsub_1s(REGISTERMD, REGISTERMD, REGISTERMD);
+	void    Fsub_1d(REGISTERMD, REGISTERMD, REGISTERMD);
 	void    Fsub_4s(REGISTERMD, REGISTERMD, REGISTERMD);
 	void    Ins_1s(REGISTERMD, uint8, REGISTERMD, uint8);
 	void    Ins_1d(REGISTERMD, uint8, REGISTER64);
@@ -145,8 +188,15 @@ public:
 	void    Ldp_PostIdx(REGISTER64, REGISTER64, REGISTER64, int32);
 	void    Ldr(REGISTER32, REGISTER64, uint32);
 	void    Ldr(REGISTER64, REGISTER64, uint32);
+	void    Ldr(REGISTER32, REGISTER64, REGISTER64, bool);
+	void    Ldr(REGISTER64, REGISTER64, REGISTER64, bool);
 	void    Ldr_1s(REGISTERMD, REGISTER64, uint32);
+	void    Ldr_1d(REGISTERMD, REGISTER64, uint32);
 	void    Ldr_1q(REGISTERMD, REGISTER64, uint32);
+	void    Ldrb(REGISTER32, REGISTER64, uint32);
+	void    Ldrh(REGISTER32, REGISTER64, uint32);
+	void    Ldrsb(REGISTER32, REGISTER64, uint32);
+	void    Ldrsh(REGISTER32, REGISTER64, uint32);
 	void    Lsl(REGISTER32, REGISTER32, uint8);
 	void    Lsl(REGISTER64, REGISTER64, uint8);
 	void    Lslv(REGISTER32, REGISTER32, REGISTER32);
@@ -165,15 +215,29 @@ public:
 	void    Movz(REGISTER32, uint16, uint8);
 	void    Movz(REGISTER64, uint16, uint8);
 	void    Msub(REGISTER32, REGISTER32, REGISTER32, REGISTER32);
+	void    Mul(REGISTER64, REGISTER64, REGISTER64);
+	void    Mul_4s(REGISTERMD, REGISTERMD, REGISTERMD);
+	void    Mul_8h(REGISTERMD, REGISTERMD, REGISTERMD);
 	void    Mvn(REGISTER32, REGISTER32);
+	void    Mvn(REGISTER64, REGISTER64);
 	void    Orn_16b(REGISTERMD, REGISTERMD, REGISTERMD);
 	void    Orr(REGISTER32, REGISTER32, REGISTER32);
+	void    Orr(REGISTER64, REGISTER64, REGISTER64);
 	void    Orr(REGISTER32, REGISTER32, uint8, uint8, uint8);
 	void    Orr_16b(REGISTERMD, REGISTERMD, REGISTERMD);
+	void    Rbit(REGISTER32, REGISTER32);
 	void    Ret(REGISTER64 = x30);
+	void    Rev(REGISTER32, REGISTER32);
+	void    Ror(REGISTER32, REGISTER32, uint8);
+	void    Ror(REGISTER64, REGISTER64, uint8);
+	void    Rorv(REGISTER32, REGISTER32, REGISTER32);
+	void    Rorv(REGISTER64, REGISTER64, REGISTER64);
 	void    Scvtf_1s(REGISTERMD, REGISTERMD);
+	void    Scvtf_1d(REGISTERMD, REGISTER32);
+	void    Scvtf_1d(REGISTERMD, REGISTER64);
 	void    Scvtf_4s(REGISTERMD, REGISTERMD);
 	void    Sdiv(REGISTER32, REGISTER32, REGISTER32);
+	void    Sdiv(REGISTER64, REGISTER64, REGISTER64);
 	void    Shl_4s(REGISTERMD, REGISTERMD, uint8);
 	void    Shl_8h(REGISTERMD, REGISTERMD, uint8);
 	void    Smax_4s(REGISTERMD, REGISTERMD, REGISTERMD);
@@ -181,6 +245,8 @@ public:
 	void    Smin_4s(REGISTERMD, REGISTERMD, REGISTERMD);
 	void    Smin_8h(REGISTERMD, REGISTERMD, REGISTERMD);
 	void    Smull(REGISTER64, REGISTER32, REGISTER32);
+	void    Smull_4s(REGISTERMD, REGISTERMD, REGISTERMD);
+	void    Smull2_4s(REGISTERMD, REGISTERMD, REGISTERMD);
 	void    Sshr_4s(REGISTERMD, REGISTERMD, uint8);
 	void    Sshr_8h(REGISTERMD, REGISTERMD, uint8);
 	void    Sqadd_4s(REGISTERMD, REGISTERMD, REGISTERMD);
@@ -193,7 +259,10 @@ public:
 	void    Str(REGISTER32, REGISTER64, uint32);
 	void    Str(REGISTER64, REGISTER64, uint32);
 	void    Str_1s(REGISTERMD, REGISTER64, uint32);
+	void    Str_1d(REGISTERMD, REGISTER64, uint32);
 	void    Str_1q(REGISTERMD, REGISTER64, uint32);
+	void    Strb(REGISTER32, REGISTER64, uint32);
+	void    Strh(REGISTER32, REGISTER64, uint32);
 	void    Sub(REGISTER32, REGISTER32, REGISTER32);
 	void    Sub(REGISTER64, REGISTER64, REGISTER64);
 	void    Sub(REGISTER32, REGISTER32, uint16, ADDSUB_IMM_SHIFT_TYPE);
@@ -201,10 +270,15 @@ public:
 	void    Sub_4s(REGISTERMD, REGISTERMD, REGISTERMD);
 	void    Sub_8h(REGISTERMD, REGISTERMD, REGISTERMD);
 	void    Sub_16b(REGISTERMD, REGISTERMD, REGISTERMD);
+	void    Sxtb(REGISTER32, REGISTER32);
+	void    Sxth(REGISTER32, REGISTER32);
+	void    Sxtw(REGISTER64, REGISTER32);
 	void    Tst(REGISTER32, REGISTER32);
 	void    Udiv(REGISTER32, REGISTER32, REGISTER32);
+	void    Udiv(REGISTER64, REGISTER64, REGISTER64);
 	void    Umov_1s(REGISTER32, REGISTERMD, uint8);
 	void    Umull(REGISTER64, REGISTER32, REGISTER32);
+	void    Umull_2d(REGISTERMD, REGISTERMD, REGISTERMD);
 	void    Uqadd_4s(REGISTERMD, REGISTERMD, REGISTERMD);
 	void    Uqadd_8h(REGISTERMD, REGISTERMD, REGISTERMD);
 	void    Uqadd_16b(REGISTERMD, REGISTERMD, REGISTERMD);
@@ -212,6 +286,10 @@ public:
 	void    Uqsub_16b(REGISTERMD, REGISTERMD, REGISTERMD);
 	void    Ushr_4s(REGISTERMD, REGISTERMD, uint8);
 	void    Ushr_8h(REGISTERMD, REGISTERMD, uint8);
+	void    Uxtb(REGISTER32, REGISTER32);
+	void    Uxth(REGISTER32, REGISTER32);
+	void    Uzp2_8h(REGISTERMD, REGISTERMD, REGISTERMD);
+	void    Xtn1_2s(REGISTERMD, REGISTERMD);
 	void    Xtn1_4h(REGISTERMD, REGISTERMD);
 	void    Xtn1_8b(REGISTERMD, REGISTERMD);
 	void    Xtn2_8h(REGISTERMD, REGISTERMD);
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "Jitter.h"
+#include "ObjectFile.h"
+#include <atomic>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace Jitter
+{
+	//Compiles a batch of functions on multiple threads and adds them to an object file.
+	//Every worker thread owns its CJitter/CCodeGen. Symbols are added in the order functions
+	//were registered, so the object file contents don't depend on the thread count.
+	class CAotCompiler
+	{
+	public:
+		//Emits the body of a function (between Begin and End). Called from worker threads.
+		typedef std::function<void (CJitter&)> FunctionEmitter;
+		//Should configure code generators for object file output (ie.: relocatable calls on AArch64).
+		typedef std::function<CCodeGen* ()> CodeGenFactory;
+
+								CAotCompiler(CObjectFile&, const CodeGenFactory&);
+		virtual					~CAotCompiler() = default;
+
+		void					AddFunction(const std::string&, const FunctionEmitter&);
+		size_t					GetFunctionCount() const;
+
+		//A thread count of 0 uses all hardware threads. External symbols must be registered
+		//in the object file before compiling.
+		void					Compile(unsigned int = 0);
+
+	private:
+		struct FUNCTION
+		{
+			std::string			name;
+			FunctionEmitter		emitter;
+		};
+		typedef std::vector<FUNCTION> FunctionArray;
+		typedef std::vector<CObjectFile::INTERNAL_SYMBOL> InternalSymbolArray;
+
+		void					CompileFunctions(InternalSymbolArray&, std::atomic<size_t>&) const;
+		CObjectFile::INTERNAL_SYMBOL	CompileFunction(CJitter&, const FUNCTION&) const;
+
+		CObjectFile&			m_objectFile;
+		CodeGenFactory			m_codeGenFactory;
+		FunctionArray			m_functions;
+	};
+}
@@ -0,0 +1,114 @@
+#pragma once
+
+#include "Types.h"
+#include <string>
+#include <vector>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <cstdio>
+
+namespace Jitter
+{
+	//Persistent cache of generated code, keyed by a hash of the IR given to CJitter and of the code generator configuration.
+	//Entries loaded from the cache file are memory mapped, new entries are appended to the file.
+	//References to external symbols registered with RegisterExternalSymbol are stored by name and patched on load,
+	//other addresses found in the IR are part of the key.
+	//Entries are not invalidated when the code generator changes, use a different configuration string or cache file then.
+	class CCodeCache
+	{
+	public:
+		struct KEY
+		{
+			uint64		hash0 = 0;
+			uint64		hash1 = 0;
+
+			bool operator ==(const KEY& rhs) const
+			{
+				return (hash0 == rhs.hash0) && (hash1 == rhs.hash1);
+			}
+		};
+
+		struct FIXUP
+		{
+			uint32		offset = 0;
+			std::string	symbolName;
+		};
+		typedef std::vector<FIXUP> FixupArray;
+
+		struct ENTRY
+		{
+			const uint8*	code = nullptr;
+			uint32			codeSize = 0;
+			FixupArray		fixups;
+		};
+
+		struct STATS
+		{
+			uint64		hitCount = 0;
+			uint64		missCount = 0;
+			uint64		storeCount = 0;
+			//Compiled functions that couldn't be stored (ie.: unpatchable external references)
+			uint64		uncacheableCount = 0;
+			uint64		totalLoadTimeNs = 0;
+		};
+
+		enum
+		{
+			CACHE_FILE_MAGIC = 0x3143434A,		//'JCC1'
+			CACHE_FILE_VERSION = 12,
+		};
+
+						CCodeCache(const std::string&, const std::string& = std::string());
+		virtual			~CCodeCache();
+
+		void			RegisterExternalSymbol(const std::string&, uintptr_t);
+		const std::string*	GetExternalSymbolName(uintptr_t) const;
+		uintptr_t		GetExternalSymbolValue(const std::string&) const;
+
+		const std::string&	GetConfiguration() const;
+		size_t			GetEntryCount() const;
+
+		//Returned entry stays valid for the cache's lifetime
+		bool			Find(const KEY&, ENTRY&) const;
+		void			Store(const KEY&, const uint8*, uint32, const FixupArray&);
+
+		//Hits are only counted once an entry is successfully loaded, entries that can't be patched count as misses
+		void			AddHit(uint64);
+		void			AddMiss();
+		void			AddUncacheable();
+		STATS			GetStats() const;
+
+	private:
+		struct KeyHasher
+		{
+			size_t operator()(const KEY& key) const
+			{
+				return static_cast<size_t>(key.hash0 ^ (key.hash1 * 31));
+			}
+		};
+		typedef std::unordered_map<KEY, ENTRY, KeyHasher> EntryMap;
+		typedef std::unordered_map<uintptr_t, std::string> SymbolNameMap;
+		typedef std::unordered_map<std::string, uintptr_t> SymbolValueMap;
+		typedef std::list<std::vector<uint8>> CodeBufferList;
+
+		void			OpenFile();
+		size_t			ParseEntries(const uint8*, size_t);
+		void			CloseFile();
+
+		std::string		m_path;
+		std::string		m_configuration;
+
+		mutable std::mutex	m_mutex;
+		EntryMap		m_entries;
+		CodeBufferList	m_storedCode;
+		SymbolNameMap	m_symbolNames;
+		SymbolValueMap	m_symbolValues;
+		STATS			m_stats;
+
+		FILE*			m_file = nullptr;
+		void*			m_mapping = nullptr;
+		size_t			m_mappingSize = 0;
+		std::vector<uint8>	m_fileContents;
+	};
+}
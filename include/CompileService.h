@@ -0,0 +1,118 @@
+#pragma once
+
+#include "Jitter.h"
+#include "MemoryFunction.h"
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace Jitter
+{
+	//Compiles functions in the background on a pool of worker threads, each owning its CJitter/CCodeGen.
+	//Jobs are spread over per-worker queues, workers take the highest priority job of all queues.
+	//Finished functions are published on a lock-free queue polled with GetCompletedJob.
+	class CCompileService
+	{
+	public:
+		typedef uint64 JOB_ID;
+		//Emits the body of a function (between Begin and End). Called from worker threads.
+		typedef std::function<void (CJitter&)> FunctionEmitter;
+		typedef std::function<CCodeGen* ()> CodeGenFactory;
+		typedef std::vector<uint8> IrData;
+
+		enum : JOB_ID
+		{
+			INVALID_JOB_ID = 0,
+		};
+
+		struct COMPLETED_JOB
+		{
+			JOB_ID					id = INVALID_JOB_ID;
+			CMemoryFunction			function;
+			//Set if compilation failed, function is empty in that case
+			std::exception_ptr		exception;
+		};
+
+								CCompileService(const CodeGenFactory&, unsigned int = 0);
+		virtual					~CCompileService();
+
+		unsigned int			GetThreadCount() const;
+
+		//Jobs with a higher priority are compiled first, jobs of equal priority in submission order.
+		JOB_ID					Submit(const FunctionEmitter&, int = 0);
+		//Compiles a function captured with CJitter::SetIrCaptureStream.
+		JOB_ID					SubmitIr(IrData, int = 0);
+
+		//Returns true if the job will not be published. Jobs already being compiled
+		//are cancelled too, their result is dropped when done.
+		bool					Cancel(JOB_ID);
+
+		//Must not be called by more than one thread at a time.
+		bool					GetCompletedJob(COMPLETED_JOB&);
+
+		//Blocks until all submitted jobs are compiled or cancelled.
+		void					WaitIdle();
+
+	private:
+		struct JOB
+		{
+			JOB_ID				id = INVALID_JOB_ID;
+			int					priority = 0;
+			FunctionEmitter		emitter;
+			IrData				irData;
+			std::atomic<bool>	cancelled = { false };
+		};
+		typedef std::shared_ptr<JOB> JobPtr;
+		typedef std::vector<JobPtr> JobHeap;
+
+		struct WORKER_QUEUE
+		{
+			std::mutex			mutex;
+			JobHeap				jobs;
+		};
+		typedef std::unique_ptr<WORKER_QUEUE> WorkerQueuePtr;
+
+		struct COMPLETION_NODE
+		{
+			COMPLETED_JOB		job;
+			COMPLETION_NODE*	next = nullptr;
+		};
+
+		JOB_ID					EnqueueJob(const JobPtr&);
+		JobPtr					TakeJob(unsigned int);
+		static JobPtr			PeekJob(WORKER_QUEUE&);
+		static bool				PopJob(WORKER_QUEUE&, const JobPtr&);
+
+		void					WorkerProc(unsigned int);
+		void					RunJob(std::unique_ptr<CJitter>&, const JobPtr&);
+		void					FinishJob();
+		void					PublishCompletion(COMPLETION_NODE*);
+
+		CodeGenFactory			m_codeGenFactory;
+
+		std::vector<std::thread>	m_threads;
+		std::vector<WorkerQueuePtr>	m_queues;
+		std::atomic<unsigned int>	m_nextQueueIndex = { 0 };
+
+		std::mutex				m_workMutex;
+		std::condition_variable	m_workCondition;
+		std::condition_variable	m_idleCondition;
+		int						m_queuedJobCount = 0;
+		int						m_pendingJobCount = 0;
+		bool					m_terminating = false;
+
+		std::mutex				m_activeJobsMutex;
+		std::unordered_map<JOB_ID, JobPtr>	m_activeJobs;
+		JOB_ID					m_nextJobId = 1;
+
+		//Producers push on this stack, the consumer grabs everything and reverses it into m_completedJobs
+		std::atomic<COMPLETION_NODE*>	m_completedHead = { nullptr };
+		COMPLETION_NODE*		m_completedJobs = nullptr;
+	};
+}
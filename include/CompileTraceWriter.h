@@ -0,0 +1,38 @@
+#pragma once
+
+#include "Types.h"
+#include "Stream.h"
+#include <chrono>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace Jitter
+{
+	//Writes compile events in Chrome's trace event format, to be loaded in chrome://tracing or Perfetto.
+	//Can be shared by jitters compiling on different threads. The event array is closed on destruction.
+	class CCompileTraceWriter
+	{
+	public:
+		typedef std::chrono::steady_clock::time_point TimePoint;
+		typedef std::vector<std::pair<const char*, uint64>> ArgumentArray;
+
+								CCompileTraceWriter(Framework::CStream&);
+								CCompileTraceWriter(const CCompileTraceWriter&) = delete;
+		virtual					~CCompileTraceWriter();
+
+		CCompileTraceWriter&	operator =(const CCompileTraceWriter&) = delete;
+
+		//Writes a complete event, names must be valid JSON strings.
+		void					WriteEvent(const char*, TimePoint, TimePoint, const ArgumentArray& = ArgumentArray());
+
+	private:
+		double					GetTimestamp(TimePoint) const;
+		static uint32			GetThreadId();
+
+		std::mutex				m_streamMutex;
+		Framework::CStream&		m_stream;
+		TimePoint				m_startTime;
+		bool					m_firstEvent = true;
+	};
+}
@@ -0,0 +1,227 @@
+#pragma once
+
+#include "Types.h"
+
+namespace Elf
+{
+	enum
+	{
+		EI_NIDENT = 16,
+	};
+
+	enum IDENT_CLASS
+	{
+		ELFCLASS32 = 1,
+		ELFCLASS64 = 2,
+	};
+
+	enum IDENT_DATA
+	{
+		ELFDATA2LSB = 1,
+	};
+
+	enum
+	{
+		EV_CURRENT = 1,
+	};
+
+	enum FILE_TYPE
+	{
+		ET_REL = 1,
+	};
+
+	enum MACHINE
+	{
+		EM_386     = 3,
+		EM_ARM     = 40,
+		EM_X86_64  = 62,
+		EM_AARCH64 = 183,
+	};
+
+	enum SECTION_TYPE
+	{
+		SHT_NULL     = 0,
+		SHT_PROGBITS = 1,
+		SHT_SYMTAB   = 2,
+		SHT_STRTAB   = 3,
+		SHT_RELA     = 4,
+		SHT_NOBITS   = 8,
+		SHT_REL      = 9,
+	};
+
+	enum SECTION_FLAGS
+	{
+		SHF_WRITE     = 0x01,
+		SHF_ALLOC     = 0x02,
+		SHF_EXECINSTR = 0x04,
+		SHF_INFO_LINK = 0x40,
+	};
+
+	enum
+	{
+		SHN_UNDEF = 0,
+		SHN_LORESERVE = 0xFF00,
+	};
+
+	enum
+	{
+		EF_ARM_EABI_VER5 = 0x05000000,
+	};
+
+	enum RELOCATION_TYPE_386
+	{
+		R_386_32 = 1,
+	};
+
+	enum RELOCATION_TYPE_ARM
+	{
+		R_ARM_ABS32       = 2,
+		R_ARM_MOVW_ABS_NC = 43,
+		R_ARM_MOVT_ABS    = 44,
+	};
+
+	enum RELOCATION_TYPE_X86_64
+	{
+		R_X86_64_64 = 1,
+	};
+
+	enum RELOCATION_TYPE_AARCH64
+	{
+		R_AARCH64_ABS64  = 257,
+		R_AARCH64_CALL26 = 283,
+	};
+
+	enum SYMBOL_BINDING
+	{
+		STB_LOCAL  = 0,
+		STB_GLOBAL = 1,
+	};
+
+	enum SYMBOL_TYPE
+	{
+		STT_NOTYPE  = 0,
+		STT_OBJECT  = 1,
+		STT_FUNC    = 2,
+		STT_SECTION = 3,
+	};
+
+	struct ELF_HEADER_32
+	{
+		uint8     ident[EI_NIDENT];
+		uint16    type;
+		uint16    machine;
+		uint32    version;
+		uint32    entry;
+		uint32    programHeaderOffset;
+		uint32    sectionHeaderOffset;
+		uint32    flags;
+		uint16    headerSize;
+		uint16    programHeaderEntrySize;
+		uint16    programHeaderCount;
+		uint16    sectionHeaderEntrySize;
+		uint16    sectionHeaderCount;
+		uint16    sectionHeaderStringTableIndex;
+	};
+	static_assert(sizeof(ELF_HEADER_32) == 0x34, "Size of ELF_HEADER_32 structure must be 52 bytes.");
+
+	struct ELF_HEADER_64
+	{
+		uint8     ident[EI_NIDENT];
+		uint16    type;
+		uint16    machine;
+		uint32    version;
+		uint64    entry;
+		uint64    programHeaderOffset;
+		uint64    sectionHeaderOffset;
+		uint32    flags;
+		uint16    headerSize;
+		uint16    programHeaderEntrySize;
+		uint16    programHeaderCount;
+		uint16    sectionHeaderEntrySize;
+		uint16    sectionHeaderCount;
+		uint16    sectionHeaderStringTableIndex;
+	};
+	static_assert(sizeof(ELF_HEADER_64) == 0x40, "Size of ELF_HEADER_64 structure must be 64 bytes.");
+
+	struct SECTION_HEADER_32
+	{
+		uint32    name;
+		uint32    type;
+		uint32    flags;
+		uint32    address;
+		uint32    offset;
+		uint32    size;
+		uint32    link;
+		uint32    info;
+		uint32    addressAlign;
+		uint32    entrySize;
+	};
+	static_assert(sizeof(SECTION_HEADER_32) == 0x28, "Size of SECTION_HEADER_32 structure must be 40 bytes.");
+
+	struct SECTION_HEADER_64
+	{
+		uint32    name;
+		uint32    type;
+		uint64    flags;
+		uint64    address;
+		uint64    offset;
+		uint64    size;
+		uint32    link;
+		uint32    info;
+		uint64    addressAlign;
+		uint64    entrySize;
+	};
+	static_assert(sizeof(SECTION_HEADER_64) == 0x40, "Size of SECTION_HEADER_64 structure must be 64 bytes.");
+
+	struct SYMBOL_32
+	{
+		uint32    name;
+		uint32    value;
+		uint32    size;
+		uint8     info;
+		uint8     other;
+		uint16    sectionIndex;
+	};
+	static_assert(sizeof(SYMBOL_32) == 0x10, "Size of SYMBOL_32 structure must be 16 bytes.");
+
+	struct SYMBOL_64
+	{
+		uint32    name;
+		uint8     info;
+		uint8     other;
+		uint16    sectionIndex;
+		uint64    value;
+		uint64    size;
+	};
+	static_assert(sizeof(SYMBOL_64) == 0x18, "Size of SYMBOL_64 structure must be 24 bytes.");
+
+	struct REL_32
+	{
+		uint32    offset;
+		uint32    info;
+	};
+	static_assert(sizeof(REL_32) == 0x08, "Size of REL_32 structure must be 8 bytes.");
+
+	struct RELA_64
+	{
+		uint64    offset;
+		uint64    info;
+		int64     addend;
+	};
+	static_assert(sizeof(RELA_64) == 0x18, "Size of RELA_64 structure must be 24 bytes.");
+
+	inline uint8 MakeSymbolInfo(SYMBOL_BINDING binding, SYMBOL_TYPE type)
+	{
+		return static_cast<uint8>((binding << 4) | type);
+	}
+
+	inline uint32 MakeRelocationInfo32(uint32 symbolIndex, uint32 type)
+	{
+		return (symbolIndex << 8) | (type & 0xFF);
+	}
+
+	inline uint64 MakeRelocationInfo64(uint32 symbolIndex, uint32 type)
+	{
+		return (static_cast<uint64>(symbolIndex) << 32) | type;
+	}
+}
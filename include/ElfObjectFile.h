@@ -0,0 +1,130 @@
+#pragma once
+
+#include "ObjectFile.h"
+#include "ElfDefs.h"
+
+namespace Jitter
+{
+	struct ELF_TRAITS_32
+	{
+		typedef Elf::ELF_HEADER_32        ELF_HEADER;
+		typedef Elf::SECTION_HEADER_32    SECTION_HEADER;
+		typedef Elf::SYMBOL_32            SYMBOL;
+		typedef Elf::REL_32               RELOCATION;
+
+		static const uint8 ELF_CLASS                = Elf::ELFCLASS32;
+		static const uint32 RELOCATION_SECTION_TYPE = Elf::SHT_REL;
+		static const uint32 POINTER_SIZE            = 4;
+
+		static RELOCATION MakeRelocation(uint32 offset, uint32 symbolIndex, uint32 type)
+		{
+			RELOCATION relocation = {};
+			relocation.offset = offset;
+			relocation.info   = Elf::MakeRelocationInfo32(symbolIndex, type);
+			return relocation;
+		}
+	};
+
+	struct ELF_TRAITS_64
+	{
+		typedef Elf::ELF_HEADER_64        ELF_HEADER;
+		typedef Elf::SECTION_HEADER_64    SECTION_HEADER;
+		typedef Elf::SYMBOL_64            SYMBOL;
+		typedef Elf::RELA_64              RELOCATION;
+
+		static const uint8 ELF_CLASS                = Elf::ELFCLASS64;
+		static const uint32 RELOCATION_SECTION_TYPE = Elf::SHT_RELA;
+		static const uint32 POINTER_SIZE            = 8;
+
+		static RELOCATION MakeRelocation(uint32 offset, uint32 symbolIndex, uint32 type)
+		{
+			RELOCATION relocation = {};
+			relocation.offset = offset;
+			relocation.info   = Elf::MakeRelocationInfo64(symbolIndex, type);
+			relocation.addend = 0;
+			return relocation;
+		}
+	};
+
+	template <typename ElfTraits>
+	class CElfObjectFile : public CObjectFile
+	{
+	public:
+						CElfObjectFile(CPU_ARCH);
+		virtual			~CElfObjectFile();
+
+		virtual void	Write(Framework::CStream&) override;
+
+	private:
+		typedef std::vector<char> StringTable;
+		typedef std::vector<uint8> SectionData;
+		typedef std::vector<typename ElfTraits::SECTION_HEADER> SectionHeaderArray;
+		typedef std::vector<typename ElfTraits::SYMBOL> SymbolArray;
+		typedef std::vector<typename ElfTraits::RELOCATION> RelocationArray;
+
+		enum SECTION_INDEX
+		{
+			SECTION_INDEX_NULL,
+			SECTION_INDEX_TEXT,
+			SECTION_INDEX_DATA,
+			SECTION_INDEX_NOTE_GNU_STACK,
+			SECTION_INDEX_REL_TEXT,
+			SECTION_INDEX_REL_DATA,
+			SECTION_INDEX_SYMTAB,
+			SECTION_INDEX_STRTAB,
+			SECTION_INDEX_SHSTRTAB,
+			SECTION_COUNT
+		};
+
+		enum
+		{
+			TEXT_SECTION_ALIGNMENT = 0x10,
+		};
+
+		struct INTERNAL_SYMBOL_INFO
+		{
+			INTERNAL_SYMBOL_INFO()
+			{
+				nameOffset = 0;
+				dataOffset = 0;
+				symbolIndex = 0;
+			}
+
+			uint32					nameOffset;
+			uint32					dataOffset;
+			uint32					symbolIndex;
+		};
+		typedef std::vector<INTERNAL_SYMBOL_INFO> InternalSymbolInfoArray;
+
+		struct EXTERNAL_SYMBOL_INFO
+		{
+			EXTERNAL_SYMBOL_INFO()
+			{
+				nameOffset = 0;
+				symbolIndex = 0;
+			}
+
+			uint32		nameOffset;
+			uint32		symbolIndex;
+		};
+		typedef std::vector<EXTERNAL_SYMBOL_INFO> ExternalSymbolInfoArray;
+
+		struct SECTION
+		{
+			SectionData				data;
+			SymbolReferenceArray	symbolReferences;
+		};
+
+		static uint32			AddString(StringTable&, const std::string&);
+		static void				FillStringTable(StringTable&, const InternalSymbolArray&, InternalSymbolInfoArray&);
+		static void				FillStringTable(StringTable&, const ExternalSymbolArray&, ExternalSymbolInfoArray&);
+		static SECTION			BuildSection(const InternalSymbolArray&, InternalSymbolInfoArray&, const InternalSymbolAliasArray&, INTERNAL_SYMBOL_LOCATION, uint32);
+		static SymbolArray		BuildSymbols(const InternalSymbolArray&, InternalSymbolInfoArray&, const ExternalSymbolArray&, ExternalSymbolInfoArray&);
+		RelocationArray			BuildRelocations(SECTION&, const InternalSymbolInfoArray&, const ExternalSymbolInfoArray&) const;
+		uint16					GetMachine() const;
+		uint32					GetFlags() const;
+	};
+
+	typedef CElfObjectFile<ELF_TRAITS_32> CElfObjectFile32;
+	typedef CElfObjectFile<ELF_TRAITS_64> CElfObjectFile64;
+}
@@ -0,0 +1,104 @@
+#pragma once
+
+#include "Types.h"
+#include <string>
+#include <vector>
+#include <list>
+#include <unordered_map>
+#include <memory>
+#include <mutex>
+#include <atomic>
+
+//Interface defined by GDB, see "JIT Compilation Interface" in GDB's manual
+extern "C"
+{
+	enum JIT_ACTIONS
+	{
+		JIT_NOACTION = 0,
+		JIT_REGISTER_FN,
+		JIT_UNREGISTER_FN,
+	};
+
+	struct jit_code_entry
+	{
+		jit_code_entry*		next_entry;
+		jit_code_entry*		prev_entry;
+		const char*			symfile_addr;
+		uint64				symfile_size;
+	};
+
+	struct jit_descriptor
+	{
+		uint32				version;
+		uint32				action_flag;
+		jit_code_entry*		relevant_entry;
+		jit_code_entry*		first_entry;
+	};
+}
+
+//Makes generated code visible to GDB by registering in-memory ELF files containing its symbols.
+//Functions can be batched in a single symbol file to lower the cost of registration.
+//Freeing a function rebuilds its batch's symbol file without it, so that stale symbols never cover reused addresses.
+//Symbol files only contain function symbols, no line tables: generated code has no source lines to map to.
+//GDB looks up the __jit_debug_descriptor and __jit_debug_register_code symbols by name, only
+//one definition must exist in the process: the host passes its own to SetInterface, or defines
+//CODEGEN_DEFINE_GDB_JIT_INTERFACE when building CodeGen to have them defined here.
+class CGdbJitRegistrar
+{
+public:
+	typedef void (*RegisterCodeFunction)();
+
+	enum
+	{
+		//Each function gets its own section in the symbol file, section indices must stay below SHN_LORESERVE
+		MAX_BATCH_SIZE = 0xFE00,
+	};
+
+	static CGdbJitRegistrar&	GetInstance();
+
+	void						SetInterface(jit_descriptor*, RegisterCodeFunction);
+
+	void						SetEnabled(bool);
+	bool						IsEnabled() const;
+
+	void						SetBatchSize(unsigned int);
+
+	void						RegisterCode(const void*, size_t, const std::string&);
+	void						UnregisterCode(const void*);
+	void						Flush();
+
+private:
+	struct FUNCTION
+	{
+		uintptr_t				address = 0;
+		size_t					size = 0;
+		std::string				name;
+	};
+	typedef std::vector<FUNCTION> FunctionArray;
+
+	struct SYMBOL_FILE
+	{
+		jit_code_entry			entry = {};
+		std::vector<uint8>		image;
+		FunctionArray			functions;
+	};
+	typedef std::list<std::unique_ptr<SYMBOL_FILE>> SymbolFileList;
+	typedef std::unordered_map<uintptr_t, SymbolFileList::iterator> FunctionSymbolFileMap;
+
+								CGdbJitRegistrar();
+
+	void						FlushLocked();
+	void						RegisterSymbolFile(FunctionArray);
+	void						UnregisterSymbolFile(SymbolFileList::iterator);
+
+	static std::vector<uint8>	BuildSymbolFile(const FunctionArray&);
+
+	std::mutex					m_mutex;
+	jit_descriptor*				m_descriptor = nullptr;
+	RegisterCodeFunction		m_registerCode = nullptr;
+	std::atomic<bool>			m_enabled = {false};
+	unsigned int				m_batchSize = 1;
+	FunctionArray				m_pendingFunctions;
+	SymbolFileList				m_symbolFiles;
+	FunctionSymbolFileMap		m_functionSymbolFiles;
+};
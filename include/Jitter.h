@@ -1,5 +1,6 @@
 #pragma once
 
+#include <array>
 #include <string>
 #include <memory>
 #include <list>
@@ -11,6 +12,8 @@
 #include "Stream.h"
 #include "Jitter_SymbolTable.h"
 #include "Jitter_CodeGen.h"
+#include "CodeCache.h"
+#include "CompileTraceWriter.h"
 
 #ifndef SIZE_MAX
 #define SIZE_MAX ((size_t)-1)
@@ -24,12 +27,18 @@ namespace Jitter
 	class CJitter
 	{
 	public:
-		enum ROUNDMODE
+		//Rounding modes now live in the Jitter namespace, these keep CJitter::ROUND_* working
+		typedef Jitter::ROUNDMODE ROUNDMODE;
+		static const ROUNDMODE ROUND_NEAREST = Jitter::ROUND_NEAREST;
+		static const ROUNDMODE ROUND_PLUSINFINITY = Jitter::ROUND_PLUSINFINITY;
+		static const ROUNDMODE ROUND_MINUSINFINITY = Jitter::ROUND_MINUSINFINITY;
+		static const ROUNDMODE ROUND_TRUNCATE = Jitter::ROUND_TRUNCATE;
+
+		enum BRANCH_HINT
 		{
-			ROUND_NEAREST = 0,
-			ROUND_PLUSINFINITY = 1,
-			ROUND_MINUSINFINITY = 2,
-			ROUND_TRUNCATE = 3
+			BRANCH_HINT_NONE,
+			BRANCH_HINT_LIKELY,
+			BRANCH_HINT_UNLIKELY,
 		};
 
 		enum RETURN_VALUE_TYPE
@@ -40,8 +49,108 @@ namespace Jitter
 			RETURN_VALUE_128,
 		};
 
+		enum COMPILE_TIER
+		{
+			//Only folds constants and keeps every temporary on the stack, for code that runs a few times
+			COMPILE_TIER_BASELINE,
+			//Runs the passes of the selected pipeline (see SetPassPipeline)
+			COMPILE_TIER_OPTIMIZING,
+		};
+
+		enum OPTIMIZATION_PASS
+		{
+			//Block passes, run on the statements of a single block
+			OPTIMIZATION_PASS_CONSTANT_PROPAGATION,
+			OPTIMIZATION_PASS_CONSTANT_FOLDING,
+			OPTIMIZATION_PASS_COPY_PROPAGATION,
+			OPTIMIZATION_PASS_DEADCODE_ELIMINATION,
+			//Turns a multiply followed by an add or subtract of its result into an unfused multiply-add
+			OPTIMIZATION_PASS_FUSE_MULTIPLY_ADD,
+			//Flow passes, run on the whole function
+			OPTIMIZATION_PASS_PRUNE_BLOCKS,
+			OPTIMIZATION_PASS_MERGE_BLOCKS,
+			//Run once on each block before code generation
+			OPTIMIZATION_PASS_COALESCE_TEMPORARIES,
+			OPTIMIZATION_PASS_ALLOCATE_REGISTERS,
+			OPTIMIZATION_PASS_COUNT,
+		};
+
+		enum OPTIMIZATION_LEVEL
+		{
+			//Single round of block passes, no register allocation. Used by the baseline tier.
+			OPTIMIZATION_LEVEL_NONE,
+			//Bounded rounds of block and flow passes, registers are allocated without coalescing temporaries
+			OPTIMIZATION_LEVEL_FAST,
+			//Runs every pass until nothing changes
+			OPTIMIZATION_LEVEL_FULL,
+		};
+
+		struct PASS_PIPELINE
+		{
+			//Run in order on every block that changed until none of them changes anything.
+			//Must contain constant folding, code generators don't handle operations on constants only.
+			std::vector<OPTIMIZATION_PASS>	blockPasses;
+			//Maximum number of rounds of block passes on a block, 0 for no limit
+			unsigned int				maxBlockIterations = 0;
+			//Run in order once all blocks are optimized, changed blocks go through block passes again
+			std::vector<OPTIMIZATION_PASS>	flowPasses;
+			//Maximum number of rounds of flow passes, 0 for no limit
+			unsigned int				maxFlowIterations = 0;
+			bool						coalesceTemporaries = false;
+			bool						allocateRegisters = false;
+		};
+
+		struct PASS_STATS
+		{
+			uint32						runCount = 0;
+			//In nanoseconds
+			uint64						time = 0;
+			//Negative if the pass added statements (ie.: register spills)
+			int64						statementsRemoved = 0;
+		};
+		typedef std::array<PASS_STATS, OPTIMIZATION_PASS_COUNT> PassStatsArray;
+
+		enum COMPILE_PHASE
+		{
+			//Optimization passes and instrumentation
+			COMPILE_PHASE_OPTIMIZE,
+			COMPILE_PHASE_ALLOCATE_REGISTERS,
+			//Block layout and stack allocation
+			COMPILE_PHASE_LAYOUT,
+			COMPILE_PHASE_GENERATE_CODE,
+			COMPILE_PHASE_COUNT,
+		};
+
+		struct COMPILE_STATS
+		{
+			uint64						functionCount = 0;
+			//Statements given to End and statements given to the code generator
+			uint64						statementsIn = 0;
+			uint64						statementsOut = 0;
+			//Blocks left after optimization
+			uint64						blockCount = 0;
+			//Moves inserted by register allocation
+			uint64						registerLoadCount = 0;
+			uint64						registerSpillCount = 0;
+			uint64						stackSize = 0;
+			uint32						maxStackSize = 0;
+			uint64						codeSize = 0;
+			//In nanoseconds
+			uint64						phaseTimes[COMPILE_PHASE_COUNT] = {};
+		};
+
 		typedef unsigned int LABEL;
 
+		struct PROFILE_COUNTER
+		{
+			uint32						blockId = 0;
+			//Non zero if this counter is for the fall through edge of a conditional jump in blockId
+			uint32						targetBlockId = 0;
+		};
+		typedef std::vector<PROFILE_COUNTER> ProfileCounterArray;
+		typedef std::unordered_map<uint32, uint64> BlockFrequencyMap;
+		typedef std::vector<uint32> BlockIdArray;
+
 										CJitter(CCodeGen*);
 		virtual							~CJitter();
 
@@ -50,7 +159,8 @@ namespace Jitter
 		
 		bool							IsStackEmpty() const;
 
-		void							BeginIf(CONDITION);
+		//Code in the unlikely side of an if is moved at the end of the function
+		void							BeginIf(CONDITION, BRANCH_HINT = BRANCH_HINT_NONE);
 		void							Else();
 		void							EndIf();
 		
@@ -77,6 +187,9 @@ namespace Jitter
 		void							DivS();
 		void							Lookup(uint32*);
 		void							Lzc();
+		void							Ctz();
+		void							PopCount();
+		void							ByteSwap();
 		void							Mult();
 		void							MultS();
 		void							Not();
@@ -84,12 +197,18 @@ namespace Jitter
 		void							SignExt();
 		void							SignExt8();
 		void							SignExt16();
+		void							ZeroExt8();
+		void							ZeroExt16();
 		void							Shl();
 		void							Shl(uint8);
 		void							Sra();
 		void							Sra(uint8);
 		void							Srl();
 		void							Srl(uint8);
+		void							Ror();
+		void							Ror(uint8);
+		void							Rol();
+		void							Rol(uint8);
 		void							Sub();
 		void							Xor();
 
@@ -101,6 +220,20 @@ namespace Jitter
 		void							LoadFromRef();
 		void							StoreAtRef();
 
+		//Sized accesses, loads are zero extended to 32-bits (sign extended for the S variants)
+		//and stores only write the low bits of the value
+		void							Load8FromRef();
+		void							Load8SFromRef();
+		void							Load16FromRef();
+		void							Load16SFromRef();
+		void							Store8AtRef();
+		void							Store16AtRef();
+
+		//Loads a 32-bits value at a guest address using a page table pointed to by a context field.
+		//Null entries in the table are misses and are serviced by calling handler(context, address).
+		//The handler must not modify context values since those might be cached in registers.
+		void							LoadFromTlb(size_t, uint8, void*);
+
 		//64-bits
 		virtual void					PushRel64(size_t);
 		void							PushCst64(uint64);
@@ -110,10 +243,19 @@ namespace Jitter
 		void							MergeTo64();
 		void							ExtLow64();
 		void							ExtHigh64();
+		void							SignExtTo64();
+		void							ZeroExtTo64();
 
 		void							Add64();
 		void							Sub64();
 		void							And64();
+		void							Or64();
+		void							Xor64();
+		void							Not64();
+		void							Mult64();
+		//Div64 and DivS64 only produce the quotient, the result of a division by zero is undefined.
+		void							Div64();
+		void							DivS64();
 		void							Cmp64(CONDITION);
 		void							Srl64();
 		void							Srl64(uint8);
@@ -121,13 +263,34 @@ namespace Jitter
 		void							Sra64(uint8);
 		void							Shl64();
 		void							Shl64(uint8);
+		void							Ror64();
+		void							Ror64(uint8);
+		void							Rol64();
+		void							Rol64(uint8);
+
+		void							Load64FromRef();
+		void							Store64AtRef();
 
 		//FPU
+		//Arithmetic operations produce a result with the same precision as their operands
 		virtual void					FP_PushWord(size_t);
 		virtual void					FP_PushSingle(size_t);
+		virtual void					FP_PushDouble(size_t);
 		virtual void					FP_PullWordTruncate(size_t);
+		//Conversions of single precision values using a rounding mode (nearest rounds half to even).
+		//Out of range values and NaNs give host dependent results, saturating variants clamp these to the
+		//int32 range and give 0 for NaNs.
+		void							FP_PullWord(size_t, ROUNDMODE);
+		void							FP_PullWordSaturate(size_t, ROUNDMODE);
 		virtual void					FP_PullSingle(size_t);
+		virtual void					FP_PullDouble(size_t);
 		virtual void					FP_PushCst(float);
+		virtual void					FP_PushCstDouble(double);
+
+		void							FP_ToSingle();
+		void							FP_ToDouble();
+		void							FP_ToInt64Truncate();
+		void							FP_FromInt64();
 
 		void							FP_Add();
 		void							FP_Abs();
@@ -141,6 +304,15 @@ namespace Jitter
 		void							FP_Rcpl();
 		void							FP_Sqrt();
 		void							FP_Rsqrt();
+		//Single precision only, the result is an integral single precision value
+		void							FP_Round(ROUNDMODE);
+
+		//Pull the multiplier, the multiplicand and the accumulator, push accumulator +/- (multiplicand * multiplier).
+		//Fused variants round once when the host has FMA, otherwise they behave like the unfused ones.
+		void							FP_MulAdd();
+		void							FP_MulSub();
+		void							FP_FusedMulAdd();
+		void							FP_FusedMulSub();
 
 		//SIMD (128-bits only)
 		virtual void					MD_PushRel(size_t);
@@ -153,6 +325,12 @@ namespace Jitter
 		void							MD_LoadFromRef();
 		void							MD_StoreAtRef();
 
+		//256-bits values can be used with MD_Add(B/H/W), MD_Sub(B/H/W), MD_And, MD_Or, MD_Xor, MD_AddS, MD_SubS and MD_MulS.
+		//Both operands need to be 256-bits wide, these are split in 128-bits halves if the host can't handle them.
+		//Other MD operations throw when given 256-bits values.
+		void							MD_PushRel256(size_t);
+		void							MD_PullRel256(size_t);
+
 		void							MD_AbsS();
 		void							MD_AddB();
 		void							MD_AddBUS();
@@ -171,6 +349,12 @@ namespace Jitter
 		void							MD_CmpGtH();
 		void							MD_CmpGtW();
 		void							MD_DivS();
+		//Pull a vector, push the 32-bit value in lane
+		void							MD_ExtractW(unsigned int);
+		void							MD_FusedMulAddS();
+		void							MD_FusedMulSubS();
+		//Pull a source and a destination vector, push the destination with lane (first) replaced by the source's lane (second)
+		void							MD_InsertW(unsigned int, unsigned int);
 		void							MD_IsNegative();
 		void							MD_IsZero();
 		void							MD_MaxH();
@@ -179,11 +363,23 @@ namespace Jitter
 		void							MD_MinH();
 		void							MD_MinW();
 		void							MD_MinS();
+		void							MD_MulH();
+		void							MD_MulHiH();
+		void							MD_MulW();
+		//Unsigned 32x32 -> 64 multiply of lanes 0 and 2
+		void							MD_MulEvenUWD();
+		//Signed 16x16 -> 32 multiply, adjacent products are added together
+		void							MD_MulAddPairsHW();
 		void							MD_MulS();
+		void							MD_MulAddS();
+		void							MD_MulSubS();
 		void							MD_Not();
 		void							MD_Or();
 		void							MD_PackHB();
 		void							MD_PackWH();
+		void							MD_Round(ROUNDMODE);
+		//Lane i of the result is lane ((selector >> (i * 2)) & 3) of the source
+		void							MD_ShuffleW(uint8);
 		void							MD_SllH(uint8);
 		void							MD_SllW(uint8);
 		void							MD_SraH(uint8);
@@ -201,6 +397,9 @@ namespace Jitter
 		void							MD_SubS();
 		void							MD_ToSingle();
 		void							MD_ToWordTruncate();
+		//Same rounding and saturation rules as FP_PullWord/FP_PullWordSaturate
+		void							MD_ToWord(ROUNDMODE);
+		void							MD_ToWordSaturate(ROUNDMODE);
 		void							MD_UnpackLowerBH();
 		void							MD_UnpackLowerHW();
 		void							MD_UnpackLowerWD();
@@ -213,6 +412,59 @@ namespace Jitter
 
 		void							SetStream(Framework::CStream*);
 
+		//Instruments the next compiled function with counters incremented when blocks and edges are executed.
+		//The counter layout is available through GetProfileCounters once compilation is done.
+		//Functions needing more counters than available are not instrumented at all and GetProfileCounters is empty,
+		//GetRequiredProfileCounterCount gives the size of the buffer needed to profile them.
+		void							EnableProfiling(uint32*, size_t);
+		const ProfileCounterArray&		GetProfileCounters() const;
+		size_t							GetRequiredProfileCounterCount() const;
+		static BlockFrequencyMap		MakeBlockFrequencies(const ProfileCounterArray&, const uint32*);
+
+		//Block frequencies collected from a previous run, used to lay out the next compiled function
+		void							SetBlockFrequencies(const BlockFrequencyMap&);
+		//Ids of the last compiled function's blocks, in the order they were laid out
+		const BlockIdArray&				GetBlockLayout() const;
+
+		void							SetCompileTier(COMPILE_TIER);
+		COMPILE_TIER					GetCompileTier() const;
+
+		//Passes run by the optimizing tier, the baseline tier always uses OPTIMIZATION_LEVEL_NONE's pipeline.
+		static PASS_PIPELINE			MakePassPipeline(OPTIMIZATION_LEVEL);
+		void							SetOptimizationLevel(OPTIMIZATION_LEVEL);
+		void							SetPassPipeline(const PASS_PIPELINE&);
+		const PASS_PIPELINE&			GetPassPipeline() const;
+
+		//Statistics are accumulated over all compiled functions while enabled.
+		void							SetPassStatsEnabled(bool);
+		const PassStatsArray&			GetPassStats() const;
+		void							ResetPassStats();
+		static const char*				GetPassName(OPTIMIZATION_PASS);
+
+		//Always collected and accumulated over all compiled functions, functions loaded from the code cache aren't counted.
+		const COMPILE_STATS&			GetCompileStats() const;
+		void							ResetCompileStats();
+		static const char*				GetCompilePhaseName(COMPILE_PHASE);
+
+		//Writes an event for every compiled function and for each of its phases.
+		void							SetCompileTraceWriter(CCompileTraceWriter*);
+
+		//The next compiled function increments the counter every time it is entered.
+		//Used to find baseline functions worth compiling again with the optimizing tier.
+		void							SetEntryCounter(uint32*);
+
+		//Code for functions found in the cache is copied to the stream without being compiled.
+		//Only used when code is written at the start of the stream and profiling options aren't set.
+		void							SetCodeCache(CCodeCache*);
+
+		//The IR of every function given to End is appended to the stream before being compiled.
+		//Captured functions can be compiled again later with BeginFromIr.
+		void							SetIrCaptureStream(Framework::CStream*);
+
+		//Starts a session with the next function captured in the stream, End must be called to compile it.
+		//Returns false if the stream has no more functions.
+		bool							BeginFromIr(Framework::CStream&);
+
 	private:
 		struct SYMBOL_REGALLOCINFO
 		{
@@ -233,7 +485,13 @@ namespace Jitter
 		typedef std::vector<AllocationRange> AllocationRangeArray;
 		typedef std::unordered_map<SymbolPtr, SYMBOL_REGALLOCINFO, SymbolHasher, SymbolComparator> SymbolRegAllocInfo;
 		typedef std::unordered_map<CSymbol*, unsigned int> SymbolUseCountMap;
-		typedef std::stack<uint32> IntStack;
+		struct IF_STATE
+		{
+			uint32						nextBlockId = 0;
+			BRANCH_HINT					hint = BRANCH_HINT_NONE;
+			bool						parentCold = false;
+		};
+		typedef std::stack<IF_STATE> IfStack;
 
 		class CRelativeVersionManager
 		{
@@ -255,6 +513,7 @@ namespace Jitter
 			CSymbolTable				symbolTable;
 			bool						optimized = false;
 			bool						hasJumpRef = false;
+			bool						cold = false;
 		};
 		typedef std::list<BASIC_BLOCK> BasicBlockList;
 
@@ -264,16 +523,32 @@ namespace Jitter
 			CRelativeVersionManager		relativeVersions;
 		};
 
+		typedef std::unordered_map<const CSymbol*, uint64> FpConstantMap;
+
+		void							InsertUnaryStatement(Jitter::OPERATION);
 		void							InsertBinaryStatement(Jitter::OPERATION);
+		void							InsertBinary64Statement(Jitter::OPERATION);
+		void							InsertLoadFromRefStatement(Jitter::OPERATION);
+		void							InsertStoreAtRefStatement(Jitter::OPERATION);
 		void							InsertUnaryMdStatement(Jitter::OPERATION);
 		void							InsertBinaryMdStatement(Jitter::OPERATION);
+		void							InsertTernaryMdStatement(Jitter::OPERATION);
+		void							InsertTernaryFpStatement(Jitter::OPERATION);
 
 		void							Compile();
 
+		bool							CanUseCodeCache() const;
+		CCodeCache::KEY					MakeCodeCacheKey(std::vector<uintptr_t>&) const;
+		bool							LoadFromCodeCache(const CCodeCache::KEY&);
+		void							CompileToCodeCache(const CCodeCache::KEY&, const std::vector<uintptr_t>&);
+
+		void							WriteIr(Framework::CStream&) const;
+
 		bool							ConstantFolding(StatementList&);
 		bool							ConstantPropagation(StatementList&);
 		bool							CopyPropagation(StatementList&);
 		bool							DeadcodeElimination(VERSIONED_STATEMENT_LIST&);
+		bool							FuseMultiplyAdd(StatementList&);
 
 		void							FixFlowControl(StatementList&);
 
@@ -281,12 +556,26 @@ namespace Jitter
 		bool							FoldConstant64Operation(STATEMENT&);
 		bool							FoldConstant6432Operation(STATEMENT&);
 		bool							FoldConstant12832Operation(STATEMENT&);
+		bool							FoldConstantFpOperation(STATEMENT&, FpConstantMap&);
+		bool							FoldExtensionShifts(StatementList&, const StatementList::iterator&);
 
 		BASIC_BLOCK						ConcatBlocks(const BasicBlockList&);
 		bool							MergeBlocks();
 		bool							PruneBlocks();
 		void							HarmonizeBlocks();
 		void							MergeBasicBlocks(BASIC_BLOCK&, const BASIC_BLOCK&);
+		void							LayoutBlocks();
+		void							ApplyBlockFrequencies();
+		void							Split256BitsMdStatements();
+		void							InstrumentBlocks();
+		void							InstrumentEntry();
+		const PASS_PIPELINE&			GetCompilePassPipeline() const;
+		void							OptimizeBlocks(const PASS_PIPELINE&);
+		bool							RunBlockPass(OPTIMIZATION_PASS, VERSIONED_STATEMENT_LIST&);
+		bool							RunFlowPass(OPTIMIZATION_PASS);
+		size_t							GetStatementCount() const;
+		template <typename CountFunction, typename PassFunction>
+		bool							RunPass(OPTIMIZATION_PASS, const CountFunction&, const PassFunction&);
 
 		void							StartBlock(uint32);
 
@@ -296,6 +585,7 @@ namespace Jitter
 		SymbolPtr						MakeSymbol(BASIC_BLOCK*, SYM_TYPE, uint32, uint32);
 		SymbolPtr						MakeConstantPtr(uintptr_t);
 		SymbolPtr						MakeConstant64(uint64);
+		SymbolPtr						MakeFpTemporarySymbol(const SymbolPtr&);
 
 		SymbolRefPtr					MakeSymbolRef(const SymbolPtr&);
 		int								GetSymbolSize(const SymbolRefPtr&);
@@ -312,7 +602,7 @@ namespace Jitter
 		static AllocationRangeArray		ComputeAllocationRanges(const BASIC_BLOCK&);
 		void							ComputeLivenessForRange(const BASIC_BLOCK&, const AllocationRange&, SymbolRegAllocInfo&) const;
 		void							MarkAliasedSymbols(const BASIC_BLOCK&, const AllocationRange&, SymbolRegAllocInfo&) const;
-		void							AssociateSymbolsToRegisters(SymbolRegAllocInfo&) const;
+		void							AssociateSymbolsToRegisters(SymbolRegAllocInfo&, bool) const;
 
 		void							NormalizeStatements(BASIC_BLOCK&);
 		unsigned int					AllocateStack(BASIC_BLOCK&);
@@ -320,7 +610,8 @@ namespace Jitter
 		bool							m_blockStarted = false;
 
 		CArrayStack<SymbolPtr>			m_shadow;
-		IntStack						m_ifStack;
+		IfStack							m_ifStack;
+		bool							m_coldRegion = false;
 
 		unsigned int					m_nextTemporary = 1;
 		unsigned int					m_nextBlockId = 1;
@@ -328,9 +619,28 @@ namespace Jitter
 		BASIC_BLOCK*					m_currentBlock = nullptr;
 		BasicBlockList					m_basicBlocks;
 		CCodeGen*						m_codeGen = nullptr;
+		Framework::CStream*				m_stream = nullptr;
+		CCodeCache*						m_codeCache = nullptr;
+		Framework::CStream*				m_irCaptureStream = nullptr;
 
 		unsigned int					m_nextLabelId = 1;
 		LabelMapType					m_labels;
+
+		uint32*							m_profileCounters = nullptr;
+		size_t							m_profileCounterCount = 0;
+		ProfileCounterArray				m_profileCounterInfos;
+		size_t							m_requiredProfileCounterCount = 0;
+		BlockFrequencyMap				m_blockFrequencies;
+		BlockIdArray					m_blockLayout;
+
+		COMPILE_TIER					m_compileTier = COMPILE_TIER_OPTIMIZING;
+		PASS_PIPELINE					m_passPipeline = MakePassPipeline(OPTIMIZATION_LEVEL_FULL);
+		bool							m_passStatsEnabled = false;
+		PassStatsArray					m_passStats;
+
+		COMPILE_STATS					m_compileStats;
+		CCompileTraceWriter*			m_compileTraceWriter = nullptr;
+		uint32*							m_entryCounter = nullptr;
 	};
 
 }
@@ -3,6 +3,7 @@
 #include "Stream.h"
 #include "Jitter_Statement.h"
 #include <map>
+#include <string>
 #include <functional>
 
 namespace Jitter
@@ -18,13 +19,24 @@ namespace Jitter
 
 		virtual void			SetStream(Framework::CStream*) = 0;
 		void					SetExternalSymbolReferencedHandler(const ExternalSymbolReferencedHandler&);
+		const ExternalSymbolReferencedHandler&	GetExternalSymbolReferencedHandler() const;
 
 		virtual void			GenerateCode(const StatementList&, unsigned int) = 0;
 		virtual unsigned int	GetAvailableRegisterCount() const = 0;
 		virtual unsigned int	GetAvailableMdRegisterCount() const = 0;
 		virtual bool			CanHold128BitsReturnValueInRegisters() const = 0;
+		//256-bits MD statements are split in 128-bits halves when not supported. When supported,
+		//256-bits values are also allocated to MD registers and show up as SYM_REGISTER256.
+		virtual bool			CanHandle256BitsMdOperations() const = 0;
 		virtual void			RegisterExternalSymbols(CObjectFile*) const = 0;
 
+		//Identifies the target and the options that affect generated code
+		virtual std::string		GetConfigurationName() const = 0;
+
+		//Writes the address of an external symbol at a location reported through ExternalSymbolReferencedHandler.
+		//Returns false if the reference can't be resolved without knowing where the code will be placed.
+		virtual bool			PatchExternalSymbolReference(uint8*, uint32, uintptr_t) const;
+
 	protected:
 		enum MATCHTYPE
 		{
@@ -55,12 +67,20 @@ namespace Jitter
 			MATCH_MEMORY128,
 			MATCH_VARIABLE128,
 
+			MATCH_RELATIVE256,
+			MATCH_TEMPORARY256,
 			MATCH_MEMORY256,
+			MATCH_REGISTER256,
+			MATCH_VARIABLE256,
 
 			MATCH_RELATIVE_FP_SINGLE,
 			MATCH_TEMPORARY_FP_SINGLE,
 			MATCH_MEMORY_FP_SINGLE,
 
+			MATCH_RELATIVE_FP_DOUBLE,
+			MATCH_TEMPORARY_FP_DOUBLE,
+			MATCH_MEMORY_FP_DOUBLE,
+
 			MATCH_RELATIVE_FP_INT32,
 		};
 
@@ -79,6 +99,8 @@ namespace Jitter
 
 		bool								SymbolMatches(MATCHTYPE, const SymbolRefPtr&);
 		static uint32						GetRegisterUsage(const StatementList&);
+		static uint32						GetMdRegisterUsage(const StatementList&);
+		static uint32						GetMd256RegisterUsage(const StatementList&);
 
 		MatcherMapType						m_matchers;
 		ExternalSymbolReferencedHandler		m_externalSymbolReferencedHandler;
@@ -3,6 +3,7 @@
 #include "Jitter_CodeGen.h"
 #include "AArch32Assembler.h"
 #include <deque>
+#include <vector>
 #include <functional>
 #include <array>
 
@@ -20,6 +21,9 @@ namespace Jitter
 		unsigned int							GetAvailableRegisterCount() const override;
 		unsigned int							GetAvailableMdRegisterCount() const override;
 		bool									CanHold128BitsReturnValueInRegisters() const override;
+		bool									CanHandle256BitsMdOperations() const override;
+		std::string								GetConfigurationName() const override;
+		bool									PatchExternalSymbolReference(uint8*, uint32, uintptr_t) const override;
 
 	private:
 		typedef std::map<uint32, CAArch32Assembler::LABEL> LabelMapType;
@@ -51,6 +55,7 @@ namespace Jitter
 
 		typedef std::function<void (PARAM_STATE&)> ParamEmitterFunction;
 		typedef std::deque<ParamEmitterFunction> ParamStack;
+		typedef std::vector<std::function<void ()>> ColdPathEmitterArray;
 		
 		enum MAX_PARAM_REGS
 		{
@@ -94,6 +99,7 @@ namespace Jitter
 		void									LoadMemory64LowInRegister(CAArch32Assembler::REGISTER, CSymbol*);
 		void									LoadMemory64HighInRegister(CAArch32Assembler::REGISTER, CSymbol*);
 		void									LoadMemory64InRegisters(CAArch32Assembler::REGISTER, CAArch32Assembler::REGISTER, CSymbol*);
+		void									LoadSymbol64InRegisters(CAArch32Assembler::REGISTER, CAArch32Assembler::REGISTER, CSymbol*);
 
 		void									StoreRegisterInMemory64Low(CSymbol*, CAArch32Assembler::REGISTER);
 		void									StoreRegisterInMemory64High(CSymbol*, CAArch32Assembler::REGISTER);
@@ -108,6 +114,9 @@ namespace Jitter
 		void									LoadTemporaryFpSingleInRegister(CTempRegisterContext&, CAArch32Assembler::SINGLE_REGISTER, CSymbol*);
 		void									StoreTemporaryFpSingleInRegister(CTempRegisterContext&, CSymbol*, CAArch32Assembler::SINGLE_REGISTER);
 
+		void									LoadMemoryFpDoubleInRegister(CTempRegisterContext&, CAArch32Assembler::DOUBLE_REGISTER, CSymbol*);
+		void									StoreRegisterInMemoryFpDouble(CTempRegisterContext&, CSymbol*, CAArch32Assembler::DOUBLE_REGISTER);
+
 		void									LoadMemory128AddressInRegister(CAArch32Assembler::REGISTER, CSymbol*, uint32 = 0);
 		void									LoadRelative128AddressInRegister(CAArch32Assembler::REGISTER, CSymbol*, uint32);
 		void									LoadTemporary128AddressInRegister(CAArch32Assembler::REGISTER, CSymbol*, uint32);
@@ -133,6 +142,9 @@ namespace Jitter
 		void									LoadConstantInRegister(CAArch32Assembler::REGISTER, uint32);
 		void									LoadConstantPtrInRegister(CAArch32Assembler::REGISTER, uintptr_t);
 
+		void									SetFpRoundingMode(CAArch32Assembler::REGISTER, CAArch32Assembler::REGISTER, ROUNDMODE);
+		void									RoundFpSingleInRegister(CAArch32Assembler::SINGLE_REGISTER, CAArch32Assembler::REGISTER, CAArch32Assembler::REGISTER);
+
 		//ALUOP ----------------------------------------------------------
 		struct ALUOP_BASE
 		{
@@ -249,6 +261,52 @@ namespace Jitter
 			static OpRegType OpReg() { return &CAArch32Assembler::Vmax_F32; }
 		};
 
+		//FPUDOP -----------------------------------------------------------
+		struct FPUDOP_BASE2
+		{
+			typedef void (CAArch32Assembler::*OpRegType)(CAArch32Assembler::DOUBLE_REGISTER, CAArch32Assembler::DOUBLE_REGISTER);
+		};
+
+		struct FPUDOP_BASE3
+		{
+			typedef void (CAArch32Assembler::*OpRegType)(CAArch32Assembler::DOUBLE_REGISTER, CAArch32Assembler::DOUBLE_REGISTER, CAArch32Assembler::DOUBLE_REGISTER);
+		};
+
+		struct FPUDOP_ABS : public FPUDOP_BASE2
+		{
+			static OpRegType OpReg() { return &CAArch32Assembler::Vabs_F64; }
+		};
+
+		struct FPUDOP_NEG : public FPUDOP_BASE2
+		{
+			static OpRegType OpReg() { return &CAArch32Assembler::Vneg_F64; }
+		};
+
+		struct FPUDOP_SQRT : public FPUDOP_BASE2
+		{
+			static OpRegType OpReg() { return &CAArch32Assembler::Vsqrt_F64; }
+		};
+
+		struct FPUDOP_ADD : public FPUDOP_BASE3
+		{
+			static OpRegType OpReg() { return &CAArch32Assembler::Vadd_F64; }
+		};
+
+		struct FPUDOP_SUB : public FPUDOP_BASE3
+		{
+			static OpRegType OpReg() { return &CAArch32Assembler::Vsub_F64; }
+		};
+
+		struct FPUDOP_MUL : public FPUDOP_BASE3
+		{
+			static OpRegType OpReg() { return &CAArch32Assembler::Vmul_F64; }
+		};
+
+		struct FPUDOP_DIV : public FPUDOP_BASE3
+		{
+			static OpRegType OpReg() { return &CAArch32Assembler::Vdiv_F64; }
+		};
+
 		//MDOP -----------------------------------------------------------
 		struct MDOP_BASE2
 		{
@@ -390,6 +448,16 @@ namespace Jitter
 			static OpRegType OpReg() { return &CAArch32Assembler::Vmax_I32; }
 		};
 
+		struct MDOP_MULH : public MDOP_BASE3
+		{
+			static OpRegType OpReg() { return &CAArch32Assembler::Vmul_I16; }
+		};
+
+		struct MDOP_MULW : public MDOP_BASE3
+		{
+			static OpRegType OpReg() { return &CAArch32Assembler::Vmul_I32; }
+		};
+
 		struct MDOP_AND : public MDOP_BASE3
 		{
 			static OpRegType OpReg() { return &CAArch32Assembler::Vand; }
@@ -511,6 +579,14 @@ namespace Jitter
 		//LZC
 		void									Emit_Lzc_VarVar(const STATEMENT&);
 
+		//SEXT/ZEXT
+		void									Emit_Ext_VarVar(const STATEMENT&);
+
+		//BSWAP/POPCNT/CTZ
+		void									Emit_ByteSwap_VarVar(const STATEMENT&);
+		void									Emit_PopCount_VarVar(const STATEMENT&);
+		void									Emit_Ctz_VarVar(const STATEMENT&);
+
 		//NOP
 		void									Emit_Nop(const STATEMENT&);
 		
@@ -523,6 +599,10 @@ namespace Jitter
 		//MERGETO64
 		void									Emit_MergeTo64_Mem64AnyAny(const STATEMENT&);
 
+		//SEXTTO64/ZEXTTO64
+		void									Emit_SignExtTo64_Mem64Var(const STATEMENT&);
+		void									Emit_ZeroExtTo64_Mem64Var(const STATEMENT&);
+
 		//CMP
 		void									Cmp_GetFlag(CAArch32Assembler::REGISTER, CONDITION);
 		void									Cmp_GenericRegCst(CAArch32Assembler::REGISTER, uint32, CAArch32Assembler::REGISTER);
@@ -550,9 +630,19 @@ namespace Jitter
 		
 		//LOADFROMREF
 		void									Emit_LoadFromRef_VarTmp(const STATEMENT&);
+		void									Emit_LoadFromRef_Mem64Mem(const STATEMENT&);
+		void									Emit_LoadSizedFromRef_VarMem(const STATEMENT&);
 		
 		//STOREATREF
 		void									Emit_StoreAtRef_TmpAny(const STATEMENT&);
+		void									Emit_StoreAtRef_MemAny64(const STATEMENT&);
+		void									Emit_StoreSizedAtRef_MemAny(const STATEMENT&);
+
+		//LOADFROMTLB
+		void									Emit_LoadFromTlb_VarAny(const STATEMENT&);
+
+		//INCCOUNTER
+		void									Emit_IncCounter(const STATEMENT&);
 		
 		//MOV64
 		void									Emit_Mov_Mem64Mem64(const STATEMENT&);
@@ -567,8 +657,17 @@ namespace Jitter
 		void									Emit_Sub64_MemMemCst(const STATEMENT&);
 		void									Emit_Sub64_MemCstMem(const STATEMENT&);
 
-		//AND64
-		void									Emit_And64_MemMemMem(const STATEMENT&);
+		//LOGIC64
+		template <typename> void				Emit_Logic64_MemAnyAny(const STATEMENT&);
+
+		//NOT64
+		void									Emit_Not64_MemMem(const STATEMENT&);
+
+		//MUL64
+		void									Emit_Mul64_MemAnyAny(const STATEMENT&);
+
+		//DIV64
+		template <bool> void					Emit_Div64_MemAnyAny(const STATEMENT&);
 
 		//SLL64
 		void									Emit_Sl64Var_MemMem(CSymbol*, CSymbol*, CAArch32Assembler::REGISTER);
@@ -587,6 +686,10 @@ namespace Jitter
 		void									Emit_Sra64_MemMemVar(const STATEMENT&);
 		void									Emit_Sra64_MemMemCst(const STATEMENT&);
 
+		//ROR64
+		void									Emit_Ror64_MemMemVar(const STATEMENT&);
+		void									Emit_Ror64_MemMemCst(const STATEMENT&);
+
 		//CMP64
 		void									Cmp64_RegSymLo(CAArch32Assembler::REGISTER, CSymbol*, CAArch32Assembler::REGISTER);
 		void									Cmp64_RegSymHi(CAArch32Assembler::REGISTER, CSymbol*, CAArch32Assembler::REGISTER);
@@ -598,16 +701,38 @@ namespace Jitter
 		template <typename> void				Emit_Fpu_MemMem(const STATEMENT&);
 		template <typename> void				Emit_Fpu_MemMemMem(const STATEMENT&);
 		template <typename> void				Emit_FpuMd_MemMemMem(const STATEMENT&);
+		template <typename> void				Emit_Fpu_MulAcc_MemMemMem(const STATEMENT&);
 		void									Emit_Fp_Rcpl_MemMem(const STATEMENT&);
 		void									Emit_Fp_Rsqrt_MemMem(const STATEMENT&);
 		void									Emit_Fp_Cmp_AnyMemMem(const STATEMENT&);
 		void									Emit_Fp_Mov_MemSRelI32(const STATEMENT&);
 		void									Emit_Fp_ToIntTrunc_MemMem(const STATEMENT&);
+		void									Emit_Fp_ToInt_MemMemCst(const STATEMENT&);
+		void									Emit_Fp_Round_MemMemCst(const STATEMENT&);
 		void									Emit_Fp_LdCst_TmpCst(const STATEMENT&);
+		void									Emit_Fp_ToDouble_MemMem(const STATEMENT&);
+		void									Emit_Fp_ToSingle_MemMem(const STATEMENT&);
+		void									Emit_Fp_ToInt64Trunc_Mem64MemS(const STATEMENT&);
+
+		//FPUDOP
+		template <typename> void				Emit_FpuD_MemMem(const STATEMENT&);
+		template <typename> void				Emit_FpuD_MemMemMem(const STATEMENT&);
+		template <bool> void					Emit_FpD_MinMax_MemMemMem(const STATEMENT&);
+		template <typename> void				Emit_FpuD_MulAcc_MemMemMem(const STATEMENT&);
+		void									Emit_FpD_Rcpl_MemMem(const STATEMENT&);
+		void									Emit_FpD_Rsqrt_MemMem(const STATEMENT&);
+		void									Emit_FpD_Cmp_AnyMemMem(const STATEMENT&);
+		void									Emit_FpD_Mov_MemMem(const STATEMENT&);
+		void									Emit_FpD_Mov_MemDRelI32(const STATEMENT&);
+		void									Emit_FpD_ToIntTrunc_MemMem(const STATEMENT&);
+		void									Emit_FpD_ToInt64Trunc_Mem64Mem(const STATEMENT&);
+		void									Emit_FpD_FromInt64_MemMem64(const STATEMENT&);
+		void									Emit_FpD_LdCst_TmpCst(const STATEMENT&);
 		
 		//MDOP
 		template <typename> void				Emit_Md_MemMem(const STATEMENT&);
 		template <typename> void				Emit_Md_MemMemMem(const STATEMENT&);
+		template <typename> void				Emit_Md_MulAcc_MemMemMemMem(const STATEMENT&);
 		template <typename> void				Emit_Md_Shift_MemMemCst(const STATEMENT&);
 		template <uint32> void					Emit_Md_Test_VarMem(const STATEMENT&);
 
@@ -625,10 +750,19 @@ namespace Jitter
 		void									Emit_Md_Expand_MemReg(const STATEMENT&);
 		void									Emit_Md_Expand_MemMem(const STATEMENT&);
 		void									Emit_Md_Expand_MemCst(const STATEMENT&);
+		void									Emit_Md_Shuffle_MemMemCst(const STATEMENT&);
+		void									Emit_Md_InsertW_MemMemMem(const STATEMENT&);
+		void									Emit_Md_ExtractW_VarMemCst(const STATEMENT&);
+		void									Emit_Md_MulHiH_MemMemMem(const STATEMENT&);
+		void									Emit_Md_MulEvenUWD_MemMemMem(const STATEMENT&);
+		void									Emit_Md_MulAddPairsHW_MemMemMem(const STATEMENT&);
 
 		void									Emit_Md_PackHB_MemMemMem(const STATEMENT&);
 		void									Emit_Md_PackWH_MemMemMem(const STATEMENT&);
 
+		void									Emit_Md_ToWord_MemMemCst(const STATEMENT&);
+		void									Emit_Md_Round_MemMemCst(const STATEMENT&);
+
 		template <uint32> void					Emit_Md_UnpackBH_MemMemMem(const STATEMENT&);
 		template <uint32> void					Emit_Md_UnpackHW_MemMemMem(const STATEMENT&);
 		template <uint32> void					Emit_Md_UnpackWD_MemMemMem(const STATEMENT&);
@@ -650,6 +784,7 @@ namespace Jitter
 		CAArch32Assembler						m_assembler;
 		LabelMapType							m_labels;
 		ParamStack								m_params;
+		ColdPathEmitterArray					m_coldPathEmitters;
 		uint32									m_stackLevel = 0;
 		bool									m_hasIntegerDiv = false;
 	};
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <deque>
+#include <vector>
 #include "Jitter_CodeGen.h"
 #include "AArch64Assembler.h"
 
@@ -20,6 +21,8 @@ namespace Jitter
 		unsigned int    GetAvailableRegisterCount() const override;
 		unsigned int    GetAvailableMdRegisterCount() const override;
 		bool            CanHold128BitsReturnValueInRegisters() const override;
+		bool            CanHandle256BitsMdOperations() const override;
+		std::string     GetConfigurationName() const override;
 
 	private:
 		typedef std::map<uint32, CAArch64Assembler::LABEL> LabelMapType;
@@ -47,6 +50,7 @@ namespace Jitter
 
 		typedef std::function<void (PARAM_STATE&)> ParamEmitterFunction;
 		typedef std::deque<ParamEmitterFunction> ParamStack;
+		typedef std::vector<std::function<void ()>> ColdPathEmitterArray;
 
 		enum
 		{
@@ -112,6 +116,9 @@ namespace Jitter
 		void    LoadMemoryFpSingleInRegister(CAArch64Assembler::REGISTERMD, CSymbol*);
 		void    StoreRegisterInMemoryFpSingle(CSymbol*, CAArch64Assembler::REGISTERMD);
 		
+		void    LoadMemoryFpDoubleInRegister(CAArch64Assembler::REGISTERMD, CSymbol*);
+		void    StoreRegisterInMemoryFpDouble(CSymbol*, CAArch64Assembler::REGISTERMD);
+		
 		void    LoadMemory128InRegister(CAArch64Assembler::REGISTERMD, CSymbol*);
 		void    StoreRegisterInMemory128(CSymbol*, CAArch64Assembler::REGISTERMD);
 		
@@ -162,6 +169,12 @@ namespace Jitter
 			static OpImmType    OpImm()    { return &CAArch64Assembler::Lsr; }
 			static OpRegType    OpReg()    { return &CAArch64Assembler::Lsrv; }
 		};
+
+		struct SHIFTOP_ROR : public SHIFTOP_BASE
+		{
+			static OpImmType    OpImm()    { return &CAArch64Assembler::Ror; }
+			static OpRegType    OpReg()    { return &CAArch64Assembler::Rorv; }
+		};
 		
 		//LOGICOP ----------------------------------------------------------
 		struct LOGICOP_BASE
@@ -234,6 +247,48 @@ namespace Jitter
 			static OpRegType    OpReg()    { return &CAArch64Assembler::Lsrv; }
 		};
 
+		struct SHIFT64OP_ROR : public SHIFT64OP_BASE
+		{
+			static OpImmType    OpImm()    { return &CAArch64Assembler::Ror; }
+			static OpRegType    OpReg()    { return &CAArch64Assembler::Rorv; }
+		};
+
+		//ALU64OP ----------------------------------------------------------
+		struct ALU64OP_BASE
+		{
+			typedef void (CAArch64Assembler::*OpRegType)(CAArch64Assembler::REGISTER64, CAArch64Assembler::REGISTER64, CAArch64Assembler::REGISTER64);
+		};
+
+		struct ALU64OP_AND : public ALU64OP_BASE
+		{
+			static OpRegType    OpReg()    { return &CAArch64Assembler::And; }
+		};
+
+		struct ALU64OP_OR : public ALU64OP_BASE
+		{
+			static OpRegType    OpReg()    { return &CAArch64Assembler::Orr; }
+		};
+
+		struct ALU64OP_XOR : public ALU64OP_BASE
+		{
+			static OpRegType    OpReg()    { return &CAArch64Assembler::Eor; }
+		};
+
+		struct ALU64OP_MUL : public ALU64OP_BASE
+		{
+			static OpRegType    OpReg()    { return &CAArch64Assembler::Mul; }
+		};
+
+		struct ALU64OP_UDIV : public ALU64OP_BASE
+		{
+			static OpRegType    OpReg()    { return &CAArch64Assembler::Udiv; }
+		};
+
+		struct ALU64OP_SDIV : public ALU64OP_BASE
+		{
+			static OpRegType    OpReg()    { return &CAArch64Assembler::Sdiv; }
+		};
+
 		//FPUOP ----------------------------------------------------------
 		struct FPUOP_BASE2
 		{
@@ -290,6 +345,76 @@ namespace Jitter
 			static OpRegType OpReg() { return &CAArch64Assembler::Fsqrt_1s; }
 		};
 		
+		struct FPUDOP_ADD : public FPUOP_BASE3
+		{
+			static OpRegType OpReg() { return &CAArch64Assembler::Fadd_1d; }
+		};
+		
+		struct FPUDOP_SUB : public FPUOP_BASE3
+		{
+			static OpRegType OpReg() { return &CAArch64Assembler::Fsub_1d; }
+		};
+
+		struct FPUDOP_MUL : public FPUOP_BASE3
+		{
+			static OpRegType OpReg() { return &CAArch64Assembler::Fmul_1d; }
+		};
+
+		struct FPUDOP_DIV : public FPUOP_BASE3
+		{
+			static OpRegType OpReg() { return &CAArch64Assembler::Fdiv_1d; }
+		};
+
+		struct FPUDOP_MIN : public FPUOP_BASE3
+		{
+			static OpRegType OpReg() { return &CAArch64Assembler::Fmin_1d; }
+		};
+		
+		struct FPUDOP_MAX : public FPUOP_BASE3
+		{
+			static OpRegType OpReg() { return &CAArch64Assembler::Fmax_1d; }
+		};
+
+		struct FPUDOP_ABS : public FPUOP_BASE2
+		{
+			static OpRegType OpReg() { return &CAArch64Assembler::Fabs_1d; }
+		};
+		
+		struct FPUDOP_NEG : public FPUOP_BASE2
+		{
+			static OpRegType OpReg() { return &CAArch64Assembler::Fneg_1d; }
+		};
+		
+		struct FPUDOP_SQRT : public FPUOP_BASE2
+		{
+			static OpRegType OpReg() { return &CAArch64Assembler::Fsqrt_1d; }
+		};
+
+		struct FPUOP_BASE4
+		{
+			typedef void (CAArch64Assembler::*OpRegType)(CAArch64Assembler::REGISTERMD, CAArch64Assembler::REGISTERMD, CAArch64Assembler::REGISTERMD, CAArch64Assembler::REGISTERMD);
+		};
+
+		struct FPUOP_FMADD : public FPUOP_BASE4
+		{
+			static OpRegType OpReg() { return &CAArch64Assembler::Fmadd_1s; }
+		};
+
+		struct FPUOP_FMSUB : public FPUOP_BASE4
+		{
+			static OpRegType OpReg() { return &CAArch64Assembler::Fmsub_1s; }
+		};
+
+		struct FPUDOP_FMADD : public FPUOP_BASE4
+		{
+			static OpRegType OpReg() { return &CAArch64Assembler::Fmadd_1d; }
+		};
+
+		struct FPUDOP_FMSUB : public FPUOP_BASE4
+		{
+			static OpRegType OpReg() { return &CAArch64Assembler::Fmsub_1d; }
+		};
+		
 		//MDOP -----------------------------------------------------------
 		struct MDOP_BASE2
 		{
@@ -430,6 +555,16 @@ namespace Jitter
 		{
 			static OpRegType OpReg() { return &CAArch64Assembler::Smax_4s; }
 		};
+
+		struct MDOP_MULH : public MDOP_BASE3
+		{
+			static OpRegType OpReg() { return &CAArch64Assembler::Mul_8h; }
+		};
+
+		struct MDOP_MULW : public MDOP_BASE3
+		{
+			static OpRegType OpReg() { return &CAArch64Assembler::Mul_4s; }
+		};
 		
 		struct MDOP_ADDS : public MDOP_BASE3
 		{
@@ -451,6 +586,16 @@ namespace Jitter
 			static OpRegType OpReg() { return &CAArch64Assembler::Fdiv_4s; }
 		};
 
+		struct MDOP_FMLAS : public MDOP_BASE3
+		{
+			static OpRegType OpReg() { return &CAArch64Assembler::Fmla_4s; }
+		};
+
+		struct MDOP_FMLSS : public MDOP_BASE3
+		{
+			static OpRegType OpReg() { return &CAArch64Assembler::Fmls_4s; }
+		};
+
 		struct MDOP_ABSS : public MDOP_BASE2
 		{
 			static OpRegType OpReg() { return &CAArch64Assembler::Fabs_4s; }
@@ -579,18 +724,31 @@ namespace Jitter
 		
 		void    Emit_Not_VarVar(const STATEMENT&);
 		void    Emit_Lzc_VarVar(const STATEMENT&);
+		void    Emit_Ext_VarVar(const STATEMENT&);
+		void    Emit_ByteSwap_VarVar(const STATEMENT&);
+		void    Emit_PopCount_VarVar(const STATEMENT&);
+		void    Emit_Ctz_VarVar(const STATEMENT&);
 		
 		void    Emit_Mov_Mem64Mem64(const STATEMENT&);
 		void    Emit_Mov_Mem64Cst64(const STATEMENT&);
 		
+		void    Emit_LoadFromRef_Mem64Mem(const STATEMENT&);
+		void    Emit_StoreAtRef_MemAny64(const STATEMENT&);
+		
 		void    Emit_ExtLow64VarMem64(const STATEMENT&);
 		void    Emit_ExtHigh64VarMem64(const STATEMENT&);
 		void    Emit_MergeTo64_Mem64AnyAny(const STATEMENT&);
+		void    Emit_SignExtTo64_Mem64Var(const STATEMENT&);
+		void    Emit_ZeroExtTo64_Mem64Var(const STATEMENT&);
 		
 		void    Emit_RelToRef_TmpCst(const STATEMENT&);
 		void    Emit_AddRef_TmpMemAny(const STATEMENT&);
 		void    Emit_LoadFromRef_VarMem(const STATEMENT&);
 		void    Emit_StoreAtRef_MemAny(const STATEMENT&);
+		void    Emit_LoadSizedFromRef_VarMem(const STATEMENT&);
+		void    Emit_StoreSizedAtRef_MemAny(const STATEMENT&);
+		void    Emit_LoadFromTlb_VarAny(const STATEMENT&);
+		void    Emit_IncCounter(const STATEMENT&);
 		
 		void    Emit_Param_Ctx(const STATEMENT&);
 		void    Emit_Param_Reg(const STATEMENT&);
@@ -627,7 +785,8 @@ namespace Jitter
 		void    Emit_Cmp64_VarAnyMem(const STATEMENT&);
 		void    Emit_Cmp64_VarMemCst(const STATEMENT&);
 		
-		void    Emit_And64_MemMemMem(const STATEMENT&);
+		template <typename> void    Emit_Alu64_MemAnyAny(const STATEMENT&);
+		void    Emit_Not64_MemMem(const STATEMENT&);
 		
 		//ADDSUB
 		template <typename> void    Emit_AddSub_VarAnyVar(const STATEMENT&);
@@ -654,18 +813,43 @@ namespace Jitter
 		//FPU
 		template <typename> void    Emit_Fpu_MemMem(const STATEMENT&);
 		template <typename> void    Emit_Fpu_MemMemMem(const STATEMENT&);
+		template <typename> void    Emit_Fpu_MulAcc_MemMemMem(const STATEMENT&);
+		template <typename> void    Emit_Fpu_FusedMulAcc_MemMemMem(const STATEMENT&);
 
 		void    Emit_Fp_Cmp_AnyMemMem(const STATEMENT&);
 		void    Emit_Fp_Rcpl_MemMem(const STATEMENT&);
 		void    Emit_Fp_Rsqrt_MemMem(const STATEMENT&);
 		void    Emit_Fp_Mov_MemSRelI32(const STATEMENT&);
 		void    Emit_Fp_ToIntTrunc_MemMem(const STATEMENT&);
+		void    Emit_Fp_ToInt_MemMemCst(const STATEMENT&);
+		void    Emit_Fp_Round_MemMemCst(const STATEMENT&);
 		void    Emit_Fp_LdCst_TmpCst(const STATEMENT&);
+		void    Emit_Fp_ToDouble_MemMem(const STATEMENT&);
+		void    Emit_Fp_ToSingle_MemMem(const STATEMENT&);
+		void    Emit_Fp_ToInt64Trunc_Mem64MemS(const STATEMENT&);
+
+		//FPU (double precision)
+		template <typename> void    Emit_FpuD_MemMem(const STATEMENT&);
+		template <typename> void    Emit_FpuD_MemMemMem(const STATEMENT&);
+		template <typename> void    Emit_FpuD_MulAcc_MemMemMem(const STATEMENT&);
+		template <typename> void    Emit_FpuD_FusedMulAcc_MemMemMem(const STATEMENT&);
+
+		void    Emit_FpD_Cmp_AnyMemMem(const STATEMENT&);
+		void    Emit_FpD_Rcpl_MemMem(const STATEMENT&);
+		void    Emit_FpD_Rsqrt_MemMem(const STATEMENT&);
+		void    Emit_FpD_Mov_MemMem(const STATEMENT&);
+		void    Emit_FpD_Mov_MemDRelI32(const STATEMENT&);
+		void    Emit_FpD_ToIntTrunc_RelMem(const STATEMENT&);
+		void    Emit_FpD_ToInt64Trunc_Mem64Mem(const STATEMENT&);
+		void    Emit_FpD_FromInt64_MemMem64(const STATEMENT&);
+		void    Emit_FpD_LdCst_TmpCst(const STATEMENT&);
 
 		//MD
 		template <typename> void    Emit_Md_VarVar(const STATEMENT&);
 		template <typename> void    Emit_Md_VarVarVar(const STATEMENT&);
 		template <typename> void    Emit_Md_VarVarVarRev(const STATEMENT&);
+		template <typename> void    Emit_Md_MulAcc_VarVarVarVar(const STATEMENT&);
+		template <typename> void    Emit_Md_FusedMulAcc_VarVarVarVar(const STATEMENT&);
 		template <typename> void    Emit_Md_Shift_VarVarCst(const STATEMENT&);
 		template <typename> void    Emit_Md_Test_VarVar(const STATEMENT&);
 
@@ -683,6 +867,14 @@ namespace Jitter
 		void    Emit_Md_Expand_VarReg(const STATEMENT&);
 		void    Emit_Md_Expand_VarMem(const STATEMENT&);
 		void    Emit_Md_Expand_VarCst(const STATEMENT&);
+		void    Emit_Md_Shuffle_VarVarCst(const STATEMENT&);
+		void    Emit_Md_InsertW_VarVarVar(const STATEMENT&);
+		void    Emit_Md_ExtractW_VarVarCst(const STATEMENT&);
+		void    Emit_Md_ToWord_VarVarCst(const STATEMENT&);
+		void    Emit_Md_Round_VarVarCst(const STATEMENT&);
+		void    Emit_Md_MulHiH_VarVarVar(const STATEMENT&);
+		void    Emit_Md_MulEvenUWD_VarVarVar(const STATEMENT&);
+		void    Emit_Md_MulAddPairsHW_VarVarVar(const STATEMENT&);
 		
 		void    Emit_Md_PackHB_VarVarVar(const STATEMENT&);
 		void    Emit_Md_PackWH_VarVarVar(const STATEMENT&);
@@ -709,6 +901,8 @@ namespace Jitter
 		CAArch64Assembler      m_assembler;
 		LabelMapType           m_labels;
 		ParamStack             m_params;
+		ColdPathEmitterArray   m_coldPathEmitters;
+		uint32                 m_mdRegisterUsage = 0;
 		uint32                 m_nextTempRegister = 0;
 		uint32                 m_nextTempRegisterMd = 0;
 		uint32                 m_paramSpillBase = 0;
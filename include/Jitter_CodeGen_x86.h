@@ -18,6 +18,7 @@ namespace Jitter
 	protected:
 		typedef std::map<uint32, CX86Assembler::LABEL> LabelMapType;
 		typedef std::vector<std::pair<uintptr_t, CX86Assembler::LABEL>> SymbolReferenceLabelArray;
+		typedef std::vector<std::function<void ()>> ColdPathEmitterArray;
 
 		//ALUOP ----------------------------------------------------------
 		struct ALUOP_BASE
@@ -81,6 +82,12 @@ namespace Jitter
 			static OpVarType OpVar() { return &CX86Assembler::ShlEd; }
 		};
 
+		struct SHIFTOP_ROR : public SHIFTOP_BASE
+		{
+			static OpCstType OpCst() { return &CX86Assembler::RorEd; }
+			static OpVarType OpVar() { return &CX86Assembler::RorEd; }
+		};
+
 		//FPUOP -----------------------------------------------------------
 		struct FPUOP_BASE
 		{
@@ -132,6 +139,77 @@ namespace Jitter
 			static OpEdType OpEd() { return &CX86Assembler::RcpssEd; }
 		};
 
+		struct FPUDOP_ADD : public FPUOP_BASE
+		{
+			static OpEdType OpEd() { return &CX86Assembler::AddsdEd; }
+		};
+
+		struct FPUDOP_SUB : public FPUOP_BASE
+		{
+			static OpEdType OpEd() { return &CX86Assembler::SubsdEd; }
+		};
+
+		struct FPUDOP_MUL : public FPUOP_BASE
+		{
+			static OpEdType OpEd() { return &CX86Assembler::MulsdEd; }
+		};
+
+		struct FPUDOP_DIV : public FPUOP_BASE
+		{
+			static OpEdType OpEd() { return &CX86Assembler::DivsdEd; }
+		};
+
+		struct FPUDOP_MAX : public FPUOP_BASE
+		{
+			static OpEdType OpEd() { return &CX86Assembler::MaxsdEd; }
+		};
+
+		struct FPUDOP_MIN : public FPUOP_BASE
+		{
+			static OpEdType OpEd() { return &CX86Assembler::MinsdEd; }
+		};
+
+		struct FPUDOP_SQRT : public FPUOP_BASE
+		{
+			static OpEdType OpEd() { return &CX86Assembler::SqrtsdEd; }
+		};
+
+		//FMAOP -----------------------------------------------------------
+		struct FMAOP_BASE
+		{
+			typedef void (CX86Assembler::*OpType)(CX86Assembler::XMMREGISTER, CX86Assembler::XMMREGISTER, const CX86Assembler::CAddress&);
+		};
+
+		struct FMAOP_MADDS : public FMAOP_BASE
+		{
+			static OpType Op() { return &CX86Assembler::Vfmadd231ssEd; }
+		};
+
+		struct FMAOP_MSUBS : public FMAOP_BASE
+		{
+			static OpType Op() { return &CX86Assembler::Vfnmadd231ssEd; }
+		};
+
+		struct FMAOP_MADDD : public FMAOP_BASE
+		{
+			static OpType Op() { return &CX86Assembler::Vfmadd231sdEd; }
+		};
+
+		struct FMAOP_MSUBD : public FMAOP_BASE
+		{
+			static OpType Op() { return &CX86Assembler::Vfnmadd231sdEd; }
+		};
+
+		struct FMAOP_MADDPS : public FMAOP_BASE
+		{
+			static OpType Op() { return &CX86Assembler::Vfmadd231psVo; }
+		};
+
+		struct FMAOP_MSUBPS : public FMAOP_BASE
+		{
+			static OpType Op() { return &CX86Assembler::Vfnmadd231psVo; }
+		};
+
 		//MDOP -----------------------------------------------------------
 		struct MDOP_BASE
 		{
@@ -248,6 +326,31 @@ namespace Jitter
 			static OpVoType OpVo() { return &CX86Assembler::PmaxsdVo; }
 		};
 
+		struct MDOP_MULH : public MDOP_BASE
+		{
+			static OpVoType OpVo() { return &CX86Assembler::PmullwVo; }
+		};
+
+		struct MDOP_MULW : public MDOP_BASE
+		{
+			static OpVoType OpVo() { return &CX86Assembler::PmulldVo; }
+		};
+
+		struct MDOP_MULHIH : public MDOP_BASE
+		{
+			static OpVoType OpVo() { return &CX86Assembler::PmulhwVo; }
+		};
+
+		struct MDOP_MULEVENUWD : public MDOP_BASE
+		{
+			static OpVoType OpVo() { return &CX86Assembler::PmuludqVo; }
+		};
+
+		struct MDOP_MULADDPAIRSHW : public MDOP_BASE
+		{
+			static OpVoType OpVo() { return &CX86Assembler::PmaddwdVo; }
+		};
+
 		struct MDOP_AND : public MDOP_BASE
 		{
 			static OpVoType OpVo() { return &CX86Assembler::PandVo; }
@@ -401,6 +504,72 @@ namespace Jitter
 			static OpEdType OpEd() { return &CCodeGen_x86::Emit_Md_IsZero; }
 		};
 
+		//MDOP256 --------------------------------------------------------
+		struct MDOP256_BASE
+		{
+			typedef void (CX86Assembler::*OpType)(CX86Assembler::XMMREGISTER, CX86Assembler::XMMREGISTER, const CX86Assembler::CAddress&);
+		};
+
+		struct MDOP256_ADDB : public MDOP256_BASE
+		{
+			static OpType Op() { return &CX86Assembler::VpaddbVqq; }
+		};
+
+		struct MDOP256_ADDH : public MDOP256_BASE
+		{
+			static OpType Op() { return &CX86Assembler::VpaddwVqq; }
+		};
+
+		struct MDOP256_ADDW : public MDOP256_BASE
+		{
+			static OpType Op() { return &CX86Assembler::VpadddVqq; }
+		};
+
+		struct MDOP256_SUBB : public MDOP256_BASE
+		{
+			static OpType Op() { return &CX86Assembler::VpsubbVqq; }
+		};
+
+		struct MDOP256_SUBH : public MDOP256_BASE
+		{
+			static OpType Op() { return &CX86Assembler::VpsubwVqq; }
+		};
+
+		struct MDOP256_SUBW : public MDOP256_BASE
+		{
+			static OpType Op() { return &CX86Assembler::VpsubdVqq; }
+		};
+
+		struct MDOP256_AND : public MDOP256_BASE
+		{
+			static OpType Op() { return &CX86Assembler::VpandVqq; }
+		};
+
+		struct MDOP256_OR : public MDOP256_BASE
+		{
+			static OpType Op() { return &CX86Assembler::VporVqq; }
+		};
+
+		struct MDOP256_XOR : public MDOP256_BASE
+		{
+			static OpType Op() { return &CX86Assembler::VpxorVqq; }
+		};
+
+		struct MDOP256_ADDS : public MDOP256_BASE
+		{
+			static OpType Op() { return &CX86Assembler::VaddpsVqq; }
+		};
+
+		struct MDOP256_SUBS : public MDOP256_BASE
+		{
+			static OpType Op() { return &CX86Assembler::VsubpsVqq; }
+		};
+
+		struct MDOP256_MULS : public MDOP256_BASE
+		{
+			static OpType Op() { return &CX86Assembler::VmulpsVqq; }
+		};
+
 		virtual void				Emit_Prolog(const StatementList&, unsigned int, uint32) = 0;
 		virtual void				Emit_Epilog(unsigned int, uint32) = 0;
 
@@ -428,6 +597,9 @@ namespace Jitter
 		CX86Assembler::CAddress		MakeRelativeFpSingleSymbolAddress(CSymbol*);
 		CX86Assembler::CAddress		MakeTemporaryFpSingleSymbolAddress(CSymbol*);
 		CX86Assembler::CAddress		MakeMemoryFpSingleSymbolAddress(CSymbol*);
+		CX86Assembler::CAddress		MakeRelativeFpDoubleSymbolAddress(CSymbol*);
+		CX86Assembler::CAddress		MakeTemporaryFpDoubleSymbolAddress(CSymbol*);
+		CX86Assembler::CAddress		MakeMemoryFpDoubleSymbolAddress(CSymbol*);
 
 		CX86Assembler::CAddress		MakeRelative128SymbolElementAddress(CSymbol*, unsigned int);
 		CX86Assembler::CAddress		MakeTemporary128SymbolElementAddress(CSymbol*, unsigned int);
@@ -437,6 +609,13 @@ namespace Jitter
 		CX86Assembler::CAddress		MakeMemory128SymbolElementAddress(CSymbol*, unsigned int);
 
 		CX86Assembler::CAddress		MakeTemporary256SymbolElementAddress(CSymbol*, unsigned int);
+		CX86Assembler::CAddress		MakeMemory256SymbolAddress(CSymbol*);
+		CX86Assembler::CAddress		MakeVariable256SymbolAddress(CSymbol*);
+
+		//Saving MD registers around calls made by statements, registers holding 256-bits values are saved whole
+		uint32						GetSavedMdRegistersSize() const;
+		void						SaveMdRegisters(uint32);
+		void						RestoreMdRegisters(uint32);
 
 		//LABEL
 		void						MarkLabel(const STATEMENT&);
@@ -493,6 +672,29 @@ namespace Jitter
 		void						Emit_Lzc_RegVar(const STATEMENT&);
 		void						Emit_Lzc_MemVar(const STATEMENT&);
 
+		//SEXT/ZEXT
+		void						Emit_Ext(CX86Assembler::REGISTER, const STATEMENT&);
+		void						Emit_Ext_RegVar(const STATEMENT&);
+		void						Emit_Ext_MemVar(const STATEMENT&);
+
+		//BSWAP
+		void						Emit_ByteSwap_RegVar(const STATEMENT&);
+		void						Emit_ByteSwap_MemVar(const STATEMENT&);
+
+		//POPCNT
+		void						Emit_PopCount(CX86Assembler::REGISTER, const CX86Assembler::CAddress&);
+		void						Emit_PopCount_RegVar(const STATEMENT&);
+		void						Emit_PopCount_MemVar(const STATEMENT&);
+		void						Emit_PopCount_Popcnt_RegVar(const STATEMENT&);
+		void						Emit_PopCount_Popcnt_MemVar(const STATEMENT&);
+
+		//CTZ
+		void						Emit_Ctz(CX86Assembler::REGISTER, const CX86Assembler::CAddress&);
+		void						Emit_Ctz_RegVar(const STATEMENT&);
+		void						Emit_Ctz_MemVar(const STATEMENT&);
+		void						Emit_Ctz_Bmi1_RegVar(const STATEMENT&);
+		void						Emit_Ctz_Bmi1_MemVar(const STATEMENT&);
+
 		//CMP
 		void						Cmp_GetFlag(const CX86Assembler::CAddress&, CONDITION);
 		void						Emit_Cmp_RegRegReg(const STATEMENT&);
@@ -557,10 +759,18 @@ namespace Jitter
 		void						Emit_ExtHigh64RegTmp64(const STATEMENT&);
 		void						Emit_ExtHigh64MemTmp64(const STATEMENT&);
 
+		//SEXTTO64/ZEXTTO64
+		void						Emit_SignExtTo64_Mem64Var(const STATEMENT&);
+		void						Emit_ZeroExtTo64_Mem64Var(const STATEMENT&);
+
 		//FPUOP
 		template <typename> void	Emit_Fpu_MemMem(const STATEMENT&);
 		template <typename> void	Emit_Fpu_MemMemMem(const STATEMENT&);
 
+		//FP_MADD/FP_MSUB
+		template <typename> void	Emit_Fp_MulAcc_MemMemMem(const STATEMENT&);
+		template <typename> void	Emit_Fp_FusedMulAcc_MemMemMem(const STATEMENT&);
+
 		//FPCMP
 		CX86Assembler::SSE_CMP_TYPE	GetSseConditionCode(Jitter::CONDITION);
 		void						Emit_Fp_Cmp_MemMem(CX86Assembler::REGISTER, const STATEMENT&);
@@ -581,9 +791,34 @@ namespace Jitter
 		//FP_TOINT_TRUNC
 		void						Emit_Fp_ToIntTrunc_RelRel(const STATEMENT&);
 
+		//FP_TOINT/FP_TOINT_SAT/FP_ROUND
+		void						Emit_Fp_ToInt_MemMemCst(const STATEMENT&);
+		void						Emit_Fp_ToIntSat_MemMemCst(const STATEMENT&);
+		void						Emit_Fp_Round_MemMemCst(const STATEMENT&);
+
 		//FP_LDCST
 		void						Emit_Fp_LdCst_MemCst(const STATEMENT&);
 
+		//FP_TODOUBLE/FP_TOSINGLE
+		void						Emit_Fp_ToDouble_MemMem(const STATEMENT&);
+		void						Emit_Fp_ToSingle_MemMem(const STATEMENT&);
+
+		//FPUDOP
+		template <typename> void	Emit_FpuD_MemMem(const STATEMENT&);
+		template <typename> void	Emit_FpuD_MemMemMem(const STATEMENT&);
+		void						Emit_FpD_Cmp_MemMem(CX86Assembler::REGISTER, const STATEMENT&);
+		void						Emit_FpD_Cmp_SymMemMem(const STATEMENT&);
+		void						Emit_FpD_Abs_MemMem(const STATEMENT&);
+		void						Emit_FpD_Neg_MemMem(const STATEMENT&);
+		void						Emit_FpD_Rcpl_MemMem(const STATEMENT&);
+		void						Emit_FpD_Rsqrt_MemMem(const STATEMENT&);
+		void						Emit_FpD_Mov_MemMem(const STATEMENT&);
+		void						Emit_FpD_Mov_RelDRelI32(const STATEMENT&);
+		void						Emit_FpD_ToIntTrunc_RelRel(const STATEMENT&);
+		void						Emit_FpD_LdCst_MemCst(const STATEMENT&);
+		template <typename> void	Emit_FpD_MulAcc_MemMemMem(const STATEMENT&);
+		template <typename> void	Emit_FpD_FusedMulAcc_MemMemMem(const STATEMENT&);
+
 		//MDOP
 		template <typename> void	Emit_Md_RegVar(const STATEMENT&);
 		template <typename> void	Emit_Md_MemVar(const STATEMENT&);
@@ -592,6 +827,8 @@ namespace Jitter
 		template <typename> void	Emit_Md_RegVarVar(const STATEMENT&);
 		template <typename> void	Emit_Md_MemVarVar(const STATEMENT&);
 		template <typename> void	Emit_Md_VarVarVarRev(const STATEMENT&);
+		template <typename> void	Emit_Md_MulAcc_VarVarVarVar(const STATEMENT&);
+		template <typename> void	Emit_Md_FusedMulAcc_VarVarVarVar(const STATEMENT&);
 		template <typename, uint8> void
 									Emit_Md_Shift_RegVarCst(const STATEMENT&);
 		template <typename, uint8> void
@@ -603,6 +840,7 @@ namespace Jitter
 		void						Emit_Md_SubSSW_VarVarVar(const STATEMENT&);
 		void						Emit_Md_MinW_VarVarVar(const STATEMENT&);
 		void						Emit_Md_MaxW_VarVarVar(const STATEMENT&);
+		void						Emit_Md_MulW_VarVarVar(const STATEMENT&);
 		void						Emit_Md_PackHB_VarVarVar(const STATEMENT&);
 		void						Emit_Md_PackWH_VarVarVar(const STATEMENT&);
 		void						Emit_Md_Mov_RegVar(const STATEMENT&);
@@ -617,6 +855,15 @@ namespace Jitter
 		void						Emit_Md_Expand_MemReg(const STATEMENT&);
 		void						Emit_Md_Expand_MemMem(const STATEMENT&);
 		void						Emit_Md_Expand_MemCst(const STATEMENT&);
+		void						Emit_Md_Shuffle_RegVarCst(const STATEMENT&);
+		void						Emit_Md_Shuffle_MemVarCst(const STATEMENT&);
+		void						Emit_Md_InsertW_VarVarVar(const STATEMENT&);
+		void						Emit_Md_InsertW_Sse41_VarVarVar(const STATEMENT&);
+		void						Emit_Md_ExtractW_VarRegCst(const STATEMENT&);
+		void						Emit_Md_ExtractW_VarMemCst(const STATEMENT&);
+		void						Emit_Md_ToWord_VarVarCst(const STATEMENT&);
+		void						Emit_Md_ToWordSat_VarVarCst(const STATEMENT&);
+		void						Emit_Md_Round_VarVarCst(const STATEMENT&);
 
 		void						Emit_MergeTo256_MemVarVar(const STATEMENT&);
 
@@ -624,17 +871,41 @@ namespace Jitter
 		void						Emit_Md_Srl256_VarMemVar(const STATEMENT&);
 		void						Emit_Md_Srl256_VarMemCst(const STATEMENT&);
 
+		//MDOP256
+		template <typename> void	Emit_Md256_VarVarVar(const STATEMENT&);
+		void						Emit_Md256_Mov_VarVar(const STATEMENT&);
+		void						Emit_MergeTo256_Avx2_RegVarVar(const STATEMENT&);
+		void						Emit_Md_Srl256_Avx2_VarVarCst(const STATEMENT&);
+		static bool					UsesYmmRegisters(const STATEMENT&);
+		static std::vector<uint32>	GetLiveMd256Registers(const StatementList&);
+
 		void						Emit_Md_Abs(CX86Assembler::XMMREGISTER);
 		void						Emit_Md_Not(CX86Assembler::XMMREGISTER);
 		void						Emit_Md_IsZero(CX86Assembler::REGISTER, const CX86Assembler::CAddress&);
 		void						Emit_Md_IsNegative(CX86Assembler::REGISTER, const CX86Assembler::CAddress&);
+		void						Emit_Md_LoadConstant(CX86Assembler::XMMREGISTER, uint32);
+		void						Emit_Md_ToWord(CX86Assembler::XMMREGISTER, ROUNDMODE);
+		void						Emit_Md_ToWordSat(CX86Assembler::XMMREGISTER, ROUNDMODE);
+		void						Emit_Md_Round(CX86Assembler::XMMREGISTER, ROUNDMODE);
+		static uint8				GetSseRoundingMode(ROUNDMODE);
 
 		CX86Assembler				m_assembler;
 		CX86Assembler::REGISTER*	m_registers = nullptr;
 		CX86Assembler::XMMREGISTER*	m_mdRegisters = nullptr;
 		LabelMapType				m_labels;
 		SymbolReferenceLabelArray	m_symbolReferenceLabels;
+		ColdPathEmitterArray		m_coldPathEmitters;
+		uint32						m_mdRegisterUsage = 0;
+		uint32						m_md256RegisterUsage = 0;
 		uint32						m_stackLevel = 0;
+		bool						m_hasSse3 = false;
+		bool						m_hasSse41 = false;
+		bool						m_hasFma = false;
+		bool						m_hasPopcnt = false;
+		bool						m_hasBmi1 = false;
+		bool						m_hasAvx2 = false;
+		//Set by statements leaving upper halves of ymm registers dirty, cleared by the next Vzeroupper
+		bool						m_upperYmmDirty = false;
 		
 	private:
 		typedef void (CCodeGen_x86::*ConstCodeEmitterType)(const STATEMENT&);
@@ -650,14 +921,32 @@ namespace Jitter
 
 		void						InsertMatchers(const CONSTMATCHER*);
 		void						SetGenerationFlags();
-		
-		bool						m_hasSse41 = false;
 
 		static CONSTMATCHER			g_constMatchers[];
 		static CONSTMATCHER			g_fpuConstMatchers[];
 		static CONSTMATCHER			g_mdConstMatchers[];
 
+		static CONSTMATCHER			g_popCountConstMatchers[];
+		static CONSTMATCHER			g_popCountPopcntConstMatchers[];
+
+		static CONSTMATCHER			g_ctzConstMatchers[];
+		static CONSTMATCHER			g_ctzBmi1ConstMatchers[];
+
 		static CONSTMATCHER			g_mdMinMaxWConstMatchers[];
 		static CONSTMATCHER			g_mdMinMaxWSse41ConstMatchers[];
+
+		static CONSTMATCHER			g_mdInsertWConstMatchers[];
+		static CONSTMATCHER			g_mdInsertWSse41ConstMatchers[];
+
+		static CONSTMATCHER			g_mdMulWConstMatchers[];
+		static CONSTMATCHER			g_mdMulWSse41ConstMatchers[];
+
+		static CONSTMATCHER			g_fpuFusedMulAddConstMatchers[];
+		static CONSTMATCHER			g_fpuFusedMulAddFmaConstMatchers[];
+		static CONSTMATCHER			g_mdFusedMulAddConstMatchers[];
+		static CONSTMATCHER			g_mdFusedMulAddFmaConstMatchers[];
+
+		static CONSTMATCHER			g_md256ConstMatchers[];
+		static CONSTMATCHER			g_md256Avx2ConstMatchers[];
 	};
 }
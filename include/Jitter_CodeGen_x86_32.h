@@ -16,6 +16,9 @@ namespace Jitter
 		unsigned int						GetAvailableRegisterCount() const override;
 		unsigned int						GetAvailableMdRegisterCount() const override;
 		bool								CanHold128BitsReturnValueInRegisters() const override;
+		bool								CanHandle256BitsMdOperations() const override;
+		std::string							GetConfigurationName() const override;
+		void								RegisterExternalSymbols(CObjectFile*) const override;
 		
 	protected:
 		enum SHIFTRIGHT_TYPE
@@ -61,8 +64,21 @@ namespace Jitter
 		void								Emit_Sub64_MemMemCst(const STATEMENT&);
 		void								Emit_Sub64_MemCstMem(const STATEMENT&);
 
-		//AND64
-		void								Emit_And64_MemMemMem(const STATEMENT&);
+		//LOGIC64
+		template <typename> void			Logic64_MemAny(CSymbol*, CSymbol*, CSymbol*);
+		template <typename> void			Emit_Logic64_MemMemAny(const STATEMENT&);
+		template <typename> void			Emit_Logic64_MemCstMem(const STATEMENT&);
+
+		//NOT64
+		void								Emit_Not64_MemMem(const STATEMENT&);
+
+		//MUL64
+		void								Mul64_MemAny(CSymbol*, CSymbol*, CSymbol*);
+		void								Emit_Mul64_MemMemAny(const STATEMENT&);
+		void								Emit_Mul64_MemCstMem(const STATEMENT&);
+
+		//DIV64
+		template <bool> void				Emit_Div64_MemAnyAny(const STATEMENT&);
 
 		//SR64
 		void								Emit_Sr64Var_MemMem(CSymbol*, CSymbol*, CX86Assembler::REGISTER, SHIFTRIGHT_TYPE);
@@ -84,6 +100,12 @@ namespace Jitter
 		void								Emit_Sll64_MemMemMem(const STATEMENT&);
 		void								Emit_Sll64_MemMemCst(const STATEMENT&);
 
+		//ROR64
+		void								Emit_Ror64_MemMemVar(const STATEMENT&, CX86Assembler::REGISTER);
+		void								Emit_Ror64_MemMemReg(const STATEMENT&);
+		void								Emit_Ror64_MemMemMem(const STATEMENT&);
+		void								Emit_Ror64_MemMemCst(const STATEMENT&);
+
 		//CMP64
 		void								Cmp64_Equal(const STATEMENT&);
 		template <typename> void			Cmp64_Order(const STATEMENT&);
@@ -107,6 +129,8 @@ namespace Jitter
 		void								Emit_LoadFromRef_MemTmp(const STATEMENT&);
 		void								Emit_LoadFromRef_Md_RegMem(const STATEMENT&);
 		void								Emit_LoadFromRef_Md_MemMem(const STATEMENT&);
+		void								Emit_LoadFromRef_64_MemMem(const STATEMENT&);
+		void								Emit_LoadSizedFromRef_VarMem(const STATEMENT&);
 
 		//STOREATREF
 		void								Emit_StoreAtRef_TmpReg(const STATEMENT&);
@@ -114,6 +138,24 @@ namespace Jitter
 		void								Emit_StoreAtRef_TmpCst(const STATEMENT&);
 		void								Emit_StoreAtRef_Md_MemReg(const STATEMENT&);
 		void								Emit_StoreAtRef_Md_MemMem(const STATEMENT&);
+		void								Emit_StoreAtRef_64_MemMem(const STATEMENT&);
+		void								Emit_StoreAtRef_64_MemCst(const STATEMENT&);
+		void								Emit_StoreSizedAtRef_MemVar(const STATEMENT&);
+		void								Emit_StoreSizedAtRef_MemCst(const STATEMENT&);
+
+		//LOADFROMTLB
+		void								LoadFromTlb(const STATEMENT&);
+		void								Emit_LoadFromTlb_VarVar(const STATEMENT&);
+		void								Emit_LoadFromTlb_VarCst(const STATEMENT&);
+
+		//INCCOUNTER
+		void								Emit_IncCounter(const STATEMENT&);
+
+		//FP_TOINT64_TRUNC/FP_FROMINT64
+		void								Fp_StoreInt64Trunc(CSymbol*);
+		void								Emit_Fp_ToInt64Trunc_Mem64MemS(const STATEMENT&);
+		void								Emit_Fp_ToInt64Trunc_Mem64MemD(const STATEMENT&);
+		void								Emit_Fp_FromInt64_MemDMem64(const STATEMENT&);
 
 	private:
 		struct CALL_STATE
@@ -22,6 +22,9 @@ namespace Jitter
 		unsigned int						GetAvailableRegisterCount() const override;
 		unsigned int						GetAvailableMdRegisterCount() const override;
 		bool								CanHold128BitsReturnValueInRegisters() const override;
+		bool								CanHandle256BitsMdOperations() const override;
+		std::string							GetConfigurationName() const override;
+		bool								PatchExternalSymbolReference(uint8*, uint32, uintptr_t) const override;
 
 	protected:
 		//ALUOP64 ----------------------------------------------------------
@@ -49,6 +52,24 @@ namespace Jitter
 			static OpEqType OpEq() { return &CX86Assembler::AndEq; }
 		};
 
+		struct ALUOP64_OR : public ALUOP64_BASE
+		{
+			static OpIqType OpIq() { return &CX86Assembler::OrIq; }
+			static OpEqType OpEq() { return &CX86Assembler::OrEq; }
+		};
+
+		struct ALUOP64_XOR : public ALUOP64_BASE
+		{
+			static OpIqType OpIq() { return &CX86Assembler::XorIq; }
+			static OpEqType OpEq() { return &CX86Assembler::XorEq; }
+		};
+
+		//No immediate form, constants are handled by Emit_Mul64_MemMemCst
+		struct ALUOP64_MUL : public ALUOP64_BASE
+		{
+			static OpEqType OpEq() { return &CX86Assembler::ImulEq; }
+		};
+
 		//SHIFTOP64 ----------------------------------------------------------
 		struct SHIFTOP64_BASE
 		{
@@ -74,6 +95,12 @@ namespace Jitter
 			static OpVarType OpVar() { return &CX86Assembler::SarEq; }
 		};
 
+		struct SHIFTOP64_ROR : public SHIFTOP64_BASE
+		{
+			static OpCstType OpCst() { return &CX86Assembler::RorEq; }
+			static OpVarType OpVar() { return &CX86Assembler::RorEq; }
+		};
+
 		virtual void						Emit_Prolog(const StatementList&, unsigned int, uint32) override;
 		virtual void						Emit_Epilog(unsigned int, uint32) override;
 
@@ -99,17 +126,29 @@ namespace Jitter
 
 		//MOV
 		void								Emit_Mov_Mem64Mem64(const STATEMENT&);
-		void								Emit_Mov_Rel64Cst64(const STATEMENT&);
+		void								Emit_Mov_Mem64Cst64(const STATEMENT&);
 
 		//ALU64
 		template <typename> void			Emit_Alu64_MemMemMem(const STATEMENT&);
 		template <typename> void			Emit_Alu64_MemMemCst(const STATEMENT&);
 		template <typename> void			Emit_Alu64_MemCstMem(const STATEMENT&);
 
+		//NOT64
+		void								Emit_Not64_MemMem(const STATEMENT&);
+
+		//MUL64
+		void								Emit_Mul64_MemMemCst(const STATEMENT&);
+
+		//DIV64
+		template <bool> void				Div64(CSymbol*, const CX86Assembler::CAddress&);
+		template <bool> void				Emit_Div64_MemMemMem(const STATEMENT&);
+		template <bool> void				Emit_Div64_MemMemCst(const STATEMENT&);
+		template <bool> void				Emit_Div64_MemCstMem(const STATEMENT&);
+
 		//SHIFT64
-		template <typename> void			Emit_Shift64_RelRelReg(const STATEMENT&);
-		template <typename> void			Emit_Shift64_RelRelMem(const STATEMENT&);
-		template <typename> void			Emit_Shift64_RelRelCst(const STATEMENT&);
+		template <typename> void			Emit_Shift64_MemMemReg(const STATEMENT&);
+		template <typename> void			Emit_Shift64_MemMemMem(const STATEMENT&);
+		template <typename> void			Emit_Shift64_MemMemCst(const STATEMENT&);
 
 		//CMP64
 		void								Cmp64_RelRel(CX86Assembler::REGISTER, const STATEMENT&);
@@ -134,6 +173,8 @@ namespace Jitter
 		void								Emit_LoadFromRef_MemMem(const STATEMENT&);
 		void								Emit_LoadFromRef_Md_RegMem(const STATEMENT&);
 		void								Emit_LoadFromRef_Md_MemMem(const STATEMENT&);
+		void								Emit_LoadFromRef_64_MemMem(const STATEMENT&);
+		void								Emit_LoadSizedFromRef_VarMem(const STATEMENT&);
 
 		//STOREATREF
 		void								Emit_StoreAtRef_MemReg(const STATEMENT&);
@@ -141,6 +182,23 @@ namespace Jitter
 		void								Emit_StoreAtRef_MemCst(const STATEMENT&);
 		void								Emit_StoreAtRef_Md_MemReg(const STATEMENT&);
 		void								Emit_StoreAtRef_Md_MemMem(const STATEMENT&);
+		void								Emit_StoreAtRef_64_MemMem(const STATEMENT&);
+		void								Emit_StoreAtRef_64_MemCst(const STATEMENT&);
+		void								Emit_StoreSizedAtRef_MemVar(const STATEMENT&);
+		void								Emit_StoreSizedAtRef_MemCst(const STATEMENT&);
+
+		//LOADFROMTLB
+		void								LoadFromTlb(const STATEMENT&);
+		void								Emit_LoadFromTlb_VarVar(const STATEMENT&);
+		void								Emit_LoadFromTlb_VarCst(const STATEMENT&);
+
+		//INCCOUNTER
+		void								Emit_IncCounter(const STATEMENT&);
+
+		//FP_TOINT64_TRUNC/FP_FROMINT64
+		void								Emit_Fp_ToInt64Trunc_Mem64MemS(const STATEMENT&);
+		void								Emit_Fp_ToInt64Trunc_Mem64MemD(const STATEMENT&);
+		void								Emit_Fp_FromInt64_MemDMem64(const STATEMENT&);
 
 	private:
 		typedef void (CCodeGen_x86_64::*ConstCodeEmitterType)(const STATEMENT&);
@@ -31,21 +31,49 @@ namespace Jitter
 
 		OP_LZC,
 
+		OP_SEXT8,
+		OP_SEXT16,
+		OP_ZEXT8,
+		OP_ZEXT16,
+
+		OP_ROR,
+		OP_BSWAP,
+		OP_POPCNT,
+		OP_CTZ,
+
 		OP_RELTOREF,
 		OP_ADDREF,
 		OP_LOADFROMREF,
 		OP_STOREATREF,
+		OP_LOAD8FROMREF,
+		OP_LOAD8SFROMREF,
+		OP_LOAD16FROMREF,
+		OP_LOAD16SFROMREF,
+		OP_STORE8ATREF,
+		OP_STORE16ATREF,
+		OP_LOADFROMTLB,
+
+		OP_INCCOUNTER,
 
 		OP_ADD64,
 		OP_SUB64,
 		OP_AND64,
+		OP_OR64,
+		OP_XOR64,
+		OP_NOT64,
+		OP_MUL64,
+		OP_DIV64,
+		OP_DIVS64,
 		OP_CMP64,
 		OP_MERGETO64,
 		OP_EXTLOW64,
 		OP_EXTHIGH64,
+		OP_SEXTTO64,
+		OP_ZEXTTO64,
 		OP_SRA64,
 		OP_SRL64,
 		OP_SLL64,
+		OP_ROR64,
 
 		OP_MERGETO256,
 
@@ -84,6 +112,15 @@ namespace Jitter
 		OP_MD_MAX_H,
 		OP_MD_MAX_W,
 
+		OP_MD_MUL_H,
+		OP_MD_MUL_W,
+		//High halves of the signed products
+		OP_MD_MULHI_H,
+		//Unsigned 64-bit products of lanes 0 and 2
+		OP_MD_MULEVEN_UWD,
+		//Signed products of halfwords, adjacent products are added into words
+		OP_MD_MULADDPAIRS_HW,
+
 		OP_MD_AND,
 		OP_MD_OR,
 		OP_MD_XOR,
@@ -103,6 +140,10 @@ namespace Jitter
 		OP_MD_ISZERO,
 
 		OP_MD_TOWORD_TRUNCATE,
+		//src2 is a constant ROUNDMODE for these
+		OP_MD_TOWORD,
+		OP_MD_TOWORD_SAT,
+		OP_MD_ROUND,
 		OP_MD_TOSINGLE,
 
 		OP_MD_EXPAND,
@@ -117,6 +158,13 @@ namespace Jitter
 		OP_MD_PACK_HB,
 		OP_MD_PACK_WH,
 
+		//src2 is a constant lane selector (2 bits per destination lane, same layout as pshufd)
+		OP_MD_SHUFFLE_W,
+		//dst = src1 with a lane replaced by a lane from src2, src3 is a constant ((srcLane << 2) | dstLane)
+		OP_MD_INSERT_W,
+		//dst (32-bits) = lane of src1, src2 is the constant lane index
+		OP_MD_EXTRACT_W,
+
 		OP_MD_ADD_S,
 		OP_MD_SUB_S,
 		OP_MD_MUL_S,
@@ -125,10 +173,21 @@ namespace Jitter
 		OP_MD_MIN_S,
 		OP_MD_MAX_S,
 
+		//dst = src1 + (src2 * src3) and dst = src1 - (src2 * src3), the product is rounded for MADD/MSUB
+		OP_MD_MADD_S,
+		OP_MD_MSUB_S,
+		OP_MD_FMADD_S,
+		OP_MD_FMSUB_S,
+
 		OP_FP_ADD,
 		OP_FP_SUB,
 		OP_FP_MUL,
 		OP_FP_DIV,
+		//Same operand layout as the OP_MD_*MADD_S/*MSUB_S operations
+		OP_FP_MADD,
+		OP_FP_MSUB,
+		OP_FP_FMADD,
+		OP_FP_FMSUB,
 		OP_FP_SQRT,
 		OP_FP_RSQRT,
 		OP_FP_RCPL,
@@ -140,6 +199,14 @@ namespace Jitter
 
 		OP_FP_LDCST,
 		OP_FP_TOINT_TRUNC,
+		//src2 is a constant ROUNDMODE for these
+		OP_FP_TOINT,
+		OP_FP_TOINT_SAT,
+		OP_FP_ROUND,
+		OP_FP_TOINT64_TRUNC,
+		OP_FP_FROMINT64,
+		OP_FP_TOSINGLE,
+		OP_FP_TODOUBLE,
 
 		OP_PARAM,
 		OP_PARAM_RET,
@@ -152,6 +219,14 @@ namespace Jitter
 		OP_LABEL,
 	};
 
+	enum ROUNDMODE
+	{
+		ROUND_NEAREST = 0,
+		ROUND_PLUSINFINITY = 1,
+		ROUND_MINUSINFINITY = 2,
+		ROUND_TRUNCATE = 3
+	};
+
 	enum CONDITION
 	{
 		CONDITION_NEVER = 0,
@@ -181,6 +256,7 @@ namespace Jitter
 		OPERATION		op;
 		SymbolRefPtr	src1;
 		SymbolRefPtr	src2;
+		SymbolRefPtr	src3;
 		SymbolRefPtr	dst;
 		uint32			jmpBlock;
 		CONDITION		jmpCondition;
@@ -193,6 +269,7 @@ namespace Jitter
 			if(dst) visitor(dst, true);
 			if(src1) visitor(src1, false);
 			if(src2) visitor(src2, false);
+			if(src3) visitor(src3, false);
 		}
 
 		void VisitOperands(const ConstOperandVisitor& visitor) const
@@ -200,6 +277,7 @@ namespace Jitter
 			if(dst) visitor(dst, true);
 			if(src1) visitor(src1, false);
 			if(src2) visitor(src2, false);
+			if(src3) visitor(src3, false);
 		}
 
 		void VisitDestination(const ConstOperandVisitor& visitor) const
@@ -211,6 +289,7 @@ namespace Jitter
 		{
 			if(src1) visitor(src1, false);
 			if(src2) visitor(src2, false);
+			if(src3) visitor(src3, false);
 		}
 	};
 
@@ -29,11 +29,16 @@ namespace Jitter
 		SYM_TEMPORARY128,
 		SYM_REGISTER128,
 
+		SYM_RELATIVE256,
 		SYM_TEMPORARY256,
+		SYM_REGISTER256,
 
 		SYM_FP_REL_SINGLE,
 		SYM_FP_TMP_SINGLE,
 
+		SYM_FP_REL_DOUBLE,
+		SYM_FP_TMP_DOUBLE,
+
 		SYM_FP_REL_INT32,
 	};
 
@@ -94,6 +99,12 @@ namespace Jitter
 			case SYM_FP_TMP_SINGLE:
 				return "TMP(FP_S)[" + std::to_string(m_valueLow) + "]";
 				break;
+			case SYM_FP_REL_DOUBLE:
+				return "REL(FP_D)[" + std::to_string(m_valueLow) + "]";
+				break;
+			case SYM_FP_TMP_DOUBLE:
+				return "TMP(FP_D)[" + std::to_string(m_valueLow) + "]";
+				break;
 			case SYM_RELATIVE128:
 				return "REL128[" + std::to_string(m_valueLow) + "]";
 				break;
@@ -103,9 +114,15 @@ namespace Jitter
 			case SYM_REGISTER128:
 				return "REG128[" + std::to_string(m_valueLow) + "]";
 				break;
+			case SYM_RELATIVE256:
+				return "REL256[" + std::to_string(m_valueLow) + "]";
+				break;
 			case SYM_TEMPORARY256:
 				return "TMP256[" + std::to_string(m_valueLow) + "]";
 				break;
+			case SYM_REGISTER256:
+				return "REG256[" + std::to_string(m_valueLow) + "]";
+				break;
 			default:
 				return "";
 				break;
@@ -131,6 +148,7 @@ namespace Jitter
 			case SYM_TEMPORARY128:
 				return 16;
 				break;
+			case SYM_RELATIVE256:
 			case SYM_TEMPORARY256:
 				return 32;
 				break;
@@ -139,6 +157,10 @@ namespace Jitter
 			case SYM_FP_REL_INT32:
 				return 4;
 				break;
+			case SYM_FP_REL_DOUBLE:
+			case SYM_FP_TMP_DOUBLE:
+				return 8;
+				break;
 			case SYM_REL_REFERENCE:
 			case SYM_TMP_REFERENCE:
 				return sizeof(void*);
@@ -154,7 +176,8 @@ namespace Jitter
 		{
 			return
 				(m_type == SYM_REGISTER) ||
-				(m_type == SYM_REGISTER128);
+				(m_type == SYM_REGISTER128) ||
+				(m_type == SYM_REGISTER256);
 		}
 
 		bool IsRelative() const
@@ -163,8 +186,10 @@ namespace Jitter
 				(m_type == SYM_RELATIVE) || 
 				(m_type == SYM_RELATIVE64) || 
 				(m_type == SYM_RELATIVE128) || 
+				(m_type == SYM_RELATIVE256) || 
 				(m_type == SYM_REL_REFERENCE) ||
 				(m_type == SYM_FP_REL_SINGLE) || 
+				(m_type == SYM_FP_REL_DOUBLE) || 
 				(m_type == SYM_FP_REL_INT32);
 		}
 
@@ -181,7 +206,8 @@ namespace Jitter
 				(m_type == SYM_TEMPORARY128) || 
 				(m_type == SYM_TEMPORARY256) ||
 				(m_type == SYM_TMP_REFERENCE) ||
-				(m_type == SYM_FP_TMP_SINGLE);
+				(m_type == SYM_FP_TMP_SINGLE) ||
+				(m_type == SYM_FP_TMP_DOUBLE);
 		}
 
 		bool Equals(CSymbol* symbol) const
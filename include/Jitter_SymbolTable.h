@@ -28,6 +28,7 @@ namespace Jitter
 		SymbolIterator			RemoveSymbol(const SymbolIterator&);
 
 		SymbolSet&				GetSymbols();
+		const SymbolSet&		GetSymbols() const;
 
 	private:
 		SymbolSet				m_symbols;
@@ -0,0 +1,50 @@
+#pragma once
+
+#include "Jitter.h"
+#include "MemoryFunction.h"
+#include <functional>
+#include <mutex>
+
+namespace Jitter
+{
+	//Function that is only compiled when it is called for the first time. Construction compiles a small
+	//stub that can be called right away. On its first call, the stub compiles the function, patches itself
+	//to jump to the compiled code and runs it, later calls only go through that jump.
+	//The jitter is used from within the first call and must not be in the middle of another compilation
+	//at that point. The stub must not be executing on another thread while it gets patched.
+	class CLazyFunction
+	{
+	public:
+		//Emits the body of the function (between Begin and End).
+		typedef std::function<void (CJitter&)> FunctionEmitter;
+
+								CLazyFunction(CJitter&, const FunctionEmitter&);
+								CLazyFunction(const CLazyFunction&) = delete;
+		virtual					~CLazyFunction();
+
+		CLazyFunction&			operator =(const CLazyFunction&) = delete;
+
+		bool					IsCompiled() const;
+		//Compiles the function ahead of its first call.
+		void					Compile();
+
+		void					operator()(void*);
+		//Entry point following CMemoryFunction's calling convention, stays valid after compilation.
+		void*					GetCode() const;
+
+	private:
+		typedef void (*FunctionType)(void*);
+
+		static void				ResolveAndRun(void*, uint32);
+		//Takes the address the stub resumes at once the resolver returns, if the stub is running
+		void					CompileAndPatch(const void*);
+		void					PatchStub(const void*);
+
+		CJitter&				m_jitter;
+		FunctionEmitter			m_emitter;
+		uint32					m_stubIndex = 0;
+		CMemoryFunction			m_stub;
+		CMemoryFunction			m_function;
+		mutable std::mutex		m_compileMutex;
+	};
+}
@@ -81,7 +81,7 @@ namespace Jitter
 
 		static void				FillStringTable(StringTable&, const InternalSymbolArray&, InternalSymbolInfoArray&);
 		static void				FillStringTable(StringTable&, const ExternalSymbolArray&, ExternalSymbolInfoArray&);
-		static SECTION			BuildSection(const InternalSymbolArray&, InternalSymbolInfoArray&, INTERNAL_SYMBOL_LOCATION);
+		static SECTION			BuildSection(const InternalSymbolArray&, InternalSymbolInfoArray&, const InternalSymbolAliasArray&, INTERNAL_SYMBOL_LOCATION);
 		static SymbolArray		BuildSymbols(const InternalSymbolArray&, InternalSymbolInfoArray&, const ExternalSymbolArray&, ExternalSymbolInfoArray&, uint32, uint32);
 		RelocationArray			BuildRelocations(SECTION&, const InternalSymbolInfoArray&, const ExternalSymbolInfoArray&) const;
 	};
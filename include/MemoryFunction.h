@@ -1,12 +1,13 @@
 #pragma once
 
 #include "Types.h"
+#include <string>
 
 class CMemoryFunction
 {
 public:
 						CMemoryFunction();
-						CMemoryFunction(const void*, size_t);
+						CMemoryFunction(const void*, size_t, const std::string& = std::string());
 						CMemoryFunction(const CMemoryFunction&) = delete;
 						CMemoryFunction(CMemoryFunction&&);
 
@@ -22,9 +23,24 @@ public:
 	void*				GetCode() const;
 	size_t				GetSize() const;
 
+	//Overwrites part of the code, the modified range must not be executing while being patched.
+	//Throws if the code is shared with other functions through code folding.
+	void				Patch(size_t, const void*, size_t);
+
+	//Code folding makes functions with identical code share the same executable memory.
+	//Code of folded functions must not be modified.
+	static void			SetCodeFoldingEnabled(bool);
+	static size_t		GetFoldedSize();
+
+	struct SHARED_CODE;
+
 private:
 	void				Reset();
 
+	static void*		AllocateCode(const void*, size_t, size_t&);
+	static void			FreeCode(void*, size_t);
+
 	void*				m_code;
 	size_t				m_size;
+	SHARED_CODE*		m_sharedCode = nullptr;
 };
@@ -4,6 +4,7 @@
 #include <string>
 #include <vector>
 #include <memory>
+#include <unordered_map>
 #include "Stream.h"
 
 namespace Jitter
@@ -63,15 +64,26 @@ namespace Jitter
 
 		unsigned int			GetExternalSymbolIndexByValue(uintptr_t) const;
 
+		//Code folding makes text symbols with identical code and references share the same bytes, disabled by default
+		void					SetCodeFoldingEnabled(bool);
+		uint32					GetFoldedSize() const;
+
 		virtual void			Write(Framework::CStream&) = 0;
 
 	protected:
 		typedef std::vector<INTERNAL_SYMBOL> InternalSymbolArray;
 		typedef std::vector<EXTERNAL_SYMBOL> ExternalSymbolArray;
+		typedef std::unordered_map<std::string, unsigned int> SymbolIndexMap;
+		typedef std::vector<unsigned int> InternalSymbolAliasArray;
+
+		//Index of the first internal symbol with identical contents for every internal symbol
+		InternalSymbolAliasArray	GetInternalSymbolAliases() const;
 
 		CPU_ARCH				m_cpuArch;
+		bool					m_codeFoldingEnabled = false;
 
 		InternalSymbolArray		m_internalSymbols;
+		SymbolIndexMap			m_internalSymbolIndices;
 		ExternalSymbolArray		m_externalSymbols;
 	};
 }
@@ -0,0 +1,75 @@
+#pragma once
+
+#include "Types.h"
+#include <string>
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <cstdio>
+
+//Publishes generated code to Linux perf, either through a perf map (/tmp/perf-<pid>.map)
+//or a jitdump file that also contains the code bytes (use with 'perf inject --jit').
+//Files are written by a background thread to keep compile latency unaffected.
+class CPerfJitWriter
+{
+public:
+	enum
+	{
+		FLAG_PERF_MAP = 0x01,
+		FLAG_JITDUMP = 0x02,
+	};
+
+	static CPerfJitWriter&	GetInstance();
+
+	void					Enable(uint32, const std::string& = "/tmp");
+	void					Disable();
+	bool					IsEnabled() const;
+
+	void					RegisterCode(const void*, size_t, const std::string&);
+	void					Flush();
+
+	std::string				GetPerfMapPath() const;
+	std::string				GetJitDumpPath() const;
+
+private:
+	struct CODE_ENTRY
+	{
+		uint64				address = 0;
+		uint64				size = 0;
+		uint64				timestamp = 0;
+		uint32				threadId = 0;
+		std::string			name;
+		std::vector<uint8>	code;
+	};
+	typedef std::deque<CODE_ENTRY> CodeEntryQueue;
+
+							CPerfJitWriter() = default;
+							~CPerfJitWriter();
+
+	void					WriterThreadProc();
+	void					WriteEntry(const CODE_ENTRY&);
+	void					WriteJitDumpHeader();
+
+	static uint64			GetTimestamp();
+	static uint32			GetThreadId();
+
+	std::thread				m_writerThread;
+	std::mutex				m_mutex;
+	std::condition_variable	m_queueCondition;
+	std::condition_variable	m_flushCondition;
+	CodeEntryQueue			m_queue;
+	bool					m_writing = false;
+	bool					m_stopping = false;
+
+	std::atomic<bool>		m_enabled = {false};
+	uint32					m_flags = 0;
+	std::string				m_directory;
+	uint64					m_nextCodeIndex = 0;
+
+	FILE*					m_perfMapFile = nullptr;
+	FILE*					m_jitDumpFile = nullptr;
+	void*					m_jitDumpMarker = nullptr;
+};
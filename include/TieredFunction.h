@@ -0,0 +1,65 @@
+#pragma once
+
+#include "Jitter.h"
+#include "MemoryFunction.h"
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+namespace Jitter
+{
+	//Function compiled with the baseline tier first and with the optimizing tier once it has been
+	//entered often enough. Calls go through a code pointer that is swapped atomically on promotion.
+	//Replaced code is kept alive until ReleaseRetiredCode is called, the host must only call it
+	//when no thread can still be executing the previous code (ie.: between two frames).
+	class CTieredFunction
+	{
+	public:
+		//Emits the body of the function (between Begin and End). Called once per tier.
+		typedef std::function<void (CJitter&)> FunctionEmitter;
+
+								CTieredFunction(const FunctionEmitter&, uint32);
+								CTieredFunction(const CTieredFunction&) = delete;
+		virtual					~CTieredFunction() = default;
+
+		CTieredFunction&		operator =(const CTieredFunction&) = delete;
+
+		//Compiles the baseline code, instrumented with an entry counter.
+		void					Compile(CJitter&);
+
+		uint32					GetEntryCount() const;
+		bool					IsPromoted() const;
+		//True once the entry count reached the promotion threshold, until promoted.
+		bool					NeedsPromotion() const;
+
+		//Compiles the optimized code and installs it.
+		void					Promote(CJitter&);
+		//Installs optimized code compiled elsewhere (ie.: by CCompileService using Emit).
+		void					Promote(CMemoryFunction&&);
+		void					Emit(CJitter&) const;
+
+		void					ReleaseRetiredCode();
+
+		void					operator()(void*);
+		void*					GetCode() const;
+
+	private:
+		typedef void (*FunctionType)(void*);
+
+		void					Install(CMemoryFunction&&);
+		CMemoryFunction			CompileTier(CJitter&, CJitter::COMPILE_TIER, uint32*) const;
+
+		FunctionEmitter			m_emitter;
+		uint32					m_promotionThreshold = 0;
+		//Incremented by generated code, accessed without synchronization
+		volatile uint32			m_entryCount = 0;
+
+		std::atomic<FunctionType>	m_code = { nullptr };
+		std::atomic<bool>		m_promoted = { false };
+
+		std::mutex				m_codeMutex;
+		CMemoryFunction			m_currentCode;
+		std::vector<CMemoryFunction>	m_retiredCode;
+	};
+}
@@ -123,7 +123,9 @@ public:
 	void									AndIb(const CAddress&, uint8);
 	void									AndId(const CAddress&, uint32);
 	void									AndIq(const CAddress&, uint64);
+	void									BsfEd(REGISTER, const CAddress&);
 	void									BsrEd(REGISTER, const CAddress&);
+	void									Bswap(REGISTER);
 	void									CallEd(const CAddress&);
 	void									CmovsEd(REGISTER, const CAddress&);
 	void									CmovnsEd(REGISTER, const CAddress&);
@@ -133,10 +135,15 @@ public:
 	void									CmpId(const CAddress&, uint32);
 	void									CmpIq(const CAddress&, uint64);
 	void									Cdq();
+	void									Cqo();
 	void									DivEd(const CAddress&);
+	void									DivEq(const CAddress&);
 	void									IdivEd(const CAddress&);
+	void									IdivEq(const CAddress&);
 	void									ImulEw(const CAddress&);
 	void									ImulEd(const CAddress&);
+	void									ImulEd(REGISTER, const CAddress&);
+	void									ImulEq(REGISTER, const CAddress&);
 	void									JbJx(LABEL);
 	void									JbeJx(LABEL);
 	void									JnbJx(LABEL);
@@ -157,25 +164,38 @@ public:
 	void									MovEq(REGISTER, const CAddress&);
 	void									MovGd(const CAddress&, REGISTER);
 	void									MovGq(const CAddress&, REGISTER);
+	void									MovGb(const CAddress&, REGISTER);
+	void									MovGw(const CAddress&, REGISTER);
 	void									MovId(REGISTER, uint32);
 	void									MovIq(REGISTER, uint64);
 	void									MovId(const CAddress&, uint32);
+	void									MovIb(const CAddress&, uint8);
+	void									MovIw(const CAddress&, uint16);
 	void									MovsxEb(REGISTER, const CAddress&);
 	void									MovsxEw(REGISTER, const CAddress&);
 	void									MovzxEb(REGISTER, const CAddress&);
+	void									MovzxEw(REGISTER, const CAddress&);
 	void									MulEd(const CAddress&);
 	void									NegEd(const CAddress&);
 	void									Nop();
 	void									NotEd(const CAddress&);
+	void									NotEq(const CAddress&);
 	void									OrEd(REGISTER, const CAddress&);
+	void									OrEq(REGISTER, const CAddress&);
 	void									OrId(const CAddress&, uint32);
+	void									OrIq(const CAddress&, uint64);
 	void									Pop(REGISTER);
+	void									PopcntEd(REGISTER, const CAddress&);
 	void									Push(REGISTER);
 	void									PushEd(const CAddress&);
 	void									PushId(uint32);
 	void									RclEd(const CAddress&, uint8);
 	void									RepMovsb();
 	void									Ret();
+	void									RorEd(const CAddress&);
+	void									RorEd(const CAddress&, uint8);
+	void									RorEq(const CAddress&);
+	void									RorEq(const CAddress&, uint8);
 	void									SarEd(const CAddress&);
 	void									SarEd(const CAddress&, uint8);
 	void									SarEq(const CAddress&);
@@ -209,17 +229,26 @@ public:
 	void									SubIq(const CAddress&, uint64);
 	void									TestEb(REGISTER, const CAddress&);
 	void									TestEd(REGISTER, const CAddress&);
+	void									TestEq(REGISTER, const CAddress&);
+	void									TzcntEd(REGISTER, const CAddress&);
 	void									XorEd(REGISTER, const CAddress&);
+	void									XorEq(REGISTER, const CAddress&);
 	void									XorId(const CAddress&, uint32);
+	void									XorIq(const CAddress&, uint64);
 	void									XorGd(const CAddress&, REGISTER);
 	void									XorGq(const CAddress&, REGISTER);
 
 	//FPU
 	void									FldEd(const CAddress&);
+	void									FldEq(const CAddress&);
 	void									FildEd(const CAddress&);
+	void									FildEq(const CAddress&);
 	void									FstpEd(const CAddress&);
+	void									FstpEq(const CAddress&);
 	void									FistpEd(const CAddress&);
+	void									FistpEq(const CAddress&);
 	void									FisttpEd(const CAddress&);
+	void									FisttpEq(const CAddress&);
 	void									FaddpSt(uint8);
 	void									FsubpSt(uint8);
 	void									FmulpSt(uint8);
@@ -270,20 +299,27 @@ public:
 	void									PcmpgtbVo(XMMREGISTER, const CAddress&);
 	void									PcmpgtwVo(XMMREGISTER, const CAddress&);
 	void									PcmpgtdVo(XMMREGISTER, const CAddress&);
+	void									PmaddwdVo(XMMREGISTER, const CAddress&);
 	void									PmaxswVo(XMMREGISTER, const CAddress&);
 	void									PmaxsdVo(XMMREGISTER, const CAddress&);
 	void									PminswVo(XMMREGISTER, const CAddress&);
 	void									PminsdVo(XMMREGISTER, const CAddress&);
 	void									PmovmskbVo(REGISTER, XMMREGISTER);
+	void									PmulhwVo(XMMREGISTER, const CAddress&);
+	void									PmulldVo(XMMREGISTER, const CAddress&);
+	void									PmullwVo(XMMREGISTER, const CAddress&);
+	void									PmuludqVo(XMMREGISTER, const CAddress&);
 	void									PorVo(XMMREGISTER, const CAddress&);
 	void									PshufbVo(XMMREGISTER, const CAddress&);
 	void									PshufdVo(XMMREGISTER, const CAddress&, uint8);
 	void									PsllwVo(XMMREGISTER, uint8);
 	void									PslldVo(XMMREGISTER, uint8);
+	void									PsllqVo(XMMREGISTER, uint8);
 	void									PsrawVo(XMMREGISTER, uint8);
 	void									PsradVo(XMMREGISTER, uint8);
 	void									PsrlwVo(XMMREGISTER, uint8);
 	void									PsrldVo(XMMREGISTER, uint8);
+	void									PsrlqVo(XMMREGISTER, uint8);
 
 	void									PsubbVo(XMMREGISTER, const CAddress&);
 	void									PsubusbVo(XMMREGISTER, const CAddress&);
@@ -314,18 +350,88 @@ public:
 	void									CmpssEd(XMMREGISTER, const CAddress&, SSE_CMP_TYPE);
 	void									Cvtsi2ssEd(XMMREGISTER, const CAddress&);
 	void									Cvttss2siEd(REGISTER, const CAddress&);
+	void									Cvttss2siEq(REGISTER, const CAddress&);
+	void									Cvtss2sdEd(XMMREGISTER, const CAddress&);
+
+	void									MovsdEd(const CAddress&, XMMREGISTER);
+	void									MovsdEd(XMMREGISTER, const CAddress&);
+	void									AddsdEd(XMMREGISTER, const CAddress&);
+	void									SubsdEd(XMMREGISTER, const CAddress&);
+	void									MaxsdEd(XMMREGISTER, const CAddress&);
+	void									MinsdEd(XMMREGISTER, const CAddress&);
+	void									MulsdEd(XMMREGISTER, const CAddress&);
+	void									DivsdEd(XMMREGISTER, const CAddress&);
+	void									SqrtsdEd(XMMREGISTER, const CAddress&);
+	void									CmpsdEd(XMMREGISTER, const CAddress&, SSE_CMP_TYPE);
+	void									Cvtsi2sdEd(XMMREGISTER, const CAddress&);
+	void									Cvtsi2sdEq(XMMREGISTER, const CAddress&);
+	void									Cvttsd2siEd(REGISTER, const CAddress&);
+	void									Cvttsd2siEq(REGISTER, const CAddress&);
+	void									Cvtsd2ssEd(XMMREGISTER, const CAddress&);
+
 	void									Cvtdq2psVo(XMMREGISTER, const CAddress&);
+	void									Cvtps2dqVo(XMMREGISTER, const CAddress&);
 	void									Cvttps2dqVo(XMMREGISTER, const CAddress&);
 
 	void									AddpsVo(XMMREGISTER, const CAddress&);
+	void									CmppsVo(XMMREGISTER, const CAddress&, SSE_CMP_TYPE);
 	void									DivpsVo(XMMREGISTER, const CAddress&);
+	void									InsertpsVo(XMMREGISTER, const CAddress&, uint8);
 	void									MaxpsVo(XMMREGISTER, const CAddress&);
 	void									MinpsVo(XMMREGISTER, const CAddress&);
 	void									MulpsVo(XMMREGISTER, const CAddress&);
+	//SSE4.1, mode bits 0-1 select the rounding direction (nearest, down, up, truncate)
+	void									RoundpsVo(XMMREGISTER, const CAddress&, uint8);
 	void									SubpsVo(XMMREGISTER, const CAddress&);
 	void									ShufpsVo(XMMREGISTER, const CAddress&, uint8);
 
+	//AVX
+	//Availability needs to be checked by the caller
+	void									Vfmadd231ssEd(XMMREGISTER, XMMREGISTER, const CAddress&);
+	void									Vfnmadd231ssEd(XMMREGISTER, XMMREGISTER, const CAddress&);
+	void									Vfmadd231sdEd(XMMREGISTER, XMMREGISTER, const CAddress&);
+	void									Vfnmadd231sdEd(XMMREGISTER, XMMREGISTER, const CAddress&);
+	void									Vfmadd231psVo(XMMREGISTER, XMMREGISTER, const CAddress&);
+	void									Vfnmadd231psVo(XMMREGISTER, XMMREGISTER, const CAddress&);
+
+	//AVX2
+	//Availability needs to be checked by the caller, Vzeroupper needs to be used before going back to SSE instructions
+	void									VaddpsVqq(XMMREGISTER, XMMREGISTER, const CAddress&);
+	void									VmovdquVqq(XMMREGISTER, const CAddress&);
+	void									VmovdquVqq(const CAddress&, XMMREGISTER);
+	void									VmulpsVqq(XMMREGISTER, XMMREGISTER, const CAddress&);
+	void									VpaddbVqq(XMMREGISTER, XMMREGISTER, const CAddress&);
+	void									VpadddVqq(XMMREGISTER, XMMREGISTER, const CAddress&);
+	void									VpaddwVqq(XMMREGISTER, XMMREGISTER, const CAddress&);
+	void									Vinserti128Vqq(XMMREGISTER, XMMREGISTER, const CAddress&, uint8);
+	void									VpalignrVo(XMMREGISTER, XMMREGISTER, const CAddress&, uint8);
+	void									VpalignrVqq(XMMREGISTER, XMMREGISTER, const CAddress&, uint8);
+	void									VpandVqq(XMMREGISTER, XMMREGISTER, const CAddress&);
+	void									VpermqVqq(XMMREGISTER, const CAddress&, uint8);
+	void									VporVqq(XMMREGISTER, XMMREGISTER, const CAddress&);
+	void									VpsubbVqq(XMMREGISTER, XMMREGISTER, const CAddress&);
+	void									VpsubdVqq(XMMREGISTER, XMMREGISTER, const CAddress&);
+	void									VpsubwVqq(XMMREGISTER, XMMREGISTER, const CAddress&);
+	void									VpxorVqq(XMMREGISTER, XMMREGISTER, const CAddress&);
+	void									VsubpsVqq(XMMREGISTER, XMMREGISTER, const CAddress&);
+	void									Vzeroupper();
+
 private:
+	enum VEX_OPCODE_MAP
+	{
+		VEX_OPCODE_MAP_0F = 1,
+		VEX_OPCODE_MAP_0F_38 = 2,
+		VEX_OPCODE_MAP_0F_3A = 3,
+	};
+
+	enum VEX_OPCODE_PREFIX
+	{
+		VEX_OPCODE_PREFIX_NONE = 0,
+		VEX_OPCODE_PREFIX_66 = 1,
+		VEX_OPCODE_PREFIX_F3 = 2,
+		VEX_OPCODE_PREFIX_F2 = 3,
+	};
+
 	enum JMP_TYPE
 	{
 		JMP_O	= 0,
@@ -408,8 +514,12 @@ private:
 	void									WriteEdVdOp_66_0F(uint8, const CAddress&, XMMREGISTER);
 	void									WriteEdVdOp_66_0F_64b(uint8, const CAddress&, XMMREGISTER);
 	void									WriteEdVdOp_66_0F_38(uint8, const CAddress&, XMMREGISTER);
+	void									WriteEdVdOp_66_0F_3A(uint8, const CAddress&, XMMREGISTER);
+	void									WriteEdVdOp_F2_0F(uint8, const CAddress&, XMMREGISTER);
+	void									WriteEdVdOp_F2_0F_64b(uint8, const CAddress&, XMMREGISTER);
 	void									WriteEdVdOp_F3_0F(uint8, const CAddress&, XMMREGISTER);
 	void									WriteVrOp_66_0F(uint8, uint8, XMMREGISTER);
+	void									WriteVexEdVdOp(VEX_OPCODE_MAP, VEX_OPCODE_PREFIX, uint8, bool, bool, const CAddress&, XMMREGISTER, XMMREGISTER);
 	void									WriteStOp(uint8, uint8, uint8);
 
 	void									CreateLabelReference(LABEL, JMP_TYPE);
@@ -34,6 +34,20 @@ CAArch32Assembler::LdrAddress CAArch32Assembler::MakeImmediateLdrAddress(int32 i
 	return result;
 }
 
+CAArch32Assembler::LdrAddress CAArch32Assembler::MakeRegisterLdrAddress(CAArch32Assembler::REGISTER registerId, const AluLdrShift& shift)
+{
+	//Only constant shifts are allowed for loads/stores
+	assert(shift.typeBit == 0);
+
+	LdrAddress result;
+	memset(&result, 0, sizeof(result));
+	result.isImmediate = false;
+	result.shiftRm.immediateShift.rm = registerId;
+	result.shiftRm.immediateShift.shiftType = shift.type;
+	result.shiftRm.immediateShift.constant = shift.amount;
+	return result;
+}
+
 CAArch32Assembler::ImmediateAluOperand CAArch32Assembler::MakeImmediateAluOperand(uint8 immediate, uint8 rotateAmount)
 {
 	ImmediateAluOperand operand;
@@ -54,6 +68,7 @@ CAArch32Assembler::AluLdrShift CAArch32Assembler::MakeConstantShift(SHIFT shiftT
 {
 	assert(!(shiftType == SHIFT_ASR && amount == 0));
 	assert(!(shiftType == SHIFT_LSR && amount == 0));
+	assert(!(shiftType == SHIFT_ROR && amount == 0));
 
 	AluLdrShift result;
 	result.typeBit = 0;
@@ -275,9 +290,29 @@ void CAArch32Assembler::Ldmia(REGISTER rbase, uint16 regList)
 void CAArch32Assembler::Ldr(REGISTER rd, REGISTER rbase, const LdrAddress& address)
 {
 	uint32 opcode = 0;
+	assert(!address.isNegative);
+	if(address.isImmediate)
+	{
+		opcode = (CONDITION_AL << 28) | (1 << 26) | (1 << 24) | (1 << 23) | (1 << 20) | (static_cast<uint32>(rbase) << 16) | (static_cast<uint32>(rd) << 12) | (static_cast<uint32>(address.immediate));
+	}
+	else
+	{
+		const auto& shiftRm = address.shiftRm.immediateShift;
+		opcode = (CONDITION_AL << 28) | (1 << 26) | (1 << 25) | (1 << 24) | (1 << 23) | (1 << 20) | (static_cast<uint32>(rbase) << 16) | (static_cast<uint32>(rd) << 12) |
+			(shiftRm.constant << 7) | (shiftRm.shiftType << 5) | (shiftRm.rm);
+	}
+	WriteWord(opcode);
+}
+
+void CAArch32Assembler::Ldrb(REGISTER rt, REGISTER rn, const LdrAddress& address)
+{
 	assert(address.isImmediate);
 	assert(!address.isNegative);
-	opcode = (CONDITION_AL << 28) | (1 << 26) | (1 << 24) | (1 << 23) | (1 << 20) | (static_cast<uint32>(rbase) << 16) | (static_cast<uint32>(rd) << 12) | (static_cast<uint32>(address.immediate));
+	uint32 opcode = 0x05D00000;
+	opcode |= (CONDITION_AL << 28);
+	opcode |= (rn << 16);
+	opcode |= (rt << 12);
+	opcode |= address.immediate;
 	WriteWord(opcode);
 }
 
@@ -295,6 +330,48 @@ void CAArch32Assembler::Ldrd(REGISTER rt, REGISTER rn, const LdrAddress& address
 	WriteWord(opcode);
 }
 
+void CAArch32Assembler::Ldrh(REGISTER rt, REGISTER rn, const LdrAddress& address)
+{
+	assert(address.isImmediate);
+	assert(!address.isNegative);
+	assert(address.immediate < 0x100);
+	uint32 opcode = 0x01D000B0;
+	opcode |= (CONDITION_AL << 28);
+	opcode |= (rn << 16);
+	opcode |= (rt << 12);
+	opcode |= (address.immediate >> 4) << 8;
+	opcode |= (address.immediate & 0xF);
+	WriteWord(opcode);
+}
+
+void CAArch32Assembler::Ldrsb(REGISTER rt, REGISTER rn, const LdrAddress& address)
+{
+	assert(address.isImmediate);
+	assert(!address.isNegative);
+	assert(address.immediate < 0x100);
+	uint32 opcode = 0x01D000D0;
+	opcode |= (CONDITION_AL << 28);
+	opcode |= (rn << 16);
+	opcode |= (rt << 12);
+	opcode |= (address.immediate >> 4) << 8;
+	opcode |= (address.immediate & 0xF);
+	WriteWord(opcode);
+}
+
+void CAArch32Assembler::Ldrsh(REGISTER rt, REGISTER rn, const LdrAddress& address)
+{
+	assert(address.isImmediate);
+	assert(!address.isNegative);
+	assert(address.immediate < 0x100);
+	uint32 opcode = 0x01D000F0;
+	opcode |= (CONDITION_AL << 28);
+	opcode |= (rn << 16);
+	opcode |= (rt << 12);
+	opcode |= (address.immediate >> 4) << 8;
+	opcode |= (address.immediate & 0xF);
+	WriteWord(opcode);
+}
+
 void CAArch32Assembler::Mov(REGISTER rd, REGISTER rm)
 {
 	InstructionAlu instruction;
@@ -360,6 +437,20 @@ void CAArch32Assembler::Movt(REGISTER rd, uint16 value)
 	WriteWord(opcode);
 }
 
+void CAArch32Assembler::Mla(REGISTER rd, REGISTER rn, REGISTER rm, REGISTER ra)
+{
+	uint32 opcode = 0;
+	opcode = (CONDITION_AL << 28) | (0x01 << 21) | (rd << 16) | (ra << 12) | (rm << 8) | (0x9 << 4) | (rn << 0);
+	WriteWord(opcode);
+}
+
+void CAArch32Assembler::Mul(REGISTER rd, REGISTER rn, REGISTER rm)
+{
+	uint32 opcode = 0;
+	opcode = (CONDITION_AL << 28) | (rd << 16) | (rm << 8) | (0x9 << 4) | (rn << 0);
+	WriteWord(opcode);
+}
+
 void CAArch32Assembler::Mvn(REGISTER rd, REGISTER rm)
 {
 	InstructionAlu instruction;
@@ -402,6 +493,24 @@ void CAArch32Assembler::Or(CONDITION cc, REGISTER rd, REGISTER rn, const Immedia
 	GenericAlu(ALU_OPCODE_ORR, false, rd, rn, operand, cc);
 }
 
+void CAArch32Assembler::Rbit(REGISTER rd, REGISTER rm)
+{
+	uint32 opcode = 0x06FF0F30;
+	opcode |= (CONDITION_AL << 28);
+	opcode |= (rd << 12);
+	opcode |= (rm <<  0);
+	WriteWord(opcode);
+}
+
+void CAArch32Assembler::Rev(REGISTER rd, REGISTER rm)
+{
+	uint32 opcode = 0x06BF0F30;
+	opcode |= (CONDITION_AL << 28);
+	opcode |= (rd << 12);
+	opcode |= (rm <<  0);
+	WriteWord(opcode);
+}
+
 void CAArch32Assembler::Rsb(REGISTER rd, REGISTER rn, const ImmediateAluOperand& operand)
 {
 	GenericAlu(ALU_OPCODE_RSB, false, rd, rn, operand);
@@ -451,6 +560,18 @@ void CAArch32Assembler::Str(REGISTER rd, REGISTER rbase, const LdrAddress& addre
 	WriteWord(opcode);
 }
 
+void CAArch32Assembler::Strb(REGISTER rt, REGISTER rn, const LdrAddress& address)
+{
+	assert(address.isImmediate);
+	assert(!address.isNegative);
+	uint32 opcode = 0x05C00000;
+	opcode |= (CONDITION_AL << 28);
+	opcode |= (rn << 16);
+	opcode |= (rt << 12);
+	opcode |= address.immediate;
+	WriteWord(opcode);
+}
+
 void CAArch32Assembler::Strd(REGISTER rt, REGISTER rn, const LdrAddress& address)
 {
 	assert(address.isImmediate);
@@ -465,6 +586,20 @@ void CAArch32Assembler::Strd(REGISTER rt, REGISTER rn, const LdrAddress& address
 	WriteWord(opcode);
 }
 
+void CAArch32Assembler::Strh(REGISTER rt, REGISTER rn, const LdrAddress& address)
+{
+	assert(address.isImmediate);
+	assert(!address.isNegative);
+	assert(address.immediate < 0x100);
+	uint32 opcode = 0x01C000B0;
+	opcode |= (CONDITION_AL << 28);
+	opcode |= (rn << 16);
+	opcode |= (rt << 12);
+	opcode |= (address.immediate >> 4) << 8;
+	opcode |= (address.immediate & 0xF);
+	WriteWord(opcode);
+}
+
 void CAArch32Assembler::Sub(REGISTER rd, REGISTER rn, REGISTER rm)
 {
 	GenericAlu(ALU_OPCODE_SUB, false, rd, rn, rm);
@@ -480,6 +615,24 @@ void CAArch32Assembler::Subs(REGISTER rd, REGISTER rn, REGISTER rm)
 	GenericAlu(ALU_OPCODE_SUB, true, rd, rn, rm);
 }
 
+void CAArch32Assembler::Sxtb(REGISTER rd, REGISTER rm)
+{
+	uint32 opcode = 0x06AF0070;
+	opcode |= (CONDITION_AL << 28);
+	opcode |= (rd << 12);
+	opcode |= (rm <<  0);
+	WriteWord(opcode);
+}
+
+void CAArch32Assembler::Sxth(REGISTER rd, REGISTER rm)
+{
+	uint32 opcode = 0x06BF0070;
+	opcode |= (CONDITION_AL << 28);
+	opcode |= (rd << 12);
+	opcode |= (rm <<  0);
+	WriteWord(opcode);
+}
+
 void CAArch32Assembler::Teq(REGISTER rn, const ImmediateAluOperand& operand)
 {
 	InstructionAlu instruction;
@@ -516,6 +669,24 @@ void CAArch32Assembler::Umull(REGISTER rdLow, REGISTER rdHigh, REGISTER rn, REGI
 	WriteWord(opcode);
 }
 
+void CAArch32Assembler::Uxtb(REGISTER rd, REGISTER rm)
+{
+	uint32 opcode = 0x06EF0070;
+	opcode |= (CONDITION_AL << 28);
+	opcode |= (rd << 12);
+	opcode |= (rm <<  0);
+	WriteWord(opcode);
+}
+
+void CAArch32Assembler::Uxth(REGISTER rd, REGISTER rm)
+{
+	uint32 opcode = 0x06FF0070;
+	opcode |= (CONDITION_AL << 28);
+	opcode |= (rd << 12);
+	opcode |= (rm <<  0);
+	WriteWord(opcode);
+}
+
 //////////////////////////////////////////////////
 // VFP/NEON Stuff
 //////////////////////////////////////////////////
@@ -581,6 +752,19 @@ void CAArch32Assembler::Vldr(SINGLE_REGISTER sd, REGISTER rbase, const LdrAddres
 	WriteWord(opcode);
 }
 
+void CAArch32Assembler::Vldr(DOUBLE_REGISTER dd, REGISTER rbase, const LdrAddress& address)
+{
+	assert(address.isImmediate);
+	assert(!address.isNegative);
+	assert((address.immediate / 4) <= 0xFF);
+
+	uint32 opcode = 0x0D900B00;
+	opcode |= (CONDITION_AL << 28);
+	opcode |= FPSIMD_EncodeDd(dd);
+	opcode |= (static_cast<uint32>(rbase) << 16) | (static_cast<uint32>(address.immediate / 4));
+	WriteWord(opcode);
+}
+
 void CAArch32Assembler::Vld1_32x2(DOUBLE_REGISTER dd, REGISTER rn)
 {
 	//TODO: Make this aligned
@@ -621,6 +805,19 @@ void CAArch32Assembler::Vstr(SINGLE_REGISTER sd, REGISTER rbase, const LdrAddres
 	WriteWord(opcode);
 }
 
+void CAArch32Assembler::Vstr(DOUBLE_REGISTER dd, REGISTER rbase, const LdrAddress& address)
+{
+	assert(address.isImmediate);
+	assert(!address.isNegative);
+	assert((address.immediate / 4) <= 0xFF);
+
+	uint32 opcode = 0x0D800B00;
+	opcode |= (CONDITION_AL << 28);
+	opcode |= FPSIMD_EncodeDd(dd);
+	opcode |= (static_cast<uint32>(rbase) << 16) | (static_cast<uint32>(address.immediate / 4));
+	WriteWord(opcode);
+}
+
 void CAArch32Assembler::Vst1_32x4(QUAD_REGISTER qd, REGISTER rn)
 {
 	uint32 opcode = 0xF4000AAF;
@@ -649,6 +846,33 @@ void CAArch32Assembler::Vmov(REGISTER rt, DOUBLE_REGISTER dn, uint8 offset)
 	WriteWord(opcode);
 }
 
+void CAArch32Assembler::Vmov(SINGLE_REGISTER sn, REGISTER rt)
+{
+	uint32 opcode = 0x0E000A10;
+	opcode |= (CONDITION_AL << 28);
+	opcode |= FPSIMD_EncodeSn(sn);
+	opcode |= (rt << 12);
+	WriteWord(opcode);
+}
+
+void CAArch32Assembler::Vmov(REGISTER rt, SINGLE_REGISTER sn)
+{
+	uint32 opcode = 0x0E100A10;
+	opcode |= (CONDITION_AL << 28);
+	opcode |= FPSIMD_EncodeSn(sn);
+	opcode |= (rt << 12);
+	WriteWord(opcode);
+}
+
+void CAArch32Assembler::VmovCc_F64(CONDITION condition, DOUBLE_REGISTER dd, DOUBLE_REGISTER dm)
+{
+	uint32 opcode = 0x0EB00B40;
+	opcode |= (condition << 28);
+	opcode |= FPSIMD_EncodeDd(dd);
+	opcode |= FPSIMD_EncodeDm(dm);
+	WriteWord(opcode);
+}
+
 void CAArch32Assembler::Vmovn_I16(DOUBLE_REGISTER dd, QUAD_REGISTER qm)
 {
 	uint32 opcode = 0xF3B20200;
@@ -665,6 +889,14 @@ void CAArch32Assembler::Vmovn_I32(DOUBLE_REGISTER dd, QUAD_REGISTER qm)
 	WriteWord(opcode);
 }
 
+void CAArch32Assembler::Vmovn_I64(DOUBLE_REGISTER dd, QUAD_REGISTER qm)
+{
+	uint32 opcode = 0xF3BA0200;
+	opcode |= FPSIMD_EncodeDd(dd);
+	opcode |= FPSIMD_EncodeQm(qm);
+	WriteWord(opcode);
+}
+
 void CAArch32Assembler::Vdup(QUAD_REGISTER qd, REGISTER rt)
 {
 	uint32 opcode = 0x0EA00B10;
@@ -717,6 +949,16 @@ void CAArch32Assembler::Vadd_F32(QUAD_REGISTER qd, QUAD_REGISTER qn, QUAD_REGIST
 	WriteWord(opcode);
 }
 
+void CAArch32Assembler::Vadd_F64(DOUBLE_REGISTER dd, DOUBLE_REGISTER dn, DOUBLE_REGISTER dm)
+{
+	uint32 opcode = 0x0E300B00;
+	opcode |= (CONDITION_AL << 28);
+	opcode |= FPSIMD_EncodeDd(dd);
+	opcode |= FPSIMD_EncodeDn(dn);
+	opcode |= FPSIMD_EncodeDm(dm);
+	WriteWord(opcode);
+}
+
 void CAArch32Assembler::Vadd_I8(QUAD_REGISTER qd, QUAD_REGISTER qn, QUAD_REGISTER qm)
 {
 	uint32 opcode = 0xF2000840;
@@ -744,6 +986,39 @@ void CAArch32Assembler::Vadd_I32(QUAD_REGISTER qd, QUAD_REGISTER qn, QUAD_REGIST
 	WriteWord(opcode);
 }
 
+void CAArch32Assembler::Vpadd_I32(DOUBLE_REGISTER dd, DOUBLE_REGISTER dn, DOUBLE_REGISTER dm)
+{
+	uint32 opcode = 0xF2200B10;
+	opcode |= FPSIMD_EncodeDd(dd);
+	opcode |= FPSIMD_EncodeDn(dn);
+	opcode |= FPSIMD_EncodeDm(dm);
+	WriteWord(opcode);
+}
+
+void CAArch32Assembler::Vpaddl_U8(DOUBLE_REGISTER dd, DOUBLE_REGISTER dm)
+{
+	uint32 opcode = 0xF3B00280;
+	opcode |= FPSIMD_EncodeDd(dd);
+	opcode |= FPSIMD_EncodeDm(dm);
+	WriteWord(opcode);
+}
+
+void CAArch32Assembler::Vpaddl_U16(DOUBLE_REGISTER dd, DOUBLE_REGISTER dm)
+{
+	uint32 opcode = 0xF3B40280;
+	opcode |= FPSIMD_EncodeDd(dd);
+	opcode |= FPSIMD_EncodeDm(dm);
+	WriteWord(opcode);
+}
+
+void CAArch32Assembler::Vcnt_I8(DOUBLE_REGISTER dd, DOUBLE_REGISTER dm)
+{
+	uint32 opcode = 0xF3B00500;
+	opcode |= FPSIMD_EncodeDd(dd);
+	opcode |= FPSIMD_EncodeDm(dm);
+	WriteWord(opcode);
+}
+
 void CAArch32Assembler::Vqadd_U8(QUAD_REGISTER qd, QUAD_REGISTER qn, QUAD_REGISTER qm)
 {
 	uint32 opcode = 0xF3000050;
@@ -808,6 +1083,16 @@ void CAArch32Assembler::Vsub_F32(QUAD_REGISTER qd, QUAD_REGISTER qn, QUAD_REGIST
 	WriteWord(opcode);
 }
 
+void CAArch32Assembler::Vsub_F64(DOUBLE_REGISTER dd, DOUBLE_REGISTER dn, DOUBLE_REGISTER dm)
+{
+	uint32 opcode = 0x0E300B40;
+	opcode |= (CONDITION_AL << 28);
+	opcode |= FPSIMD_EncodeDd(dd);
+	opcode |= FPSIMD_EncodeDn(dn);
+	opcode |= FPSIMD_EncodeDm(dm);
+	WriteWord(opcode);
+}
+
 void CAArch32Assembler::Vsub_I8(QUAD_REGISTER qd, QUAD_REGISTER qn, QUAD_REGISTER qm)
 {
 	uint32 opcode = 0xF3000840;
@@ -890,6 +1175,52 @@ void CAArch32Assembler::Vmul_F32(QUAD_REGISTER qd, QUAD_REGISTER qn, QUAD_REGIST
 	WriteWord(opcode);
 }
 
+void CAArch32Assembler::Vmul_F64(DOUBLE_REGISTER dd, DOUBLE_REGISTER dn, DOUBLE_REGISTER dm)
+{
+	uint32 opcode = 0x0E200B00;
+	opcode |= (CONDITION_AL << 28);
+	opcode |= FPSIMD_EncodeDd(dd);
+	opcode |= FPSIMD_EncodeDn(dn);
+	opcode |= FPSIMD_EncodeDm(dm);
+	WriteWord(opcode);
+}
+
+void CAArch32Assembler::Vmul_I16(QUAD_REGISTER qd, QUAD_REGISTER qn, QUAD_REGISTER qm)
+{
+	uint32 opcode = 0xF2100950;
+	opcode |= FPSIMD_EncodeQd(qd);
+	opcode |= FPSIMD_EncodeQn(qn);
+	opcode |= FPSIMD_EncodeQm(qm);
+	WriteWord(opcode);
+}
+
+void CAArch32Assembler::Vmul_I32(QUAD_REGISTER qd, QUAD_REGISTER qn, QUAD_REGISTER qm)
+{
+	uint32 opcode = 0xF2200950;
+	opcode |= FPSIMD_EncodeQd(qd);
+	opcode |= FPSIMD_EncodeQn(qn);
+	opcode |= FPSIMD_EncodeQm(qm);
+	WriteWord(opcode);
+}
+
+void CAArch32Assembler::Vmull_I16(QUAD_REGISTER qd, DOUBLE_REGISTER dn, DOUBLE_REGISTER dm)
+{
+	uint32 opcode = 0xF2900C00;
+	opcode |= FPSIMD_EncodeQd(qd);
+	opcode |= FPSIMD_EncodeDn(dn);
+	opcode |= FPSIMD_EncodeDm(dm);
+	WriteWord(opcode);
+}
+
+void CAArch32Assembler::Vmull_U32(QUAD_REGISTER qd, DOUBLE_REGISTER dn, DOUBLE_REGISTER dm)
+{
+	uint32 opcode = 0xF3A00C00;
+	opcode |= FPSIMD_EncodeQd(qd);
+	opcode |= FPSIMD_EncodeDn(dn);
+	opcode |= FPSIMD_EncodeDm(dm);
+	WriteWord(opcode);
+}
+
 void CAArch32Assembler::Vdiv_F32(SINGLE_REGISTER sd, SINGLE_REGISTER sn, SINGLE_REGISTER sm)
 {
 	uint32 opcode = 0x0E800A00;
@@ -900,6 +1231,16 @@ void CAArch32Assembler::Vdiv_F32(SINGLE_REGISTER sd, SINGLE_REGISTER sn, SINGLE_
 	WriteWord(opcode);
 }
 
+void CAArch32Assembler::Vdiv_F64(DOUBLE_REGISTER dd, DOUBLE_REGISTER dn, DOUBLE_REGISTER dm)
+{
+	uint32 opcode = 0x0E800B00;
+	opcode |= (CONDITION_AL << 28);
+	opcode |= FPSIMD_EncodeDd(dd);
+	opcode |= FPSIMD_EncodeDn(dn);
+	opcode |= FPSIMD_EncodeDm(dm);
+	WriteWord(opcode);
+}
+
 void CAArch32Assembler::Vand(QUAD_REGISTER qd, QUAD_REGISTER qn, QUAD_REGISTER qm)
 {
 	uint32 opcode = 0xF2000150;
@@ -990,6 +1331,16 @@ void CAArch32Assembler::Vshr_I32(QUAD_REGISTER qd, QUAD_REGISTER qm, uint8 shift
 	WriteWord(opcode);
 }
 
+void CAArch32Assembler::Vshrn_I32(DOUBLE_REGISTER dd, QUAD_REGISTER qm, uint8 shiftAmount)
+{
+	assert((shiftAmount >= 1) && (shiftAmount <= 16));
+	uint32 opcode = 0xF2800810;
+	opcode |= (0x20 - shiftAmount) << 16;
+	opcode |= FPSIMD_EncodeDd(dd);
+	opcode |= FPSIMD_EncodeQm(qm);
+	WriteWord(opcode);
+}
+
 void CAArch32Assembler::Vabs_F32(SINGLE_REGISTER sd, SINGLE_REGISTER sm)
 {
 	uint32 opcode = 0x0EB00AC0;
@@ -1025,6 +1376,33 @@ void CAArch32Assembler::Vsqrt_F32(SINGLE_REGISTER sd, SINGLE_REGISTER sm)
 	WriteWord(opcode);
 }
 
+void CAArch32Assembler::Vabs_F64(DOUBLE_REGISTER dd, DOUBLE_REGISTER dm)
+{
+	uint32 opcode = 0x0EB00BC0;
+	opcode |= (CONDITION_AL << 28);
+	opcode |= FPSIMD_EncodeDd(dd);
+	opcode |= FPSIMD_EncodeDm(dm);
+	WriteWord(opcode);
+}
+
+void CAArch32Assembler::Vneg_F64(DOUBLE_REGISTER dd, DOUBLE_REGISTER dm)
+{
+	uint32 opcode = 0x0EB10B40;
+	opcode |= (CONDITION_AL << 28);
+	opcode |= FPSIMD_EncodeDd(dd);
+	opcode |= FPSIMD_EncodeDm(dm);
+	WriteWord(opcode);
+}
+
+void CAArch32Assembler::Vsqrt_F64(DOUBLE_REGISTER dd, DOUBLE_REGISTER dm)
+{
+	uint32 opcode = 0x0EB10BC0;
+	opcode |= (CONDITION_AL << 28);
+	opcode |= FPSIMD_EncodeDd(dd);
+	opcode |= FPSIMD_EncodeDm(dm);
+	WriteWord(opcode);
+}
+
 void CAArch32Assembler::Vceq_I8(QUAD_REGISTER qd, QUAD_REGISTER qn, QUAD_REGISTER qm)
 {
 	uint32 opcode = 0xF3000850;
@@ -1122,6 +1500,61 @@ void CAArch32Assembler::Vcvt_S32_F32(QUAD_REGISTER qd, QUAD_REGISTER qm)
 	WriteWord(opcode);
 }
 
+void CAArch32Assembler::Vcvtr_S32_F32(SINGLE_REGISTER sd, SINGLE_REGISTER sm)
+{
+	//Uses the rounding mode set in FPSCR
+	uint32 opcode = 0x0EBD0A40;
+	opcode |= (CONDITION_AL << 28);
+	opcode |= FPSIMD_EncodeSd(sd);
+	opcode |= FPSIMD_EncodeSm(sm);
+	WriteWord(opcode);
+}
+
+void CAArch32Assembler::Vcmp_F64(DOUBLE_REGISTER dd, DOUBLE_REGISTER dm)
+{
+	uint32 opcode = 0x0EB40B40;
+	opcode |= (CONDITION_AL << 28);
+	opcode |= FPSIMD_EncodeDd(dd);
+	opcode |= FPSIMD_EncodeDm(dm);
+	WriteWord(opcode);
+}
+
+void CAArch32Assembler::Vcvt_F64_S32(DOUBLE_REGISTER dd, SINGLE_REGISTER sm)
+{
+	uint32 opcode = 0x0EB80BC0;
+	opcode |= (CONDITION_AL << 28);
+	opcode |= FPSIMD_EncodeDd(dd);
+	opcode |= FPSIMD_EncodeSm(sm);
+	WriteWord(opcode);
+}
+
+void CAArch32Assembler::Vcvt_S32_F64(SINGLE_REGISTER sd, DOUBLE_REGISTER dm)
+{
+	uint32 opcode = 0x0EBD0BC0;
+	opcode |= (CONDITION_AL << 28);
+	opcode |= FPSIMD_EncodeSd(sd);
+	opcode |= FPSIMD_EncodeDm(dm);
+	WriteWord(opcode);
+}
+
+void CAArch32Assembler::Vcvt_F64_F32(DOUBLE_REGISTER dd, SINGLE_REGISTER sm)
+{
+	uint32 opcode = 0x0EB70AC0;
+	opcode |= (CONDITION_AL << 28);
+	opcode |= FPSIMD_EncodeDd(dd);
+	opcode |= FPSIMD_EncodeSm(sm);
+	WriteWord(opcode);
+}
+
+void CAArch32Assembler::Vcvt_F32_F64(SINGLE_REGISTER sd, DOUBLE_REGISTER dm)
+{
+	uint32 opcode = 0x0EB70BC0;
+	opcode |= (CONDITION_AL << 28);
+	opcode |= FPSIMD_EncodeSd(sd);
+	opcode |= FPSIMD_EncodeDm(dm);
+	WriteWord(opcode);
+}
+
 void CAArch32Assembler::Vmrs(REGISTER rt)
 {
 	uint32 opcode = 0x0EF10A10;
@@ -1130,6 +1563,14 @@ void CAArch32Assembler::Vmrs(REGISTER rt)
 	WriteWord(opcode);
 }
 
+void CAArch32Assembler::Vmsr(REGISTER rt)
+{
+	uint32 opcode = 0x0EE10A10;
+	opcode |= (CONDITION_AL << 28);
+	opcode |= (rt << 12);
+	WriteWord(opcode);
+}
+
 void CAArch32Assembler::Vrecpe_F32(QUAD_REGISTER qd, QUAD_REGISTER qm)
 {
 	uint32 opcode = 0xF3BB0540;
@@ -127,6 +127,23 @@ void CAArch64Assembler::Add_16b(REGISTERMD rd, REGISTERMD rn, REGISTERMD rm)
 	WriteWord(opcode);
 }
 
+void CAArch64Assembler::Addp_4s(REGISTERMD rd, REGISTERMD rn, REGISTERMD rm)
+{
+	uint32 opcode = 0x4EA0BC00;
+	opcode |= (rd  <<  0);
+	opcode |= (rn  <<  5);
+	opcode |= (rm  << 16);
+	WriteWord(opcode);
+}
+
+void CAArch64Assembler::Addv_8b(REGISTERMD rd, REGISTERMD rn)
+{
+	uint32 opcode = 0x0E31B800;
+	opcode |= (rd << 0);
+	opcode |= (rn << 5);
+	WriteWord(opcode);
+}
+
 void CAArch64Assembler::And(REGISTER32 rd, REGISTER32 rn, REGISTER32 rm)
 {
 	uint32 opcode = 0x0A000000;
@@ -312,6 +329,14 @@ void CAArch64Assembler::Cmp(REGISTER64 rn, uint16 imm, ADDSUB_IMM_SHIFT_TYPE shi
 	WriteAddSubOpImm(0xF1000000, shift, imm, rn, wZR);
 }
 
+void CAArch64Assembler::Cnt_8b(REGISTERMD rd, REGISTERMD rn)
+{
+	uint32 opcode = 0x0E205800;
+	opcode |= (rd << 0);
+	opcode |= (rn << 5);
+	WriteWord(opcode);
+}
+
 void CAArch64Assembler::Cset(REGISTER32 rd, CONDITION condition)
 {
 	uint32 opcode = 0x1A800400;
@@ -330,6 +355,17 @@ void CAArch64Assembler::Dup_4s(REGISTERMD rd, REGISTER32 rn)
 	WriteWord(opcode);
 }
 
+void CAArch64Assembler::Dup_4s(REGISTERMD rd, REGISTERMD rn, uint8 index)
+{
+	assert(index < 4);
+	index &= 0x3;
+	uint32 opcode = 0x4E040400;
+	opcode |= (rd    <<  0);
+	opcode |= (rn    <<  5);
+	opcode |= (index << 19);
+	WriteWord(opcode);
+}
+
 void CAArch64Assembler::Eor(REGISTER32 rd, REGISTER32 rn, REGISTER32 rm)
 {
 	uint32 opcode = 0x4A000000;
@@ -339,6 +375,15 @@ void CAArch64Assembler::Eor(REGISTER32 rd, REGISTER32 rn, REGISTER32 rm)
 	WriteWord(opcode);
 }
 
+void CAArch64Assembler::Eor(REGISTER64 rd, REGISTER64 rn, REGISTER64 rm)
+{
+	uint32 opcode = 0xCA000000;
+	opcode |= (rd <<  0);
+	opcode |= (rn <<  5);
+	opcode |= (rm << 16);
+	WriteWord(opcode);
+}
+
 void CAArch64Assembler::Eor(REGISTER32 rd, REGISTER32 rn, uint8 n, uint8 immr, uint8 imms)
 {
 	WriteLogicalOpImm(0x52000000, n, immr, imms, rn, rd);
@@ -353,6 +398,18 @@ void CAArch64Assembler::Eor_16b(REGISTERMD rd, REGISTERMD rn, REGISTERMD rm)
 	WriteWord(opcode);
 }
 
+void CAArch64Assembler::Ext_16b(REGISTERMD rd, REGISTERMD rn, REGISTERMD rm, uint8 index)
+{
+	assert(index < 16);
+	index &= 0xF;
+	uint32 opcode = 0x6E000000;
+	opcode |= (rd    <<  0);
+	opcode |= (rn    <<  5);
+	opcode |= (index << 11);
+	opcode |= (rm    << 16);
+	WriteWord(opcode);
+}
+
 void CAArch64Assembler::Fabs_1s(REGISTERMD rd, REGISTERMD rn)
 {
 	uint32 opcode = 0x1E20C000;
@@ -361,6 +418,14 @@ void CAArch64Assembler::Fabs_1s(REGISTERMD rd, REGISTERMD rn)
 	WriteWord(opcode);
 }
 
+void CAArch64Assembler::Fabs_1d(REGISTERMD rd, REGISTERMD rn)
+{
+	uint32 opcode = 0x1E60C000;
+	opcode |= (rd <<  0);
+	opcode |= (rn <<  5);
+	WriteWord(opcode);
+}
+
 void CAArch64Assembler::Fabs_4s(REGISTERMD rd, REGISTERMD rn)
 {
 	uint32 opcode = 0x4EA0F800;
@@ -378,6 +443,15 @@ void CAArch64Assembler::Fadd_1s(REGISTERMD rd, REGISTERMD rn, REGISTERMD rm)
 	WriteWord(opcode);
 }
 
+void CAArch64Assembler::Fadd_1d(REGISTERMD rd, REGISTERMD rn, REGISTERMD rm)
+{
+	uint32 opcode = 0x1E602800;
+	opcode |= (rd <<  0);
+	opcode |= (rn <<  5);
+	opcode |= (rm << 16);
+	WriteWord(opcode);
+}
+
 void CAArch64Assembler::Fadd_4s(REGISTERMD rd, REGISTERMD rn, REGISTERMD rm)
 {
 	uint32 opcode = 0x4E20D400;
@@ -411,6 +485,78 @@ void CAArch64Assembler::Fcmp_1s(REGISTERMD rn, REGISTERMD rm)
 	WriteWord(opcode);
 }
 
+void CAArch64Assembler::Fcmp_1d(REGISTERMD rn, REGISTERMD rm)
+{
+	uint32 opcode = 0x1E602000;
+	opcode |= (rn <<  5);
+	opcode |= (rm << 16);
+	WriteWord(opcode);
+}
+
+void CAArch64Assembler::Fcvt_1d_1s(REGISTERMD rd, REGISTERMD rn)
+{
+	uint32 opcode = 0x1E22C000;
+	opcode |= (rd <<  0);
+	opcode |= (rn <<  5);
+	WriteWord(opcode);
+}
+
+void CAArch64Assembler::Fcvt_1s_1d(REGISTERMD rd, REGISTERMD rn)
+{
+	uint32 opcode = 0x1E624000;
+	opcode |= (rd <<  0);
+	opcode |= (rn <<  5);
+	WriteWord(opcode);
+}
+
+void CAArch64Assembler::Fcvtms_1s(REGISTERMD rd, REGISTERMD rn)
+{
+	uint32 opcode = 0x5E21B800;
+	opcode |= (rd <<  0);
+	opcode |= (rn <<  5);
+	WriteWord(opcode);
+}
+
+void CAArch64Assembler::Fcvtms_4s(REGISTERMD rd, REGISTERMD rn)
+{
+	uint32 opcode = 0x4E21B800;
+	opcode |= (rd <<  0);
+	opcode |= (rn <<  5);
+	WriteWord(opcode);
+}
+
+void CAArch64Assembler::Fcvtns_1s(REGISTERMD rd, REGISTERMD rn)
+{
+	uint32 opcode = 0x5E21A800;
+	opcode |= (rd <<  0);
+	opcode |= (rn <<  5);
+	WriteWord(opcode);
+}
+
+void CAArch64Assembler::Fcvtns_4s(REGISTERMD rd, REGISTERMD rn)
+{
+	uint32 opcode = 0x4E21A800;
+	opcode |= (rd <<  0);
+	opcode |= (rn <<  5);
+	WriteWord(opcode);
+}
+
+void CAArch64Assembler::Fcvtps_1s(REGISTERMD rd, REGISTERMD rn)
+{
+	uint32 opcode = 0x5EA1A800;
+	opcode |= (rd <<  0);
+	opcode |= (rn <<  5);
+	WriteWord(opcode);
+}
+
+void CAArch64Assembler::Fcvtps_4s(REGISTERMD rd, REGISTERMD rn)
+{
+	uint32 opcode = 0x4EA1A800;
+	opcode |= (rd <<  0);
+	opcode |= (rn <<  5);
+	WriteWord(opcode);
+}
+
 void CAArch64Assembler::Fcvtzs_1s(REGISTERMD rd, REGISTERMD rn)
 {
 	uint32 opcode = 0x5EA1B800;
@@ -419,6 +565,30 @@ void CAArch64Assembler::Fcvtzs_1s(REGISTERMD rd, REGISTERMD rn)
 	WriteWord(opcode);
 }
 
+void CAArch64Assembler::Fcvtzs_1s(REGISTER64 rd, REGISTERMD rn)
+{
+	uint32 opcode = 0x9E380000;
+	opcode |= (rd <<  0);
+	opcode |= (rn <<  5);
+	WriteWord(opcode);
+}
+
+void CAArch64Assembler::Fcvtzs_1d(REGISTER32 rd, REGISTERMD rn)
+{
+	uint32 opcode = 0x1E780000;
+	opcode |= (rd <<  0);
+	opcode |= (rn <<  5);
+	WriteWord(opcode);
+}
+
+void CAArch64Assembler::Fcvtzs_1d(REGISTER64 rd, REGISTERMD rn)
+{
+	uint32 opcode = 0x9E780000;
+	opcode |= (rd <<  0);
+	opcode |= (rn <<  5);
+	WriteWord(opcode);
+}
+
 void CAArch64Assembler::Fcvtzs_4s(REGISTERMD rd, REGISTERMD rn)
 {
 	uint32 opcode = 0x4EA1B800;
@@ -436,6 +606,15 @@ void CAArch64Assembler::Fdiv_1s(REGISTERMD rd, REGISTERMD rn, REGISTERMD rm)
 	WriteWord(opcode);
 }
 
+void CAArch64Assembler::Fdiv_1d(REGISTERMD rd, REGISTERMD rn, REGISTERMD rm)
+{
+	uint32 opcode = 0x1E601800;
+	opcode |= (rd <<  0);
+	opcode |= (rn <<  5);
+	opcode |= (rm << 16);
+	WriteWord(opcode);
+}
+
 void CAArch64Assembler::Fdiv_4s(REGISTERMD rd, REGISTERMD rn, REGISTERMD rm)
 {
 	uint32 opcode = 0x6E20FC00;
@@ -453,6 +632,80 @@ void CAArch64Assembler::Fmov_1s(REGISTERMD rd, uint8 imm)
 	WriteWord(opcode);
 }
 
+void CAArch64Assembler::Fmov_1s(REGISTERMD rd, REGISTER32 rn)
+{
+	uint32 opcode = 0x1E270000;
+	opcode |= (rd << 0);
+	opcode |= (rn << 5);
+	WriteWord(opcode);
+}
+
+void CAArch64Assembler::Fmov_1d(REGISTERMD rd, uint8 imm)
+{
+	uint32 opcode = 0x1E601000;
+	opcode |= (rd <<   0);
+	opcode |= (imm << 13);
+	WriteWord(opcode);
+}
+
+void CAArch64Assembler::Fmadd_1s(REGISTERMD rd, REGISTERMD rn, REGISTERMD rm, REGISTERMD ra)
+{
+	uint32 opcode = 0x1F000000;
+	opcode |= (rd <<  0);
+	opcode |= (rn <<  5);
+	opcode |= (ra << 10);
+	opcode |= (rm << 16);
+	WriteWord(opcode);
+}
+
+void CAArch64Assembler::Fmadd_1d(REGISTERMD rd, REGISTERMD rn, REGISTERMD rm, REGISTERMD ra)
+{
+	uint32 opcode = 0x1F400000;
+	opcode |= (rd <<  0);
+	opcode |= (rn <<  5);
+	opcode |= (ra << 10);
+	opcode |= (rm << 16);
+	WriteWord(opcode);
+}
+
+void CAArch64Assembler::Fmla_4s(REGISTERMD rd, REGISTERMD rn, REGISTERMD rm)
+{
+	uint32 opcode = 0x4E20CC00;
+	opcode |= (rd <<  0);
+	opcode |= (rn <<  5);
+	opcode |= (rm << 16);
+	WriteWord(opcode);
+}
+
+void CAArch64Assembler::Fmls_4s(REGISTERMD rd, REGISTERMD rn, REGISTERMD rm)
+{
+	uint32 opcode = 0x4EA0CC00;
+	opcode |= (rd <<  0);
+	opcode |= (rn <<  5);
+	opcode |= (rm << 16);
+	WriteWord(opcode);
+}
+
+void CAArch64Assembler::Fmsub_1s(REGISTERMD rd, REGISTERMD rn, REGISTERMD rm, REGISTERMD ra)
+{
+	uint32 opcode = 0x1F008000;
+	opcode |= (rd <<  0);
+	opcode |= (rn <<  5);
+	opcode |= (ra << 10);
+	opcode |= (rm << 16);
+	WriteWord(opcode);
+}
+
+void CAArch64Assembler::Fmsub_1d(REGISTERMD rd, REGISTERMD rn, REGISTERMD rm, REGISTERMD ra)
+{
+	uint32 opcode = 0x1F408000;
+	opcode |= (rd <<  0);
+	opcode |= (rn <<  5);
+	opcode |= (ra << 10);
+	opcode |= (rm << 16);
+	WriteWord(opcode);
+}
+
 void CAArch64Assembler::Fmul_1s(REGISTERMD rd, REGISTERMD rn, REGISTERMD rm)
 {
 	uint32 opcode = 0x1E200800;
@@ -462,6 +715,15 @@ void CAArch64Assembler::Fmul_1s(REGISTERMD rd, REGISTERMD rn, REGISTERMD rm)
 	WriteWord(opcode);
 }
 
+void CAArch64Assembler::Fmul_1d(REGISTERMD rd, REGISTERMD rn, REGISTERMD rm)
+{
+	uint32 opcode = 0x1E600800;
+	opcode |= (rd <<  0);
+	opcode |= (rn <<  5);
+	opcode |= (rm << 16);
+	WriteWord(opcode);
+}
+
 void CAArch64Assembler::Fmul_4s(REGISTERMD rd, REGISTERMD rn, REGISTERMD rm)
 {
 	uint32 opcode = 0x6E20DC00;
@@ -480,6 +742,15 @@ void CAArch64Assembler::Fmax_1s(REGISTERMD rd, REGISTERMD rn, REGISTERMD rm)
 	WriteWord(opcode);
 }
 
+void CAArch64Assembler::Fmax_1d(REGISTERMD rd, REGISTERMD rn, REGISTERMD rm)
+{
+	uint32 opcode = 0x1E604800;
+	opcode |= (rd <<  0);
+	opcode |= (rn <<  5);
+	opcode |= (rm << 16);
+	WriteWord(opcode);
+}
+
 void CAArch64Assembler::Fmax_4s(REGISTERMD rd, REGISTERMD rn, REGISTERMD rm)
 {
 	uint32 opcode = 0x4E20F400;
@@ -497,6 +768,14 @@ void CAArch64Assembler::Fneg_1s(REGISTERMD rd, REGISTERMD rn)
 	WriteWord(opcode);
 }
 
+void CAArch64Assembler::Fneg_1d(REGISTERMD rd, REGISTERMD rn)
+{
+	uint32 opcode = 0x1E614000;
+	opcode |= (rd <<  0);
+	opcode |= (rn <<  5);
+	WriteWord(opcode);
+}
+
 void CAArch64Assembler::Fmin_1s(REGISTERMD rd, REGISTERMD rn, REGISTERMD rm)
 {
 	uint32 opcode = 0x1E205800;
@@ -506,6 +785,15 @@ void CAArch64Assembler::Fmin_1s(REGISTERMD rd, REGISTERMD rn, REGISTERMD rm)
 	WriteWord(opcode);
 }
 
+void CAArch64Assembler::Fmin_1d(REGISTERMD rd, REGISTERMD rn, REGISTERMD rm)
+{
+	uint32 opcode = 0x1E605800;
+	opcode |= (rd <<  0);
+	opcode |= (rn <<  5);
+	opcode |= (rm << 16);
+	WriteWord(opcode);
+}
+
 void CAArch64Assembler::Fmin_4s(REGISTERMD rd, REGISTERMD rn, REGISTERMD rm)
 {
 	uint32 opcode = 0x4EA0F400;
@@ -515,6 +803,70 @@ void CAArch64Assembler::Fmin_4s(REGISTERMD rd, REGISTERMD rn, REGISTERMD rm)
 	WriteWord(opcode);
 }
 
+void CAArch64Assembler::Frintm_1s(REGISTERMD rd, REGISTERMD rn)
+{
+	uint32 opcode = 0x1E254000;
+	opcode |= (rd <<  0);
+	opcode |= (rn <<  5);
+	WriteWord(opcode);
+}
+
+void CAArch64Assembler::Frintm_4s(REGISTERMD rd, REGISTERMD rn)
+{
+	uint32 opcode = 0x4E219800;
+	opcode |= (rd <<  0);
+	opcode |= (rn <<  5);
+	WriteWord(opcode);
+}
+
+void CAArch64Assembler::Frintn_1s(REGISTERMD rd, REGISTERMD rn)
+{
+	uint32 opcode = 0x1E244000;
+	opcode |= (rd <<  0);
+	opcode |= (rn <<  5);
+	WriteWord(opcode);
+}
+
+void CAArch64Assembler::Frintn_4s(REGISTERMD rd, REGISTERMD rn)
+{
+	uint32 opcode = 0x4E218800;
+	opcode |= (rd <<  0);
+	opcode |= (rn <<  5);
+	WriteWord(opcode);
+}
+
+void CAArch64Assembler::Frintp_1s(REGISTERMD rd, REGISTERMD rn)
+{
+	uint32 opcode = 0x1E24C000;
+	opcode |= (rd <<  0);
+	opcode |= (rn <<  5);
+	WriteWord(opcode);
+}
+
+void CAArch64Assembler::Frintp_4s(REGISTERMD rd, REGISTERMD rn)
+{
+	uint32 opcode = 0x4EA18800;
+	opcode |= (rd <<  0);
+	opcode |= (rn <<  5);
+	WriteWord(opcode);
+}
+
+void CAArch64Assembler::Frintz_1s(REGISTERMD rd, REGISTERMD rn)
+{
+	uint32 opcode = 0x1E25C000;
+	opcode |= (rd <<  0);
+	opcode |= (rn <<  5);
+	WriteWord(opcode);
+}
+
+void CAArch64Assembler::Frintz_4s(REGISTERMD rd, REGISTERMD rn)
+{
+	uint32 opcode = 0x4EA19800;
+	opcode |= (rd <<  0);
+	opcode |= (rn <<  5);
+	WriteWord(opcode);
+}
+
 void CAArch64Assembler::Fsqrt_1s(REGISTERMD rd, REGISTERMD rn)
 {
 	uint32 opcode = 0x1E21C000;
@@ -523,6 +875,14 @@ void CAArch64Assembler::Fsqrt_1s(REGISTERMD rd, REGISTERMD rn)
 	WriteWord(opcode);
 }
 
+void CAArch64Assembler::Fsqrt_1d(REGISTERMD rd, REGISTERMD rn)
+{
+	uint32 opcode = 0x1E61C000;
+	opcode |= (rd <<  0);
+	opcode |= (rn <<  5);
+	WriteWord(opcode);
+}
+
 void CAArch64Assembler::Fsub_1s(REGISTERMD rd, REGISTERMD rn, REGISTERMD rm)
 {
 	uint32 opcode = 0x1E203800;
@@ -532,6 +892,15 @@ void CAArch64Assembler::Fsub_1s(REGISTERMD rd, REGISTERMD rn, REGISTERMD rm)
 	WriteWord(opcode);
 }
 
+void CAArch64Assembler::Fsub_1d(REGISTERMD rd, REGISTERMD rn, REGISTERMD rm)
+{
+	uint32 opcode = 0x1E603800;
+	opcode |= (rd <<  0);
+	opcode |= (rn <<  5);
+	opcode |= (rm << 16);
+	WriteWord(opcode);
+}
+
 void CAArch64Assembler::Fsub_4s(REGISTERMD rd, REGISTERMD rn, REGISTERMD rm)
 {
 	uint32 opcode = 0x4EA0D400;
@@ -604,6 +973,26 @@ void CAArch64Assembler::Ldr(REGISTER64 rt, REGISTER64 rn, uint32 offset)
 	WriteLoadStoreOpImm(0xF9400000, scaledOffset, rn, rt);
 }
 
+void CAArch64Assembler::Ldr(REGISTER32 rt, REGISTER64 rn, REGISTER64 rm, bool scaled)
+{
+	uint32 opcode = 0xB8606800;
+	opcode |= (rt <<  0);
+	opcode |= (rn <<  5);
+	opcode |= (scaled ? 1 : 0) << 12;
+	opcode |= (rm << 16);
+	WriteWord(opcode);
+}
+
+void CAArch64Assembler::Ldr(REGISTER64 rt, REGISTER64 rn, REGISTER64 rm, bool scaled)
+{
+	uint32 opcode = 0xF8606800;
+	opcode |= (rt <<  0);
+	opcode |= (rn <<  5);
+	opcode |= (scaled ? 1 : 0) << 12;
+	opcode |= (rm << 16);
+	WriteWord(opcode);
+}
+
 void CAArch64Assembler::Ldr_1s(REGISTERMD rt, REGISTER64 rn, uint32 offset)
 {
 	assert((offset & 0x03) == 0);
@@ -612,6 +1001,14 @@ void CAArch64Assembler::Ldr_1s(REGISTERMD rt, REGISTER64 rn, uint32 offset)
 	WriteLoadStoreOpImm(0xBD400000, scaledOffset, rn, rt);
 }
 
+void CAArch64Assembler::Ldr_1d(REGISTERMD rt, REGISTER64 rn, uint32 offset)
+{
+	assert((offset & 0x07) == 0);
+	uint32 scaledOffset = offset / 8;
+	assert(scaledOffset < 0x1000);
+	WriteLoadStoreOpImm(0xFD400000, scaledOffset, rn, rt);
+}
+
 void CAArch64Assembler::Ldr_1q(REGISTERMD rt, REGISTER64 rn, uint32 offset)
 {
 	assert((offset & 0x0F) == 0);
@@ -620,6 +1017,34 @@ void CAArch64Assembler::Ldr_1q(REGISTERMD rt, REGISTER64 rn, uint32 offset)
 	WriteLoadStoreOpImm(0x3DC00000, scaledOffset, rn, rt);
 }
 
+void CAArch64Assembler::Ldrb(REGISTER32 rt, REGISTER64 rn, uint32 offset)
+{
+	assert(offset < 0x1000);
+	WriteLoadStoreOpImm(0x39400000, offset, rn, rt);
+}
+
+void CAArch64Assembler::Ldrh(REGISTER32 rt, REGISTER64 rn, uint32 offset)
+{
+	assert((offset & 0x01) == 0);
+	uint32 scaledOffset = offset / 2;
+	assert(scaledOffset < 0x1000);
+	WriteLoadStoreOpImm(0x79400000, scaledOffset, rn, rt);
+}
+
+void CAArch64Assembler::Ldrsb(REGISTER32 rt, REGISTER64 rn, uint32 offset)
+{
+	assert(offset < 0x1000);
+	WriteLoadStoreOpImm(0x39C00000, offset, rn, rt);
+}
+
+void CAArch64Assembler::Ldrsh(REGISTER32 rt, REGISTER64 rn, uint32 offset)
+{
+	assert((offset & 0x01) == 0);
+	uint32 scaledOffset = offset / 2;
+	assert(scaledOffset < 0x1000);
+	WriteLoadStoreOpImm(0x79C00000, scaledOffset, rn, rt);
+}
+
 void CAArch64Assembler::Lsl(REGISTER32 rd, REGISTER32 rn, uint8 sa)
 {
 	uint32 imms = 0x1F - (sa & 0x1F);
@@ -737,6 +1162,33 @@ void CAArch64Assembler::Msub(REGISTER32 rd, REGISTER32 rn, REGISTER32 rm, REGIST
 	WriteWord(opcode);
 }
 
+void CAArch64Assembler::Mul(REGISTER64 rd, REGISTER64 rn, REGISTER64 rm)
+{
+	uint32 opcode = 0x9B007C00;
+	opcode |= (rd <<  0);
+	opcode |= (rn <<  5);
+	opcode |= (rm << 16);
+	WriteWord(opcode);
+}
+
+void CAArch64Assembler::Mul_4s(REGISTERMD rd, REGISTERMD rn, REGISTERMD rm)
+{
+	uint32 opcode = 0x4EA09C00;
+	opcode |= (rd  <<  0);
+	opcode |= (rn  <<  5);
+	opcode |= (rm  << 16);
+	WriteWord(opcode);
+}
+
+void CAArch64Assembler::Mul_8h(REGISTERMD rd, REGISTERMD rn, REGISTERMD rm)
+{
+	uint32 opcode = 0x4E609C00;
+	opcode |= (rd  <<  0);
+	opcode |= (rn  <<  5);
+	opcode |= (rm  << 16);
+	WriteWord(opcode);
+}
+
 void CAArch64Assembler::Mvn(REGISTER32 rd, REGISTER32 rm)
 {
 	uint32 opcode = 0x2A200000;
@@ -746,6 +1198,15 @@ void CAArch64Assembler::Mvn(REGISTER32 rd, REGISTER32 rm)
 	WriteWord(opcode);
 }
 
+void CAArch64Assembler::Mvn(REGISTER64 rd, REGISTER64 rm)
+{
+	uint32 opcode = 0xAA200000;
+	opcode |= (rd  << 0);
+	opcode |= (xZR << 5);
+	opcode |= (rm  << 16);
+	WriteWord(opcode);
+}
+
 void CAArch64Assembler::Orn_16b(REGISTERMD rd, REGISTERMD rn, REGISTERMD rm)
 {
 	uint32 opcode = 0x4EE01C00;
@@ -764,6 +1225,15 @@ void CAArch64Assembler::Orr(REGISTER32 rd, REGISTER32 rn, REGISTER32 rm)
 	WriteWord(opcode);
 }
 
+void CAArch64Assembler::Orr(REGISTER64 rd, REGISTER64 rn, REGISTER64 rm)
+{
+	uint32 opcode = 0xAA000000;
+	opcode |= (rd <<  0);
+	opcode |= (rn <<  5);
+	opcode |= (rm << 16);
+	WriteWord(opcode);
+}
+
 void CAArch64Assembler::Orr(REGISTER32 rd, REGISTER32 rn, uint8 n, uint8 immr, uint8 imms)
 {
 	WriteLogicalOpImm(0x32000000, n, immr, imms, rn, rd);
@@ -778,6 +1248,14 @@ void CAArch64Assembler::Orr_16b(REGISTERMD rd, REGISTERMD rn, REGISTERMD rm)
 	WriteWord(opcode);
 }
 
+void CAArch64Assembler::Rbit(REGISTER32 rd, REGISTER32 rn)
+{
+	uint32 opcode = 0x5AC00000;
+	opcode |= (rd << 0);
+	opcode |= (rn << 5);
+	WriteWord(opcode);
+}
+
 void CAArch64Assembler::Ret(REGISTER64 rn)
 {
 	uint32 opcode = 0xD65F0000;
@@ -785,6 +1263,45 @@ void CAArch64Assembler::Ret(REGISTER64 rn)
 	WriteWord(opcode);
 }
 
+void CAArch64Assembler::Rev(REGISTER32 rd, REGISTER32 rn)
+{
+	uint32 opcode = 0x5AC00800;
+	opcode |= (rd << 0);
+	opcode |= (rn << 5);
+	WriteWord(opcode);
+}
+
+void CAArch64Assembler::Ror(REGISTER32 rd, REGISTER32 rs, uint8 sa)
+{
+	//Alias of extr with both sources being the same register
+	uint32 opcode = 0x13800000;
+	opcode |= (rd << 0);
+	opcode |= (rs << 5);
+	opcode |= ((sa & 0x1F) << 10);
+	opcode |= (rs << 16);
+	WriteWord(opcode);
+}
+
+void CAArch64Assembler::Ror(REGISTER64 rd, REGISTER64 rs, uint8 sa)
+{
+	uint32 opcode = 0x93C00000;
+	opcode |= (rd << 0);
+	opcode |= (rs << 5);
+	opcode |= ((sa & 0x3F) << 10);
+	opcode |= (rs << 16);
+	WriteWord(opcode);
+}
+
+void CAArch64Assembler::Rorv(REGISTER32 rd, REGISTER32 rn, REGISTER32 rm)
+{
+	WriteDataProcOpReg2(0x1AC02C00, rm, rn, rd);
+}
+
+void CAArch64Assembler::Rorv(REGISTER64 rd, REGISTER64 rn, REGISTER64 rm)
+{
+	WriteDataProcOpReg2(0x9AC02C00, rm, rn, rd);
+}
+
 void CAArch64Assembler::Scvtf_1s(REGISTERMD rd, REGISTERMD rn)
 {
 	uint32 opcode = 0x5E21D800;
@@ -793,6 +1310,22 @@ void CAArch64Assembler::Scvtf_1s(REGISTERMD rd, REGISTERMD rn)
 	WriteWord(opcode);
 }
 
+void CAArch64Assembler::Scvtf_1d(REGISTERMD rd, REGISTER32 rn)
+{
+	uint32 opcode = 0x1E620000;
+	opcode |= (rd <<  0);
+	opcode |= (rn <<  5);
+	WriteWord(opcode);
+}
+
+void CAArch64Assembler::Scvtf_1d(REGISTERMD rd, REGISTER64 rn)
+{
+	uint32 opcode = 0x9E620000;
+	opcode |= (rd <<  0);
+	opcode |= (rn <<  5);
+	WriteWord(opcode);
+}
+
 void CAArch64Assembler::Scvtf_4s(REGISTERMD rd, REGISTERMD rn)
 {
 	uint32 opcode = 0x4E21D800;
@@ -810,6 +1343,15 @@ void CAArch64Assembler::Sdiv(REGISTER32 rd, REGISTER32 rn, REGISTER32 rm)
 	WriteWord(opcode);
 }
 
+void CAArch64Assembler::Sdiv(REGISTER64 rd, REGISTER64 rn, REGISTER64 rm)
+{
+	uint32 opcode = 0x9AC00C00;
+	opcode |= (rd <<  0);
+	opcode |= (rn <<  5);
+	opcode |= (rm << 16);
+	WriteWord(opcode);
+}
+
 void CAArch64Assembler::Shl_4s(REGISTERMD rd, REGISTERMD rn, uint8 sa)
 {
 	uint8 immhb = (sa & 0x1F) + 32;
@@ -876,6 +1418,24 @@ void CAArch64Assembler::Smull(REGISTER64 rd, REGISTER32 rn, REGISTER32 rm)
 	WriteWord(opcode);
 }
 
+void CAArch64Assembler::Smull_4s(REGISTERMD rd, REGISTERMD rn, REGISTERMD rm)
+{
+	uint32 opcode = 0x0E60C000;
+	opcode |= (rd  <<  0);
+	opcode |= (rn  <<  5);
+	opcode |= (rm  << 16);
+	WriteWord(opcode);
+}
+
+void CAArch64Assembler::Smull2_4s(REGISTERMD rd, REGISTERMD rn, REGISTERMD rm)
+{
+	uint32 opcode = 0x4E60C000;
+	opcode |= (rd  <<  0);
+	opcode |= (rn  <<  5);
+	opcode |= (rm  << 16);
+	WriteWord(opcode);
+}
+
 void CAArch64Assembler::Sshr_4s(REGISTERMD rd, REGISTERMD rn, uint8 sa)
 {
 	uint8 immhb = (32 * 2) - (sa & 0x1F);
@@ -990,6 +1550,14 @@ void CAArch64Assembler::Str_1s(REGISTERMD rt, REGISTER64 rn, uint32 offset)
 	WriteLoadStoreOpImm(0xBD000000, scaledOffset, rn, rt);
 }
 
+void CAArch64Assembler::Str_1d(REGISTERMD rt, REGISTER64 rn, uint32 offset)
+{
+	assert((offset & 0x07) == 0);
+	uint32 scaledOffset = offset / 8;
+	assert(scaledOffset < 0x1000);
+	WriteLoadStoreOpImm(0xFD000000, scaledOffset, rn, rt);
+}
+
 void CAArch64Assembler::Str_1q(REGISTERMD rt, REGISTER64 rn, uint32 offset)
 {
 	assert((offset & 0x0F) == 0);
@@ -998,6 +1566,20 @@ void CAArch64Assembler::Str_1q(REGISTERMD rt, REGISTER64 rn, uint32 offset)
 	WriteLoadStoreOpImm(0x3D800000, scaledOffset, rn, rt);
 }
 
+void CAArch64Assembler::Strb(REGISTER32 rt, REGISTER64 rn, uint32 offset)
+{
+	assert(offset < 0x1000);
+	WriteLoadStoreOpImm(0x39000000, offset, rn, rt);
+}
+
+void CAArch64Assembler::Strh(REGISTER32 rt, REGISTER64 rn, uint32 offset)
+{
+	assert((offset & 0x01) == 0);
+	uint32 scaledOffset = offset / 2;
+	assert(scaledOffset < 0x1000);
+	WriteLoadStoreOpImm(0x79000000, scaledOffset, rn, rt);
+}
+
 void CAArch64Assembler::Sub(REGISTER32 rd, REGISTER32 rn, REGISTER32 rm)
 {
 	uint32 opcode = 0x4B000000;
@@ -1053,6 +1635,21 @@ void CAArch64Assembler::Sub_16b(REGISTERMD rd, REGISTERMD rn, REGISTERMD rm)
 	WriteWord(opcode);
 }
 
+void CAArch64Assembler::Sxtb(REGISTER32 rd, REGISTER32 rn)
+{
+	WriteLogicalOpImm(0x13000000, 0, 0, 7, rn, rd);
+}
+
+void CAArch64Assembler::Sxth(REGISTER32 rd, REGISTER32 rn)
+{
+	WriteLogicalOpImm(0x13000000, 0, 0, 15, rn, rd);
+}
+
+void CAArch64Assembler::Sxtw(REGISTER64 rd, REGISTER32 rn)
+{
+	WriteLogicalOpImm(0x93400000, 0, 0, 31, rn, rd);
+}
+
 void CAArch64Assembler::Tst(REGISTER32 rn, REGISTER32 rm)
 {
 	uint32 opcode = 0x6A000000;
@@ -1071,6 +1668,15 @@ void CAArch64Assembler::Udiv(REGISTER32 rd, REGISTER32 rn, REGISTER32 rm)
 	WriteWord(opcode);
 }
 
+void CAArch64Assembler::Udiv(REGISTER64 rd, REGISTER64 rn, REGISTER64 rm)
+{
+	uint32 opcode = 0x9AC00800;
+	opcode |= (rd <<  0);
+	opcode |= (rn <<  5);
+	opcode |= (rm << 16);
+	WriteWord(opcode);
+}
+
 void CAArch64Assembler::Umov_1s(REGISTER32 rd, REGISTERMD rn, uint8 index)
 {
 	assert(index < 4);
@@ -1092,6 +1698,15 @@ void CAArch64Assembler::Umull(REGISTER64 rd, REGISTER32 rn, REGISTER32 rm)
 	WriteWord(opcode);
 }
 
+void CAArch64Assembler::Umull_2d(REGISTERMD rd, REGISTERMD rn, REGISTERMD rm)
+{
+	uint32 opcode = 0x2EA0C000;
+	opcode |= (rd  <<  0);
+	opcode |= (rn  <<  5);
+	opcode |= (rm  << 16);
+	WriteWord(opcode);
+}
+
 void CAArch64Assembler::Uqadd_4s(REGISTERMD rd, REGISTERMD rn, REGISTERMD rm)
 {
 	uint32 opcode = 0x6EA00C00;
@@ -1157,6 +1772,33 @@ void CAArch64Assembler::Ushr_8h(REGISTERMD rd, REGISTERMD rn, uint8 sa)
 	WriteWord(opcode);
 }
 
+void CAArch64Assembler::Uxtb(REGISTER32 rd, REGISTER32 rn)
+{
+	WriteLogicalOpImm(0x53000000, 0, 0, 7, rn, rd);
+}
+
+void CAArch64Assembler::Uxth(REGISTER32 rd, REGISTER32 rn)
+{
+	WriteLogicalOpImm(0x53000000, 0, 0, 15, rn, rd);
+}
+
+void CAArch64Assembler::Uzp2_8h(REGISTERMD rd, REGISTERMD rn, REGISTERMD rm)
+{
+	uint32 opcode = 0x4E405800;
+	opcode |= (rd  <<  0);
+	opcode |= (rn  <<  5);
+	opcode |= (rm  << 16);
+	WriteWord(opcode);
+}
+
+void CAArch64Assembler::Xtn1_2s(REGISTERMD rd, REGISTERMD rn)
+{
+	uint32 opcode = 0x0EA12800;
+	opcode |= (rd << 0);
+	opcode |= (rn << 5);
+	WriteWord(opcode);
+}
+
 void CAArch64Assembler::Xtn1_4h(REGISTERMD rd, REGISTERMD rn)
 {
 	uint32 opcode = 0x0E612800;
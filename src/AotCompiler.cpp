@@ -0,0 +1,128 @@
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include "AotCompiler.h"
+#include "MemStream.h"
+
+using namespace Jitter;
+
+CAotCompiler::CAotCompiler(CObjectFile& objectFile, const CodeGenFactory& codeGenFactory)
+: m_objectFile(objectFile)
+, m_codeGenFactory(codeGenFactory)
+{
+
+}
+
+void CAotCompiler::AddFunction(const std::string& name, const FunctionEmitter& emitter)
+{
+	FUNCTION function;
+	function.name = name;
+	function.emitter = emitter;
+	m_functions.push_back(function);
+}
+
+size_t CAotCompiler::GetFunctionCount() const
+{
+	return m_functions.size();
+}
+
+void CAotCompiler::Compile(unsigned int threadCount)
+{
+	if(threadCount == 0)
+	{
+		threadCount = std::max<unsigned int>(std::thread::hardware_concurrency(), 1);
+	}
+	threadCount = static_cast<unsigned int>(std::min<size_t>(threadCount, std::max<size_t>(m_functions.size(), 1)));
+
+	InternalSymbolArray symbols(m_functions.size());
+	std::atomic<size_t> nextFunctionIndex(0);
+
+	if(threadCount == 1)
+	{
+		CompileFunctions(symbols, nextFunctionIndex);
+	}
+	else
+	{
+		std::mutex exceptionMutex;
+		std::exception_ptr exception;
+		std::vector<std::thread> threads;
+		threads.reserve(threadCount);
+		for(unsigned int i = 0; i < threadCount; i++)
+		{
+			threads.emplace_back(
+				[&] ()
+				{
+					try
+					{
+						CompileFunctions(symbols, nextFunctionIndex);
+					}
+					catch(...)
+					{
+						std::lock_guard<std::mutex> exceptionLock(exceptionMutex);
+						if(!exception) exception = std::current_exception();
+						//Make other workers stop
+						nextFunctionIndex = m_functions.size();
+					}
+				}
+			);
+		}
+		for(auto& thread : threads)
+		{
+			thread.join();
+		}
+		if(exception)
+		{
+			std::rethrow_exception(exception);
+		}
+	}
+
+	//Merge in registration order
+	for(const auto& symbol : symbols)
+	{
+		m_objectFile.AddInternalSymbol(symbol);
+	}
+	m_functions.clear();
+}
+
+void CAotCompiler::CompileFunctions(InternalSymbolArray& symbols, std::atomic<size_t>& nextFunctionIndex) const
+{
+	CJitter jitter(m_codeGenFactory());
+	while(1)
+	{
+		size_t functionIndex = nextFunctionIndex++;
+		if(functionIndex >= m_functions.size()) break;
+		symbols[functionIndex] = CompileFunction(jitter, m_functions[functionIndex]);
+	}
+}
+
+CObjectFile::INTERNAL_SYMBOL CAotCompiler::CompileFunction(CJitter& jitter, const FUNCTION& function) const
+{
+	CObjectFile::INTERNAL_SYMBOL symbol;
+	symbol.name = function.name;
+	symbol.location = CObjectFile::INTERNAL_SYMBOL_LOCATION_TEXT;
+
+	auto codeGen = jitter.GetCodeGen();
+	codeGen->SetExternalSymbolReferencedHandler(
+		[&] (uintptr_t value, uint32 offset)
+		{
+			CObjectFile::SYMBOL_REFERENCE reference;
+			reference.type = CObjectFile::SYMBOL_TYPE_EXTERNAL;
+			reference.symbolIndex = m_objectFile.GetExternalSymbolIndexByValue(value);
+			reference.offset = offset;
+			symbol.symbolReferences.push_back(reference);
+		}
+	);
+
+	Framework::CMemStream stream;
+	jitter.SetStream(&stream);
+	jitter.Begin();
+	function.emitter(jitter);
+	jitter.End();
+
+	codeGen->SetExternalSymbolReferencedHandler(CCodeGen::ExternalSymbolReferencedHandler());
+
+	symbol.data = std::vector<uint8>(stream.GetBuffer(), stream.GetBuffer() + stream.GetSize());
+	return symbol;
+}
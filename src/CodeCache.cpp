@@ -0,0 +1,281 @@
+#include <cassert>
+#include <cstring>
+#include "CodeCache.h"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+using namespace Jitter;
+
+struct CACHE_FILE_HEADER
+{
+	uint32	magic;
+	uint32	version;
+};
+
+struct CACHE_ENTRY_HEADER
+{
+	uint64	hash0;
+	uint64	hash1;
+	uint32	codeSize;
+	uint32	fixupCount;
+};
+
+CCodeCache::CCodeCache(const std::string& path, const std::string& configuration)
+: m_path(path)
+, m_configuration(configuration)
+{
+	OpenFile();
+}
+
+CCodeCache::~CCodeCache()
+{
+	CloseFile();
+}
+
+void CCodeCache::RegisterExternalSymbol(const std::string& name, uintptr_t value)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	m_symbolNames[value] = name;
+	m_symbolValues[name] = value;
+}
+
+const std::string* CCodeCache::GetExternalSymbolName(uintptr_t value) const
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	auto symbolIterator = m_symbolNames.find(value);
+	return (symbolIterator != std::end(m_symbolNames)) ? &symbolIterator->second : nullptr;
+}
+
+uintptr_t CCodeCache::GetExternalSymbolValue(const std::string& name) const
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	auto symbolIterator = m_symbolValues.find(name);
+	return (symbolIterator != std::end(m_symbolValues)) ? symbolIterator->second : 0;
+}
+
+const std::string& CCodeCache::GetConfiguration() const
+{
+	return m_configuration;
+}
+
+size_t CCodeCache::GetEntryCount() const
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	return m_entries.size();
+}
+
+bool CCodeCache::Find(const KEY& key, ENTRY& entry) const
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	auto entryIterator = m_entries.find(key);
+	if(entryIterator == std::end(m_entries)) return false;
+	entry = entryIterator->second;
+	return true;
+}
+
+void CCodeCache::Store(const KEY& key, const uint8* code, uint32 codeSize, const FixupArray& fixups)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	if(m_entries.find(key) != std::end(m_entries)) return;
+
+	m_storedCode.emplace_back(code, code + codeSize);
+
+	ENTRY entry;
+	entry.code = m_storedCode.back().data();
+	entry.codeSize = codeSize;
+	entry.fixups = fixups;
+	m_entries.insert(std::make_pair(key, entry));
+	m_stats.storeCount++;
+
+	if(m_file)
+	{
+		CACHE_ENTRY_HEADER entryHeader = {};
+		entryHeader.hash0 = key.hash0;
+		entryHeader.hash1 = key.hash1;
+		entryHeader.codeSize = codeSize;
+		entryHeader.fixupCount = static_cast<uint32>(fixups.size());
+		fwrite(&entryHeader, sizeof(CACHE_ENTRY_HEADER), 1, m_file);
+		for(const auto& fixup : fixups)
+		{
+			uint32 nameLength = static_cast<uint32>(fixup.symbolName.size());
+			fwrite(&fixup.offset, sizeof(uint32), 1, m_file);
+			fwrite(&nameLength, sizeof(uint32), 1, m_file);
+			fwrite(fixup.symbolName.data(), 1, nameLength, m_file);
+		}
+		fwrite(code, 1, codeSize, m_file);
+		fflush(m_file);
+	}
+}
+
+void CCodeCache::AddHit(uint64 loadTimeNs)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	m_stats.hitCount++;
+	m_stats.totalLoadTimeNs += loadTimeNs;
+}
+
+void CCodeCache::AddMiss()
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	m_stats.missCount++;
+}
+
+void CCodeCache::AddUncacheable()
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	m_stats.uncacheableCount++;
+}
+
+CCodeCache::STATS CCodeCache::GetStats() const
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	return m_stats;
+}
+
+void CCodeCache::OpenFile()
+{
+	const uint8* fileData = nullptr;
+	size_t fileSize = 0;
+
+#ifdef _WIN32
+	if(FILE* inputFile = fopen(m_path.c_str(), "rb"))
+	{
+		fseek(inputFile, 0, SEEK_END);
+		m_fileContents.resize(ftell(inputFile));
+		fseek(inputFile, 0, SEEK_SET);
+		m_fileContents.resize(fread(m_fileContents.data(), 1, m_fileContents.size(), inputFile));
+		fclose(inputFile);
+		fileData = m_fileContents.data();
+		fileSize = m_fileContents.size();
+	}
+#else
+	int fd = open(m_path.c_str(), O_RDONLY);
+	if(fd >= 0)
+	{
+		struct stat fileStat = {};
+		if((fstat(fd, &fileStat) == 0) && (fileStat.st_size != 0))
+		{
+			void* mapping = mmap(nullptr, fileStat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+			if(mapping != MAP_FAILED)
+			{
+				m_mapping = mapping;
+				m_mappingSize = fileStat.st_size;
+				fileData = reinterpret_cast<const uint8*>(mapping);
+				fileSize = m_mappingSize;
+			}
+		}
+		close(fd);
+	}
+#endif
+
+	size_t validSize = fileData ? ParseEntries(fileData, fileSize) : 0;
+	if(validSize == 0)
+	{
+		//Missing, incompatible or corrupted file, start a new one
+		m_entries.clear();
+#ifndef _WIN32
+		if(m_mapping)
+		{
+			munmap(m_mapping, m_mappingSize);
+			m_mapping = nullptr;
+			m_mappingSize = 0;
+		}
+#endif
+		m_file = fopen(m_path.c_str(), "wb");
+		if(m_file)
+		{
+			CACHE_FILE_HEADER header = {};
+			header.magic = CACHE_FILE_MAGIC;
+			header.version = CACHE_FILE_VERSION;
+			fwrite(&header, sizeof(CACHE_FILE_HEADER), 1, m_file);
+			fflush(m_file);
+		}
+		return;
+	}
+
+	if(validSize != fileSize)
+	{
+		//Drop a partially written entry, new entries wouldn't be reachable otherwise
+#ifdef _WIN32
+		FILE* outputFile = fopen(m_path.c_str(), "wb");
+		if(outputFile)
+		{
+			fwrite(fileData, 1, validSize, outputFile);
+			fclose(outputFile);
+		}
+#else
+		int result = truncate(m_path.c_str(), validSize);
+		assert(result == 0);
+		(void)result;
+#endif
+	}
+	m_file = fopen(m_path.c_str(), "ab");
+}
+
+size_t CCodeCache::ParseEntries(const uint8* fileData, size_t fileSize)
+{
+	if(fileSize < sizeof(CACHE_FILE_HEADER)) return 0;
+
+	CACHE_FILE_HEADER header = {};
+	memcpy(&header, fileData, sizeof(CACHE_FILE_HEADER));
+	if((header.magic != CACHE_FILE_MAGIC) || (header.version != CACHE_FILE_VERSION)) return 0;
+
+	size_t position = sizeof(CACHE_FILE_HEADER);
+	while(1)
+	{
+		size_t entryPosition = position;
+		if((fileSize - position) < sizeof(CACHE_ENTRY_HEADER)) return entryPosition;
+
+		CACHE_ENTRY_HEADER entryHeader = {};
+		memcpy(&entryHeader, fileData + position, sizeof(CACHE_ENTRY_HEADER));
+		position += sizeof(CACHE_ENTRY_HEADER);
+
+		ENTRY entry;
+		for(uint32 i = 0; i < entryHeader.fixupCount; i++)
+		{
+			uint32 fixupHeader[2] = {};
+			if((fileSize - position) < sizeof(fixupHeader)) return entryPosition;
+			memcpy(fixupHeader, fileData + position, sizeof(fixupHeader));
+			position += sizeof(fixupHeader);
+			if((fileSize - position) < fixupHeader[1]) return entryPosition;
+
+			FIXUP fixup;
+			fixup.offset = fixupHeader[0];
+			fixup.symbolName = std::string(reinterpret_cast<const char*>(fileData + position), fixupHeader[1]);
+			position += fixupHeader[1];
+			entry.fixups.push_back(fixup);
+		}
+
+		if((fileSize - position) < entryHeader.codeSize) return entryPosition;
+		entry.code = fileData + position;
+		entry.codeSize = entryHeader.codeSize;
+		position += entryHeader.codeSize;
+
+		KEY key;
+		key.hash0 = entryHeader.hash0;
+		key.hash1 = entryHeader.hash1;
+		m_entries.insert(std::make_pair(key, entry));
+	}
+}
+
+void CCodeCache::CloseFile()
+{
+	if(m_file)
+	{
+		fclose(m_file);
+		m_file = nullptr;
+	}
+#ifndef _WIN32
+	if(m_mapping)
+	{
+		munmap(m_mapping, m_mappingSize);
+		m_mapping = nullptr;
+		m_mappingSize = 0;
+	}
+#endif
+}
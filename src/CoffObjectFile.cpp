@@ -42,8 +42,9 @@ void CCoffObjectFile::Write(Framework::CStream& stream)
 	FillStringTable(stringTable, m_internalSymbols, internalSymbolInfos);
 	FillStringTable(stringTable, m_externalSymbols, externalSymbolInfos);
 
-	auto textSection = BuildSection(m_internalSymbols, internalSymbolInfos, INTERNAL_SYMBOL_LOCATION_TEXT);
-	auto dataSection = BuildSection(m_internalSymbols, internalSymbolInfos, INTERNAL_SYMBOL_LOCATION_DATA);
+	auto internalSymbolAliases = GetInternalSymbolAliases();
+	auto textSection = BuildSection(m_internalSymbols, internalSymbolInfos, internalSymbolAliases, INTERNAL_SYMBOL_LOCATION_TEXT);
+	auto dataSection = BuildSection(m_internalSymbols, internalSymbolInfos, internalSymbolAliases, INTERNAL_SYMBOL_LOCATION_DATA);
 
 	auto symbols = BuildSymbols(m_internalSymbols, internalSymbolInfos, 
 		m_externalSymbols, externalSymbolInfos, textSection.data.size(), dataSection.data.size());
@@ -148,7 +149,7 @@ void CCoffObjectFile::FillStringTable(StringTable& stringTable, const ExternalSy
 	}
 }
 
-CCoffObjectFile::SECTION CCoffObjectFile::BuildSection(const InternalSymbolArray& internalSymbols, InternalSymbolInfoArray& internalSymbolInfos, INTERNAL_SYMBOL_LOCATION location)
+CCoffObjectFile::SECTION CCoffObjectFile::BuildSection(const InternalSymbolArray& internalSymbols, InternalSymbolInfoArray& internalSymbolInfos, const InternalSymbolAliasArray& internalSymbolAliases, INTERNAL_SYMBOL_LOCATION location)
 {
 	SECTION section;
 	auto& sectionData(section.data);
@@ -164,6 +165,12 @@ CCoffObjectFile::SECTION CCoffObjectFile::BuildSection(const InternalSymbolArray
 		if(internalSymbol.location != location) continue;
 
 		auto& internalSymbolInfo = internalSymbolInfos[i];
+		if(internalSymbolAliases[i] != i)
+		{
+			//Folded, share the code of the first identical symbol
+			internalSymbolInfo.dataOffset = internalSymbolInfos[internalSymbolAliases[i]].dataOffset;
+			continue;
+		}
 		internalSymbolInfo.dataOffset = sectionData.size();
 		for(const auto& symbolReference : internalSymbol.symbolReferences)
 		{
@@ -0,0 +1,288 @@
+#include <algorithm>
+#include <stdexcept>
+#include "CompileService.h"
+#include "MemStream.h"
+
+using namespace Jitter;
+
+namespace
+{
+	//Heap ordering: highest priority first, then submission order
+	struct JobComparator
+	{
+		template <typename JobPtr>
+		bool operator()(const JobPtr& job1, const JobPtr& job2) const
+		{
+			if(job1->priority != job2->priority) return job1->priority < job2->priority;
+			return job1->id > job2->id;
+		}
+	};
+}
+
+CCompileService::CCompileService(const CodeGenFactory& codeGenFactory, unsigned int threadCount)
+: m_codeGenFactory(codeGenFactory)
+{
+	if(threadCount == 0)
+	{
+		threadCount = std::max<unsigned int>(std::thread::hardware_concurrency(), 1);
+	}
+	for(unsigned int i = 0; i < threadCount; i++)
+	{
+		m_queues.push_back(WorkerQueuePtr(new WORKER_QUEUE()));
+	}
+	m_threads.reserve(threadCount);
+	for(unsigned int i = 0; i < threadCount; i++)
+	{
+		m_threads.emplace_back(&CCompileService::WorkerProc, this, i);
+	}
+}
+
+CCompileService::~CCompileService()
+{
+	{
+		std::lock_guard<std::mutex> activeJobsLock(m_activeJobsMutex);
+		for(const auto& activeJobPair : m_activeJobs)
+		{
+			activeJobPair.second->cancelled = true;
+		}
+		m_activeJobs.clear();
+	}
+	{
+		std::lock_guard<std::mutex> workLock(m_workMutex);
+		m_terminating = true;
+	}
+	m_workCondition.notify_all();
+	for(auto& thread : m_threads)
+	{
+		thread.join();
+	}
+
+	COMPLETED_JOB completedJob;
+	while(GetCompletedJob(completedJob))
+	{
+
+	}
+}
+
+unsigned int CCompileService::GetThreadCount() const
+{
+	return static_cast<unsigned int>(m_threads.size());
+}
+
+CCompileService::JOB_ID CCompileService::Submit(const FunctionEmitter& emitter, int priority)
+{
+	auto job = std::make_shared<JOB>();
+	job->priority = priority;
+	job->emitter = emitter;
+	return EnqueueJob(job);
+}
+
+CCompileService::JOB_ID CCompileService::SubmitIr(IrData irData, int priority)
+{
+	auto job = std::make_shared<JOB>();
+	job->priority = priority;
+	job->irData = std::move(irData);
+	return EnqueueJob(job);
+}
+
+bool CCompileService::Cancel(JOB_ID jobId)
+{
+	//Cancelled jobs are left in their queue and skipped by workers
+	std::lock_guard<std::mutex> activeJobsLock(m_activeJobsMutex);
+	auto jobIterator = m_activeJobs.find(jobId);
+	if(jobIterator == std::end(m_activeJobs)) return false;
+	jobIterator->second->cancelled = true;
+	m_activeJobs.erase(jobIterator);
+	return true;
+}
+
+bool CCompileService::GetCompletedJob(COMPLETED_JOB& completedJob)
+{
+	if(!m_completedJobs)
+	{
+		auto node = m_completedHead.exchange(nullptr, std::memory_order_acquire);
+		while(node)
+		{
+			auto nextNode = node->next;
+			node->next = m_completedJobs;
+			m_completedJobs = node;
+			node = nextNode;
+		}
+	}
+	if(!m_completedJobs) return false;
+
+	auto node = m_completedJobs;
+	m_completedJobs = node->next;
+	completedJob = std::move(node->job);
+	delete node;
+	return true;
+}
+
+void CCompileService::WaitIdle()
+{
+	std::unique_lock<std::mutex> workLock(m_workMutex);
+	m_idleCondition.wait(workLock, [this] () { return m_pendingJobCount == 0; });
+}
+
+CCompileService::JOB_ID CCompileService::EnqueueJob(const JobPtr& job)
+{
+	{
+		std::lock_guard<std::mutex> activeJobsLock(m_activeJobsMutex);
+		job->id = m_nextJobId++;
+		m_activeJobs.insert(std::make_pair(job->id, job));
+	}
+
+	{
+		auto& queue = *m_queues[m_nextQueueIndex++ % m_queues.size()];
+		std::lock_guard<std::mutex> queueLock(queue.mutex);
+		queue.jobs.push_back(job);
+		std::push_heap(std::begin(queue.jobs), std::end(queue.jobs), JobComparator());
+	}
+
+	{
+		std::lock_guard<std::mutex> workLock(m_workMutex);
+		m_queuedJobCount++;
+		m_pendingJobCount++;
+	}
+	m_workCondition.notify_one();
+
+	return job->id;
+}
+
+CCompileService::JobPtr CCompileService::PeekJob(WORKER_QUEUE& queue)
+{
+	std::lock_guard<std::mutex> queueLock(queue.mutex);
+	if(queue.jobs.empty()) return JobPtr();
+	return queue.jobs.front();
+}
+
+bool CCompileService::PopJob(WORKER_QUEUE& queue, const JobPtr& job)
+{
+	std::lock_guard<std::mutex> queueLock(queue.mutex);
+	if(queue.jobs.empty() || (queue.jobs.front() != job)) return false;
+	std::pop_heap(std::begin(queue.jobs), std::end(queue.jobs), JobComparator());
+	queue.jobs.pop_back();
+	return true;
+}
+
+CCompileService::JobPtr CCompileService::TakeJob(unsigned int workerIndex)
+{
+	//Priority is only ordered within a queue, compare the top of every queue to find the best job
+	while(1)
+	{
+		WORKER_QUEUE* bestQueue = nullptr;
+		JobPtr bestJob;
+		for(unsigned int i = 0; i < m_queues.size(); i++)
+		{
+			auto& queue = *m_queues[(workerIndex + i) % m_queues.size()];
+			auto job = PeekJob(queue);
+			if(job && (!bestJob || JobComparator()(bestJob, job)))
+			{
+				bestQueue = &queue;
+				bestJob = job;
+			}
+		}
+		if(!bestQueue) return JobPtr();
+
+		//Queues might have changed since they were inspected, look again if the job isn't on top anymore
+		if(PopJob(*bestQueue, bestJob))
+		{
+			std::lock_guard<std::mutex> workLock(m_workMutex);
+			m_queuedJobCount--;
+			return bestJob;
+		}
+	}
+}
+
+void CCompileService::WorkerProc(unsigned int workerIndex)
+{
+	std::unique_ptr<CJitter> jitter(new CJitter(m_codeGenFactory()));
+	while(1)
+	{
+		auto job = TakeJob(workerIndex);
+		if(job)
+		{
+			RunJob(jitter, job);
+			FinishJob();
+			continue;
+		}
+
+		std::unique_lock<std::mutex> workLock(m_workMutex);
+		m_workCondition.wait(workLock, [this] () { return m_terminating || (m_queuedJobCount > 0); });
+		if(m_terminating) break;
+	}
+}
+
+void CCompileService::RunJob(std::unique_ptr<CJitter>& jitter, const JobPtr& job)
+{
+	if(job->cancelled) return;
+
+	auto node = new COMPLETION_NODE();
+	node->job.id = job->id;
+
+	try
+	{
+		Framework::CMemStream stream;
+		jitter->SetStream(&stream);
+		if(job->emitter)
+		{
+			jitter->Begin();
+			job->emitter(*jitter);
+			jitter->End();
+		}
+		else
+		{
+			Framework::CMemStream irStream;
+			irStream.Write(job->irData.data(), job->irData.size());
+			irStream.Seek(0, Framework::STREAM_SEEK_SET);
+			if(!jitter->BeginFromIr(irStream))
+			{
+				throw std::runtime_error("Empty IR data.");
+			}
+			jitter->End();
+		}
+		jitter->SetStream(nullptr);
+		node->job.function = CMemoryFunction(stream.GetBuffer(), stream.GetSize());
+	}
+	catch(...)
+	{
+		node->job.exception = std::current_exception();
+		//The session might have been left open, start over with a new jitter
+		jitter.reset(new CJitter(m_codeGenFactory()));
+	}
+
+	{
+		std::lock_guard<std::mutex> activeJobsLock(m_activeJobsMutex);
+		if(job->cancelled)
+		{
+			delete node;
+			return;
+		}
+		m_activeJobs.erase(job->id);
+	}
+
+	PublishCompletion(node);
+}
+
+void CCompileService::FinishJob()
+{
+	bool idle = false;
+	{
+		std::lock_guard<std::mutex> workLock(m_workMutex);
+		m_pendingJobCount--;
+		idle = (m_pendingJobCount == 0);
+	}
+	if(idle)
+	{
+		m_idleCondition.notify_all();
+	}
+}
+
+void CCompileService::PublishCompletion(COMPLETION_NODE* node)
+{
+	node->next = m_completedHead.load(std::memory_order_relaxed);
+	while(!m_completedHead.compare_exchange_weak(node->next, node, std::memory_order_release, std::memory_order_relaxed))
+	{
+
+	}
+}
@@ -0,0 +1,57 @@
+#include <cstdio>
+#include <functional>
+#include <string>
+#include <thread>
+#include "CompileTraceWriter.h"
+
+using namespace Jitter;
+
+CCompileTraceWriter::CCompileTraceWriter(Framework::CStream& stream)
+: m_stream(stream)
+, m_startTime(std::chrono::steady_clock::now())
+{
+	m_stream.Write("[", 1);
+}
+
+CCompileTraceWriter::~CCompileTraceWriter()
+{
+	m_stream.Write("\n]\n", 3);
+}
+
+void CCompileTraceWriter::WriteEvent(const char* name, TimePoint startTime, TimePoint endTime, const ArgumentArray& arguments)
+{
+	char buffer[256];
+	snprintf(buffer, sizeof(buffer), "{\"name\":\"%s\",\"cat\":\"jit\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f",
+		name, GetThreadId(), GetTimestamp(startTime), GetTimestamp(endTime) - GetTimestamp(startTime));
+
+	std::string event(buffer);
+	if(!arguments.empty())
+	{
+		event += ",\"args\":{";
+		for(size_t i = 0; i < arguments.size(); i++)
+		{
+			const auto& argument = arguments[i];
+			snprintf(buffer, sizeof(buffer), "%s\"%s\":%llu", (i == 0) ? "" : ",",
+				argument.first, static_cast<unsigned long long>(argument.second));
+			event += buffer;
+		}
+		event += "}";
+	}
+	event += "}";
+
+	std::lock_guard<std::mutex> streamLock(m_streamMutex);
+	m_stream.Write(m_firstEvent ? "\n" : ",\n", m_firstEvent ? 1 : 2);
+	m_stream.Write(event.c_str(), event.size());
+	m_firstEvent = false;
+}
+
+double CCompileTraceWriter::GetTimestamp(TimePoint timePoint) const
+{
+	//Trace event timestamps are in microseconds
+	return std::chrono::duration<double, std::micro>(timePoint - m_startTime).count();
+}
+
+uint32 CCompileTraceWriter::GetThreadId()
+{
+	return static_cast<uint32>(std::hash<std::thread::id>()(std::this_thread::get_id()));
+}
@@ -0,0 +1,432 @@
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <stdexcept>
+#include "ElfObjectFile.h"
+
+using namespace Jitter;
+
+template <typename ElfTraits>
+CElfObjectFile<ElfTraits>::CElfObjectFile(CPU_ARCH cpuArch)
+: CObjectFile(cpuArch)
+{
+
+}
+
+template <typename ElfTraits>
+CElfObjectFile<ElfTraits>::~CElfObjectFile()
+{
+
+}
+
+static uint32 AlignOffset(uint32 offset, uint32 alignment)
+{
+	return (offset + alignment - 1) & ~(alignment - 1);
+}
+
+static void WritePadding(Framework::CStream& stream, uint32 currentOffset, uint32 targetOffset)
+{
+	assert(currentOffset <= targetOffset);
+	static const uint8 zero[0x10] = {};
+	while(currentOffset != targetOffset)
+	{
+		uint32 size = std::min<uint32>(targetOffset - currentOffset, sizeof(zero));
+		stream.Write(zero, size);
+		currentOffset += size;
+	}
+}
+
+template <typename ElfTraits>
+void CElfObjectFile<ElfTraits>::Write(Framework::CStream& stream)
+{
+	auto internalSymbolInfos = InternalSymbolInfoArray(m_internalSymbols.size());
+	auto externalSymbolInfos = ExternalSymbolInfoArray(m_externalSymbols.size());
+
+	StringTable stringTable;
+	stringTable.push_back(0x00);
+	FillStringTable(stringTable, m_internalSymbols, internalSymbolInfos);
+	FillStringTable(stringTable, m_externalSymbols, externalSymbolInfos);
+
+	auto internalSymbolAliases = GetInternalSymbolAliases();
+	auto textSection = BuildSection(m_internalSymbols, internalSymbolInfos, internalSymbolAliases, INTERNAL_SYMBOL_LOCATION_TEXT, TEXT_SECTION_ALIGNMENT);
+	auto dataSection = BuildSection(m_internalSymbols, internalSymbolInfos, internalSymbolAliases, INTERNAL_SYMBOL_LOCATION_DATA, ElfTraits::POINTER_SIZE);
+
+	auto symbols = BuildSymbols(m_internalSymbols, internalSymbolInfos, m_externalSymbols, externalSymbolInfos);
+
+	auto textSectionRelocations = BuildRelocations(textSection, internalSymbolInfos, externalSymbolInfos);
+	auto dataSectionRelocations = BuildRelocations(dataSection, internalSymbolInfos, externalSymbolInfos);
+
+	bool usesRela = (ElfTraits::RELOCATION_SECTION_TYPE == Elf::SHT_RELA);
+
+	StringTable sectionStringTable;
+	sectionStringTable.push_back(0x00);
+	uint32 textNameOffset          = AddString(sectionStringTable, ".text");
+	uint32 dataNameOffset          = AddString(sectionStringTable, ".data");
+	uint32 noteGnuStackNameOffset  = AddString(sectionStringTable, ".note.GNU-stack");
+	uint32 relTextNameOffset       = AddString(sectionStringTable, usesRela ? ".rela.text" : ".rel.text");
+	uint32 relDataNameOffset       = AddString(sectionStringTable, usesRela ? ".rela.data" : ".rel.data");
+	uint32 symtabNameOffset        = AddString(sectionStringTable, ".symtab");
+	uint32 strtabNameOffset        = AddString(sectionStringTable, ".strtab");
+	uint32 shstrtabNameOffset      = AddString(sectionStringTable, ".shstrtab");
+
+	uint32 textSectionSize         = static_cast<uint32>(textSection.data.size());
+	uint32 dataSectionSize         = static_cast<uint32>(dataSection.data.size());
+	uint32 textRelocationsSize     = static_cast<uint32>(textSectionRelocations.size() * sizeof(typename ElfTraits::RELOCATION));
+	uint32 dataRelocationsSize     = static_cast<uint32>(dataSectionRelocations.size() * sizeof(typename ElfTraits::RELOCATION));
+	uint32 symbolsSize             = static_cast<uint32>(symbols.size() * sizeof(typename ElfTraits::SYMBOL));
+
+	//File layout: header, section contents, relocations, symbols, string tables and section headers
+	uint32 textSectionOffset       = AlignOffset(sizeof(typename ElfTraits::ELF_HEADER), TEXT_SECTION_ALIGNMENT);
+	uint32 dataSectionOffset       = AlignOffset(textSectionOffset + textSectionSize, ElfTraits::POINTER_SIZE);
+	uint32 textRelocationsOffset   = AlignOffset(dataSectionOffset + dataSectionSize, ElfTraits::POINTER_SIZE);
+	uint32 dataRelocationsOffset   = textRelocationsOffset + textRelocationsSize;
+	uint32 symbolsOffset           = dataRelocationsOffset + dataRelocationsSize;
+	uint32 stringTableOffset       = symbolsOffset + symbolsSize;
+	uint32 sectionStringTableOffset = stringTableOffset + static_cast<uint32>(stringTable.size());
+	uint32 sectionHeadersOffset    = AlignOffset(sectionStringTableOffset + static_cast<uint32>(sectionStringTable.size()), ElfTraits::POINTER_SIZE);
+
+	SectionHeaderArray sectionHeaders(SECTION_COUNT);
+	memset(sectionHeaders.data(), 0, sizeof(typename ElfTraits::SECTION_HEADER) * sectionHeaders.size());
+
+	{
+		auto& sectionHeader = sectionHeaders[SECTION_INDEX_TEXT];
+		sectionHeader.name          = textNameOffset;
+		sectionHeader.type          = Elf::SHT_PROGBITS;
+		sectionHeader.flags         = Elf::SHF_ALLOC | Elf::SHF_EXECINSTR;
+		sectionHeader.offset        = textSectionOffset;
+		sectionHeader.size          = textSectionSize;
+		sectionHeader.addressAlign  = TEXT_SECTION_ALIGNMENT;
+	}
+
+	{
+		auto& sectionHeader = sectionHeaders[SECTION_INDEX_DATA];
+		sectionHeader.name          = dataNameOffset;
+		sectionHeader.type          = Elf::SHT_PROGBITS;
+		sectionHeader.flags         = Elf::SHF_ALLOC | Elf::SHF_WRITE;
+		sectionHeader.offset        = dataSectionOffset;
+		sectionHeader.size          = dataSectionSize;
+		sectionHeader.addressAlign  = ElfTraits::POINTER_SIZE;
+	}
+
+	{
+		//Empty section telling the linker that we don't need an executable stack
+		auto& sectionHeader = sectionHeaders[SECTION_INDEX_NOTE_GNU_STACK];
+		sectionHeader.name          = noteGnuStackNameOffset;
+		sectionHeader.type          = Elf::SHT_PROGBITS;
+		sectionHeader.offset        = dataSectionOffset + dataSectionSize;
+		sectionHeader.addressAlign  = 1;
+	}
+
+	{
+		auto& sectionHeader = sectionHeaders[SECTION_INDEX_REL_TEXT];
+		sectionHeader.name          = relTextNameOffset;
+		sectionHeader.type          = ElfTraits::RELOCATION_SECTION_TYPE;
+		sectionHeader.flags         = Elf::SHF_INFO_LINK;
+		sectionHeader.offset        = textRelocationsOffset;
+		sectionHeader.size          = textRelocationsSize;
+		sectionHeader.link          = SECTION_INDEX_SYMTAB;
+		sectionHeader.info          = SECTION_INDEX_TEXT;
+		sectionHeader.addressAlign  = ElfTraits::POINTER_SIZE;
+		sectionHeader.entrySize     = sizeof(typename ElfTraits::RELOCATION);
+	}
+
+	{
+		auto& sectionHeader = sectionHeaders[SECTION_INDEX_REL_DATA];
+		sectionHeader.name          = relDataNameOffset;
+		sectionHeader.type          = ElfTraits::RELOCATION_SECTION_TYPE;
+		sectionHeader.flags         = Elf::SHF_INFO_LINK;
+		sectionHeader.offset        = dataRelocationsOffset;
+		sectionHeader.size          = dataRelocationsSize;
+		sectionHeader.link          = SECTION_INDEX_SYMTAB;
+		sectionHeader.info          = SECTION_INDEX_DATA;
+		sectionHeader.addressAlign  = ElfTraits::POINTER_SIZE;
+		sectionHeader.entrySize     = sizeof(typename ElfTraits::RELOCATION);
+	}
+
+	{
+		auto& sectionHeader = sectionHeaders[SECTION_INDEX_SYMTAB];
+		sectionHeader.name          = symtabNameOffset;
+		sectionHeader.type          = Elf::SHT_SYMTAB;
+		sectionHeader.offset        = symbolsOffset;
+		sectionHeader.size          = symbolsSize;
+		sectionHeader.link          = SECTION_INDEX_STRTAB;
+		sectionHeader.info          = 1;		//Index of first global symbol (only the null symbol is local)
+		sectionHeader.addressAlign  = ElfTraits::POINTER_SIZE;
+		sectionHeader.entrySize     = sizeof(typename ElfTraits::SYMBOL);
+	}
+
+	{
+		auto& sectionHeader = sectionHeaders[SECTION_INDEX_STRTAB];
+		sectionHeader.name          = strtabNameOffset;
+		sectionHeader.type          = Elf::SHT_STRTAB;
+		sectionHeader.offset        = stringTableOffset;
+		sectionHeader.size          = static_cast<uint32>(stringTable.size());
+		sectionHeader.addressAlign  = 1;
+	}
+
+	{
+		auto& sectionHeader = sectionHeaders[SECTION_INDEX_SHSTRTAB];
+		sectionHeader.name          = shstrtabNameOffset;
+		sectionHeader.type          = Elf::SHT_STRTAB;
+		sectionHeader.offset        = sectionStringTableOffset;
+		sectionHeader.size          = static_cast<uint32>(sectionStringTable.size());
+		sectionHeader.addressAlign  = 1;
+	}
+
+	typename ElfTraits::ELF_HEADER header;
+	memset(&header, 0, sizeof(typename ElfTraits::ELF_HEADER));
+	header.ident[0] = 0x7F;
+	header.ident[1] = 'E';
+	header.ident[2] = 'L';
+	header.ident[3] = 'F';
+	header.ident[4] = ElfTraits::ELF_CLASS;
+	header.ident[5] = Elf::ELFDATA2LSB;
+	header.ident[6] = Elf::EV_CURRENT;
+	header.type                          = Elf::ET_REL;
+	header.machine                       = GetMachine();
+	header.version                       = Elf::EV_CURRENT;
+	header.sectionHeaderOffset           = sectionHeadersOffset;
+	header.flags                         = GetFlags();
+	header.headerSize                    = sizeof(typename ElfTraits::ELF_HEADER);
+	header.sectionHeaderEntrySize        = sizeof(typename ElfTraits::SECTION_HEADER);
+	header.sectionHeaderCount            = SECTION_COUNT;
+	header.sectionHeaderStringTableIndex = SECTION_INDEX_SHSTRTAB;
+
+	uint32 currentOffset = 0;
+	stream.Write(&header, sizeof(typename ElfTraits::ELF_HEADER));
+	currentOffset += sizeof(typename ElfTraits::ELF_HEADER);
+
+	WritePadding(stream, currentOffset, textSectionOffset);
+	stream.Write(textSection.data.data(), textSectionSize);
+	currentOffset = textSectionOffset + textSectionSize;
+
+	WritePadding(stream, currentOffset, dataSectionOffset);
+	stream.Write(dataSection.data.data(), dataSectionSize);
+	currentOffset = dataSectionOffset + dataSectionSize;
+
+	WritePadding(stream, currentOffset, textRelocationsOffset);
+	stream.Write(textSectionRelocations.data(), textRelocationsSize);
+	stream.Write(dataSectionRelocations.data(), dataRelocationsSize);
+	stream.Write(symbols.data(), symbolsSize);
+	stream.Write(stringTable.data(), stringTable.size());
+	stream.Write(sectionStringTable.data(), sectionStringTable.size());
+	currentOffset = sectionStringTableOffset + static_cast<uint32>(sectionStringTable.size());
+
+	WritePadding(stream, currentOffset, sectionHeadersOffset);
+	stream.Write(sectionHeaders.data(), sizeof(typename ElfTraits::SECTION_HEADER) * sectionHeaders.size());
+}
+
+template <typename ElfTraits>
+uint32 CElfObjectFile<ElfTraits>::AddString(StringTable& stringTable, const std::string& value)
+{
+	uint32 offset = static_cast<uint32>(stringTable.size());
+	stringTable.insert(std::end(stringTable), std::begin(value), std::end(value));
+	stringTable.push_back(0);
+	return offset;
+}
+
+template <typename ElfTraits>
+void CElfObjectFile<ElfTraits>::FillStringTable(StringTable& stringTable, const InternalSymbolArray& internalSymbols, InternalSymbolInfoArray& internalSymbolInfos)
+{
+	for(uint32 i = 0; i < internalSymbols.size(); i++)
+	{
+		internalSymbolInfos[i].nameOffset = AddString(stringTable, internalSymbols[i].name);
+	}
+}
+
+template <typename ElfTraits>
+void CElfObjectFile<ElfTraits>::FillStringTable(StringTable& stringTable, const ExternalSymbolArray& externalSymbols, ExternalSymbolInfoArray& externalSymbolInfos)
+{
+	for(uint32 i = 0; i < externalSymbols.size(); i++)
+	{
+		externalSymbolInfos[i].nameOffset = AddString(stringTable, externalSymbols[i].name);
+	}
+}
+
+template <typename ElfTraits>
+typename CElfObjectFile<ElfTraits>::SECTION CElfObjectFile<ElfTraits>::BuildSection(const InternalSymbolArray& internalSymbols, InternalSymbolInfoArray& internalSymbolInfos, const InternalSymbolAliasArray& internalSymbolAliases, INTERNAL_SYMBOL_LOCATION location, uint32 symbolAlignment)
+{
+	SECTION section;
+	auto& sectionData(section.data);
+	for(uint32 i = 0; i < internalSymbols.size(); i++)
+	{
+		const auto& internalSymbol = internalSymbols[i];
+		if(internalSymbol.location != location) continue;
+
+		auto& internalSymbolInfo = internalSymbolInfos[i];
+		if(internalSymbolAliases[i] != i)
+		{
+			//Folded, share the code of the first identical symbol
+			internalSymbolInfo.dataOffset = internalSymbolInfos[internalSymbolAliases[i]].dataOffset;
+			continue;
+		}
+
+		sectionData.resize(AlignOffset(static_cast<uint32>(sectionData.size()), symbolAlignment));
+		internalSymbolInfo.dataOffset = static_cast<uint32>(sectionData.size());
+		for(const auto& symbolReference : internalSymbol.symbolReferences)
+		{
+			SYMBOL_REFERENCE newReference;
+			newReference.offset			= symbolReference.offset + internalSymbolInfo.dataOffset;
+			newReference.symbolIndex	= symbolReference.symbolIndex;
+			newReference.type			= symbolReference.type;
+			section.symbolReferences.push_back(newReference);
+		}
+		sectionData.insert(std::end(sectionData), std::begin(internalSymbol.data), std::end(internalSymbol.data));
+	}
+	return section;
+}
+
+template <typename ElfTraits>
+typename CElfObjectFile<ElfTraits>::SymbolArray CElfObjectFile<ElfTraits>::BuildSymbols(
+	const InternalSymbolArray& internalSymbols, InternalSymbolInfoArray& internalSymbolInfos,
+	const ExternalSymbolArray& externalSymbols, ExternalSymbolInfoArray& externalSymbolInfos
+	)
+{
+	SymbolArray symbols;
+	symbols.reserve(1 + internalSymbols.size() + externalSymbols.size());
+
+	//Null symbol
+	{
+		typename ElfTraits::SYMBOL symbol;
+		memset(&symbol, 0, sizeof(typename ElfTraits::SYMBOL));
+		symbols.push_back(symbol);
+	}
+
+	//Internal symbols
+	for(uint32 i = 0; i < internalSymbols.size(); i++)
+	{
+		const auto& internalSymbol = internalSymbols[i];
+		auto& internalSymbolInfo = internalSymbolInfos[i];
+		internalSymbolInfo.symbolIndex = static_cast<uint32>(symbols.size());
+
+		bool isText = (internalSymbol.location == CObjectFile::INTERNAL_SYMBOL_LOCATION_TEXT);
+
+		typename ElfTraits::SYMBOL symbol;
+		memset(&symbol, 0, sizeof(typename ElfTraits::SYMBOL));
+		symbol.name           = internalSymbolInfo.nameOffset;
+		symbol.value          = internalSymbolInfo.dataOffset;
+		symbol.size           = static_cast<uint32>(internalSymbol.data.size());
+		symbol.info           = Elf::MakeSymbolInfo(Elf::STB_GLOBAL, isText ? Elf::STT_FUNC : Elf::STT_OBJECT);
+		symbol.sectionIndex   = isText ? SECTION_INDEX_TEXT : SECTION_INDEX_DATA;
+		symbols.push_back(symbol);
+	}
+
+	//External symbols
+	for(uint32 i = 0; i < externalSymbols.size(); i++)
+	{
+		auto& externalSymbolInfo = externalSymbolInfos[i];
+		externalSymbolInfo.symbolIndex = static_cast<uint32>(symbols.size());
+
+		typename ElfTraits::SYMBOL symbol;
+		memset(&symbol, 0, sizeof(typename ElfTraits::SYMBOL));
+		symbol.name           = externalSymbolInfo.nameOffset;
+		symbol.info           = Elf::MakeSymbolInfo(Elf::STB_GLOBAL, Elf::STT_NOTYPE);
+		symbol.sectionIndex   = Elf::SHN_UNDEF;
+		symbols.push_back(symbol);
+	}
+
+	return symbols;
+}
+
+template <typename ElfTraits>
+typename CElfObjectFile<ElfTraits>::RelocationArray CElfObjectFile<ElfTraits>::BuildRelocations(
+	SECTION& section, const InternalSymbolInfoArray& internalSymbolInfos,
+	const ExternalSymbolInfoArray& externalSymbolInfos) const
+{
+	RelocationArray relocations;
+	relocations.reserve(section.symbolReferences.size() * 2); //Times 2 because of possible MOVW/MOVT pairs
+
+	for(const auto& symbolReference : section.symbolReferences)
+	{
+		uint32 symbolIndex = (symbolReference.type == SYMBOL_TYPE_INTERNAL) ?
+			internalSymbolInfos[symbolReference.symbolIndex].symbolIndex :
+			externalSymbolInfos[symbolReference.symbolIndex].symbolIndex;
+		auto patchAddress = section.data.data() + symbolReference.offset;
+
+		//Addends are always 0. ELF32 targets use REL relocations where the addend is
+		//read from the relocated field, so the field needs to be cleared.
+		if((m_cpuArch == CObjectFile::CPU_ARCH_ARM) && (symbolReference.type == SYMBOL_TYPE_EXTERNAL))
+		{
+			//We assume that all external symbols are coming from the OP_CALL emitter on ARM
+			//which uses MOVW and MOVT
+			relocations.push_back(ElfTraits::MakeRelocation(symbolReference.offset + 0, symbolIndex, Elf::R_ARM_MOVW_ABS_NC));
+			relocations.push_back(ElfTraits::MakeRelocation(symbolReference.offset + 4, symbolIndex, Elf::R_ARM_MOVT_ABS));
+
+			*reinterpret_cast<uint32*>(patchAddress + 0) &= ~0xF0FFF;
+			*reinterpret_cast<uint32*>(patchAddress + 4) &= ~0xF0FFF;
+		}
+		else if((m_cpuArch == CObjectFile::CPU_ARCH_ARM64) && (symbolReference.type == SYMBOL_TYPE_EXTERNAL))
+		{
+			//We assume that the instruction that references this symbol is BL.
+			relocations.push_back(ElfTraits::MakeRelocation(symbolReference.offset, symbolIndex, Elf::R_AARCH64_CALL26));
+
+			*reinterpret_cast<uint32*>(patchAddress) &= ~0x03FFFFFF;
+		}
+		else
+		{
+			//Pointer sized absolute reference (MOV reg, imm on x86, pointers in data sections)
+			uint32 type = 0;
+			switch(m_cpuArch)
+			{
+			case CObjectFile::CPU_ARCH_X86:
+				type = Elf::R_386_32;
+				break;
+			case CObjectFile::CPU_ARCH_X64:
+				type = Elf::R_X86_64_64;
+				break;
+			case CObjectFile::CPU_ARCH_ARM:
+				type = Elf::R_ARM_ABS32;
+				break;
+			case CObjectFile::CPU_ARCH_ARM64:
+				type = Elf::R_AARCH64_ABS64;
+				break;
+			default:
+				assert(false);
+				break;
+			}
+			relocations.push_back(ElfTraits::MakeRelocation(symbolReference.offset, symbolIndex, type));
+
+			switch(ElfTraits::POINTER_SIZE)
+			{
+			case 4:
+				*reinterpret_cast<uint32*>(patchAddress) = 0;
+				break;
+			case 8:
+				*reinterpret_cast<uint64*>(patchAddress) = 0;
+				break;
+			default:
+				assert(false);
+				break;
+			}
+		}
+	}
+
+	return relocations;
+}
+
+template <typename ElfTraits>
+uint16 CElfObjectFile<ElfTraits>::GetMachine() const
+{
+	switch(m_cpuArch)
+	{
+	case CPU_ARCH_X86:
+		return Elf::EM_386;
+	case CPU_ARCH_X64:
+		return Elf::EM_X86_64;
+	case CPU_ARCH_ARM:
+		return Elf::EM_ARM;
+	case CPU_ARCH_ARM64:
+		return Elf::EM_AARCH64;
+	default:
+		throw std::runtime_error("ElfObjectFile: Unsupported CPU architecture.");
+	}
+}
+
+template <typename ElfTraits>
+uint32 CElfObjectFile<ElfTraits>::GetFlags() const
+{
+	return (m_cpuArch == CPU_ARCH_ARM) ? Elf::EF_ARM_EABI_VER5 : 0;
+}
+
+template class Jitter::CElfObjectFile<ELF_TRAITS_32>;
+template class Jitter::CElfObjectFile<ELF_TRAITS_64>;
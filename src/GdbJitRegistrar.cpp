@@ -0,0 +1,359 @@
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+#include <iterator>
+#include "GdbJitRegistrar.h"
+#include "ElfDefs.h"
+
+#ifdef CODEGEN_DEFINE_GDB_JIT_INTERFACE
+
+extern "C"
+{
+	jit_descriptor __jit_debug_descriptor = { 1, JIT_NOACTION, nullptr, nullptr };
+
+	//GDB sets a breakpoint in this function, it must not be inlined or optimized away
+#if defined(_MSC_VER)
+	__declspec(noinline) void __jit_debug_register_code()
+	{
+
+	}
+#else
+	__attribute__((noinline)) void __jit_debug_register_code()
+	{
+		__asm__ __volatile__("" ::: "memory");
+	}
+#endif
+}
+
+#endif
+
+#if (UINTPTR_MAX == UINT32_MAX)
+typedef Elf::ELF_HEADER_32 HostElfHeader;
+typedef Elf::SECTION_HEADER_32 HostElfSectionHeader;
+typedef Elf::SYMBOL_32 HostElfSymbol;
+static const uint8 g_hostElfClass = Elf::ELFCLASS32;
+#elif (UINTPTR_MAX == UINT64_MAX)
+typedef Elf::ELF_HEADER_64 HostElfHeader;
+typedef Elf::SECTION_HEADER_64 HostElfSectionHeader;
+typedef Elf::SYMBOL_64 HostElfSymbol;
+static const uint8 g_hostElfClass = Elf::ELFCLASS64;
+#else
+static_assert(false, "Unsupported pointer size.");
+#endif
+
+#if defined(__x86_64__) || defined(_M_X64)
+static const uint16 g_hostElfMachine = Elf::EM_X86_64;
+#elif defined(__i386__) || defined(_M_IX86)
+static const uint16 g_hostElfMachine = Elf::EM_386;
+#elif defined(__aarch64__) || defined(_M_ARM64)
+static const uint16 g_hostElfMachine = Elf::EM_AARCH64;
+#elif defined(__arm__) || defined(_M_ARM)
+static const uint16 g_hostElfMachine = Elf::EM_ARM;
+#else
+static const uint16 g_hostElfMachine = 0;
+#endif
+
+//Null section, one section per function, symtab, strtab and shstrtab
+static_assert((CGdbJitRegistrar::MAX_BATCH_SIZE + 4) <= Elf::SHN_LORESERVE, "Batch size too large for section indices.");
+
+CGdbJitRegistrar& CGdbJitRegistrar::GetInstance()
+{
+	static CGdbJitRegistrar instance;
+	return instance;
+}
+
+CGdbJitRegistrar::CGdbJitRegistrar()
+{
+#ifdef CODEGEN_DEFINE_GDB_JIT_INTERFACE
+	m_descriptor = &__jit_debug_descriptor;
+	m_registerCode = &__jit_debug_register_code;
+#endif
+}
+
+void CGdbJitRegistrar::SetInterface(jit_descriptor* descriptor, RegisterCodeFunction registerCode)
+{
+	assert((descriptor == nullptr) == (registerCode == nullptr));
+	std::unique_lock<std::mutex> registrarLock(m_mutex);
+	//Symbols registered through the previous interface are dropped, only code registered from now on is visible
+	m_pendingFunctions.clear();
+	while(!m_symbolFiles.empty())
+	{
+		UnregisterSymbolFile(m_symbolFiles.begin());
+	}
+	m_descriptor = descriptor;
+	m_registerCode = registerCode;
+}
+
+void CGdbJitRegistrar::SetEnabled(bool enabled)
+{
+	std::unique_lock<std::mutex> registrarLock(m_mutex);
+	m_enabled = enabled;
+	if(!m_enabled)
+	{
+		m_pendingFunctions.clear();
+		while(!m_symbolFiles.empty())
+		{
+			UnregisterSymbolFile(m_symbolFiles.begin());
+		}
+	}
+}
+
+bool CGdbJitRegistrar::IsEnabled() const
+{
+	return m_enabled;
+}
+
+void CGdbJitRegistrar::SetBatchSize(unsigned int batchSize)
+{
+	assert(batchSize != 0);
+	std::unique_lock<std::mutex> registrarLock(m_mutex);
+	m_batchSize = std::min<unsigned int>(std::max<unsigned int>(batchSize, 1), MAX_BATCH_SIZE);
+	if(m_pendingFunctions.size() >= m_batchSize)
+	{
+		FlushLocked();
+	}
+}
+
+void CGdbJitRegistrar::RegisterCode(const void* code, size_t size, const std::string& name)
+{
+	std::unique_lock<std::mutex> registrarLock(m_mutex);
+	if(!m_enabled || !m_descriptor) return;
+
+	FUNCTION function;
+	function.address = reinterpret_cast<uintptr_t>(code);
+	function.size = size;
+	function.name = name;
+	if(function.name.empty())
+	{
+		char defaultName[32];
+		snprintf(defaultName, sizeof(defaultName), "CodeGen_%llx", static_cast<unsigned long long>(function.address));
+		function.name = defaultName;
+	}
+	m_pendingFunctions.push_back(std::move(function));
+
+	if(m_pendingFunctions.size() >= m_batchSize)
+	{
+		FlushLocked();
+	}
+}
+
+void CGdbJitRegistrar::UnregisterCode(const void* code)
+{
+	std::unique_lock<std::mutex> registrarLock(m_mutex);
+	auto address = reinterpret_cast<uintptr_t>(code);
+	auto matchesAddress = [address] (const FUNCTION& function) { return function.address == address; };
+
+	{
+		auto functionIterator = std::find_if(m_pendingFunctions.begin(), m_pendingFunctions.end(), matchesAddress);
+		if(functionIterator != m_pendingFunctions.end())
+		{
+			m_pendingFunctions.erase(functionIterator);
+			return;
+		}
+	}
+
+	auto functionSymbolFileIterator = m_functionSymbolFiles.find(address);
+	if(functionSymbolFileIterator == m_functionSymbolFiles.end()) return;
+
+	//Symbol files can't be modified once registered, replace it by one without the freed function.
+	//Its address might be reused by new code and GDB must not keep resolving it to the old symbol.
+	auto symbolFileIterator = functionSymbolFileIterator->second;
+	FunctionArray functions;
+	std::remove_copy_if((*symbolFileIterator)->functions.begin(), (*symbolFileIterator)->functions.end(),
+		std::back_inserter(functions), matchesAddress);
+	UnregisterSymbolFile(symbolFileIterator);
+	if(!functions.empty())
+	{
+		RegisterSymbolFile(std::move(functions));
+	}
+}
+
+void CGdbJitRegistrar::Flush()
+{
+	std::unique_lock<std::mutex> registrarLock(m_mutex);
+	FlushLocked();
+}
+
+void CGdbJitRegistrar::FlushLocked()
+{
+	if(m_pendingFunctions.empty()) return;
+	FunctionArray functions;
+	std::swap(functions, m_pendingFunctions);
+	RegisterSymbolFile(std::move(functions));
+}
+
+void CGdbJitRegistrar::RegisterSymbolFile(FunctionArray functions)
+{
+	auto symbolFile = std::unique_ptr<SYMBOL_FILE>(new SYMBOL_FILE());
+	symbolFile->image = BuildSymbolFile(functions);
+	symbolFile->functions = std::move(functions);
+
+	auto& entry = symbolFile->entry;
+	entry.symfile_addr = reinterpret_cast<const char*>(symbolFile->image.data());
+	entry.symfile_size = symbolFile->image.size();
+	entry.prev_entry = nullptr;
+	entry.next_entry = m_descriptor->first_entry;
+	if(entry.next_entry)
+	{
+		entry.next_entry->prev_entry = &entry;
+	}
+
+	m_descriptor->first_entry = &entry;
+	m_descriptor->relevant_entry = &entry;
+	m_descriptor->action_flag = JIT_REGISTER_FN;
+	m_registerCode();
+
+	auto symbolFileIterator = m_symbolFiles.insert(m_symbolFiles.end(), std::move(symbolFile));
+	for(const auto& function : (*symbolFileIterator)->functions)
+	{
+		m_functionSymbolFiles[function.address] = symbolFileIterator;
+	}
+}
+
+void CGdbJitRegistrar::UnregisterSymbolFile(SymbolFileList::iterator symbolFileIterator)
+{
+	auto& entry = (*symbolFileIterator)->entry;
+	if(entry.prev_entry)
+	{
+		entry.prev_entry->next_entry = entry.next_entry;
+	}
+	else
+	{
+		m_descriptor->first_entry = entry.next_entry;
+	}
+	if(entry.next_entry)
+	{
+		entry.next_entry->prev_entry = entry.prev_entry;
+	}
+
+	m_descriptor->relevant_entry = &entry;
+	m_descriptor->action_flag = JIT_UNREGISTER_FN;
+	m_registerCode();
+
+	//Addresses of freed functions might have been reused by functions in other symbol files
+	for(const auto& function : (*symbolFileIterator)->functions)
+	{
+		auto functionSymbolFileIterator = m_functionSymbolFiles.find(function.address);
+		if((functionSymbolFileIterator != m_functionSymbolFiles.end()) && (functionSymbolFileIterator->second == symbolFileIterator))
+		{
+			m_functionSymbolFiles.erase(functionSymbolFileIterator);
+		}
+	}
+
+	m_symbolFiles.erase(symbolFileIterator);
+}
+
+std::vector<uint8> CGdbJitRegistrar::BuildSymbolFile(const FunctionArray& functions)
+{
+	//Layout: header, string tables, symbol table, section headers
+	//Each function gets its own NOBITS section placed at the function's address
+	assert(functions.size() <= MAX_BATCH_SIZE);
+	std::vector<char> sectionStringTable(1, 0);
+	auto addSectionString =
+		[&] (const char* string)
+		{
+			uint32 offset = static_cast<uint32>(sectionStringTable.size());
+			sectionStringTable.insert(sectionStringTable.end(), string, string + strlen(string) + 1);
+			return offset;
+		};
+	uint32 textNameOffset = addSectionString(".text");
+	uint32 symtabNameOffset = addSectionString(".symtab");
+	uint32 strtabNameOffset = addSectionString(".strtab");
+	uint32 shstrtabNameOffset = addSectionString(".shstrtab");
+
+	std::vector<char> stringTable(1, 0);
+	std::vector<HostElfSymbol> symbols(1, HostElfSymbol());
+	uint32 firstTextSectionIndex = 1;
+	for(uint32 i = 0; i < functions.size(); i++)
+	{
+		const auto& function(functions[i]);
+		HostElfSymbol symbol = {};
+		symbol.name = static_cast<uint32>(stringTable.size());
+		symbol.info = Elf::MakeSymbolInfo(Elf::STB_GLOBAL, Elf::STT_FUNC);
+		symbol.sectionIndex = static_cast<uint16>(firstTextSectionIndex + i);
+		symbol.value = 0;
+		symbol.size = static_cast<decltype(symbol.size)>(function.size);
+		symbols.push_back(symbol);
+		stringTable.insert(stringTable.end(), function.name.begin(), function.name.end());
+		stringTable.push_back(0);
+	}
+
+	uint32 symtabSectionIndex = firstTextSectionIndex + static_cast<uint32>(functions.size());
+	uint32 strtabSectionIndex = symtabSectionIndex + 1;
+	uint32 shstrtabSectionIndex = strtabSectionIndex + 1;
+	uint32 sectionCount = shstrtabSectionIndex + 1;
+
+	auto align = [] (size_t value) { return (value + 7) & ~static_cast<size_t>(7); };
+	size_t shstrtabOffset = sizeof(HostElfHeader);
+	size_t strtabOffset = shstrtabOffset + sectionStringTable.size();
+	size_t symtabOffset = align(strtabOffset + stringTable.size());
+	size_t sectionHeadersOffset = align(symtabOffset + (symbols.size() * sizeof(HostElfSymbol)));
+	size_t imageSize = sectionHeadersOffset + (sectionCount * sizeof(HostElfSectionHeader));
+
+	std::vector<HostElfSectionHeader> sectionHeaders(sectionCount, HostElfSectionHeader());
+	for(uint32 i = 0; i < functions.size(); i++)
+	{
+		const auto& function(functions[i]);
+		auto& sectionHeader = sectionHeaders[firstTextSectionIndex + i];
+		sectionHeader.name = textNameOffset;
+		sectionHeader.type = Elf::SHT_NOBITS;
+		sectionHeader.flags = Elf::SHF_ALLOC | Elf::SHF_EXECINSTR;
+		sectionHeader.address = function.address;
+		sectionHeader.offset = static_cast<uint32>(sectionHeadersOffset);
+		sectionHeader.size = static_cast<decltype(sectionHeader.size)>(function.size);
+		sectionHeader.addressAlign = 16;
+	}
+	{
+		auto& sectionHeader = sectionHeaders[symtabSectionIndex];
+		sectionHeader.name = symtabNameOffset;
+		sectionHeader.type = Elf::SHT_SYMTAB;
+		sectionHeader.offset = symtabOffset;
+		sectionHeader.size = symbols.size() * sizeof(HostElfSymbol);
+		sectionHeader.link = strtabSectionIndex;
+		sectionHeader.info = 1;
+		sectionHeader.addressAlign = 8;
+		sectionHeader.entrySize = sizeof(HostElfSymbol);
+	}
+	{
+		auto& sectionHeader = sectionHeaders[strtabSectionIndex];
+		sectionHeader.name = strtabNameOffset;
+		sectionHeader.type = Elf::SHT_STRTAB;
+		sectionHeader.offset = strtabOffset;
+		sectionHeader.size = stringTable.size();
+		sectionHeader.addressAlign = 1;
+	}
+	{
+		auto& sectionHeader = sectionHeaders[shstrtabSectionIndex];
+		sectionHeader.name = shstrtabNameOffset;
+		sectionHeader.type = Elf::SHT_STRTAB;
+		sectionHeader.offset = shstrtabOffset;
+		sectionHeader.size = sectionStringTable.size();
+		sectionHeader.addressAlign = 1;
+	}
+
+	HostElfHeader header = {};
+	header.ident[0] = 0x7F;
+	header.ident[1] = 'E';
+	header.ident[2] = 'L';
+	header.ident[3] = 'F';
+	header.ident[4] = g_hostElfClass;
+	header.ident[5] = Elf::ELFDATA2LSB;
+	header.ident[6] = Elf::EV_CURRENT;
+	header.type = Elf::ET_REL;
+	header.machine = g_hostElfMachine;
+	header.version = Elf::EV_CURRENT;
+	header.sectionHeaderOffset = sectionHeadersOffset;
+	header.headerSize = sizeof(HostElfHeader);
+	header.sectionHeaderEntrySize = sizeof(HostElfSectionHeader);
+	header.sectionHeaderCount = static_cast<uint16>(sectionCount);
+	header.sectionHeaderStringTableIndex = static_cast<uint16>(shstrtabSectionIndex);
+
+	std::vector<uint8> image(imageSize, 0);
+	memcpy(image.data(), &header, sizeof(header));
+	memcpy(image.data() + shstrtabOffset, sectionStringTable.data(), sectionStringTable.size());
+	memcpy(image.data() + strtabOffset, stringTable.data(), stringTable.size());
+	memcpy(image.data() + symtabOffset, symbols.data(), symbols.size() * sizeof(HostElfSymbol));
+	memcpy(image.data() + sectionHeadersOffset, sectionHeaders.data(), sectionHeaders.size() * sizeof(HostElfSectionHeader));
+	return image;
+}
@@ -1,4 +1,5 @@
 #include <assert.h>
+#include <stdexcept>
 #include "Jitter.h"
 #include "PtrMacro.h"
 #include "placeholder_def.h"
@@ -6,6 +7,42 @@
 using namespace std;
 using namespace Jitter;
 
+const CJitter::ROUNDMODE CJitter::ROUND_NEAREST;
+const CJitter::ROUNDMODE CJitter::ROUND_PLUSINFINITY;
+const CJitter::ROUNDMODE CJitter::ROUND_MINUSINFINITY;
+const CJitter::ROUNDMODE CJitter::ROUND_TRUNCATE;
+
+namespace
+{
+	bool Is256BitsMdSymbol(const SymbolPtr& symbol)
+	{
+		return (symbol->m_type == SYM_RELATIVE256) || (symbol->m_type == SYM_TEMPORARY256);
+	}
+
+	//Operations every code generator can handle on 256-bits values, either directly or split in halves
+	bool Is256BitsMdOperation(OPERATION operation)
+	{
+		switch(operation)
+		{
+		case OP_MD_ADD_B:
+		case OP_MD_ADD_H:
+		case OP_MD_ADD_W:
+		case OP_MD_SUB_B:
+		case OP_MD_SUB_H:
+		case OP_MD_SUB_W:
+		case OP_MD_AND:
+		case OP_MD_OR:
+		case OP_MD_XOR:
+		case OP_MD_ADD_S:
+		case OP_MD_SUB_S:
+		case OP_MD_MUL_S:
+			return true;
+		default:
+			return false;
+		}
+	}
+}
+
 CJitter::CJitter(CCodeGen* codeGen)
 : m_codeGen(codeGen)
 {
@@ -24,16 +61,87 @@ CCodeGen* CJitter::GetCodeGen()
 
 void CJitter::SetStream(Framework::CStream* stream)
 {
+	m_stream = stream;
 	m_codeGen->SetStream(stream);
 }
 
+void CJitter::SetCodeCache(CCodeCache* codeCache)
+{
+	m_codeCache = codeCache;
+}
+
+void CJitter::SetIrCaptureStream(Framework::CStream* irCaptureStream)
+{
+	m_irCaptureStream = irCaptureStream;
+}
+
+void CJitter::EnableProfiling(uint32* counters, size_t counterCount)
+{
+	assert(m_blockStarted == false);
+	m_profileCounters = counters;
+	m_profileCounterCount = counterCount;
+}
+
+const CJitter::ProfileCounterArray& CJitter::GetProfileCounters() const
+{
+	return m_profileCounterInfos;
+}
+
+size_t CJitter::GetRequiredProfileCounterCount() const
+{
+	return m_requiredProfileCounterCount;
+}
+
+CJitter::BlockFrequencyMap CJitter::MakeBlockFrequencies(const ProfileCounterArray& counterInfos, const uint32* counters)
+{
+	BlockFrequencyMap result;
+	for(size_t i = 0; i < counterInfos.size(); i++)
+	{
+		const auto& counterInfo(counterInfos[i]);
+		if(counterInfo.targetBlockId != 0) continue;
+		result[counterInfo.blockId] += counters[i];
+	}
+	return result;
+}
+
+void CJitter::SetBlockFrequencies(const BlockFrequencyMap& blockFrequencies)
+{
+	assert(m_blockStarted == false);
+	m_blockFrequencies = blockFrequencies;
+}
+
+const CJitter::BlockIdArray& CJitter::GetBlockLayout() const
+{
+	return m_blockLayout;
+}
+
+void CJitter::SetCompileTier(COMPILE_TIER compileTier)
+{
+	m_compileTier = compileTier;
+}
+
+CJitter::COMPILE_TIER CJitter::GetCompileTier() const
+{
+	return m_compileTier;
+}
+
+void CJitter::SetEntryCounter(uint32* entryCounter)
+{
+	assert(m_blockStarted == false);
+	m_entryCounter = entryCounter;
+}
+
 void CJitter::Begin()
 {
 	assert(m_blockStarted == false);
 	m_blockStarted = true;
 	m_nextTemporary = 1;
 	m_nextBlockId = 1;
+	m_coldRegion = false;
 	m_basicBlocks.clear();
+	m_profileCounterInfos.clear();
+	m_requiredProfileCounterCount = 0;
+	m_blockLayout.clear();
 
 	StartBlock(m_nextBlockId++);
 }
@@ -44,7 +152,30 @@ void CJitter::End()
 	assert(m_blockStarted == true);
 	m_blockStarted = false;
 
-	Compile();
+	if(m_irCaptureStream)
+	{
+		WriteIr(*m_irCaptureStream);
+	}
+
+	if(CanUseCodeCache())
+	{
+		std::vector<uintptr_t> externalSymbols;
+		auto key = MakeCodeCacheKey(externalSymbols);
+		if(!LoadFromCodeCache(key))
+		{
+			CompileToCodeCache(key, externalSymbols);
+		}
+	}
+	else
+	{
+		Compile();
+	}
+
+	//Profiling settings only apply to one function
+	m_profileCounters = nullptr;
+	m_profileCounterCount = 0;
+	m_blockFrequencies.clear();
+	m_entryCounter = nullptr;
 }
 
 bool CJitter::IsStackEmpty() const
@@ -57,6 +188,7 @@ void CJitter::StartBlock(uint32 blockId)
 	auto blockIterator = m_basicBlocks.emplace(m_basicBlocks.end(), BASIC_BLOCK());
 	m_currentBlock = &(*blockIterator);
 	m_currentBlock->id = blockId;
+	m_currentBlock->cold = m_coldRegion;
 }
 
 CJitter::LABEL CJitter::CreateLabel()
@@ -122,10 +254,15 @@ CONDITION CJitter::GetReverseCondition(CONDITION condition)
 	throw std::exception();
 }
 
-void CJitter::BeginIf(CONDITION condition)
+void CJitter::BeginIf(CONDITION condition, BRANCH_HINT hint)
 {
 	uint32 jumpBlockId = m_nextBlockId++;
-	m_ifStack.push(jumpBlockId);
+
+	IF_STATE ifState;
+	ifState.nextBlockId	= jumpBlockId;
+	ifState.hint		= hint;
+	ifState.parentCold	= m_coldRegion;
+	m_ifStack.push(ifState);
 
 	STATEMENT statement;
 	statement.op			= OP_CONDJMP;
@@ -137,6 +274,8 @@ void CJitter::BeginIf(CONDITION condition)
 
 	assert(m_shadow.GetCount() == 0);
 
+	m_coldRegion = ifState.parentCold || (hint == BRANCH_HINT_UNLIKELY);
+
 	uint32 newBlockId = m_nextBlockId++;
 	StartBlock(newBlockId);
 }
@@ -146,16 +285,19 @@ void CJitter::Else()
 	assert(!m_ifStack.empty());
 	assert(m_shadow.GetCount() == 0);
 
-	uint32 nextBlockId = m_ifStack.top(); m_ifStack.pop();
+	auto& ifState = m_ifStack.top();
+	uint32 nextBlockId = ifState.nextBlockId;
 
 	uint32 jumpBlockId = m_nextBlockId++;
-	m_ifStack.push(jumpBlockId);
+	ifState.nextBlockId = jumpBlockId;
 
 	STATEMENT statement;
 	statement.op			= OP_JMP;
 	statement.jmpBlock		= jumpBlockId;
 	InsertStatement(statement);
 
+	m_coldRegion = ifState.parentCold || (ifState.hint == BRANCH_HINT_LIKELY);
+
 	StartBlock(nextBlockId);
 }
 
@@ -164,7 +306,11 @@ void CJitter::EndIf()
 	assert(!m_ifStack.empty());
 	assert(m_shadow.GetCount() == 0);
 
-	uint32 nextBlockId = m_ifStack.top(); m_ifStack.pop();
+	const auto& ifState = m_ifStack.top();
+	uint32 nextBlockId = ifState.nextBlockId;
+	m_coldRegion = ifState.parentCold;
+	m_ifStack.pop();
+
 	StartBlock(nextBlockId);
 }
 
@@ -347,6 +493,21 @@ void CJitter::Lzc()
 	m_shadow.Push(tempSym);
 }
 
+void CJitter::Ctz()
+{
+	InsertUnaryStatement(OP_CTZ);
+}
+
+void CJitter::PopCount()
+{
+	InsertUnaryStatement(OP_POPCNT);
+}
+
+void CJitter::ByteSwap()
+{
+	InsertUnaryStatement(OP_BSWAP);
+}
+
 void CJitter::Mult()
 {
 	SymbolPtr tempSym = MakeSymbol(SYM_TEMPORARY64, m_nextTemporary++);
@@ -400,14 +561,22 @@ void CJitter::SignExt()
 
 void CJitter::SignExt8()
 {
-	Shl(24);
-	Sra(24);
+	InsertUnaryStatement(OP_SEXT8);
 }
 
 void CJitter::SignExt16()
 {
-	Shl(16);
-	Sra(16);
+	InsertUnaryStatement(OP_SEXT16);
+}
+
+void CJitter::ZeroExt8()
+{
+	InsertUnaryStatement(OP_ZEXT8);
+}
+
+void CJitter::ZeroExt16()
+{
+	InsertUnaryStatement(OP_ZEXT16);
 }
 
 void CJitter::Shl()
@@ -494,6 +663,55 @@ void CJitter::Srl(uint8 nAmount)
 	m_shadow.Push(tempSym);
 }
 
+void CJitter::Ror()
+{
+	SymbolPtr tempSym = MakeSymbol(SYM_TEMPORARY, m_nextTemporary++);
+
+	STATEMENT statement;
+	statement.op	= OP_ROR;
+	statement.src2	= MakeSymbolRef(m_shadow.Pull());
+	statement.src1	= MakeSymbolRef(m_shadow.Pull());
+	statement.dst	= MakeSymbolRef(tempSym);
+	InsertStatement(statement);
+
+	m_shadow.Push(tempSym);
+}
+
+void CJitter::Ror(uint8 nAmount)
+{
+	SymbolPtr tempSym = MakeSymbol(SYM_TEMPORARY, m_nextTemporary++);
+
+	STATEMENT statement;
+	statement.op	= OP_ROR;
+	statement.src2	= MakeSymbolRef(MakeSymbol(SYM_CONSTANT, nAmount));
+	statement.src1	= MakeSymbolRef(m_shadow.Pull());
+	statement.dst	= MakeSymbolRef(tempSym);
+	InsertStatement(statement);
+
+	m_shadow.Push(tempSym);
+}
+
+void CJitter::Rol()
+{
+	//Rotating left by n is the same as rotating right by -n, rotate amounts are taken modulo 32
+	SymbolPtr amountSym = MakeSymbol(SYM_TEMPORARY, m_nextTemporary++);
+
+	STATEMENT negStatement;
+	negStatement.op		= OP_SUB;
+	negStatement.src2	= MakeSymbolRef(m_shadow.Pull());
+	negStatement.src1	= MakeSymbolRef(MakeSymbol(SYM_CONSTANT, 0));
+	negStatement.dst	= MakeSymbolRef(amountSym);
+	InsertStatement(negStatement);
+
+	m_shadow.Push(amountSym);
+	Ror();
+}
+
+void CJitter::Rol(uint8 nAmount)
+{
+	Ror(static_cast<uint8>((32 - nAmount) & 0x1F));
+}
+
 void CJitter::Sub()
 {
 	InsertBinaryStatement(OP_SUB);
@@ -540,24 +758,59 @@ void CJitter::AddRef()
 
 void CJitter::LoadFromRef()
 {
-	SymbolPtr tempSym = MakeSymbol(SYM_TEMPORARY, m_nextTemporary++);
+	InsertLoadFromRefStatement(OP_LOADFROMREF);
+}
 
-	STATEMENT statement;
-	statement.op	= OP_LOADFROMREF;
-	statement.src1	= MakeSymbolRef(m_shadow.Pull());
-	statement.dst	= MakeSymbolRef(tempSym);
-	InsertStatement(statement);
+void CJitter::StoreAtRef()
+{
+	InsertStoreAtRefStatement(OP_STOREATREF);
+}
 
-	m_shadow.Push(tempSym);
+void CJitter::Load8FromRef()
+{
+	InsertLoadFromRefStatement(OP_LOAD8FROMREF);
 }
 
-void CJitter::StoreAtRef()
+void CJitter::Load8SFromRef()
+{
+	InsertLoadFromRefStatement(OP_LOAD8SFROMREF);
+}
+
+void CJitter::Load16FromRef()
+{
+	InsertLoadFromRefStatement(OP_LOAD16FROMREF);
+}
+
+void CJitter::Load16SFromRef()
+{
+	InsertLoadFromRefStatement(OP_LOAD16SFROMREF);
+}
+
+void CJitter::Store8AtRef()
+{
+	InsertStoreAtRefStatement(OP_STORE8ATREF);
+}
+
+void CJitter::Store16AtRef()
 {
+	InsertStoreAtRefStatement(OP_STORE16ATREF);
+}
+
+void CJitter::LoadFromTlb(size_t tableOffset, uint8 pageShift, void* missHandler)
+{
+	assert((pageShift != 0) && (pageShift < 32));
+
+	SymbolPtr tempSym = MakeSymbol(SYM_TEMPORARY, m_nextTemporary++);
+
 	STATEMENT statement;
-	statement.op	= OP_STOREATREF;
-	statement.src2	= MakeSymbolRef(m_shadow.Pull());
+	statement.op	= OP_LOADFROMTLB;
 	statement.src1	= MakeSymbolRef(m_shadow.Pull());
+	statement.src2	= MakeSymbolRef(MakeConstantPtr(reinterpret_cast<uintptr_t>(missHandler)));
+	statement.src3	= MakeSymbolRef(MakeConstant64((static_cast<uint64>(pageShift) << 32) | static_cast<uint32>(tableOffset)));
+	statement.dst	= MakeSymbolRef(tempSym);
 	InsertStatement(statement);
+
+	m_shadow.Push(tempSym);
 }
 
 //64-bits
@@ -627,6 +880,36 @@ void CJitter::ExtHigh64()
 	m_shadow.Push(tempSym);
 }
 
+void CJitter::SignExtTo64()
+{
+	SymbolPtr tempSym = MakeSymbol(SYM_TEMPORARY64, m_nextTemporary++);
+
+	STATEMENT statement;
+	statement.op	= OP_SEXTTO64;
+	statement.src1	= MakeSymbolRef(m_shadow.Pull());
+	statement.dst	= MakeSymbolRef(tempSym);
+	InsertStatement(statement);
+
+	assert(GetSymbolSize(statement.src1) == 4);
+
+	m_shadow.Push(tempSym);
+}
+
+void CJitter::ZeroExtTo64()
+{
+	SymbolPtr tempSym = MakeSymbol(SYM_TEMPORARY64, m_nextTemporary++);
+
+	STATEMENT statement;
+	statement.op	= OP_ZEXTTO64;
+	statement.src1	= MakeSymbolRef(m_shadow.Pull());
+	statement.dst	= MakeSymbolRef(tempSym);
+	InsertStatement(statement);
+
+	assert(GetSymbolSize(statement.src1) == 4);
+
+	m_shadow.Push(tempSym);
+}
+
 void CJitter::Add64()
 {
 	SymbolPtr tempSym = MakeSymbol(SYM_TEMPORARY64, m_nextTemporary++);
@@ -655,6 +938,44 @@ void CJitter::And64()
 	m_shadow.Push(tempSym);
 }
 
+void CJitter::Or64()
+{
+	InsertBinary64Statement(OP_OR64);
+}
+
+void CJitter::Xor64()
+{
+	InsertBinary64Statement(OP_XOR64);
+}
+
+void CJitter::Not64()
+{
+	SymbolPtr tempSym = MakeSymbol(SYM_TEMPORARY64, m_nextTemporary++);
+
+	STATEMENT statement;
+	statement.op	= OP_NOT64;
+	statement.src1	= MakeSymbolRef(m_shadow.Pull());
+	statement.dst	= MakeSymbolRef(tempSym);
+	InsertStatement(statement);
+
+	m_shadow.Push(tempSym);
+}
+
+void CJitter::Mult64()
+{
+	InsertBinary64Statement(OP_MUL64);
+}
+
+void CJitter::Div64()
+{
+	InsertBinary64Statement(OP_DIV64);
+}
+
+void CJitter::DivS64()
+{
+	InsertBinary64Statement(OP_DIVS64);
+}
+
 void CJitter::Cmp64(CONDITION condition)
 {
 	SymbolPtr tempSym = MakeSymbol(SYM_TEMPORARY, m_nextTemporary++);
@@ -768,58 +1089,61 @@ void CJitter::Shl64(uint8 nAmount)
 	m_shadow.Push(tempSym);
 }
 
-//Floating-Point
-//------------------------------------------------
-void CJitter::FP_PushCst(float constant)
+void CJitter::Ror64()
 {
-	SymbolPtr tempSym = MakeSymbol(SYM_FP_TMP_SINGLE, m_nextTemporary++);
+	SymbolPtr tempSym = MakeSymbol(SYM_TEMPORARY64, m_nextTemporary++);
 
 	STATEMENT statement;
-	statement.op	= OP_FP_LDCST;
-	statement.src1	= MakeSymbolRef(MakeSymbol(SYM_CONSTANT, *reinterpret_cast<uint32*>(&constant)));
+	statement.op	= OP_ROR64;
+	statement.src2	= MakeSymbolRef(m_shadow.Pull());
+	statement.src1	= MakeSymbolRef(m_shadow.Pull());
 	statement.dst	= MakeSymbolRef(tempSym);
 	InsertStatement(statement);
 
 	m_shadow.Push(tempSym);
 }
 
-void CJitter::FP_PushSingle(size_t offset)
+void CJitter::Ror64(uint8 nAmount)
 {
-	m_shadow.Push(MakeSymbol(SYM_FP_REL_SINGLE, static_cast<uint32>(offset)));
-}
+	SymbolPtr tempSym = MakeSymbol(SYM_TEMPORARY64, m_nextTemporary++);
 
-void CJitter::FP_PushWord(size_t offset)
-{
-	m_shadow.Push(MakeSymbol(SYM_FP_REL_INT32, static_cast<uint32>(offset)));
+	STATEMENT statement;
+	statement.op	= OP_ROR64;
+	statement.src2	= MakeSymbolRef(MakeSymbol(SYM_CONSTANT, nAmount));
+	statement.src1	= MakeSymbolRef(m_shadow.Pull());
+	statement.dst	= MakeSymbolRef(tempSym);
+	InsertStatement(statement);
+
+	m_shadow.Push(tempSym);
 }
 
-void CJitter::FP_PullSingle(size_t offset)
+void CJitter::Rol64()
 {
-	STATEMENT statement;
-	statement.op		= OP_MOV;
-	statement.src1		= MakeSymbolRef(m_shadow.Pull());
-	statement.dst		= MakeSymbolRef(MakeSymbol(SYM_FP_REL_SINGLE, static_cast<uint32>(offset)));
-	InsertStatement(statement);
+	//Same as Rol, rotate amounts are taken modulo 64
+	SymbolPtr amountSym = MakeSymbol(SYM_TEMPORARY, m_nextTemporary++);
 
-	assert(GetSymbolSize(statement.src1) == GetSymbolSize(statement.dst));
+	STATEMENT negStatement;
+	negStatement.op		= OP_SUB;
+	negStatement.src2	= MakeSymbolRef(m_shadow.Pull());
+	negStatement.src1	= MakeSymbolRef(MakeSymbol(SYM_CONSTANT, 0));
+	negStatement.dst	= MakeSymbolRef(amountSym);
+	InsertStatement(negStatement);
+
+	m_shadow.Push(amountSym);
+	Ror64();
 }
 
-void CJitter::FP_PullWordTruncate(size_t offset)
+void CJitter::Rol64(uint8 nAmount)
 {
-	STATEMENT statement;
-	statement.op		= OP_FP_TOINT_TRUNC;
-	statement.src1		= MakeSymbolRef(m_shadow.Pull());
-	statement.dst		= MakeSymbolRef(MakeSymbol(SYM_FP_REL_SINGLE, static_cast<uint32>(offset)));
-	InsertStatement(statement);
+	Ror64(static_cast<uint8>((64 - nAmount) & 0x3F));
 }
 
-void CJitter::FP_Add()
+void CJitter::Load64FromRef()
 {
-	SymbolPtr tempSym = MakeSymbol(SYM_FP_TMP_SINGLE, m_nextTemporary++);
+	auto tempSym = MakeSymbol(SYM_TEMPORARY64, m_nextTemporary++);
 
 	STATEMENT statement;
-	statement.op	= OP_FP_ADD;
-	statement.src2	= MakeSymbolRef(m_shadow.Pull());
+	statement.op	= OP_LOADFROMREF;
 	statement.src1	= MakeSymbolRef(m_shadow.Pull());
 	statement.dst	= MakeSymbolRef(tempSym);
 	InsertStatement(statement);
@@ -827,43 +1151,227 @@ void CJitter::FP_Add()
 	m_shadow.Push(tempSym);
 }
 
-void CJitter::FP_Sub()
+void CJitter::Store64AtRef()
+{
+	StoreAtRef();
+}
+
+//Floating-Point
+//------------------------------------------------
+void CJitter::FP_PushCst(float constant)
 {
 	SymbolPtr tempSym = MakeSymbol(SYM_FP_TMP_SINGLE, m_nextTemporary++);
 
 	STATEMENT statement;
-	statement.op	= OP_FP_SUB;
-	statement.src2	= MakeSymbolRef(m_shadow.Pull());
-	statement.src1	= MakeSymbolRef(m_shadow.Pull());
+	statement.op	= OP_FP_LDCST;
+	statement.src1	= MakeSymbolRef(MakeSymbol(SYM_CONSTANT, *reinterpret_cast<uint32*>(&constant)));
 	statement.dst	= MakeSymbolRef(tempSym);
 	InsertStatement(statement);
 
 	m_shadow.Push(tempSym);
 }
 
-void CJitter::FP_Mul()
+void CJitter::FP_PushCstDouble(double constant)
 {
-	SymbolPtr tempSym = MakeSymbol(SYM_FP_TMP_SINGLE, m_nextTemporary++);
+	SymbolPtr tempSym = MakeSymbol(SYM_FP_TMP_DOUBLE, m_nextTemporary++);
 
 	STATEMENT statement;
-	statement.op	= OP_FP_MUL;
-	statement.src2	= MakeSymbolRef(m_shadow.Pull());
-	statement.src1	= MakeSymbolRef(m_shadow.Pull());
+	statement.op	= OP_FP_LDCST;
+	statement.src1	= MakeSymbolRef(MakeConstant64(*reinterpret_cast<uint64*>(&constant)));
 	statement.dst	= MakeSymbolRef(tempSym);
 	InsertStatement(statement);
 
 	m_shadow.Push(tempSym);
 }
 
-void CJitter::FP_Div()
+void CJitter::FP_PushSingle(size_t offset)
+{
+	m_shadow.Push(MakeSymbol(SYM_FP_REL_SINGLE, static_cast<uint32>(offset)));
+}
+
+void CJitter::FP_PushDouble(size_t offset)
+{
+	m_shadow.Push(MakeSymbol(SYM_FP_REL_DOUBLE, static_cast<uint32>(offset)));
+}
+
+void CJitter::FP_PushWord(size_t offset)
+{
+	m_shadow.Push(MakeSymbol(SYM_FP_REL_INT32, static_cast<uint32>(offset)));
+}
+
+void CJitter::FP_PullSingle(size_t offset)
+{
+	STATEMENT statement;
+	statement.op		= OP_MOV;
+	statement.src1		= MakeSymbolRef(m_shadow.Pull());
+	statement.dst		= MakeSymbolRef(MakeSymbol(SYM_FP_REL_SINGLE, static_cast<uint32>(offset)));
+	InsertStatement(statement);
+
+	assert(GetSymbolSize(statement.src1) == GetSymbolSize(statement.dst));
+}
+
+void CJitter::FP_PullDouble(size_t offset)
+{
+	STATEMENT statement;
+	statement.op		= OP_MOV;
+	statement.src1		= MakeSymbolRef(m_shadow.Pull());
+	statement.dst		= MakeSymbolRef(MakeSymbol(SYM_FP_REL_DOUBLE, static_cast<uint32>(offset)));
+	InsertStatement(statement);
+
+	//Words pushed with FP_PushWord are converted while being moved
+	assert((GetSymbolSize(statement.src1) == GetSymbolSize(statement.dst)) || (statement.src1->GetSymbol()->m_type == SYM_FP_REL_INT32));
+}
+
+void CJitter::FP_PullWordTruncate(size_t offset)
+{
+	STATEMENT statement;
+	statement.op		= OP_FP_TOINT_TRUNC;
+	statement.src1		= MakeSymbolRef(m_shadow.Pull());
+	statement.dst		= MakeSymbolRef(MakeSymbol(SYM_FP_REL_SINGLE, static_cast<uint32>(offset)));
+	InsertStatement(statement);
+}
+
+void CJitter::FP_PullWord(size_t offset, ROUNDMODE roundMode)
+{
+	STATEMENT statement;
+	statement.op		= OP_FP_TOINT;
+	statement.src2		= MakeSymbolRef(MakeSymbol(SYM_CONSTANT, roundMode));
+	statement.src1		= MakeSymbolRef(m_shadow.Pull());
+	statement.dst		= MakeSymbolRef(MakeSymbol(SYM_FP_REL_SINGLE, static_cast<uint32>(offset)));
+	InsertStatement(statement);
+
+	assert(GetSymbolSize(statement.src1) == 4);
+}
+
+void CJitter::FP_PullWordSaturate(size_t offset, ROUNDMODE roundMode)
+{
+	STATEMENT statement;
+	statement.op		= OP_FP_TOINT_SAT;
+	statement.src2		= MakeSymbolRef(MakeSymbol(SYM_CONSTANT, roundMode));
+	statement.src1		= MakeSymbolRef(m_shadow.Pull());
+	statement.dst		= MakeSymbolRef(MakeSymbol(SYM_FP_REL_SINGLE, static_cast<uint32>(offset)));
+	InsertStatement(statement);
+
+	assert(GetSymbolSize(statement.src1) == 4);
+}
+
+void CJitter::FP_ToSingle()
 {
 	SymbolPtr tempSym = MakeSymbol(SYM_FP_TMP_SINGLE, m_nextTemporary++);
 
+	STATEMENT statement;
+	statement.op	= OP_FP_TOSINGLE;
+	statement.src1	= MakeSymbolRef(m_shadow.Pull());
+	statement.dst	= MakeSymbolRef(tempSym);
+	InsertStatement(statement);
+
+	assert(GetSymbolSize(statement.src1) == 8);
+
+	m_shadow.Push(tempSym);
+}
+
+void CJitter::FP_ToDouble()
+{
+	SymbolPtr tempSym = MakeSymbol(SYM_FP_TMP_DOUBLE, m_nextTemporary++);
+
+	STATEMENT statement;
+	statement.op	= OP_FP_TODOUBLE;
+	statement.src1	= MakeSymbolRef(m_shadow.Pull());
+	statement.dst	= MakeSymbolRef(tempSym);
+	InsertStatement(statement);
+
+	assert(GetSymbolSize(statement.src1) == 4);
+
+	m_shadow.Push(tempSym);
+}
+
+void CJitter::FP_ToInt64Truncate()
+{
+	SymbolPtr tempSym = MakeSymbol(SYM_TEMPORARY64, m_nextTemporary++);
+
+	STATEMENT statement;
+	statement.op	= OP_FP_TOINT64_TRUNC;
+	statement.src1	= MakeSymbolRef(m_shadow.Pull());
+	statement.dst	= MakeSymbolRef(tempSym);
+	InsertStatement(statement);
+
+	m_shadow.Push(tempSym);
+}
+
+void CJitter::FP_FromInt64()
+{
+	SymbolPtr tempSym = MakeSymbol(SYM_FP_TMP_DOUBLE, m_nextTemporary++);
+
+	STATEMENT statement;
+	statement.op	= OP_FP_FROMINT64;
+	statement.src1	= MakeSymbolRef(m_shadow.Pull());
+	statement.dst	= MakeSymbolRef(tempSym);
+	InsertStatement(statement);
+
+	assert(GetSymbolSize(statement.src1) == 8);
+
+	m_shadow.Push(tempSym);
+}
+
+void CJitter::FP_Add()
+{
+	STATEMENT statement;
+	statement.op	= OP_FP_ADD;
+	statement.src2	= MakeSymbolRef(m_shadow.Pull());
+	statement.src1	= MakeSymbolRef(m_shadow.Pull());
+
+	SymbolPtr tempSym = MakeFpTemporarySymbol(statement.src1->GetSymbol());
+	statement.dst	= MakeSymbolRef(tempSym);
+
+	assert(GetSymbolSize(statement.src1) == GetSymbolSize(statement.src2));
+	InsertStatement(statement);
+
+	m_shadow.Push(tempSym);
+}
+
+void CJitter::FP_Sub()
+{
+	STATEMENT statement;
+	statement.op	= OP_FP_SUB;
+	statement.src2	= MakeSymbolRef(m_shadow.Pull());
+	statement.src1	= MakeSymbolRef(m_shadow.Pull());
+
+	SymbolPtr tempSym = MakeFpTemporarySymbol(statement.src1->GetSymbol());
+	statement.dst	= MakeSymbolRef(tempSym);
+
+	assert(GetSymbolSize(statement.src1) == GetSymbolSize(statement.src2));
+	InsertStatement(statement);
+
+	m_shadow.Push(tempSym);
+}
+
+void CJitter::FP_Mul()
+{
+	STATEMENT statement;
+	statement.op	= OP_FP_MUL;
+	statement.src2	= MakeSymbolRef(m_shadow.Pull());
+	statement.src1	= MakeSymbolRef(m_shadow.Pull());
+
+	SymbolPtr tempSym = MakeFpTemporarySymbol(statement.src1->GetSymbol());
+	statement.dst	= MakeSymbolRef(tempSym);
+
+	assert(GetSymbolSize(statement.src1) == GetSymbolSize(statement.src2));
+	InsertStatement(statement);
+
+	m_shadow.Push(tempSym);
+}
+
+void CJitter::FP_Div()
+{
 	STATEMENT statement;
 	statement.op	= OP_FP_DIV;
 	statement.src2	= MakeSymbolRef(m_shadow.Pull());
 	statement.src1	= MakeSymbolRef(m_shadow.Pull());
+
+	SymbolPtr tempSym = MakeFpTemporarySymbol(statement.src1->GetSymbol());
 	statement.dst	= MakeSymbolRef(tempSym);
+
+	assert(GetSymbolSize(statement.src1) == GetSymbolSize(statement.src2));
 	InsertStatement(statement);
 
 	m_shadow.Push(tempSym);
@@ -886,11 +1394,11 @@ void CJitter::FP_Cmp(Jitter::CONDITION condition)
 
 void CJitter::FP_Sqrt()
 {
-	SymbolPtr tempSym = MakeSymbol(SYM_FP_TMP_SINGLE, m_nextTemporary++);
-
 	STATEMENT statement;
 	statement.op	= OP_FP_SQRT;
 	statement.src1	= MakeSymbolRef(m_shadow.Pull());
+
+	SymbolPtr tempSym = MakeFpTemporarySymbol(statement.src1->GetSymbol());
 	statement.dst	= MakeSymbolRef(tempSym);
 	InsertStatement(statement);
 
@@ -899,24 +1407,40 @@ void CJitter::FP_Sqrt()
 
 void CJitter::FP_Rsqrt()
 {
-	SymbolPtr tempSym = MakeSymbol(SYM_FP_TMP_SINGLE, m_nextTemporary++);
-
 	STATEMENT statement;
 	statement.op	= OP_FP_RSQRT;
 	statement.src1	= MakeSymbolRef(m_shadow.Pull());
+
+	SymbolPtr tempSym = MakeFpTemporarySymbol(statement.src1->GetSymbol());
 	statement.dst	= MakeSymbolRef(tempSym);
 	InsertStatement(statement);
 
 	m_shadow.Push(tempSym);
 }
 
-void CJitter::FP_Rcpl()
+void CJitter::FP_Round(ROUNDMODE roundMode)
 {
-	SymbolPtr tempSym = MakeSymbol(SYM_FP_TMP_SINGLE, m_nextTemporary++);
+	STATEMENT statement;
+	statement.op	= OP_FP_ROUND;
+	statement.src2	= MakeSymbolRef(MakeSymbol(SYM_CONSTANT, roundMode));
+	statement.src1	= MakeSymbolRef(m_shadow.Pull());
+
+	assert(GetSymbolSize(statement.src1) == 4);
+
+	SymbolPtr tempSym = MakeFpTemporarySymbol(statement.src1->GetSymbol());
+	statement.dst	= MakeSymbolRef(tempSym);
+	InsertStatement(statement);
+
+	m_shadow.Push(tempSym);
+}
 
+void CJitter::FP_Rcpl()
+{
 	STATEMENT statement;
 	statement.op	= OP_FP_RCPL;
 	statement.src1	= MakeSymbolRef(m_shadow.Pull());
+
+	SymbolPtr tempSym = MakeFpTemporarySymbol(statement.src1->GetSymbol());
 	statement.dst	= MakeSymbolRef(tempSym);
 	InsertStatement(statement);
 
@@ -925,11 +1449,11 @@ void CJitter::FP_Rcpl()
 
 void CJitter::FP_Abs()
 {
-	SymbolPtr tempSym = MakeSymbol(SYM_FP_TMP_SINGLE, m_nextTemporary++);
-
 	STATEMENT statement;
 	statement.op	= OP_FP_ABS;
 	statement.src1	= MakeSymbolRef(m_shadow.Pull());
+
+	SymbolPtr tempSym = MakeFpTemporarySymbol(statement.src1->GetSymbol());
 	statement.dst	= MakeSymbolRef(tempSym);
 	InsertStatement(statement);
 
@@ -938,11 +1462,11 @@ void CJitter::FP_Abs()
 
 void CJitter::FP_Neg()
 {
-	SymbolPtr tempSym = MakeSymbol(SYM_FP_TMP_SINGLE, m_nextTemporary++);
-
 	STATEMENT statement;
 	statement.op	= OP_FP_NEG;
 	statement.src1	= MakeSymbolRef(m_shadow.Pull());
+
+	SymbolPtr tempSym = MakeFpTemporarySymbol(statement.src1->GetSymbol());
 	statement.dst	= MakeSymbolRef(tempSym);
 	InsertStatement(statement);
 
@@ -951,13 +1475,15 @@ void CJitter::FP_Neg()
 
 void CJitter::FP_Min()
 {
-	SymbolPtr tempSym = MakeSymbol(SYM_FP_TMP_SINGLE, m_nextTemporary++);
-
 	STATEMENT statement;
 	statement.op	= OP_FP_MIN;
 	statement.src2	= MakeSymbolRef(m_shadow.Pull());
 	statement.src1	= MakeSymbolRef(m_shadow.Pull());
+
+	SymbolPtr tempSym = MakeFpTemporarySymbol(statement.src1->GetSymbol());
 	statement.dst	= MakeSymbolRef(tempSym);
+
+	assert(GetSymbolSize(statement.src1) == GetSymbolSize(statement.src2));
 	InsertStatement(statement);
 
 	m_shadow.Push(tempSym);
@@ -965,18 +1491,40 @@ void CJitter::FP_Min()
 
 void CJitter::FP_Max()
 {
-	SymbolPtr tempSym = MakeSymbol(SYM_FP_TMP_SINGLE, m_nextTemporary++);
-
 	STATEMENT statement;
 	statement.op	= OP_FP_MAX;
 	statement.src2	= MakeSymbolRef(m_shadow.Pull());
 	statement.src1	= MakeSymbolRef(m_shadow.Pull());
+
+	SymbolPtr tempSym = MakeFpTemporarySymbol(statement.src1->GetSymbol());
 	statement.dst	= MakeSymbolRef(tempSym);
+
+	assert(GetSymbolSize(statement.src1) == GetSymbolSize(statement.src2));
 	InsertStatement(statement);
 
 	m_shadow.Push(tempSym);
 }
 
+void CJitter::FP_MulAdd()
+{
+	InsertTernaryFpStatement(OP_FP_MADD);
+}
+
+void CJitter::FP_MulSub()
+{
+	InsertTernaryFpStatement(OP_FP_MSUB);
+}
+
+void CJitter::FP_FusedMulAdd()
+{
+	InsertTernaryFpStatement(OP_FP_FMADD);
+}
+
+void CJitter::FP_FusedMulSub()
+{
+	InsertTernaryFpStatement(OP_FP_FMSUB);
+}
+
 //SIMD
 //------------------------------------------------
 void CJitter::MD_PullRel(size_t offset)
@@ -1023,6 +1571,22 @@ void CJitter::MD_PushRel(size_t offset)
 	m_shadow.Push(MakeSymbol(SYM_RELATIVE128, static_cast<uint32>(offset)));
 }
 
+void CJitter::MD_PushRel256(size_t offset)
+{
+	m_shadow.Push(MakeSymbol(SYM_RELATIVE256, static_cast<uint32>(offset)));
+}
+
+void CJitter::MD_PullRel256(size_t offset)
+{
+	STATEMENT statement;
+	statement.op		= OP_MOV;
+	statement.src1		= MakeSymbolRef(m_shadow.Pull());
+	statement.dst		= MakeSymbolRef(MakeSymbol(SYM_RELATIVE256, static_cast<uint32>(offset)));
+	InsertStatement(statement);
+
+	assert(GetSymbolSize(statement.src1) == GetSymbolSize(statement.dst));
+}
+
 void CJitter::MD_PushRelExpand(size_t offset)
 {
 	SymbolPtr tempSym = MakeSymbol(SYM_TEMPORARY128, m_nextTemporary++);
@@ -1305,6 +1869,31 @@ void CJitter::MD_MaxW()
 	InsertBinaryMdStatement(OP_MD_MAX_W);
 }
 
+void CJitter::MD_MulH()
+{
+	InsertBinaryMdStatement(OP_MD_MUL_H);
+}
+
+void CJitter::MD_MulHiH()
+{
+	InsertBinaryMdStatement(OP_MD_MULHI_H);
+}
+
+void CJitter::MD_MulW()
+{
+	InsertBinaryMdStatement(OP_MD_MUL_W);
+}
+
+void CJitter::MD_MulEvenUWD()
+{
+	InsertBinaryMdStatement(OP_MD_MULEVEN_UWD);
+}
+
+void CJitter::MD_MulAddPairsHW()
+{
+	InsertBinaryMdStatement(OP_MD_MULADDPAIRS_HW);
+}
+
 void CJitter::MD_CmpEqB()
 {
 	InsertBinaryMdStatement(OP_MD_CMPEQ_B);
@@ -1375,6 +1964,68 @@ void CJitter::MD_PackWH()
 	InsertBinaryMdStatement(OP_MD_PACK_WH);
 }
 
+void CJitter::MD_Round(ROUNDMODE roundMode)
+{
+	SymbolPtr tempSym = MakeSymbol(SYM_TEMPORARY128, m_nextTemporary++);
+
+	STATEMENT statement;
+	statement.op	= OP_MD_ROUND;
+	statement.src2	= MakeSymbolRef(MakeSymbol(SYM_CONSTANT, roundMode));
+	statement.src1	= MakeSymbolRef(m_shadow.Pull());
+	statement.dst	= MakeSymbolRef(tempSym);
+	InsertStatement(statement);
+
+	m_shadow.Push(tempSym);
+}
+
+void CJitter::MD_ShuffleW(uint8 selector)
+{
+	SymbolPtr tempSym = MakeSymbol(SYM_TEMPORARY128, m_nextTemporary++);
+
+	STATEMENT statement;
+	statement.op	= OP_MD_SHUFFLE_W;
+	statement.src2	= MakeSymbolRef(MakeSymbol(SYM_CONSTANT, selector));
+	statement.src1	= MakeSymbolRef(m_shadow.Pull());
+	statement.dst	= MakeSymbolRef(tempSym);
+	InsertStatement(statement);
+
+	m_shadow.Push(tempSym);
+}
+
+void CJitter::MD_InsertW(unsigned int dstLane, unsigned int srcLane)
+{
+	assert(dstLane < 4);
+	assert(srcLane < 4);
+
+	SymbolPtr tempSym = MakeSymbol(SYM_TEMPORARY128, m_nextTemporary++);
+
+	STATEMENT statement;
+	statement.op	= OP_MD_INSERT_W;
+	statement.src3	= MakeSymbolRef(MakeSymbol(SYM_CONSTANT, ((srcLane & 3) << 2) | (dstLane & 3)));
+	statement.src2	= MakeSymbolRef(m_shadow.Pull());
+	statement.src1	= MakeSymbolRef(m_shadow.Pull());
+	statement.dst	= MakeSymbolRef(tempSym);
+	InsertStatement(statement);
+
+	m_shadow.Push(tempSym);
+}
+
+void CJitter::MD_ExtractW(unsigned int lane)
+{
+	assert(lane < 4);
+
+	SymbolPtr tempSym = MakeSymbol(SYM_TEMPORARY, m_nextTemporary++);
+
+	STATEMENT statement;
+	statement.op	= OP_MD_EXTRACT_W;
+	statement.src2	= MakeSymbolRef(MakeSymbol(SYM_CONSTANT, lane & 3));
+	statement.src1	= MakeSymbolRef(m_shadow.Pull());
+	statement.dst	= MakeSymbolRef(tempSym);
+	InsertStatement(statement);
+
+	m_shadow.Push(tempSym);
+}
+
 void CJitter::MD_AddS()
 {
 	InsertBinaryMdStatement(OP_MD_ADD_S);
@@ -1395,6 +2046,26 @@ void CJitter::MD_DivS()
 	InsertBinaryMdStatement(OP_MD_DIV_S);
 }
 
+void CJitter::MD_MulAddS()
+{
+	InsertTernaryMdStatement(OP_MD_MADD_S);
+}
+
+void CJitter::MD_MulSubS()
+{
+	InsertTernaryMdStatement(OP_MD_MSUB_S);
+}
+
+void CJitter::MD_FusedMulAddS()
+{
+	InsertTernaryMdStatement(OP_MD_FMADD_S);
+}
+
+void CJitter::MD_FusedMulSubS()
+{
+	InsertTernaryMdStatement(OP_MD_FMSUB_S);
+}
+
 void CJitter::MD_AbsS()
 {
 	InsertUnaryMdStatement(OP_MD_ABS_S);
@@ -1441,6 +2112,34 @@ void CJitter::MD_ToWordTruncate()
 	InsertUnaryMdStatement(OP_MD_TOWORD_TRUNCATE);
 }
 
+void CJitter::MD_ToWord(ROUNDMODE roundMode)
+{
+	SymbolPtr tempSym = MakeSymbol(SYM_TEMPORARY128, m_nextTemporary++);
+
+	STATEMENT statement;
+	statement.op	= OP_MD_TOWORD;
+	statement.src2	= MakeSymbolRef(MakeSymbol(SYM_CONSTANT, roundMode));
+	statement.src1	= MakeSymbolRef(m_shadow.Pull());
+	statement.dst	= MakeSymbolRef(tempSym);
+	InsertStatement(statement);
+
+	m_shadow.Push(tempSym);
+}
+
+void CJitter::MD_ToWordSaturate(ROUNDMODE roundMode)
+{
+	SymbolPtr tempSym = MakeSymbol(SYM_TEMPORARY128, m_nextTemporary++);
+
+	STATEMENT statement;
+	statement.op	= OP_MD_TOWORD_SAT;
+	statement.src2	= MakeSymbolRef(MakeSymbol(SYM_CONSTANT, roundMode));
+	statement.src1	= MakeSymbolRef(m_shadow.Pull());
+	statement.dst	= MakeSymbolRef(tempSym);
+	InsertStatement(statement);
+
+	m_shadow.Push(tempSym);
+}
+
 void CJitter::MD_ToSingle()
 {
 	InsertUnaryMdStatement(OP_MD_TOSINGLE);
@@ -1449,6 +2148,19 @@ void CJitter::MD_ToSingle()
 //Generic Statement Inserters
 //------------------------------------------------
 
+void CJitter::InsertUnaryStatement(Jitter::OPERATION operation)
+{
+	auto tempSym = MakeSymbol(SYM_TEMPORARY, m_nextTemporary++);
+
+	STATEMENT statement;
+	statement.op	= operation;
+	statement.src1	= MakeSymbolRef(m_shadow.Pull());
+	statement.dst	= MakeSymbolRef(tempSym);
+	InsertStatement(statement);
+
+	m_shadow.Push(tempSym);
+}
+
 void CJitter::InsertBinaryStatement(Jitter::OPERATION operation)
 {
 	auto tempSym = MakeSymbol(SYM_TEMPORARY, m_nextTemporary++);
@@ -1463,13 +2175,55 @@ void CJitter::InsertBinaryStatement(Jitter::OPERATION operation)
 	m_shadow.Push(tempSym);
 }
 
+void CJitter::InsertLoadFromRefStatement(Jitter::OPERATION operation)
+{
+	auto tempSym = MakeSymbol(SYM_TEMPORARY, m_nextTemporary++);
+
+	STATEMENT statement;
+	statement.op	= operation;
+	statement.src1	= MakeSymbolRef(m_shadow.Pull());
+	statement.dst	= MakeSymbolRef(tempSym);
+	InsertStatement(statement);
+
+	m_shadow.Push(tempSym);
+}
+
+void CJitter::InsertStoreAtRefStatement(Jitter::OPERATION operation)
+{
+	STATEMENT statement;
+	statement.op	= operation;
+	statement.src2	= MakeSymbolRef(m_shadow.Pull());
+	statement.src1	= MakeSymbolRef(m_shadow.Pull());
+	InsertStatement(statement);
+}
+
+void CJitter::InsertBinary64Statement(Jitter::OPERATION operation)
+{
+	auto tempSym = MakeSymbol(SYM_TEMPORARY64, m_nextTemporary++);
+
+	STATEMENT statement;
+	statement.op	= operation;
+	statement.src2	= MakeSymbolRef(m_shadow.Pull());
+	statement.src1	= MakeSymbolRef(m_shadow.Pull());
+	statement.dst	= MakeSymbolRef(tempSym);
+	InsertStatement(statement);
+
+	m_shadow.Push(tempSym);
+}
+
 void CJitter::InsertUnaryMdStatement(Jitter::OPERATION operation)
 {
+	auto src1 = m_shadow.Pull();
+	if(Is256BitsMdSymbol(src1))
+	{
+		throw std::runtime_error("Operation doesn't support 256-bits operands.");
+	}
+
 	auto tempSym = MakeSymbol(SYM_TEMPORARY128, m_nextTemporary++);
 
 	STATEMENT statement;
 	statement.op	= operation;
-	statement.src1	= MakeSymbolRef(m_shadow.Pull());
+	statement.src1	= MakeSymbolRef(src1);
 	statement.dst	= MakeSymbolRef(tempSym);
 	InsertStatement(statement);
 
@@ -1478,13 +2232,64 @@ void CJitter::InsertUnaryMdStatement(Jitter::OPERATION operation)
 
 void CJitter::InsertBinaryMdStatement(Jitter::OPERATION operation)
 {
+	auto src2 = m_shadow.Pull();
+	auto src1 = m_shadow.Pull();
+
+	bool is256 = Is256BitsMdSymbol(src1);
+	if((is256 != Is256BitsMdSymbol(src2)) || (is256 && !Is256BitsMdOperation(operation)))
+	{
+		//Caught here since code generators would only fail to find a matcher for these
+		throw std::runtime_error("Operation doesn't support 256-bits operands.");
+	}
+
+	auto tempSym = MakeSymbol(is256 ? SYM_TEMPORARY256 : SYM_TEMPORARY128, m_nextTemporary++);
+
+	STATEMENT statement;
+	statement.op	= operation;
+	statement.src2	= MakeSymbolRef(src2);
+	statement.src1	= MakeSymbolRef(src1);
+	statement.dst	= MakeSymbolRef(tempSym);
+	InsertStatement(statement);
+
+	m_shadow.Push(tempSym);
+}
+
+void CJitter::InsertTernaryMdStatement(Jitter::OPERATION operation)
+{
+	auto src3 = m_shadow.Pull();
+	auto src2 = m_shadow.Pull();
+	auto src1 = m_shadow.Pull();
+	if(Is256BitsMdSymbol(src1) || Is256BitsMdSymbol(src2) || Is256BitsMdSymbol(src3))
+	{
+		throw std::runtime_error("Operation doesn't support 256-bits operands.");
+	}
+
 	auto tempSym = MakeSymbol(SYM_TEMPORARY128, m_nextTemporary++);
 
 	STATEMENT statement;
 	statement.op	= operation;
+	statement.src3	= MakeSymbolRef(src3);
+	statement.src2	= MakeSymbolRef(src2);
+	statement.src1	= MakeSymbolRef(src1);
+	statement.dst	= MakeSymbolRef(tempSym);
+	InsertStatement(statement);
+
+	m_shadow.Push(tempSym);
+}
+
+void CJitter::InsertTernaryFpStatement(Jitter::OPERATION operation)
+{
+	STATEMENT statement;
+	statement.op	= operation;
+	statement.src3	= MakeSymbolRef(m_shadow.Pull());
 	statement.src2	= MakeSymbolRef(m_shadow.Pull());
 	statement.src1	= MakeSymbolRef(m_shadow.Pull());
+
+	SymbolPtr tempSym = MakeFpTemporarySymbol(statement.src1->GetSymbol());
 	statement.dst	= MakeSymbolRef(tempSym);
+
+	assert(GetSymbolSize(statement.src1) == GetSymbolSize(statement.src2));
+	assert(GetSymbolSize(statement.src1) == GetSymbolSize(statement.src3));
 	InsertStatement(statement);
 
 	m_shadow.Push(tempSym);
@@ -0,0 +1,234 @@
+#include <algorithm>
+#include <chrono>
+#include "Jitter.h"
+
+using namespace Jitter;
+
+namespace
+{
+	class CKeyHasher
+	{
+	public:
+		void Add(uint64 value)
+		{
+			//FNV-1a over the bytes for the first hash, multiply/rotate mixing over words for the second one
+			for(unsigned int i = 0; i < 8; i++)
+			{
+				m_hash0 = (m_hash0 ^ ((value >> (i * 8)) & 0xFF)) * 0x100000001B3ULL;
+			}
+			m_hash1 ^= value * 0x9E3779B97F4A7C15ULL;
+			m_hash1 = ((m_hash1 << 27) | (m_hash1 >> 37)) * 0x94D049BB133111EBULL;
+		}
+
+		void Add(const std::string& value)
+		{
+			Add(value.size());
+			for(auto character : value)
+			{
+				Add(static_cast<uint8>(character));
+			}
+		}
+
+		CCodeCache::KEY GetKey() const
+		{
+			CCodeCache::KEY key;
+			key.hash0 = m_hash0;
+			key.hash1 = m_hash1;
+			return key;
+		}
+
+	private:
+		uint64	m_hash0 = 0xCBF29CE484222325ULL;
+		uint64	m_hash1 = 0x84222325CBF29CE4ULL;
+	};
+}
+
+bool CJitter::CanUseCodeCache() const
+{
+	if(!m_codeCache || !m_stream) return false;
+	//Instrumentation and layout depend on state that is not part of the IR
+	if(m_profileCounters || m_entryCounter || !m_blockFrequencies.empty()) return false;
+	//Symbol reference offsets reported by code generators are relative to the start of the stream
+	return m_stream->Tell() == 0;
+}
+
+CCodeCache::KEY CJitter::MakeCodeCacheKey(std::vector<uintptr_t>& externalSymbols) const
+{
+	CKeyHasher hasher;
+	hasher.Add(m_codeCache->GetConfiguration());
+	hasher.Add(m_codeGen->GetConfigurationName());
+	hasher.Add(m_compileTier);
+
+	const auto& pipeline = GetCompilePassPipeline();
+	hasher.Add(pipeline.blockPasses.size());
+	for(const auto& pass : pipeline.blockPasses)
+	{
+		hasher.Add(pass);
+	}
+	hasher.Add(pipeline.maxBlockIterations);
+	hasher.Add(pipeline.flowPasses.size());
+	for(const auto& pass : pipeline.flowPasses)
+	{
+		hasher.Add(pass);
+	}
+	hasher.Add(pipeline.maxFlowIterations);
+	hasher.Add(pipeline.coalesceTemporaries);
+	hasher.Add(pipeline.allocateRegisters);
+
+	hasher.Add(m_basicBlocks.size());
+
+	auto addOperand =
+		[&] (const SymbolRefPtr& symbolRef)
+		{
+			if(!symbolRef)
+			{
+				hasher.Add(~0ULL);
+				return;
+			}
+			auto symbol = symbolRef->GetSymbol();
+			hasher.Add(symbol->m_type);
+			const std::string* externalSymbolName = nullptr;
+			if(symbol->m_type == SYM_CONSTANTPTR)
+			{
+				externalSymbolName = m_codeCache->GetExternalSymbolName(symbol->GetConstantPtr());
+			}
+			if(externalSymbolName)
+			{
+				//Address will be patched when loaded, only the name matters
+				hasher.Add(*externalSymbolName);
+				externalSymbols.push_back(symbol->GetConstantPtr());
+			}
+			else
+			{
+				hasher.Add(symbol->m_valueLow);
+				hasher.Add(symbol->m_valueHigh);
+			}
+		};
+
+	hasher.Add(m_labels.size());
+	for(const auto& labelPair : m_labels)
+	{
+		hasher.Add(labelPair.first);
+		hasher.Add(labelPair.second);
+	}
+
+	for(const auto& basicBlock : m_basicBlocks)
+	{
+		hasher.Add(basicBlock.id);
+		hasher.Add(basicBlock.cold);
+		hasher.Add(basicBlock.statements.size());
+		for(const auto& statement : basicBlock.statements)
+		{
+			hasher.Add(statement.op);
+			hasher.Add(statement.jmpBlock);
+			hasher.Add(statement.jmpCondition);
+			addOperand(statement.dst);
+			addOperand(statement.src1);
+			addOperand(statement.src2);
+			addOperand(statement.src3);
+		}
+	}
+
+	std::sort(std::begin(externalSymbols), std::end(externalSymbols));
+	externalSymbols.erase(std::unique(std::begin(externalSymbols), std::end(externalSymbols)), std::end(externalSymbols));
+
+	return hasher.GetKey();
+}
+
+bool CJitter::LoadFromCodeCache(const CCodeCache::KEY& key)
+{
+	auto startTime = std::chrono::steady_clock::now();
+
+	CCodeCache::ENTRY entry;
+	if(!m_codeCache->Find(key, entry))
+	{
+		m_codeCache->AddMiss();
+		return false;
+	}
+
+	std::vector<uint8> code(entry.code, entry.code + entry.codeSize);
+	for(const auto& fixup : entry.fixups)
+	{
+		auto value = m_codeCache->GetExternalSymbolValue(fixup.symbolName);
+		bool patched = (value != 0) && m_codeGen->PatchExternalSymbolReference(code.data(), fixup.offset, value);
+		if(!patched)
+		{
+			//Entry is unusable in this process, function will be compiled again
+			m_codeCache->AddMiss();
+			return false;
+		}
+	}
+
+	const auto& externalSymbolReferencedHandler = m_codeGen->GetExternalSymbolReferencedHandler();
+	if(externalSymbolReferencedHandler)
+	{
+		for(const auto& fixup : entry.fixups)
+		{
+			externalSymbolReferencedHandler(m_codeCache->GetExternalSymbolValue(fixup.symbolName), fixup.offset);
+		}
+	}
+
+	m_stream->Write(code.data(), code.size());
+	m_labels.clear();
+
+	auto loadTime = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - startTime);
+	m_codeCache->AddHit(loadTime.count());
+	return true;
+}
+
+void CJitter::CompileToCodeCache(const CCodeCache::KEY& key, const std::vector<uintptr_t>& externalSymbols)
+{
+	auto previousHandler = m_codeGen->GetExternalSymbolReferencedHandler();
+
+	CCodeCache::FixupArray fixups;
+	std::vector<uintptr_t> referencedSymbols;
+	m_codeGen->SetExternalSymbolReferencedHandler(
+		[&] (uintptr_t value, uint32 offset)
+		{
+			if(previousHandler)
+			{
+				previousHandler(value, offset);
+			}
+			auto externalSymbolName = m_codeCache->GetExternalSymbolName(value);
+			if(!externalSymbolName) return;
+			CCodeCache::FIXUP fixup;
+			fixup.offset = offset;
+			fixup.symbolName = *externalSymbolName;
+			fixups.push_back(fixup);
+			referencedSymbols.push_back(value);
+		}
+	);
+
+	Compile();
+
+	m_codeGen->SetExternalSymbolReferencedHandler(previousHandler);
+
+	//Code embedding the address of a registered symbol without reporting it can't be reused by another process
+	bool cacheable = std::all_of(std::begin(externalSymbols), std::end(externalSymbols),
+		[&] (uintptr_t value)
+		{
+			return std::find(std::begin(referencedSymbols), std::end(referencedSymbols), value) != std::end(referencedSymbols);
+		}
+	);
+
+	auto codeSize = m_stream->Tell();
+	std::vector<uint8> code(codeSize);
+	m_stream->Seek(0, Framework::STREAM_SEEK_SET);
+	m_stream->Read(code.data(), codeSize);
+	m_stream->Seek(codeSize, Framework::STREAM_SEEK_SET);
+
+	for(const auto& fixup : fixups)
+	{
+		if(!cacheable) break;
+		cacheable = m_codeGen->PatchExternalSymbolReference(code.data(), fixup.offset, m_codeCache->GetExternalSymbolValue(fixup.symbolName));
+	}
+
+	if(cacheable)
+	{
+		m_codeCache->Store(key, code.data(), static_cast<uint32>(codeSize), fixups);
+	}
+	else
+	{
+		m_codeCache->AddUncacheable();
+	}
+}
@@ -7,6 +7,16 @@ void CCodeGen::SetExternalSymbolReferencedHandler(const ExternalSymbolReferenced
 	m_externalSymbolReferencedHandler = externalSymbolReferencedHandler;
 }
 
+const CCodeGen::ExternalSymbolReferencedHandler& CCodeGen::GetExternalSymbolReferencedHandler() const
+{
+	return m_externalSymbolReferencedHandler;
+}
+
+bool CCodeGen::PatchExternalSymbolReference(uint8*, uint32, uintptr_t) const
+{
+	return false;
+}
+
 bool CCodeGen::SymbolMatches(MATCHTYPE match, const SymbolRefPtr& symbolRef)
 {
 	if(match == MATCH_ANY) return true;
@@ -55,6 +65,13 @@ bool CCodeGen::SymbolMatches(MATCHTYPE match, const SymbolRefPtr& symbolRef)
 	case MATCH_MEMORY_FP_SINGLE:
 		return (symbol->m_type == SYM_FP_REL_SINGLE) || (symbol->m_type == SYM_FP_TMP_SINGLE);
 
+	case MATCH_RELATIVE_FP_DOUBLE:
+		return (symbol->m_type == SYM_FP_REL_DOUBLE);
+	case MATCH_TEMPORARY_FP_DOUBLE:
+		return (symbol->m_type == SYM_FP_TMP_DOUBLE);
+	case MATCH_MEMORY_FP_DOUBLE:
+		return (symbol->m_type == SYM_FP_REL_DOUBLE) || (symbol->m_type == SYM_FP_TMP_DOUBLE);
+
 	case MATCH_RELATIVE_FP_INT32:
 		return (symbol->m_type == SYM_FP_REL_INT32);
 
@@ -69,8 +86,16 @@ bool CCodeGen::SymbolMatches(MATCHTYPE match, const SymbolRefPtr& symbolRef)
 	case MATCH_VARIABLE128:
 		return (symbol->m_type == SYM_REGISTER128) || (symbol->m_type == SYM_RELATIVE128) || (symbol->m_type == SYM_TEMPORARY128);
 
-	case MATCH_MEMORY256:
+	case MATCH_RELATIVE256:
+		return (symbol->m_type == SYM_RELATIVE256);
+	case MATCH_TEMPORARY256:
 		return (symbol->m_type == SYM_TEMPORARY256);
+	case MATCH_MEMORY256:
+		return (symbol->m_type == SYM_RELATIVE256) || (symbol->m_type == SYM_TEMPORARY256);
+	case MATCH_REGISTER256:
+		return (symbol->m_type == SYM_REGISTER256);
+	case MATCH_VARIABLE256:
+		return (symbol->m_type == SYM_REGISTER256) || (symbol->m_type == SYM_RELATIVE256) || (symbol->m_type == SYM_TEMPORARY256);
 		
 	case MATCH_CONTEXT:
 		return (symbol->m_type == SYM_CONTEXT);
@@ -90,3 +115,33 @@ uint32 CCodeGen::GetRegisterUsage(const StatementList& statements)
 	}
 	return registerUsage;
 }
+
+uint32 CCodeGen::GetMdRegisterUsage(const StatementList& statements)
+{
+	uint32 registerUsage = 0;
+	for(const auto& statement : statements)
+	{
+		if(CSymbol* dst = dynamic_symbolref_cast(SYM_REGISTER128, statement.dst))
+		{
+			registerUsage |= (1 << dst->m_valueLow);
+		}
+		else if(CSymbol* dst = dynamic_symbolref_cast(SYM_REGISTER256, statement.dst))
+		{
+			registerUsage |= (1 << dst->m_valueLow);
+		}
+	}
+	return registerUsage;
+}
+
+uint32 CCodeGen::GetMd256RegisterUsage(const StatementList& statements)
+{
+	uint32 registerUsage = 0;
+	for(const auto& statement : statements)
+	{
+		if(CSymbol* dst = dynamic_symbolref_cast(SYM_REGISTER256, statement.dst))
+		{
+			registerUsage |= (1 << dst->m_valueLow);
+		}
+	}
+	return registerUsage;
+}
@@ -154,9 +154,19 @@ CCodeGen_AArch32::CONSTMATCHER CCodeGen_AArch32::g_constMatchers[] =
 	
 	{ OP_LZC,			MATCH_VARIABLE,		MATCH_VARIABLE,		MATCH_NIL,			&CCodeGen_AArch32::Emit_Lzc_VarVar								},
 
+	{ OP_SEXT8,			MATCH_VARIABLE,		MATCH_VARIABLE,		MATCH_NIL,			&CCodeGen_AArch32::Emit_Ext_VarVar								},
+	{ OP_SEXT16,		MATCH_VARIABLE,		MATCH_VARIABLE,		MATCH_NIL,			&CCodeGen_AArch32::Emit_Ext_VarVar								},
+	{ OP_ZEXT8,			MATCH_VARIABLE,		MATCH_VARIABLE,		MATCH_NIL,			&CCodeGen_AArch32::Emit_Ext_VarVar								},
+	{ OP_ZEXT16,		MATCH_VARIABLE,		MATCH_VARIABLE,		MATCH_NIL,			&CCodeGen_AArch32::Emit_Ext_VarVar								},
+
+	{ OP_BSWAP,			MATCH_VARIABLE,		MATCH_VARIABLE,		MATCH_NIL,			&CCodeGen_AArch32::Emit_ByteSwap_VarVar							},
+	{ OP_POPCNT,		MATCH_VARIABLE,		MATCH_VARIABLE,		MATCH_NIL,			&CCodeGen_AArch32::Emit_PopCount_VarVar							},
+	{ OP_CTZ,			MATCH_VARIABLE,		MATCH_VARIABLE,		MATCH_NIL,			&CCodeGen_AArch32::Emit_Ctz_VarVar								},
+
 	{ OP_SRL,			MATCH_ANY,			MATCH_ANY,			MATCH_ANY,			&CCodeGen_AArch32::Emit_Shift_Generic<CAArch32Assembler::SHIFT_LSR>	},
 	{ OP_SRA,			MATCH_ANY,			MATCH_ANY,			MATCH_ANY,			&CCodeGen_AArch32::Emit_Shift_Generic<CAArch32Assembler::SHIFT_ASR>	},
 	{ OP_SLL,			MATCH_ANY,			MATCH_ANY,			MATCH_ANY,			&CCodeGen_AArch32::Emit_Shift_Generic<CAArch32Assembler::SHIFT_LSL>	},
+	{ OP_ROR,			MATCH_ANY,			MATCH_ANY,			MATCH_ANY,			&CCodeGen_AArch32::Emit_Shift_Generic<CAArch32Assembler::SHIFT_ROR>	},
 
 	{ OP_PARAM,			MATCH_NIL,			MATCH_CONTEXT,		MATCH_NIL,			&CCodeGen_AArch32::Emit_Param_Ctx								},
 	{ OP_PARAM,			MATCH_NIL,			MATCH_REGISTER,		MATCH_NIL,			&CCodeGen_AArch32::Emit_Param_Reg								},
@@ -201,6 +211,20 @@ CCodeGen_AArch32::CONSTMATCHER CCodeGen_AArch32::g_constMatchers[] =
 	//Cannot use MATCH_ANY here because it will match SYM_RELATIVE128
 	{ OP_STOREATREF,	MATCH_NIL,			MATCH_TMP_REF,		MATCH_VARIABLE,		&CCodeGen_AArch32::Emit_StoreAtRef_TmpAny						},
 	{ OP_STOREATREF,	MATCH_NIL,			MATCH_TMP_REF,		MATCH_CONSTANT,		&CCodeGen_AArch32::Emit_StoreAtRef_TmpAny						},
+
+	{ OP_LOAD8FROMREF,		MATCH_VARIABLE,	MATCH_MEM_REF,		MATCH_NIL,			&CCodeGen_AArch32::Emit_LoadSizedFromRef_VarMem					},
+	{ OP_LOAD8SFROMREF,		MATCH_VARIABLE,	MATCH_MEM_REF,		MATCH_NIL,			&CCodeGen_AArch32::Emit_LoadSizedFromRef_VarMem					},
+	{ OP_LOAD16FROMREF,		MATCH_VARIABLE,	MATCH_MEM_REF,		MATCH_NIL,			&CCodeGen_AArch32::Emit_LoadSizedFromRef_VarMem					},
+	{ OP_LOAD16SFROMREF,	MATCH_VARIABLE,	MATCH_MEM_REF,		MATCH_NIL,			&CCodeGen_AArch32::Emit_LoadSizedFromRef_VarMem					},
+
+	{ OP_STORE8ATREF,	MATCH_NIL,			MATCH_MEM_REF,		MATCH_VARIABLE,		&CCodeGen_AArch32::Emit_StoreSizedAtRef_MemAny					},
+	{ OP_STORE8ATREF,	MATCH_NIL,			MATCH_MEM_REF,		MATCH_CONSTANT,		&CCodeGen_AArch32::Emit_StoreSizedAtRef_MemAny					},
+	{ OP_STORE16ATREF,	MATCH_NIL,			MATCH_MEM_REF,		MATCH_VARIABLE,		&CCodeGen_AArch32::Emit_StoreSizedAtRef_MemAny					},
+	{ OP_STORE16ATREF,	MATCH_NIL,			MATCH_MEM_REF,		MATCH_CONSTANT,		&CCodeGen_AArch32::Emit_StoreSizedAtRef_MemAny					},
+
+	{ OP_LOADFROMTLB,	MATCH_VARIABLE,		MATCH_ANY,			MATCH_CONSTANTPTR,	&CCodeGen_AArch32::Emit_LoadFromTlb_VarAny						},
+
+	{ OP_INCCOUNTER,	MATCH_NIL,			MATCH_CONSTANTPTR,	MATCH_NIL,			&CCodeGen_AArch32::Emit_IncCounter								},
 	
 	{ OP_MOV,			MATCH_NIL,			MATCH_NIL,			MATCH_NIL,			NULL														},
 };
@@ -280,6 +304,34 @@ bool CCodeGen_AArch32::CanHold128BitsReturnValueInRegisters() const
 	return false;
 }
 
+bool CCodeGen_AArch32::CanHandle256BitsMdOperations() const
+{
+	return false;
+}
+
+std::string CCodeGen_AArch32::GetConfigurationName() const
+{
+	return m_hasIntegerDiv ? "aarch32+idiv" : "aarch32";
+}
+
+bool CCodeGen_AArch32::PatchExternalSymbolReference(uint8* code, uint32 offset, uintptr_t value) const
+{
+	//References come from MOVW/MOVT pairs (see LoadConstantPtrInRegister)
+	auto patchImmediate =
+		[] (uint8* instructionPtr, uint16 immediate)
+		{
+			uint32 instruction = 0;
+			memcpy(&instruction, instructionPtr, sizeof(uint32));
+			instruction &= ~0xF0FFF;
+			instruction |= ((immediate & 0xF000) << 4) | (immediate & 0x0FFF);
+			memcpy(instructionPtr, &instruction, sizeof(uint32));
+		};
+	uint32 address = static_cast<uint32>(value);
+	patchImmediate(code + offset + 0, static_cast<uint16>(address & 0xFFFF));
+	patchImmediate(code + offset + 4, static_cast<uint16>(address >> 16));
+	return true;
+}
+
 void CCodeGen_AArch32::SetStream(Framework::CStream* stream)
 {
 	m_stream = stream;
@@ -292,6 +344,11 @@ void CCodeGen_AArch32::RegisterExternalSymbols(CObjectFile* objectFile) const
 	objectFile->AddExternalSymbol("_CodeGen_AArch32_div_signed",	reinterpret_cast<uintptr_t>(&CodeGen_AArch32_div_signed));
 	objectFile->AddExternalSymbol("_CodeGen_AArch32_mod_unsigned",	reinterpret_cast<uintptr_t>(&CodeGen_AArch32_mod_unsigned));
 	objectFile->AddExternalSymbol("_CodeGen_AArch32_mod_signed",	reinterpret_cast<uintptr_t>(&CodeGen_AArch32_mod_signed));
+	objectFile->AddExternalSymbol("_CodeGen_AArch32_div64_unsigned",	reinterpret_cast<uintptr_t>(&CodeGen_AArch32_div64_unsigned));
+	objectFile->AddExternalSymbol("_CodeGen_AArch32_div64_signed",	reinterpret_cast<uintptr_t>(&CodeGen_AArch32_div64_signed));
+	objectFile->AddExternalSymbol("_CodeGen_AArch32_int64_to_double",	reinterpret_cast<uintptr_t>(&CodeGen_AArch32_int64_to_double));
+	objectFile->AddExternalSymbol("_CodeGen_AArch32_double_to_int64_trunc",	reinterpret_cast<uintptr_t>(&CodeGen_AArch32_double_to_int64_trunc));
+	objectFile->AddExternalSymbol("_CodeGen_AArch32_single_to_int64_trunc",	reinterpret_cast<uintptr_t>(&CodeGen_AArch32_single_to_int64_trunc));
 }
 
 void CCodeGen_AArch32::GenerateCode(const StatementList& statements, unsigned int stackSize)
@@ -328,9 +385,16 @@ void CCodeGen_AArch32::GenerateCode(const StatementList& statements, unsigned in
 
 	Emit_Epilog(stackSize, registerSave);
 
+	//Slow paths are placed after the epilog to keep them out of the main flow
+	for(const auto& coldPathEmitter : m_coldPathEmitters)
+	{
+		coldPathEmitter();
+	}
+
 	m_assembler.ResolveLabelReferences();
 	m_assembler.ClearLabels();
 	m_labels.clear();
+	m_coldPathEmitters.clear();
 }
 
 uint16 CCodeGen_AArch32::GetSavedRegisterList(uint32 registerUsage)
@@ -575,6 +639,11 @@ CAArch32Assembler::AluLdrShift CCodeGen_AArch32::GetAluShiftFromSymbol(CAArch32A
 		return CAArch32Assembler::MakeVariableShift(shiftType, preferedRegister);
 		break;
 	case SYM_CONSTANT:
+		if((shiftType == CAArch32Assembler::SHIFT_ROR) && ((symbol->m_valueLow & 0x1F) == 0))
+		{
+			//ROR #0 encodes RRX, use a plain move instead
+			return CAArch32Assembler::MakeConstantShift(CAArch32Assembler::SHIFT_LSL, 0);
+		}
 		return CAArch32Assembler::MakeConstantShift(shiftType, static_cast<uint8>(symbol->m_valueLow & 0x1F));
 		break;
 	default:
@@ -1023,6 +1092,82 @@ void CCodeGen_AArch32::Emit_Lzc_VarVar(const STATEMENT& statement)
 	CommitSymbolRegister(dst, dstRegister);
 }
 
+void CCodeGen_AArch32::Emit_Ext_VarVar(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	auto dstRegister = PrepareSymbolRegisterDef(dst, CAArch32Assembler::r0);
+	auto src1Register = PrepareSymbolRegisterUse(src1, CAArch32Assembler::r1);
+
+	switch(statement.op)
+	{
+	case OP_SEXT8:
+		m_assembler.Sxtb(dstRegister, src1Register);
+		break;
+	case OP_SEXT16:
+		m_assembler.Sxth(dstRegister, src1Register);
+		break;
+	case OP_ZEXT8:
+		m_assembler.Uxtb(dstRegister, src1Register);
+		break;
+	case OP_ZEXT16:
+		m_assembler.Uxth(dstRegister, src1Register);
+		break;
+	default:
+		assert(false);
+		break;
+	}
+
+	CommitSymbolRegister(dst, dstRegister);
+}
+
+void CCodeGen_AArch32::Emit_ByteSwap_VarVar(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	auto dstRegister = PrepareSymbolRegisterDef(dst, CAArch32Assembler::r0);
+	auto src1Register = PrepareSymbolRegisterUse(src1, CAArch32Assembler::r1);
+
+	m_assembler.Rev(dstRegister, src1Register);
+
+	CommitSymbolRegister(dst, dstRegister);
+}
+
+void CCodeGen_AArch32::Emit_PopCount_VarVar(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	auto dstRegister = PrepareSymbolRegisterDef(dst, CAArch32Assembler::r0);
+	auto src1Register = PrepareSymbolRegisterUse(src1, CAArch32Assembler::r1);
+
+	//Count bits of each byte and add them up pairwise
+	auto tmpRegister = CAArch32Assembler::d0;
+	m_assembler.Vmov(tmpRegister, src1Register, 0);
+	m_assembler.Vcnt_I8(tmpRegister, tmpRegister);
+	m_assembler.Vpaddl_U8(tmpRegister, tmpRegister);
+	m_assembler.Vpaddl_U16(tmpRegister, tmpRegister);
+	m_assembler.Vmov(dstRegister, tmpRegister, 0);
+
+	CommitSymbolRegister(dst, dstRegister);
+}
+
+void CCodeGen_AArch32::Emit_Ctz_VarVar(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	auto dstRegister = PrepareSymbolRegisterDef(dst, CAArch32Assembler::r0);
+	auto src1Register = PrepareSymbolRegisterUse(src1, CAArch32Assembler::r1);
+
+	m_assembler.Rbit(dstRegister, src1Register);
+	m_assembler.Clz(dstRegister, dstRegister);
+
+	CommitSymbolRegister(dst, dstRegister);
+}
+
 void CCodeGen_AArch32::Emit_Jmp(const STATEMENT& statement)
 {
 	m_assembler.BCc(CAArch32Assembler::CONDITION_AL, GetLabel(statement.jmpBlock));
@@ -1292,3 +1437,130 @@ void CCodeGen_AArch32::Emit_StoreAtRef_TmpAny(const STATEMENT& statement)
 	LoadTemporaryReferenceInRegister(addressReg, src1);
 	m_assembler.Str(valueReg, addressReg, CAArch32Assembler::MakeImmediateLdrAddress(0));
 }
+
+void CCodeGen_AArch32::Emit_LoadSizedFromRef_VarMem(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	auto addressReg = CAArch32Assembler::r0;
+	auto dstReg = PrepareSymbolRegisterDef(dst, CAArch32Assembler::r1);
+
+	LoadMemoryReferenceInRegister(addressReg, src1);
+	switch(statement.op)
+	{
+	case OP_LOAD8FROMREF:
+		m_assembler.Ldrb(dstReg, addressReg, CAArch32Assembler::MakeImmediateLdrAddress(0));
+		break;
+	case OP_LOAD8SFROMREF:
+		m_assembler.Ldrsb(dstReg, addressReg, CAArch32Assembler::MakeImmediateLdrAddress(0));
+		break;
+	case OP_LOAD16FROMREF:
+		m_assembler.Ldrh(dstReg, addressReg, CAArch32Assembler::MakeImmediateLdrAddress(0));
+		break;
+	case OP_LOAD16SFROMREF:
+		m_assembler.Ldrsh(dstReg, addressReg, CAArch32Assembler::MakeImmediateLdrAddress(0));
+		break;
+	default:
+		assert(false);
+		break;
+	}
+
+	CommitSymbolRegister(dst, dstReg);
+}
+
+void CCodeGen_AArch32::Emit_StoreSizedAtRef_MemAny(const STATEMENT& statement)
+{
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	auto addressReg = CAArch32Assembler::r0;
+	auto valueReg = PrepareSymbolRegisterUse(src2, CAArch32Assembler::r1);
+
+	LoadMemoryReferenceInRegister(addressReg, src1);
+	switch(statement.op)
+	{
+	case OP_STORE8ATREF:
+		m_assembler.Strb(valueReg, addressReg, CAArch32Assembler::MakeImmediateLdrAddress(0));
+		break;
+	case OP_STORE16ATREF:
+		m_assembler.Strh(valueReg, addressReg, CAArch32Assembler::MakeImmediateLdrAddress(0));
+		break;
+	default:
+		assert(false);
+		break;
+	}
+}
+
+void CCodeGen_AArch32::Emit_LoadFromTlb_VarAny(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+	auto src3 = statement.src3->GetSymbol().get();
+
+	assert(src2->m_type == SYM_CONSTANTPTR);
+	assert(src3->m_type == SYM_CONSTANT64);
+
+	uint32 tableOffset = src3->m_valueLow;
+	uint8 pageShift = static_cast<uint8>(src3->m_valueHigh);
+	uintptr_t missHandler = src2->GetConstantPtr();
+
+	auto dstReg = PrepareSymbolRegisterDef(dst, CAArch32Assembler::r0);
+	auto addressReg = PrepareSymbolRegisterUse(src1, CAArch32Assembler::r1);
+	auto indexReg = CAArch32Assembler::r2;
+	auto entryReg = CAArch32Assembler::r3;
+
+	auto missLabel = m_assembler.CreateLabel();
+	auto doneLabel = m_assembler.CreateLabel();
+
+	m_assembler.Mov(indexReg, CAArch32Assembler::MakeRegisterAluOperand(addressReg, 
+		CAArch32Assembler::MakeConstantShift(CAArch32Assembler::SHIFT_LSR, pageShift)));
+	m_assembler.Ldr(entryReg, g_baseRegister, CAArch32Assembler::MakeImmediateLdrAddress(tableOffset));
+	m_assembler.Ldr(entryReg, entryReg, CAArch32Assembler::MakeRegisterLdrAddress(indexReg, 
+		CAArch32Assembler::MakeConstantShift(CAArch32Assembler::SHIFT_LSL, 2)));
+	m_assembler.Cmp(entryReg, CAArch32Assembler::MakeImmediateAluOperand(0, 0));
+	m_assembler.BCc(CAArch32Assembler::CONDITION_EQ, missLabel);
+
+	//Page mask might not be encodable as an immediate, clear upper bits with shifts instead
+	m_assembler.Mov(indexReg, CAArch32Assembler::MakeRegisterAluOperand(addressReg, 
+		CAArch32Assembler::MakeConstantShift(CAArch32Assembler::SHIFT_LSL, 32 - pageShift)));
+	m_assembler.Ldr(dstReg, entryReg, CAArch32Assembler::MakeRegisterLdrAddress(indexReg, 
+		CAArch32Assembler::MakeConstantShift(CAArch32Assembler::SHIFT_LSR, 32 - pageShift)));
+
+	m_assembler.MarkLabel(doneLabel);
+	CommitSymbolRegister(dst, dstReg);
+
+	m_coldPathEmitters.push_back(
+		[this, addressReg, dstReg, missLabel, doneLabel, missHandler] ()
+		{
+			//Allocated registers are callee saved, but g_callAddressRegister might hold a value here
+			auto callAddressReg = CAArch32Assembler::r2;
+
+			m_assembler.MarkLabel(missLabel);
+			m_assembler.Mov(CAArch32Assembler::r1, addressReg);
+			m_assembler.Mov(CAArch32Assembler::r0, g_baseRegister);
+			LoadConstantPtrInRegister(callAddressReg, missHandler);
+			m_assembler.Mov(CAArch32Assembler::rLR, CAArch32Assembler::rPC);
+			m_assembler.Mov(CAArch32Assembler::rPC, callAddressReg);
+			m_assembler.Mov(dstReg, CAArch32Assembler::r0);
+			m_assembler.BCc(CAArch32Assembler::CONDITION_AL, doneLabel);
+		}
+	);
+}
+
+void CCodeGen_AArch32::Emit_IncCounter(const STATEMENT& statement)
+{
+	auto src1 = statement.src1->GetSymbol().get();
+
+	auto addressReg = CAArch32Assembler::r0;
+	auto counterReg = CAArch32Assembler::r1;
+
+	//Counters are not external symbols, don't use LoadConstantPtrInRegister
+	uintptr_t counterAddress = src1->GetConstantPtr();
+	m_assembler.Movw(addressReg, static_cast<uint16>(counterAddress & 0xFFFF));
+	m_assembler.Movt(addressReg, static_cast<uint16>(counterAddress >> 16));
+	m_assembler.Ldr(counterReg, addressReg, CAArch32Assembler::MakeImmediateLdrAddress(0));
+	m_assembler.Add(counterReg, counterReg, CAArch32Assembler::MakeImmediateAluOperand(1, 0));
+	m_assembler.Str(counterReg, addressReg, CAArch32Assembler::MakeImmediateLdrAddress(0));
+}
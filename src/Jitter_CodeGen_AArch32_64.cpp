@@ -2,6 +2,10 @@
 
 using namespace Jitter;
 
+//Defined in Jitter_CodeGen_AArch32_Div.h
+extern "C" uint64 CodeGen_AArch32_div64_unsigned(uint64, uint64);
+extern "C" int64 CodeGen_AArch32_div64_signed(int64, int64);
+
 uint32 CCodeGen_AArch32::GetMemory64Offset(CSymbol* symbol) const
 {
 	switch(symbol->m_type)
@@ -79,6 +83,19 @@ void CCodeGen_AArch32::LoadMemory64InRegisters(CAArch32Assembler::REGISTER regLo
 	}
 }
 
+void CCodeGen_AArch32::LoadSymbol64InRegisters(CAArch32Assembler::REGISTER regLo, CAArch32Assembler::REGISTER regHi, CSymbol* symbol)
+{
+	if(symbol->m_type == SYM_CONSTANT64)
+	{
+		LoadConstantInRegister(regLo, symbol->m_valueLow);
+		LoadConstantInRegister(regHi, symbol->m_valueHigh);
+	}
+	else
+	{
+		LoadMemory64InRegisters(regLo, regHi, symbol);
+	}
+}
+
 void CCodeGen_AArch32::StoreRegistersInMemory64(CSymbol* symbol, CAArch32Assembler::REGISTER regLo, CAArch32Assembler::REGISTER regHi)
 {
 	if(
@@ -162,6 +179,35 @@ void CCodeGen_AArch32::Emit_Mov_Mem64Cst64(const STATEMENT& statement)
 	StoreRegistersInMemory64(dst, regLo, regHi);
 }
 
+void CCodeGen_AArch32::Emit_LoadFromRef_Mem64Mem(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	//Referenced values might only be word aligned, ldrd can't be used
+	auto addressReg = CAArch32Assembler::r0;
+	auto regLo = CAArch32Assembler::r2;
+	auto regHi = CAArch32Assembler::r3;
+	LoadMemoryReferenceInRegister(addressReg, src1);
+	m_assembler.Ldr(regLo, addressReg, CAArch32Assembler::MakeImmediateLdrAddress(0));
+	m_assembler.Ldr(regHi, addressReg, CAArch32Assembler::MakeImmediateLdrAddress(4));
+	StoreRegistersInMemory64(dst, regLo, regHi);
+}
+
+void CCodeGen_AArch32::Emit_StoreAtRef_MemAny64(const STATEMENT& statement)
+{
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	auto addressReg = CAArch32Assembler::r0;
+	auto regLo = CAArch32Assembler::r2;
+	auto regHi = CAArch32Assembler::r3;
+	LoadMemoryReferenceInRegister(addressReg, src1);
+	LoadSymbol64InRegisters(regLo, regHi, src2);
+	m_assembler.Str(regLo, addressReg, CAArch32Assembler::MakeImmediateLdrAddress(0));
+	m_assembler.Str(regHi, addressReg, CAArch32Assembler::MakeImmediateLdrAddress(4));
+}
+
 void CCodeGen_AArch32::Emit_ExtLow64VarMem64(const STATEMENT& statement)
 {
 	auto dst = statement.dst->GetSymbol().get();
@@ -194,6 +240,31 @@ void CCodeGen_AArch32::Emit_MergeTo64_Mem64AnyAny(const STATEMENT& statement)
 	StoreRegistersInMemory64(dst, regLo, regHi);
 }
 
+void CCodeGen_AArch32::Emit_SignExtTo64_Mem64Var(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	auto regLo = PrepareSymbolRegisterUse(src1, CAArch32Assembler::r0);
+	auto regHi = CAArch32Assembler::r1;
+	m_assembler.Mov(regHi, CAArch32Assembler::MakeRegisterAluOperand(regLo,
+		CAArch32Assembler::MakeConstantShift(CAArch32Assembler::SHIFT_ASR, 31)));
+
+	StoreRegistersInMemory64(dst, regLo, regHi);
+}
+
+void CCodeGen_AArch32::Emit_ZeroExtTo64_Mem64Var(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	auto regLo = PrepareSymbolRegisterUse(src1, CAArch32Assembler::r0);
+	auto regHi = CAArch32Assembler::r1;
+	LoadConstantInRegister(regHi, 0);
+
+	StoreRegistersInMemory64(dst, regLo, regHi);
+}
+
 void CCodeGen_AArch32::Emit_Add64_MemMemMem(const STATEMENT& statement)
 {
 	auto dst = statement.dst->GetSymbol().get();
@@ -300,7 +371,8 @@ void CCodeGen_AArch32::Emit_Sub64_MemCstMem(const STATEMENT& statement)
 	StoreRegistersInMemory64(dst, regLo1, regHi1);
 }
 
-void CCodeGen_AArch32::Emit_And64_MemMemMem(const STATEMENT& statement)
+template <typename ALUOP>
+void CCodeGen_AArch32::Emit_Logic64_MemAnyAny(const STATEMENT& statement)
 {
 	auto dst = statement.dst->GetSymbol().get();
 	auto src1 = statement.src1->GetSymbol().get();
@@ -311,15 +383,77 @@ void CCodeGen_AArch32::Emit_And64_MemMemMem(const STATEMENT& statement)
 	auto regLo2 = CAArch32Assembler::r2;
 	auto regHi2 = CAArch32Assembler::r3;
 
-	LoadMemory64InRegisters(regLo1, regHi1, src1);
-	LoadMemory64InRegisters(regLo2, regHi2, src2);
+	LoadSymbol64InRegisters(regLo1, regHi1, src1);
+	LoadSymbol64InRegisters(regLo2, regHi2, src2);
 
-	m_assembler.And(regLo1, regLo1, regLo2);
-	m_assembler.And(regHi1, regHi1, regHi2);
+	((m_assembler).*(ALUOP::OpReg()))(regLo1, regLo1, regLo2);
+	((m_assembler).*(ALUOP::OpReg()))(regHi1, regHi1, regHi2);
 
 	StoreRegistersInMemory64(dst, regLo1, regHi1);
 }
 
+void CCodeGen_AArch32::Emit_Not64_MemMem(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	auto regLo = CAArch32Assembler::r0;
+	auto regHi = CAArch32Assembler::r1;
+
+	LoadMemory64InRegisters(regLo, regHi, src1);
+
+	m_assembler.Mvn(regLo, regLo);
+	m_assembler.Mvn(regHi, regHi);
+
+	StoreRegistersInMemory64(dst, regLo, regHi);
+}
+
+void CCodeGen_AArch32::Emit_Mul64_MemAnyAny(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	auto regLo1 = CAArch32Assembler::r0;
+	auto regHi1 = CAArch32Assembler::r1;
+	auto regLo2 = CAArch32Assembler::r2;
+	auto regHi2 = CAArch32Assembler::r3;
+	//r12 is free to use as a scratch register here
+	auto resLoReg = CAArch32Assembler::r3;
+	auto resHiReg = CAArch32Assembler::r12;
+
+	LoadSymbol64InRegisters(regLo1, regHi1, src1);
+	LoadSymbol64InRegisters(regLo2, regHi2, src2);
+
+	//Cross products only contribute to the high word
+	m_assembler.Mul(regHi1, regLo2, regHi1);
+	m_assembler.Mla(regHi1, regLo1, regHi2, regHi1);
+	m_assembler.Umull(resLoReg, resHiReg, regLo1, regLo2);
+	m_assembler.Add(regHi1, regHi1, resHiReg);
+
+	StoreRegistersInMemory64(dst, resLoReg, regHi1);
+}
+
+template <bool isSigned>
+void CCodeGen_AArch32::Emit_Div64_MemAnyAny(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	auto divFct = isSigned ? 
+		reinterpret_cast<uintptr_t>(&CodeGen_AArch32_div64_signed) : reinterpret_cast<uintptr_t>(&CodeGen_AArch32_div64_unsigned);
+
+	//Operands are passed in r0:r1 and r2:r3, result comes back in r0:r1
+	LoadSymbol64InRegisters(CAArch32Assembler::r0, CAArch32Assembler::r1, src1);
+	LoadSymbol64InRegisters(CAArch32Assembler::r2, CAArch32Assembler::r3, src2);
+
+	LoadConstantPtrInRegister(CAArch32Assembler::r12, divFct);
+	m_assembler.Blx(CAArch32Assembler::r12);
+
+	StoreRegistersInMemory64(dst, CAArch32Assembler::r0, CAArch32Assembler::r1);
+}
+
 void CCodeGen_AArch32::Emit_Sl64Var_MemMem(CSymbol* dst, CSymbol* src, CAArch32Assembler::REGISTER saReg)
 {
 	//saReg will be modified by this function, do not use PrepareRegister
@@ -664,6 +798,114 @@ void CCodeGen_AArch32::Emit_Sra64_MemMemCst(const STATEMENT& statement)
 	Emit_Sr64Cst_MemMem(dst, src1, shiftAmount, CAArch32Assembler::SHIFT_ASR);
 }
 
+void CCodeGen_AArch32::Emit_Ror64_MemMemVar(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	auto saReg = CAArch32Assembler::r0;
+	auto tmpReg = CAArch32Assembler::r1;
+	auto loReg = CAArch32Assembler::r2;
+	auto hiReg = CAArch32Assembler::r3;
+	//r12 is free to use as a scratch register here
+	auto invSaReg = CAArch32Assembler::r12;
+
+	switch(src2->m_type)
+	{
+	case SYM_REGISTER:
+		m_assembler.Mov(saReg, g_registers[src2->m_valueLow]);
+		break;
+	case SYM_RELATIVE:
+	case SYM_TEMPORARY:
+		LoadMemoryInRegister(saReg, src2);
+		break;
+	default:
+		assert(0);
+		break;
+	}
+
+	auto noSwapLabel = m_assembler.CreateLabel();
+
+	LoadMemory64InRegisters(loReg, hiReg, src1);
+
+	//Rotating by 32 or more swaps both halves
+	m_assembler.And(tmpReg, saReg, CAArch32Assembler::MakeImmediateAluOperand(0x20, 0));
+	m_assembler.Cmp(tmpReg, CAArch32Assembler::MakeImmediateAluOperand(0, 0));
+	m_assembler.BCc(CAArch32Assembler::CONDITION_EQ, noSwapLabel);
+
+	m_assembler.Mov(tmpReg, loReg);
+	m_assembler.Mov(loReg, hiReg);
+	m_assembler.Mov(hiReg, tmpReg);
+
+	//noSwap:
+	m_assembler.MarkLabel(noSwapLabel);
+
+	//Register shifts by 32 give 0, no need to special case a rotation by 0
+	m_assembler.And(saReg, saReg, CAArch32Assembler::MakeImmediateAluOperand(0x1F, 0));
+	m_assembler.Rsb(invSaReg, saReg, CAArch32Assembler::MakeImmediateAluOperand(32, 0));
+
+	auto shiftRight = CAArch32Assembler::MakeVariableShift(CAArch32Assembler::SHIFT_LSR, saReg);
+	auto shiftLeft = CAArch32Assembler::MakeVariableShift(CAArch32Assembler::SHIFT_LSL, invSaReg);
+
+	//Lo part -> (lo >> sa) | (hi << (32 - sa))
+	//Hi part -> (hi >> sa) | (lo << (32 - sa))
+	m_assembler.Mov(tmpReg, CAArch32Assembler::MakeRegisterAluOperand(loReg, shiftRight));
+	m_assembler.Mov(loReg, CAArch32Assembler::MakeRegisterAluOperand(loReg, shiftLeft));
+	m_assembler.Mov(invSaReg, CAArch32Assembler::MakeRegisterAluOperand(hiReg, shiftLeft));
+	m_assembler.Or(tmpReg, tmpReg, invSaReg);
+	m_assembler.Mov(hiReg, CAArch32Assembler::MakeRegisterAluOperand(hiReg, shiftRight));
+	m_assembler.Or(hiReg, hiReg, loReg);
+
+	StoreRegistersInMemory64(dst, tmpReg, hiReg);
+}
+
+void CCodeGen_AArch32::Emit_Ror64_MemMemCst(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	auto shiftAmount = src2->m_valueLow & 0x3F;
+
+	auto srcLo = CAArch32Assembler::r0;
+	auto srcHi = CAArch32Assembler::r1;
+	auto dstLo = CAArch32Assembler::r2;
+	auto dstHi = CAArch32Assembler::r3;
+
+	//Rotating by 32 or more swaps both halves
+	if(shiftAmount >= 32)
+	{
+		LoadMemory64InRegisters(srcHi, srcLo, src1);
+	}
+	else
+	{
+		LoadMemory64InRegisters(srcLo, srcHi, src1);
+	}
+
+	shiftAmount &= 0x1F;
+	if(shiftAmount == 0)
+	{
+		StoreRegistersInMemory64(dst, srcLo, srcHi);
+		return;
+	}
+
+	auto shiftRight = CAArch32Assembler::MakeConstantShift(CAArch32Assembler::SHIFT_LSR, shiftAmount);
+	auto shiftLeft = CAArch32Assembler::MakeConstantShift(CAArch32Assembler::SHIFT_LSL, 32 - shiftAmount);
+
+	//Lo part -> (lo >> sa) | (hi << (32 - sa))
+	m_assembler.Mov(dstLo, CAArch32Assembler::MakeRegisterAluOperand(srcLo, shiftRight));
+	m_assembler.Mov(dstHi, CAArch32Assembler::MakeRegisterAluOperand(srcHi, shiftLeft));
+	m_assembler.Or(dstLo, dstLo, dstHi);
+
+	//Hi part -> (hi >> sa) | (lo << (32 - sa))
+	m_assembler.Mov(dstHi, CAArch32Assembler::MakeRegisterAluOperand(srcHi, shiftRight));
+	m_assembler.Mov(srcLo, CAArch32Assembler::MakeRegisterAluOperand(srcLo, shiftLeft));
+	m_assembler.Or(dstHi, dstHi, srcLo);
+
+	StoreRegistersInMemory64(dst, dstLo, dstHi);
+}
+
 void CCodeGen_AArch32::Cmp64_RegSymLo(CAArch32Assembler::REGISTER src1Reg, CSymbol* src2, CAArch32Assembler::REGISTER src2Reg)
 {
 	switch(src2->m_type)
@@ -835,6 +1077,9 @@ CCodeGen_AArch32::CONSTMATCHER CCodeGen_AArch32::g_64ConstMatchers[] =
 
 	{ OP_MERGETO64,		MATCH_MEMORY64,		MATCH_ANY,			MATCH_ANY,			&CCodeGen_AArch32::Emit_MergeTo64_Mem64AnyAny		},
 
+	{ OP_SEXTTO64,		MATCH_MEMORY64,		MATCH_VARIABLE,		MATCH_NIL,			&CCodeGen_AArch32::Emit_SignExtTo64_Mem64Var		},
+	{ OP_ZEXTTO64,		MATCH_MEMORY64,		MATCH_VARIABLE,		MATCH_NIL,			&CCodeGen_AArch32::Emit_ZeroExtTo64_Mem64Var		},
+
 	{ OP_ADD64,			MATCH_MEMORY64,		MATCH_MEMORY64,		MATCH_MEMORY64,		&CCodeGen_AArch32::Emit_Add64_MemMemMem				},
 	{ OP_ADD64,			MATCH_MEMORY64,		MATCH_MEMORY64,		MATCH_CONSTANT64,	&CCodeGen_AArch32::Emit_Add64_MemMemCst				},
 
@@ -842,7 +1087,14 @@ CCodeGen_AArch32::CONSTMATCHER CCodeGen_AArch32::g_64ConstMatchers[] =
 	{ OP_SUB64,			MATCH_MEMORY64,		MATCH_MEMORY64,		MATCH_CONSTANT64,	&CCodeGen_AArch32::Emit_Sub64_MemMemCst,			},
 	{ OP_SUB64,			MATCH_MEMORY64,		MATCH_CONSTANT64,	MATCH_MEMORY64,		&CCodeGen_AArch32::Emit_Sub64_MemCstMem				},
 
-	{ OP_AND64,			MATCH_MEMORY64,		MATCH_MEMORY64,		MATCH_MEMORY64,		&CCodeGen_AArch32::Emit_And64_MemMemMem,			},
+	{ OP_AND64,			MATCH_MEMORY64,		MATCH_ANY,			MATCH_ANY,			&CCodeGen_AArch32::Emit_Logic64_MemAnyAny<ALUOP_AND>	},
+	{ OP_OR64,			MATCH_MEMORY64,		MATCH_ANY,			MATCH_ANY,			&CCodeGen_AArch32::Emit_Logic64_MemAnyAny<ALUOP_OR>	},
+	{ OP_XOR64,			MATCH_MEMORY64,		MATCH_ANY,			MATCH_ANY,			&CCodeGen_AArch32::Emit_Logic64_MemAnyAny<ALUOP_XOR>	},
+	{ OP_NOT64,			MATCH_MEMORY64,		MATCH_MEMORY64,		MATCH_NIL,			&CCodeGen_AArch32::Emit_Not64_MemMem				},
+
+	{ OP_MUL64,			MATCH_MEMORY64,		MATCH_ANY,			MATCH_ANY,			&CCodeGen_AArch32::Emit_Mul64_MemAnyAny				},
+	{ OP_DIV64,			MATCH_MEMORY64,		MATCH_ANY,			MATCH_ANY,			&CCodeGen_AArch32::Emit_Div64_MemAnyAny<false>		},
+	{ OP_DIVS64,		MATCH_MEMORY64,		MATCH_ANY,			MATCH_ANY,			&CCodeGen_AArch32::Emit_Div64_MemAnyAny<true>		},
 
 	{ OP_SLL64,			MATCH_MEMORY64,		MATCH_MEMORY64,		MATCH_VARIABLE,		&CCodeGen_AArch32::Emit_Sll64_MemMemVar				},
 	{ OP_SLL64,			MATCH_MEMORY64,		MATCH_MEMORY64,		MATCH_CONSTANT,		&CCodeGen_AArch32::Emit_Sll64_MemMemCst				},
@@ -853,9 +1105,16 @@ CCodeGen_AArch32::CONSTMATCHER CCodeGen_AArch32::g_64ConstMatchers[] =
 	{ OP_SRA64,			MATCH_MEMORY64,		MATCH_MEMORY64,		MATCH_VARIABLE,		&CCodeGen_AArch32::Emit_Sra64_MemMemVar				},
 	{ OP_SRA64,			MATCH_MEMORY64,		MATCH_MEMORY64,		MATCH_CONSTANT,		&CCodeGen_AArch32::Emit_Sra64_MemMemCst				},
 
+	{ OP_ROR64,			MATCH_MEMORY64,		MATCH_MEMORY64,		MATCH_VARIABLE,		&CCodeGen_AArch32::Emit_Ror64_MemMemVar				},
+	{ OP_ROR64,			MATCH_MEMORY64,		MATCH_MEMORY64,		MATCH_CONSTANT,		&CCodeGen_AArch32::Emit_Ror64_MemMemCst				},
+
 	{ OP_CMP64,			MATCH_VARIABLE,		MATCH_MEMORY64,		MATCH_MEMORY64,		&CCodeGen_AArch32::Emit_Cmp64_VarMemAny				},
 	{ OP_CMP64,			MATCH_VARIABLE,		MATCH_MEMORY64,		MATCH_CONSTANT64,	&CCodeGen_AArch32::Emit_Cmp64_VarMemAny				},
 
+	{ OP_LOADFROMREF,	MATCH_MEMORY64,		MATCH_MEM_REF,		MATCH_NIL,			&CCodeGen_AArch32::Emit_LoadFromRef_Mem64Mem		},
+	{ OP_STOREATREF,	MATCH_NIL,			MATCH_MEM_REF,		MATCH_MEMORY64,		&CCodeGen_AArch32::Emit_StoreAtRef_MemAny64			},
+	{ OP_STOREATREF,	MATCH_NIL,			MATCH_MEM_REF,		MATCH_CONSTANT64,	&CCodeGen_AArch32::Emit_StoreAtRef_MemAny64			},
+
 	{ OP_MOV,			MATCH_MEMORY64,		MATCH_MEMORY64,		MATCH_NIL,			&CCodeGen_AArch32::Emit_Mov_Mem64Mem64				},
 	{ OP_MOV,			MATCH_MEMORY64,		MATCH_CONSTANT64,	MATCH_NIL,			&CCodeGen_AArch32::Emit_Mov_Mem64Cst64				},
 
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstring>
+
 extern "C" uint32 CodeGen_AArch32_div_unsigned(uint32 a, uint32 b)
 {
 	return a / b;
@@ -20,6 +22,40 @@ extern "C" int32 CodeGen_AArch32_mod_signed(int32 a, int32 b)
 	return a % b;
 }
 
+extern "C" uint64 CodeGen_AArch32_div64_unsigned(uint64 a, uint64 b)
+{
+	return a / b;
+}
+
+extern "C" int64 CodeGen_AArch32_div64_signed(int64 a, int64 b)
+{
+	return a / b;
+}
+
+//Floating point values are exchanged as raw bits to stay independent from the float ABI
+
+extern "C" uint64 CodeGen_AArch32_int64_to_double(int64 a)
+{
+	double result = static_cast<double>(a);
+	uint64 resultBits = 0;
+	memcpy(&resultBits, &result, sizeof(double));
+	return resultBits;
+}
+
+extern "C" int64 CodeGen_AArch32_double_to_int64_trunc(uint64 a)
+{
+	double value = 0;
+	memcpy(&value, &a, sizeof(double));
+	return static_cast<int64>(value);
+}
+
+extern "C" int64 CodeGen_AArch32_single_to_int64_trunc(uint32 a)
+{
+	float value = 0;
+	memcpy(&value, &a, sizeof(float));
+	return static_cast<int64>(value);
+}
+
 template <bool isSigned>
 void CCodeGen_AArch32::Div_GenericTmp64AnyAnySoft(const STATEMENT& statement)
 {
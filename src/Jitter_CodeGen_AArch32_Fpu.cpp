@@ -2,6 +2,11 @@
 
 using namespace Jitter;
 
+//Defined in Jitter_CodeGen_AArch32_Div.h
+extern "C" uint64 CodeGen_AArch32_int64_to_double(int64);
+extern "C" int64 CodeGen_AArch32_double_to_int64_trunc(uint64);
+extern "C" int64 CodeGen_AArch32_single_to_int64_trunc(uint32);
+
 void CCodeGen_AArch32::LoadMemoryFpSingleInRegister(CTempRegisterContext& tempRegContext, CAArch32Assembler::SINGLE_REGISTER reg, CSymbol* symbol)
 {
 	switch(symbol->m_type)
@@ -104,6 +109,68 @@ void CCodeGen_AArch32::StoreTemporaryFpSingleInRegister(CTempRegisterContext& te
 	}
 }
 
+void CCodeGen_AArch32::LoadMemoryFpDoubleInRegister(CTempRegisterContext& tempRegContext, CAArch32Assembler::DOUBLE_REGISTER reg, CSymbol* symbol)
+{
+	auto baseRegister = g_baseRegister;
+	uint32 offset = 0;
+	switch(symbol->m_type)
+	{
+	case SYM_FP_REL_DOUBLE:
+		offset = symbol->m_valueLow;
+		break;
+	case SYM_FP_TMP_DOUBLE:
+		baseRegister = CAArch32Assembler::rSP;
+		offset = symbol->m_stackLocation + m_stackLevel;
+		break;
+	default:
+		assert(false);
+		break;
+	}
+	if((offset / 4) < 0x100)
+	{
+		m_assembler.Vldr(reg, baseRegister, CAArch32Assembler::MakeImmediateLdrAddress(offset));
+	}
+	else
+	{
+		auto offsetRegister = tempRegContext.Allocate();
+		LoadConstantInRegister(offsetRegister, offset);
+		m_assembler.Add(offsetRegister, offsetRegister, baseRegister);
+		m_assembler.Vldr(reg, offsetRegister, CAArch32Assembler::MakeImmediateLdrAddress(0));
+		tempRegContext.Release(offsetRegister);
+	}
+}
+
+void CCodeGen_AArch32::StoreRegisterInMemoryFpDouble(CTempRegisterContext& tempRegContext, CSymbol* symbol, CAArch32Assembler::DOUBLE_REGISTER reg)
+{
+	auto baseRegister = g_baseRegister;
+	uint32 offset = 0;
+	switch(symbol->m_type)
+	{
+	case SYM_FP_REL_DOUBLE:
+		offset = symbol->m_valueLow;
+		break;
+	case SYM_FP_TMP_DOUBLE:
+		baseRegister = CAArch32Assembler::rSP;
+		offset = symbol->m_stackLocation + m_stackLevel;
+		break;
+	default:
+		assert(false);
+		break;
+	}
+	if((offset / 4) < 0x100)
+	{
+		m_assembler.Vstr(reg, baseRegister, CAArch32Assembler::MakeImmediateLdrAddress(offset));
+	}
+	else
+	{
+		auto offsetRegister = tempRegContext.Allocate();
+		LoadConstantInRegister(offsetRegister, offset);
+		m_assembler.Add(offsetRegister, offsetRegister, baseRegister);
+		m_assembler.Vstr(reg, offsetRegister, CAArch32Assembler::MakeImmediateLdrAddress(0));
+		tempRegContext.Release(offsetRegister);
+	}
+}
+
 template <typename FPUOP>
 void CCodeGen_AArch32::Emit_Fpu_MemMem(const STATEMENT& statement)
 {
@@ -132,6 +199,25 @@ void CCodeGen_AArch32::Emit_Fpu_MemMemMem(const STATEMENT& statement)
 	StoreRegisterInMemoryFpSingle(tempRegisterContext, dst, CAArch32Assembler::s2);
 }
 
+template <typename FPUOP>
+void CCodeGen_AArch32::Emit_Fpu_MulAcc_MemMemMem(const STATEMENT& statement)
+{
+	//VFPv3 doesn't have fused multiply-add, fused operations also go through here
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+	auto src3 = statement.src3->GetSymbol().get();
+
+	CTempRegisterContext tempRegisterContext;
+
+	LoadMemoryFpSingleInRegister(tempRegisterContext, CAArch32Assembler::s0, src1);
+	LoadMemoryFpSingleInRegister(tempRegisterContext, CAArch32Assembler::s1, src2);
+	LoadMemoryFpSingleInRegister(tempRegisterContext, CAArch32Assembler::s2, src3);
+	m_assembler.Vmul_F32(CAArch32Assembler::s1, CAArch32Assembler::s1, CAArch32Assembler::s2);
+	((m_assembler).*(FPUOP::OpReg()))(CAArch32Assembler::s2, CAArch32Assembler::s0, CAArch32Assembler::s1);
+	StoreRegisterInMemoryFpSingle(tempRegisterContext, dst, CAArch32Assembler::s2);
+}
+
 template <typename FPUMDOP>
 void CCodeGen_AArch32::Emit_FpuMd_MemMemMem(const STATEMENT& statement)
 {
@@ -247,6 +333,92 @@ void CCodeGen_AArch32::Emit_Fp_ToIntTrunc_MemMem(const STATEMENT& statement)
 	StoreRegisterInMemoryFpSingle(tempRegisterContext, dst, dstReg);
 }
 
+void CCodeGen_AArch32::SetFpRoundingMode(CAArch32Assembler::REGISTER savedReg, CAArch32Assembler::REGISTER tmpReg, ROUNDMODE roundMode)
+{
+	//FPSCR's RMode field (bits 22-23) uses the same ordering as ROUNDMODE.
+	//Previous value is kept in savedReg, restore it with Vmsr when done.
+	assert(roundMode < 4);
+	m_assembler.Vmrs(savedReg);
+	m_assembler.Bic(tmpReg, savedReg, CAArch32Assembler::MakeImmediateAluOperand(0x03, 5));
+	if(roundMode != ROUND_NEAREST)
+	{
+		m_assembler.Or(tmpReg, tmpReg, CAArch32Assembler::MakeImmediateAluOperand(roundMode, 5));
+	}
+	m_assembler.Vmsr(tmpReg);
+}
+
+void CCodeGen_AArch32::RoundFpSingleInRegister(CAArch32Assembler::SINGLE_REGISTER reg, CAArch32Assembler::REGISTER tmpReg1, CAArch32Assembler::REGISTER tmpReg2)
+{
+	//Rounds using the rounding mode set in FPSCR. Values that are already integral
+	//(|x| >= 2^23), infinities and NaNs are left untouched. Sign is copied back
+	//from the source to get -0 for negative values rounding to 0.
+	auto doneLabel = m_assembler.CreateLabel();
+
+	m_assembler.Vmov(tmpReg1, reg);
+	m_assembler.Bic(tmpReg2, tmpReg1, CAArch32Assembler::MakeImmediateAluOperand(0x02, 1));
+	m_assembler.Cmp(tmpReg2, CAArch32Assembler::MakeImmediateAluOperand(0x4B, 4));
+	m_assembler.BCc(CAArch32Assembler::CONDITION_CS, doneLabel);
+
+	m_assembler.Vcvtr_S32_F32(reg, reg);
+	m_assembler.Vcvt_F32_S32(reg, reg);
+	m_assembler.Vmov(tmpReg2, reg);
+	m_assembler.And(tmpReg1, tmpReg1, CAArch32Assembler::MakeImmediateAluOperand(0x02, 1));
+	m_assembler.Or(tmpReg2, tmpReg2, tmpReg1);
+	m_assembler.Vmov(reg, tmpReg2);
+
+	m_assembler.MarkLabel(doneLabel);
+}
+
+void CCodeGen_AArch32::Emit_Fp_ToInt_MemMemCst(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	CTempRegisterContext tempRegisterContext;
+
+	auto dstReg = CAArch32Assembler::s0;
+	auto src1Reg = CAArch32Assembler::s1;
+
+	LoadMemoryFpSingleInRegister(tempRegisterContext, src1Reg, src1);
+
+	//Conversion saturates and gives 0 for NaNs
+	auto savedReg = tempRegisterContext.Allocate();
+	auto tmpReg = tempRegisterContext.Allocate();
+	SetFpRoundingMode(savedReg, tmpReg, static_cast<ROUNDMODE>(src2->m_valueLow));
+	m_assembler.Vcvtr_S32_F32(dstReg, src1Reg);
+	m_assembler.Vmsr(savedReg);
+	tempRegisterContext.Release(tmpReg);
+	tempRegisterContext.Release(savedReg);
+
+	StoreRegisterInMemoryFpSingle(tempRegisterContext, dst, dstReg);
+}
+
+void CCodeGen_AArch32::Emit_Fp_Round_MemMemCst(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	CTempRegisterContext tempRegisterContext;
+
+	auto resultReg = CAArch32Assembler::s0;
+
+	LoadMemoryFpSingleInRegister(tempRegisterContext, resultReg, src1);
+
+	auto savedReg = tempRegisterContext.Allocate();
+	auto tmpReg1 = tempRegisterContext.Allocate();
+	auto tmpReg2 = tempRegisterContext.Allocate();
+	SetFpRoundingMode(savedReg, tmpReg1, static_cast<ROUNDMODE>(src2->m_valueLow));
+	RoundFpSingleInRegister(resultReg, tmpReg1, tmpReg2);
+	m_assembler.Vmsr(savedReg);
+	tempRegisterContext.Release(tmpReg2);
+	tempRegisterContext.Release(tmpReg1);
+	tempRegisterContext.Release(savedReg);
+
+	StoreRegisterInMemoryFpSingle(tempRegisterContext, dst, resultReg);
+}
+
 void CCodeGen_AArch32::Emit_Fp_LdCst_TmpCst(const STATEMENT& statement)
 {
 	auto dst = statement.dst->GetSymbol().get();
@@ -259,6 +431,269 @@ void CCodeGen_AArch32::Emit_Fp_LdCst_TmpCst(const STATEMENT& statement)
 	m_assembler.Str(CAArch32Assembler::r0, CAArch32Assembler::rSP, CAArch32Assembler::MakeImmediateLdrAddress(dst->m_stackLocation + m_stackLevel));
 }
 
+void CCodeGen_AArch32::Emit_Fp_ToDouble_MemMem(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	CTempRegisterContext tempRegisterContext;
+
+	LoadMemoryFpSingleInRegister(tempRegisterContext, CAArch32Assembler::s0, src1);
+	m_assembler.Vcvt_F64_F32(CAArch32Assembler::d1, CAArch32Assembler::s0);
+	StoreRegisterInMemoryFpDouble(tempRegisterContext, dst, CAArch32Assembler::d1);
+}
+
+void CCodeGen_AArch32::Emit_Fp_ToSingle_MemMem(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	CTempRegisterContext tempRegisterContext;
+
+	LoadMemoryFpDoubleInRegister(tempRegisterContext, CAArch32Assembler::d1, src1);
+	m_assembler.Vcvt_F32_F64(CAArch32Assembler::s0, CAArch32Assembler::d1);
+	StoreRegisterInMemoryFpSingle(tempRegisterContext, dst, CAArch32Assembler::s0);
+}
+
+void CCodeGen_AArch32::Emit_Fp_ToInt64Trunc_Mem64MemS(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	CTempRegisterContext tempRegisterContext;
+
+	//Value bits are passed in r0, result comes back in r0:r1
+	LoadMemoryFpSingleInRegister(tempRegisterContext, CAArch32Assembler::s0, src1);
+	m_assembler.Vmov(CAArch32Assembler::r0, CAArch32Assembler::d0, 0);
+
+	LoadConstantPtrInRegister(CAArch32Assembler::r12, reinterpret_cast<uintptr_t>(&CodeGen_AArch32_single_to_int64_trunc));
+	m_assembler.Blx(CAArch32Assembler::r12);
+
+	StoreRegistersInMemory64(dst, CAArch32Assembler::r0, CAArch32Assembler::r1);
+}
+
+template <typename FPUOP>
+void CCodeGen_AArch32::Emit_FpuD_MemMem(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	CTempRegisterContext tempRegisterContext;
+
+	LoadMemoryFpDoubleInRegister(tempRegisterContext, CAArch32Assembler::d0, src1);
+	((m_assembler).*(FPUOP::OpReg()))(CAArch32Assembler::d1, CAArch32Assembler::d0);
+	StoreRegisterInMemoryFpDouble(tempRegisterContext, dst, CAArch32Assembler::d1);
+}
+
+template <typename FPUOP>
+void CCodeGen_AArch32::Emit_FpuD_MemMemMem(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	CTempRegisterContext tempRegisterContext;
+
+	LoadMemoryFpDoubleInRegister(tempRegisterContext, CAArch32Assembler::d0, src1);
+	LoadMemoryFpDoubleInRegister(tempRegisterContext, CAArch32Assembler::d1, src2);
+	((m_assembler).*(FPUOP::OpReg()))(CAArch32Assembler::d2, CAArch32Assembler::d0, CAArch32Assembler::d1);
+	StoreRegisterInMemoryFpDouble(tempRegisterContext, dst, CAArch32Assembler::d2);
+}
+
+template <typename FPUOP>
+void CCodeGen_AArch32::Emit_FpuD_MulAcc_MemMemMem(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+	auto src3 = statement.src3->GetSymbol().get();
+
+	CTempRegisterContext tempRegisterContext;
+
+	LoadMemoryFpDoubleInRegister(tempRegisterContext, CAArch32Assembler::d0, src1);
+	LoadMemoryFpDoubleInRegister(tempRegisterContext, CAArch32Assembler::d1, src2);
+	LoadMemoryFpDoubleInRegister(tempRegisterContext, CAArch32Assembler::d2, src3);
+	m_assembler.Vmul_F64(CAArch32Assembler::d1, CAArch32Assembler::d1, CAArch32Assembler::d2);
+	((m_assembler).*(FPUOP::OpReg()))(CAArch32Assembler::d2, CAArch32Assembler::d0, CAArch32Assembler::d1);
+	StoreRegisterInMemoryFpDouble(tempRegisterContext, dst, CAArch32Assembler::d2);
+}
+
+template <bool isMax>
+void CCodeGen_AArch32::Emit_FpD_MinMax_MemMemMem(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	CTempRegisterContext tempRegisterContext;
+
+	//VFP has no scalar min/max, select src2 if it compares better than src1
+	LoadMemoryFpDoubleInRegister(tempRegisterContext, CAArch32Assembler::d0, src1);
+	LoadMemoryFpDoubleInRegister(tempRegisterContext, CAArch32Assembler::d1, src2);
+	m_assembler.Vcmp_F64(CAArch32Assembler::d0, CAArch32Assembler::d1);
+	m_assembler.Vmrs(CAArch32Assembler::rPC);	//Move to general purpose status register
+	m_assembler.VmovCc_F64(isMax ? CAArch32Assembler::CONDITION_MI : CAArch32Assembler::CONDITION_GT, CAArch32Assembler::d0, CAArch32Assembler::d1);
+	StoreRegisterInMemoryFpDouble(tempRegisterContext, dst, CAArch32Assembler::d0);
+}
+
+void CCodeGen_AArch32::Emit_FpD_Rcpl_MemMem(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	CTempRegisterContext tempRegisterContext;
+
+	//Reciprocal estimates are only good to single precision, use a real division
+	LoadConstantInRegister(CAArch32Assembler::r0, 1);
+	m_assembler.Vmov(CAArch32Assembler::d2, CAArch32Assembler::r0, 0);
+	m_assembler.Vcvt_F64_S32(CAArch32Assembler::d1, CAArch32Assembler::s4);
+	LoadMemoryFpDoubleInRegister(tempRegisterContext, CAArch32Assembler::d0, src1);
+	m_assembler.Vdiv_F64(CAArch32Assembler::d1, CAArch32Assembler::d1, CAArch32Assembler::d0);
+	StoreRegisterInMemoryFpDouble(tempRegisterContext, dst, CAArch32Assembler::d1);
+}
+
+void CCodeGen_AArch32::Emit_FpD_Rsqrt_MemMem(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	CTempRegisterContext tempRegisterContext;
+
+	LoadConstantInRegister(CAArch32Assembler::r0, 1);
+	m_assembler.Vmov(CAArch32Assembler::d2, CAArch32Assembler::r0, 0);
+	m_assembler.Vcvt_F64_S32(CAArch32Assembler::d1, CAArch32Assembler::s4);
+	LoadMemoryFpDoubleInRegister(tempRegisterContext, CAArch32Assembler::d0, src1);
+	m_assembler.Vsqrt_F64(CAArch32Assembler::d0, CAArch32Assembler::d0);
+	m_assembler.Vdiv_F64(CAArch32Assembler::d1, CAArch32Assembler::d1, CAArch32Assembler::d0);
+	StoreRegisterInMemoryFpDouble(tempRegisterContext, dst, CAArch32Assembler::d1);
+}
+
+void CCodeGen_AArch32::Emit_FpD_Cmp_AnyMemMem(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	CTempRegisterContext tempRegisterContext;
+
+	auto tmpReg = tempRegisterContext.Allocate();
+	auto dstReg = PrepareSymbolRegisterDef(dst, tmpReg);
+
+	m_assembler.Mov(dstReg, CAArch32Assembler::MakeImmediateAluOperand(0, 0));
+	LoadMemoryFpDoubleInRegister(tempRegisterContext, CAArch32Assembler::d0, src1);
+	LoadMemoryFpDoubleInRegister(tempRegisterContext, CAArch32Assembler::d1, src2);
+	m_assembler.Vcmp_F64(CAArch32Assembler::d0, CAArch32Assembler::d1);
+	m_assembler.Vmrs(CAArch32Assembler::rPC);	//Move to general purpose status register
+	switch(statement.jmpCondition)
+	{
+	case Jitter::CONDITION_AB:
+		m_assembler.MovCc(CAArch32Assembler::CONDITION_GT, dstReg, CAArch32Assembler::MakeImmediateAluOperand(1, 0));
+		break;
+	case Jitter::CONDITION_BE:
+		m_assembler.MovCc(CAArch32Assembler::CONDITION_LS, dstReg, CAArch32Assembler::MakeImmediateAluOperand(1, 0));
+		break;
+	case Jitter::CONDITION_BL:
+		m_assembler.MovCc(CAArch32Assembler::CONDITION_MI, dstReg, CAArch32Assembler::MakeImmediateAluOperand(1, 0));
+		break;
+	case Jitter::CONDITION_EQ:
+		m_assembler.MovCc(CAArch32Assembler::CONDITION_EQ, dstReg, CAArch32Assembler::MakeImmediateAluOperand(1, 0));
+		break;
+	default:
+		assert(0);
+		break;
+	}
+
+	CommitSymbolRegister(dst, dstReg);
+	tempRegisterContext.Release(tmpReg);
+}
+
+void CCodeGen_AArch32::Emit_FpD_Mov_MemMem(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	CTempRegisterContext tempRegisterContext;
+
+	LoadMemoryFpDoubleInRegister(tempRegisterContext, CAArch32Assembler::d0, src1);
+	StoreRegisterInMemoryFpDouble(tempRegisterContext, dst, CAArch32Assembler::d0);
+}
+
+void CCodeGen_AArch32::Emit_FpD_Mov_MemDRelI32(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	assert(src1->m_type == SYM_FP_REL_INT32);
+
+	CTempRegisterContext tempRegisterContext;
+
+	m_assembler.Vldr(CAArch32Assembler::s0, g_baseRegister, CAArch32Assembler::MakeImmediateLdrAddress(src1->m_valueLow));
+	m_assembler.Vcvt_F64_S32(CAArch32Assembler::d1, CAArch32Assembler::s0);
+	StoreRegisterInMemoryFpDouble(tempRegisterContext, dst, CAArch32Assembler::d1);
+}
+
+void CCodeGen_AArch32::Emit_FpD_ToIntTrunc_MemMem(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	CTempRegisterContext tempRegisterContext;
+
+	LoadMemoryFpDoubleInRegister(tempRegisterContext, CAArch32Assembler::d1, src1);
+	m_assembler.Vcvt_S32_F64(CAArch32Assembler::s0, CAArch32Assembler::d1);
+	StoreRegisterInMemoryFpSingle(tempRegisterContext, dst, CAArch32Assembler::s0);
+}
+
+void CCodeGen_AArch32::Emit_FpD_ToInt64Trunc_Mem64Mem(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	CTempRegisterContext tempRegisterContext;
+
+	//Value bits are passed in r0:r1, result comes back in r0:r1
+	LoadMemoryFpDoubleInRegister(tempRegisterContext, CAArch32Assembler::d0, src1);
+	m_assembler.Vmov(CAArch32Assembler::r0, CAArch32Assembler::d0, 0);
+	m_assembler.Vmov(CAArch32Assembler::r1, CAArch32Assembler::d0, 1);
+
+	LoadConstantPtrInRegister(CAArch32Assembler::r12, reinterpret_cast<uintptr_t>(&CodeGen_AArch32_double_to_int64_trunc));
+	m_assembler.Blx(CAArch32Assembler::r12);
+
+	StoreRegistersInMemory64(dst, CAArch32Assembler::r0, CAArch32Assembler::r1);
+}
+
+void CCodeGen_AArch32::Emit_FpD_FromInt64_MemMem64(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	CTempRegisterContext tempRegisterContext;
+
+	//Value is passed in r0:r1, result bits come back in r0:r1
+	LoadMemory64InRegisters(CAArch32Assembler::r0, CAArch32Assembler::r1, src1);
+
+	LoadConstantPtrInRegister(CAArch32Assembler::r12, reinterpret_cast<uintptr_t>(&CodeGen_AArch32_int64_to_double));
+	m_assembler.Blx(CAArch32Assembler::r12);
+
+	m_assembler.Vmov(CAArch32Assembler::d0, CAArch32Assembler::r0, 0);
+	m_assembler.Vmov(CAArch32Assembler::d0, CAArch32Assembler::r1, 1);
+	StoreRegisterInMemoryFpDouble(tempRegisterContext, dst, CAArch32Assembler::d0);
+}
+
+void CCodeGen_AArch32::Emit_FpD_LdCst_TmpCst(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	assert(dst->m_type  == SYM_FP_TMP_DOUBLE);
+	assert(src1->m_type == SYM_CONSTANT64);
+
+	LoadConstantInRegister(CAArch32Assembler::r0, src1->m_valueLow);
+	LoadConstantInRegister(CAArch32Assembler::r1, src1->m_valueHigh);
+	m_assembler.Str(CAArch32Assembler::r0, CAArch32Assembler::rSP, CAArch32Assembler::MakeImmediateLdrAddress(dst->m_stackLocation + m_stackLevel + 0));
+	m_assembler.Str(CAArch32Assembler::r1, CAArch32Assembler::rSP, CAArch32Assembler::MakeImmediateLdrAddress(dst->m_stackLocation + m_stackLevel + 4));
+}
+
 CCodeGen_AArch32::CONSTMATCHER CCodeGen_AArch32::g_fpuConstMatchers[] = 
 {
 	{ OP_FP_ADD,			MATCH_MEMORY_FP_SINGLE,		MATCH_MEMORY_FP_SINGLE,		MATCH_MEMORY_FP_SINGLE,	&CCodeGen_AArch32::Emit_Fpu_MemMemMem<FPUOP_ADD>		},
@@ -266,6 +701,11 @@ CCodeGen_AArch32::CONSTMATCHER CCodeGen_AArch32::g_fpuConstMatchers[] =
 	{ OP_FP_MUL,			MATCH_MEMORY_FP_SINGLE,		MATCH_MEMORY_FP_SINGLE,		MATCH_MEMORY_FP_SINGLE,	&CCodeGen_AArch32::Emit_Fpu_MemMemMem<FPUOP_MUL>		},
 	{ OP_FP_DIV,			MATCH_MEMORY_FP_SINGLE,		MATCH_MEMORY_FP_SINGLE,		MATCH_MEMORY_FP_SINGLE,	&CCodeGen_AArch32::Emit_Fpu_MemMemMem<FPUOP_DIV>		},
 
+	{ OP_FP_MADD,			MATCH_MEMORY_FP_SINGLE,		MATCH_MEMORY_FP_SINGLE,		MATCH_MEMORY_FP_SINGLE,	&CCodeGen_AArch32::Emit_Fpu_MulAcc_MemMemMem<FPUOP_ADD>	},
+	{ OP_FP_MSUB,			MATCH_MEMORY_FP_SINGLE,		MATCH_MEMORY_FP_SINGLE,		MATCH_MEMORY_FP_SINGLE,	&CCodeGen_AArch32::Emit_Fpu_MulAcc_MemMemMem<FPUOP_SUB>	},
+	{ OP_FP_FMADD,			MATCH_MEMORY_FP_SINGLE,		MATCH_MEMORY_FP_SINGLE,		MATCH_MEMORY_FP_SINGLE,	&CCodeGen_AArch32::Emit_Fpu_MulAcc_MemMemMem<FPUOP_ADD>	},
+	{ OP_FP_FMSUB,			MATCH_MEMORY_FP_SINGLE,		MATCH_MEMORY_FP_SINGLE,		MATCH_MEMORY_FP_SINGLE,	&CCodeGen_AArch32::Emit_Fpu_MulAcc_MemMemMem<FPUOP_SUB>	},
+
 	{ OP_FP_CMP,			MATCH_ANY,					MATCH_MEMORY_FP_SINGLE,		MATCH_MEMORY_FP_SINGLE,	&CCodeGen_AArch32::Emit_Fp_Cmp_AnyMemMem				},
 
 	{ OP_FP_MIN,			MATCH_MEMORY_FP_SINGLE,		MATCH_MEMORY_FP_SINGLE,		MATCH_MEMORY_FP_SINGLE,	&CCodeGen_AArch32::Emit_FpuMd_MemMemMem<FPUMDOP_MIN>	},
@@ -280,8 +720,45 @@ CCodeGen_AArch32::CONSTMATCHER CCodeGen_AArch32::g_fpuConstMatchers[] =
 
 	{ OP_MOV,				MATCH_MEMORY_FP_SINGLE,		MATCH_RELATIVE_FP_INT32,	MATCH_NIL,				&CCodeGen_AArch32::Emit_Fp_Mov_MemSRelI32				},
 	{ OP_FP_TOINT_TRUNC,	MATCH_MEMORY_FP_SINGLE,		MATCH_MEMORY_FP_SINGLE,		MATCH_NIL,				&CCodeGen_AArch32::Emit_Fp_ToIntTrunc_MemMem			},
+	{ OP_FP_TOINT,			MATCH_MEMORY_FP_SINGLE,		MATCH_MEMORY_FP_SINGLE,		MATCH_CONSTANT,			&CCodeGen_AArch32::Emit_Fp_ToInt_MemMemCst				},
+	{ OP_FP_TOINT_SAT,		MATCH_MEMORY_FP_SINGLE,		MATCH_MEMORY_FP_SINGLE,		MATCH_CONSTANT,			&CCodeGen_AArch32::Emit_Fp_ToInt_MemMemCst				},
+	{ OP_FP_ROUND,			MATCH_MEMORY_FP_SINGLE,		MATCH_MEMORY_FP_SINGLE,		MATCH_CONSTANT,			&CCodeGen_AArch32::Emit_Fp_Round_MemMemCst				},
 
 	{ OP_FP_LDCST,			MATCH_TEMPORARY_FP_SINGLE,	MATCH_CONSTANT,				MATCH_NIL,				&CCodeGen_AArch32::Emit_Fp_LdCst_TmpCst					},
 
+	{ OP_FP_TODOUBLE,		MATCH_MEMORY_FP_DOUBLE,		MATCH_MEMORY_FP_SINGLE,		MATCH_NIL,				&CCodeGen_AArch32::Emit_Fp_ToDouble_MemMem				},
+	{ OP_FP_TOSINGLE,		MATCH_MEMORY_FP_SINGLE,		MATCH_MEMORY_FP_DOUBLE,		MATCH_NIL,				&CCodeGen_AArch32::Emit_Fp_ToSingle_MemMem				},
+	{ OP_FP_TOINT64_TRUNC,	MATCH_MEMORY64,				MATCH_MEMORY_FP_SINGLE,		MATCH_NIL,				&CCodeGen_AArch32::Emit_Fp_ToInt64Trunc_Mem64MemS		},
+
+	{ OP_FP_ADD,			MATCH_MEMORY_FP_DOUBLE,		MATCH_MEMORY_FP_DOUBLE,		MATCH_MEMORY_FP_DOUBLE,	&CCodeGen_AArch32::Emit_FpuD_MemMemMem<FPUDOP_ADD>		},
+	{ OP_FP_SUB,			MATCH_MEMORY_FP_DOUBLE,		MATCH_MEMORY_FP_DOUBLE,		MATCH_MEMORY_FP_DOUBLE,	&CCodeGen_AArch32::Emit_FpuD_MemMemMem<FPUDOP_SUB>		},
+	{ OP_FP_MUL,			MATCH_MEMORY_FP_DOUBLE,		MATCH_MEMORY_FP_DOUBLE,		MATCH_MEMORY_FP_DOUBLE,	&CCodeGen_AArch32::Emit_FpuD_MemMemMem<FPUDOP_MUL>		},
+	{ OP_FP_DIV,			MATCH_MEMORY_FP_DOUBLE,		MATCH_MEMORY_FP_DOUBLE,		MATCH_MEMORY_FP_DOUBLE,	&CCodeGen_AArch32::Emit_FpuD_MemMemMem<FPUDOP_DIV>		},
+
+	{ OP_FP_MADD,			MATCH_MEMORY_FP_DOUBLE,		MATCH_MEMORY_FP_DOUBLE,		MATCH_MEMORY_FP_DOUBLE,	&CCodeGen_AArch32::Emit_FpuD_MulAcc_MemMemMem<FPUDOP_ADD>	},
+	{ OP_FP_MSUB,			MATCH_MEMORY_FP_DOUBLE,		MATCH_MEMORY_FP_DOUBLE,		MATCH_MEMORY_FP_DOUBLE,	&CCodeGen_AArch32::Emit_FpuD_MulAcc_MemMemMem<FPUDOP_SUB>	},
+	{ OP_FP_FMADD,			MATCH_MEMORY_FP_DOUBLE,		MATCH_MEMORY_FP_DOUBLE,		MATCH_MEMORY_FP_DOUBLE,	&CCodeGen_AArch32::Emit_FpuD_MulAcc_MemMemMem<FPUDOP_ADD>	},
+	{ OP_FP_FMSUB,			MATCH_MEMORY_FP_DOUBLE,		MATCH_MEMORY_FP_DOUBLE,		MATCH_MEMORY_FP_DOUBLE,	&CCodeGen_AArch32::Emit_FpuD_MulAcc_MemMemMem<FPUDOP_SUB>	},
+
+	{ OP_FP_CMP,			MATCH_ANY,					MATCH_MEMORY_FP_DOUBLE,		MATCH_MEMORY_FP_DOUBLE,	&CCodeGen_AArch32::Emit_FpD_Cmp_AnyMemMem				},
+
+	{ OP_FP_MIN,			MATCH_MEMORY_FP_DOUBLE,		MATCH_MEMORY_FP_DOUBLE,		MATCH_MEMORY_FP_DOUBLE,	&CCodeGen_AArch32::Emit_FpD_MinMax_MemMemMem<false>		},
+	{ OP_FP_MAX,			MATCH_MEMORY_FP_DOUBLE,		MATCH_MEMORY_FP_DOUBLE,		MATCH_MEMORY_FP_DOUBLE,	&CCodeGen_AArch32::Emit_FpD_MinMax_MemMemMem<true>		},
+
+	{ OP_FP_RCPL,			MATCH_MEMORY_FP_DOUBLE,		MATCH_MEMORY_FP_DOUBLE,		MATCH_NIL,				&CCodeGen_AArch32::Emit_FpD_Rcpl_MemMem					},
+	{ OP_FP_SQRT,			MATCH_MEMORY_FP_DOUBLE,		MATCH_MEMORY_FP_DOUBLE,		MATCH_NIL,				&CCodeGen_AArch32::Emit_FpuD_MemMem<FPUDOP_SQRT>		},
+	{ OP_FP_RSQRT,			MATCH_MEMORY_FP_DOUBLE,		MATCH_MEMORY_FP_DOUBLE,		MATCH_NIL,				&CCodeGen_AArch32::Emit_FpD_Rsqrt_MemMem				},
+
+	{ OP_FP_ABS,			MATCH_MEMORY_FP_DOUBLE,		MATCH_MEMORY_FP_DOUBLE,		MATCH_NIL,				&CCodeGen_AArch32::Emit_FpuD_MemMem<FPUDOP_ABS>			},
+	{ OP_FP_NEG,			MATCH_MEMORY_FP_DOUBLE,		MATCH_MEMORY_FP_DOUBLE,		MATCH_NIL,				&CCodeGen_AArch32::Emit_FpuD_MemMem<FPUDOP_NEG>			},
+
+	{ OP_MOV,				MATCH_MEMORY_FP_DOUBLE,		MATCH_MEMORY_FP_DOUBLE,		MATCH_NIL,				&CCodeGen_AArch32::Emit_FpD_Mov_MemMem					},
+	{ OP_MOV,				MATCH_MEMORY_FP_DOUBLE,		MATCH_RELATIVE_FP_INT32,	MATCH_NIL,				&CCodeGen_AArch32::Emit_FpD_Mov_MemDRelI32				},
+	{ OP_FP_TOINT_TRUNC,	MATCH_MEMORY_FP_SINGLE,		MATCH_MEMORY_FP_DOUBLE,		MATCH_NIL,				&CCodeGen_AArch32::Emit_FpD_ToIntTrunc_MemMem			},
+	{ OP_FP_TOINT64_TRUNC,	MATCH_MEMORY64,				MATCH_MEMORY_FP_DOUBLE,		MATCH_NIL,				&CCodeGen_AArch32::Emit_FpD_ToInt64Trunc_Mem64Mem		},
+	{ OP_FP_FROMINT64,		MATCH_MEMORY_FP_DOUBLE,		MATCH_MEMORY64,				MATCH_NIL,				&CCodeGen_AArch32::Emit_FpD_FromInt64_MemMem64			},
+
+	{ OP_FP_LDCST,			MATCH_TEMPORARY_FP_DOUBLE,	MATCH_CONSTANT64,			MATCH_NIL,				&CCodeGen_AArch32::Emit_FpD_LdCst_TmpCst				},
+
 	{ OP_MOV,				MATCH_NIL,					MATCH_NIL,					MATCH_NIL,				NULL												},
 };
@@ -118,6 +118,36 @@ void CCodeGen_AArch32::Emit_Md_MemMemMem(const STATEMENT& statement)
 	m_assembler.Vst1_32x4(dstReg, dstAddrReg);
 }
 
+template <typename MDOP>
+void CCodeGen_AArch32::Emit_Md_MulAcc_MemMemMemMem(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+	auto src3 = statement.src3->GetSymbol().get();
+
+	auto dstAddrReg = CAArch32Assembler::r0;
+	auto src1AddrReg = CAArch32Assembler::r1;
+	auto src2AddrReg = CAArch32Assembler::r2;
+	auto src3AddrReg = CAArch32Assembler::r3;
+	auto dstReg = CAArch32Assembler::q0;
+	auto src1Reg = CAArch32Assembler::q1;
+	auto src2Reg = CAArch32Assembler::q2;
+	auto src3Reg = CAArch32Assembler::q3;
+
+	LoadMemory128AddressInRegister(dstAddrReg, dst);
+	LoadMemory128AddressInRegister(src1AddrReg, src1);
+	LoadMemory128AddressInRegister(src2AddrReg, src2);
+	LoadMemory128AddressInRegister(src3AddrReg, src3);
+
+	m_assembler.Vld1_32x4(src1Reg, src1AddrReg);
+	m_assembler.Vld1_32x4(src2Reg, src2AddrReg);
+	m_assembler.Vld1_32x4(src3Reg, src3AddrReg);
+	m_assembler.Vmul_F32(src2Reg, src2Reg, src3Reg);
+	((m_assembler).*(MDOP::OpReg()))(dstReg, src1Reg, src2Reg);
+	m_assembler.Vst1_32x4(dstReg, dstAddrReg);
+}
+
 template <typename MDSHIFTOP>
 void CCodeGen_AArch32::Emit_Md_Shift_MemMemCst(const STATEMENT& statement)
 {
@@ -408,6 +438,166 @@ void CCodeGen_AArch32::Emit_Md_Expand_MemCst(const STATEMENT& statement)
 	m_assembler.Vst1_32x4(tmpReg, dstAddrReg);
 }
 
+void CCodeGen_AArch32::Emit_Md_Shuffle_MemMemCst(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	auto selector = static_cast<uint8>(src2->m_valueLow);
+
+	auto dstAddrReg = CAArch32Assembler::r0;
+	auto src1AddrReg = CAArch32Assembler::r1;
+	auto tmpReg = CAArch32Assembler::r3;
+	auto dstReg = CAArch32Assembler::q0;
+	auto src1Reg = CAArch32Assembler::q1;
+
+	LoadMemory128AddressInRegister(dstAddrReg, dst);
+	LoadMemory128AddressInRegister(src1AddrReg, src1);
+
+	m_assembler.Vld1_32x4(src1Reg, src1AddrReg);
+	for(unsigned int i = 0; i < 4; i++)
+	{
+		unsigned int lane = (selector >> (i * 2)) & 3;
+		m_assembler.Vmov(tmpReg, static_cast<CAArch32Assembler::DOUBLE_REGISTER>(src1Reg + (lane / 2)), lane & 1);
+		m_assembler.Vmov(static_cast<CAArch32Assembler::DOUBLE_REGISTER>(dstReg + (i / 2)), tmpReg, i & 1);
+	}
+	m_assembler.Vst1_32x4(dstReg, dstAddrReg);
+}
+
+void CCodeGen_AArch32::Emit_Md_InsertW_MemMemMem(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+	auto src3 = statement.src3->GetSymbol().get();
+
+	assert(src3->m_type == SYM_CONSTANT);
+
+	uint32 srcLane = (src3->m_valueLow >> 2) & 3;
+	uint32 dstLane = src3->m_valueLow & 3;
+
+	auto dstAddrReg = CAArch32Assembler::r0;
+	auto src1AddrReg = CAArch32Assembler::r1;
+	auto src2AddrReg = CAArch32Assembler::r2;
+	auto tmpReg = CAArch32Assembler::r3;
+	auto dstReg = CAArch32Assembler::q0;
+
+	LoadMemory128AddressInRegister(dstAddrReg, dst);
+	LoadMemory128AddressInRegister(src1AddrReg, src1);
+	LoadMemory128AddressInRegister(src2AddrReg, src2, srcLane * 4);
+
+	m_assembler.Vld1_32x4(dstReg, src1AddrReg);
+	m_assembler.Ldr(tmpReg, src2AddrReg, CAArch32Assembler::MakeImmediateLdrAddress(0));
+	m_assembler.Vmov(static_cast<CAArch32Assembler::DOUBLE_REGISTER>(dstReg + (dstLane / 2)), tmpReg, dstLane & 1);
+	m_assembler.Vst1_32x4(dstReg, dstAddrReg);
+}
+
+void CCodeGen_AArch32::Emit_Md_MulHiH_MemMemMem(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	auto dstAddrReg = CAArch32Assembler::r0;
+	auto src1AddrReg = CAArch32Assembler::r1;
+	auto src2AddrReg = CAArch32Assembler::r2;
+	auto src1Reg = CAArch32Assembler::q1;
+	auto src2Reg = CAArch32Assembler::q2;
+	auto lowReg = CAArch32Assembler::q0;
+	auto highReg = CAArch32Assembler::q3;
+	auto dstReg = CAArch32Assembler::q1;
+
+	LoadMemory128AddressInRegister(dstAddrReg, dst);
+	LoadMemory128AddressInRegister(src1AddrReg, src1);
+	LoadMemory128AddressInRegister(src2AddrReg, src2);
+
+	m_assembler.Vld1_32x4(src1Reg, src1AddrReg);
+	m_assembler.Vld1_32x4(src2Reg, src2AddrReg);
+	m_assembler.Vmull_I16(lowReg, 
+		static_cast<CAArch32Assembler::DOUBLE_REGISTER>(src1Reg + 0), static_cast<CAArch32Assembler::DOUBLE_REGISTER>(src2Reg + 0));
+	m_assembler.Vmull_I16(highReg, 
+		static_cast<CAArch32Assembler::DOUBLE_REGISTER>(src1Reg + 1), static_cast<CAArch32Assembler::DOUBLE_REGISTER>(src2Reg + 1));
+	m_assembler.Vshrn_I32(static_cast<CAArch32Assembler::DOUBLE_REGISTER>(dstReg + 0), lowReg, 16);
+	m_assembler.Vshrn_I32(static_cast<CAArch32Assembler::DOUBLE_REGISTER>(dstReg + 1), highReg, 16);
+	m_assembler.Vst1_32x4(dstReg, dstAddrReg);
+}
+
+void CCodeGen_AArch32::Emit_Md_MulEvenUWD_MemMemMem(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	auto dstAddrReg = CAArch32Assembler::r0;
+	auto src1AddrReg = CAArch32Assembler::r1;
+	auto src2AddrReg = CAArch32Assembler::r2;
+	auto src1Reg = CAArch32Assembler::q1;
+	auto src2Reg = CAArch32Assembler::q2;
+	auto evenReg = CAArch32Assembler::q0;
+	auto dstReg = CAArch32Assembler::q1;
+
+	LoadMemory128AddressInRegister(dstAddrReg, dst);
+	LoadMemory128AddressInRegister(src1AddrReg, src1);
+	LoadMemory128AddressInRegister(src2AddrReg, src2);
+
+	//Narrowing doublewords to words keeps lanes 0 and 2
+	m_assembler.Vld1_32x4(src1Reg, src1AddrReg);
+	m_assembler.Vld1_32x4(src2Reg, src2AddrReg);
+	m_assembler.Vmovn_I64(static_cast<CAArch32Assembler::DOUBLE_REGISTER>(evenReg + 0), src1Reg);
+	m_assembler.Vmovn_I64(static_cast<CAArch32Assembler::DOUBLE_REGISTER>(evenReg + 1), src2Reg);
+	m_assembler.Vmull_U32(dstReg, 
+		static_cast<CAArch32Assembler::DOUBLE_REGISTER>(evenReg + 0), static_cast<CAArch32Assembler::DOUBLE_REGISTER>(evenReg + 1));
+	m_assembler.Vst1_32x4(dstReg, dstAddrReg);
+}
+
+void CCodeGen_AArch32::Emit_Md_MulAddPairsHW_MemMemMem(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	auto dstAddrReg = CAArch32Assembler::r0;
+	auto src1AddrReg = CAArch32Assembler::r1;
+	auto src2AddrReg = CAArch32Assembler::r2;
+	auto src1Reg = CAArch32Assembler::q1;
+	auto src2Reg = CAArch32Assembler::q2;
+	auto lowReg = CAArch32Assembler::q0;
+	auto highReg = CAArch32Assembler::q3;
+	auto dstReg = CAArch32Assembler::q1;
+
+	LoadMemory128AddressInRegister(dstAddrReg, dst);
+	LoadMemory128AddressInRegister(src1AddrReg, src1);
+	LoadMemory128AddressInRegister(src2AddrReg, src2);
+
+	m_assembler.Vld1_32x4(src1Reg, src1AddrReg);
+	m_assembler.Vld1_32x4(src2Reg, src2AddrReg);
+	m_assembler.Vmull_I16(lowReg, 
+		static_cast<CAArch32Assembler::DOUBLE_REGISTER>(src1Reg + 0), static_cast<CAArch32Assembler::DOUBLE_REGISTER>(src2Reg + 0));
+	m_assembler.Vmull_I16(highReg, 
+		static_cast<CAArch32Assembler::DOUBLE_REGISTER>(src1Reg + 1), static_cast<CAArch32Assembler::DOUBLE_REGISTER>(src2Reg + 1));
+	m_assembler.Vpadd_I32(static_cast<CAArch32Assembler::DOUBLE_REGISTER>(dstReg + 0), 
+		static_cast<CAArch32Assembler::DOUBLE_REGISTER>(lowReg + 0), static_cast<CAArch32Assembler::DOUBLE_REGISTER>(lowReg + 1));
+	m_assembler.Vpadd_I32(static_cast<CAArch32Assembler::DOUBLE_REGISTER>(dstReg + 1), 
+		static_cast<CAArch32Assembler::DOUBLE_REGISTER>(highReg + 0), static_cast<CAArch32Assembler::DOUBLE_REGISTER>(highReg + 1));
+	m_assembler.Vst1_32x4(dstReg, dstAddrReg);
+}
+
+void CCodeGen_AArch32::Emit_Md_ExtractW_VarMemCst(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	auto src1AddrReg = CAArch32Assembler::r1;
+
+	LoadMemory128AddressInRegister(src1AddrReg, src1, (src2->m_valueLow & 3) * 4);
+
+	auto dstReg = PrepareSymbolRegisterDef(dst, CAArch32Assembler::r0);
+	m_assembler.Ldr(dstReg, src1AddrReg, CAArch32Assembler::MakeImmediateLdrAddress(0));
+	CommitSymbolRegister(dst, dstReg);
+}
+
 void CCodeGen_AArch32::Emit_Md_PackHB_MemMemMem(const STATEMENT& statement)
 {
 	auto dst = statement.dst->GetSymbol().get();
@@ -456,6 +646,60 @@ void CCodeGen_AArch32::Emit_Md_PackWH_MemMemMem(const STATEMENT& statement)
 	m_assembler.Vst1_32x4(dstReg, dstAddrReg);
 }
 
+void CCodeGen_AArch32::Emit_Md_ToWord_MemMemCst(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	auto dstAddrReg = CAArch32Assembler::r0;
+	auto src1AddrReg = CAArch32Assembler::r1;
+	auto savedReg = CAArch32Assembler::r2;
+	auto tmpReg = CAArch32Assembler::r3;
+	auto resultReg = CAArch32Assembler::q0;
+
+	LoadMemory128AddressInRegister(dstAddrReg, dst);
+	LoadMemory128AddressInRegister(src1AddrReg, src1);
+
+	//NEON conversions always truncate, go through VFP to use FPSCR's rounding mode
+	m_assembler.Vld1_32x4(resultReg, src1AddrReg);
+	SetFpRoundingMode(savedReg, tmpReg, static_cast<ROUNDMODE>(src2->m_valueLow));
+	for(unsigned int i = 0; i < 4; i++)
+	{
+		auto laneReg = static_cast<CAArch32Assembler::SINGLE_REGISTER>(CAArch32Assembler::s0 + i);
+		m_assembler.Vcvtr_S32_F32(laneReg, laneReg);
+	}
+	m_assembler.Vmsr(savedReg);
+	m_assembler.Vst1_32x4(resultReg, dstAddrReg);
+}
+
+void CCodeGen_AArch32::Emit_Md_Round_MemMemCst(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	auto dstAddrReg = CAArch32Assembler::r0;
+	auto src1AddrReg = CAArch32Assembler::r1;
+	auto savedReg = CAArch32Assembler::r2;
+	auto tmpReg = CAArch32Assembler::r3;
+	auto resultReg = CAArch32Assembler::q0;
+
+	LoadMemory128AddressInRegister(dstAddrReg, dst);
+	LoadMemory128AddressInRegister(src1AddrReg, src1);
+
+	m_assembler.Vld1_32x4(resultReg, src1AddrReg);
+	SetFpRoundingMode(savedReg, tmpReg, static_cast<ROUNDMODE>(src2->m_valueLow));
+	for(unsigned int i = 0; i < 4; i++)
+	{
+		auto laneReg = static_cast<CAArch32Assembler::SINGLE_REGISTER>(CAArch32Assembler::s0 + i);
+		//Source address isn't needed anymore, use it as a temporary
+		RoundFpSingleInRegister(laneReg, tmpReg, src1AddrReg);
+	}
+	m_assembler.Vmsr(savedReg);
+	m_assembler.Vst1_32x4(resultReg, dstAddrReg);
+}
+
 template <uint32 offset>
 void CCodeGen_AArch32::Emit_Md_UnpackBH_MemMemMem(const STATEMENT& statement)
 {
@@ -591,10 +835,21 @@ CCodeGen_AArch32::CONSTMATCHER CCodeGen_AArch32::g_mdConstMatchers[] =
 	{ OP_MD_MAX_H,				MATCH_MEMORY128,			MATCH_MEMORY128,			MATCH_MEMORY128,		&CCodeGen_AArch32::Emit_Md_MemMemMem<MDOP_MAXH>					},
 	{ OP_MD_MAX_W,				MATCH_MEMORY128,			MATCH_MEMORY128,			MATCH_MEMORY128,		&CCodeGen_AArch32::Emit_Md_MemMemMem<MDOP_MAXW>					},
 
+	{ OP_MD_MUL_H,				MATCH_MEMORY128,			MATCH_MEMORY128,			MATCH_MEMORY128,		&CCodeGen_AArch32::Emit_Md_MemMemMem<MDOP_MULH>					},
+	{ OP_MD_MUL_W,				MATCH_MEMORY128,			MATCH_MEMORY128,			MATCH_MEMORY128,		&CCodeGen_AArch32::Emit_Md_MemMemMem<MDOP_MULW>					},
+	{ OP_MD_MULHI_H,			MATCH_MEMORY128,			MATCH_MEMORY128,			MATCH_MEMORY128,		&CCodeGen_AArch32::Emit_Md_MulHiH_MemMemMem						},
+	{ OP_MD_MULEVEN_UWD,		MATCH_MEMORY128,			MATCH_MEMORY128,			MATCH_MEMORY128,		&CCodeGen_AArch32::Emit_Md_MulEvenUWD_MemMemMem					},
+	{ OP_MD_MULADDPAIRS_HW,		MATCH_MEMORY128,			MATCH_MEMORY128,			MATCH_MEMORY128,		&CCodeGen_AArch32::Emit_Md_MulAddPairsHW_MemMemMem				},
+
 	{ OP_MD_ADD_S,				MATCH_MEMORY128,			MATCH_MEMORY128,			MATCH_MEMORY128,		&CCodeGen_AArch32::Emit_Md_MemMemMem<MDOP_ADDS>					},
 	{ OP_MD_SUB_S,				MATCH_MEMORY128,			MATCH_MEMORY128,			MATCH_MEMORY128,		&CCodeGen_AArch32::Emit_Md_MemMemMem<MDOP_SUBS>					},
 	{ OP_MD_MUL_S,				MATCH_MEMORY128,			MATCH_MEMORY128,			MATCH_MEMORY128,		&CCodeGen_AArch32::Emit_Md_MemMemMem<MDOP_MULS>					},
 	{ OP_MD_DIV_S,				MATCH_MEMORY128,			MATCH_MEMORY128,			MATCH_MEMORY128,		&CCodeGen_AArch32::Emit_Md_DivS_MemMemMem						},
+	{ OP_MD_MADD_S,				MATCH_MEMORY128,			MATCH_MEMORY128,			MATCH_MEMORY128,		&CCodeGen_AArch32::Emit_Md_MulAcc_MemMemMemMem<MDOP_ADDS>		},
+	{ OP_MD_MSUB_S,				MATCH_MEMORY128,			MATCH_MEMORY128,			MATCH_MEMORY128,		&CCodeGen_AArch32::Emit_Md_MulAcc_MemMemMemMem<MDOP_SUBS>		},
+	//No fused multiply-add before VFPv4
+	{ OP_MD_FMADD_S,			MATCH_MEMORY128,			MATCH_MEMORY128,			MATCH_MEMORY128,		&CCodeGen_AArch32::Emit_Md_MulAcc_MemMemMemMem<MDOP_ADDS>		},
+	{ OP_MD_FMSUB_S,			MATCH_MEMORY128,			MATCH_MEMORY128,			MATCH_MEMORY128,		&CCodeGen_AArch32::Emit_Md_MulAcc_MemMemMemMem<MDOP_SUBS>		},
 
 	{ OP_MD_ABS_S,				MATCH_MEMORY128,			MATCH_MEMORY128,			MATCH_NIL,				&CCodeGen_AArch32::Emit_Md_MemMem<MDOP_ABSS>					},
 	{ OP_MD_MIN_S,				MATCH_MEMORY128,			MATCH_MEMORY128,			MATCH_MEMORY128,		&CCodeGen_AArch32::Emit_Md_MemMemMem<FPUMDOP_MIN>				},
@@ -615,14 +870,17 @@ CCodeGen_AArch32::CONSTMATCHER CCodeGen_AArch32::g_mdConstMatchers[] =
 	{ OP_MD_SRAH,				MATCH_MEMORY128,			MATCH_MEMORY128,			MATCH_CONSTANT,			&CCodeGen_AArch32::Emit_Md_Shift_MemMemCst<MDOP_SRAH>			},
 	{ OP_MD_SRAW,				MATCH_MEMORY128,			MATCH_MEMORY128,			MATCH_CONSTANT,			&CCodeGen_AArch32::Emit_Md_Shift_MemMemCst<MDOP_SRAW>			},
 
-	{ OP_MD_SRL256,				MATCH_VARIABLE128,			MATCH_MEMORY256,			MATCH_VARIABLE,			&CCodeGen_AArch32::Emit_Md_Srl256_MemMemVar						},
-	{ OP_MD_SRL256,				MATCH_VARIABLE128,			MATCH_MEMORY256,			MATCH_CONSTANT,			&CCodeGen_AArch32::Emit_Md_Srl256_MemMemCst						},
+	{ OP_MD_SRL256,				MATCH_VARIABLE128,			MATCH_TEMPORARY256,			MATCH_VARIABLE,			&CCodeGen_AArch32::Emit_Md_Srl256_MemMemVar						},
+	{ OP_MD_SRL256,				MATCH_VARIABLE128,			MATCH_TEMPORARY256,			MATCH_CONSTANT,			&CCodeGen_AArch32::Emit_Md_Srl256_MemMemCst						},
 
 	{ OP_MD_ISNEGATIVE,			MATCH_VARIABLE,				MATCH_MEMORY128,			MATCH_NIL,				&CCodeGen_AArch32::Emit_Md_Test_VarMem<CAArch32Assembler::CONDITION_MI> },
 	{ OP_MD_ISZERO,				MATCH_VARIABLE,				MATCH_MEMORY128,			MATCH_NIL,				&CCodeGen_AArch32::Emit_Md_Test_VarMem<CAArch32Assembler::CONDITION_EQ> },
 
 	{ OP_MD_TOSINGLE,			MATCH_MEMORY128,			MATCH_MEMORY128,			MATCH_NIL,				&CCodeGen_AArch32::Emit_Md_MemMem<MDOP_TOSINGLE>				},
 	{ OP_MD_TOWORD_TRUNCATE,	MATCH_MEMORY128,			MATCH_MEMORY128,			MATCH_NIL,				&CCodeGen_AArch32::Emit_Md_MemMem<MDOP_TOWORD>					},
+	{ OP_MD_TOWORD,				MATCH_MEMORY128,			MATCH_MEMORY128,			MATCH_CONSTANT,			&CCodeGen_AArch32::Emit_Md_ToWord_MemMemCst						},
+	{ OP_MD_TOWORD_SAT,			MATCH_MEMORY128,			MATCH_MEMORY128,			MATCH_CONSTANT,			&CCodeGen_AArch32::Emit_Md_ToWord_MemMemCst						},
+	{ OP_MD_ROUND,				MATCH_MEMORY128,			MATCH_MEMORY128,			MATCH_CONSTANT,			&CCodeGen_AArch32::Emit_Md_Round_MemMemCst						},
 
 	{ OP_MOV,					MATCH_MEMORY128,			MATCH_MEMORY128,			MATCH_NIL,				&CCodeGen_AArch32::Emit_Md_Mov_MemMem							},
 
@@ -635,6 +893,10 @@ CCodeGen_AArch32::CONSTMATCHER CCodeGen_AArch32::g_mdConstMatchers[] =
 	{ OP_MD_EXPAND,				MATCH_MEMORY128,			MATCH_MEMORY,				MATCH_NIL,				&CCodeGen_AArch32::Emit_Md_Expand_MemMem						},
 	{ OP_MD_EXPAND,				MATCH_MEMORY128,			MATCH_CONSTANT,				MATCH_NIL,				&CCodeGen_AArch32::Emit_Md_Expand_MemCst						},
 
+	{ OP_MD_SHUFFLE_W,			MATCH_MEMORY128,			MATCH_MEMORY128,			MATCH_CONSTANT,			&CCodeGen_AArch32::Emit_Md_Shuffle_MemMemCst					},
+	{ OP_MD_INSERT_W,			MATCH_MEMORY128,			MATCH_MEMORY128,			MATCH_MEMORY128,		&CCodeGen_AArch32::Emit_Md_InsertW_MemMemMem					},
+	{ OP_MD_EXTRACT_W,			MATCH_VARIABLE,				MATCH_MEMORY128,			MATCH_CONSTANT,			&CCodeGen_AArch32::Emit_Md_ExtractW_VarMemCst					},
+
 	{ OP_MD_PACK_HB,			MATCH_MEMORY128,			MATCH_MEMORY128,			MATCH_MEMORY128,		&CCodeGen_AArch32::Emit_Md_PackHB_MemMemMem						},
 	{ OP_MD_PACK_WH,			MATCH_MEMORY128,			MATCH_MEMORY128,			MATCH_MEMORY128,		&CCodeGen_AArch32::Emit_Md_PackWH_MemMemMem						},
 
@@ -646,7 +908,7 @@ CCodeGen_AArch32::CONSTMATCHER CCodeGen_AArch32::g_mdConstMatchers[] =
 	{ OP_MD_UNPACK_UPPER_HW,	MATCH_MEMORY128,			MATCH_MEMORY128,			MATCH_MEMORY128,		&CCodeGen_AArch32::Emit_Md_UnpackHW_MemMemMem<8>				},
 	{ OP_MD_UNPACK_UPPER_WD,	MATCH_MEMORY128,			MATCH_MEMORY128,			MATCH_MEMORY128,		&CCodeGen_AArch32::Emit_Md_UnpackWD_MemMemMem<8>				},
 
-	{ OP_MERGETO256,			MATCH_MEMORY256,			MATCH_VARIABLE128,			MATCH_VARIABLE128,		&CCodeGen_AArch32::Emit_MergeTo256_MemMemMem					},
+	{ OP_MERGETO256,			MATCH_TEMPORARY256,			MATCH_VARIABLE128,			MATCH_VARIABLE128,		&CCodeGen_AArch32::Emit_MergeTo256_MemMemMem					},
 
 	{ OP_MOV,					MATCH_NIL,					MATCH_NIL,					MATCH_NIL,				NULL														},
 };
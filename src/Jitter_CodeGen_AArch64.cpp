@@ -278,6 +278,15 @@ CCodeGen_AArch64::CONSTMATCHER CCodeGen_AArch64::g_constMatchers[] =
 
 	{ OP_NOT,            MATCH_VARIABLE,       MATCH_VARIABLE,       MATCH_NIL,           &CCodeGen_AArch64::Emit_Not_VarVar                          },
 	{ OP_LZC,            MATCH_VARIABLE,       MATCH_VARIABLE,       MATCH_NIL,           &CCodeGen_AArch64::Emit_Lzc_VarVar                          },
+
+	{ OP_SEXT8,          MATCH_VARIABLE,       MATCH_VARIABLE,       MATCH_NIL,           &CCodeGen_AArch64::Emit_Ext_VarVar                          },
+	{ OP_SEXT16,         MATCH_VARIABLE,       MATCH_VARIABLE,       MATCH_NIL,           &CCodeGen_AArch64::Emit_Ext_VarVar                          },
+	{ OP_ZEXT8,          MATCH_VARIABLE,       MATCH_VARIABLE,       MATCH_NIL,           &CCodeGen_AArch64::Emit_Ext_VarVar                          },
+	{ OP_ZEXT16,         MATCH_VARIABLE,       MATCH_VARIABLE,       MATCH_NIL,           &CCodeGen_AArch64::Emit_Ext_VarVar                          },
+
+	{ OP_BSWAP,          MATCH_VARIABLE,       MATCH_VARIABLE,       MATCH_NIL,           &CCodeGen_AArch64::Emit_ByteSwap_VarVar                     },
+	{ OP_POPCNT,         MATCH_VARIABLE,       MATCH_VARIABLE,       MATCH_NIL,           &CCodeGen_AArch64::Emit_PopCount_VarVar                     },
+	{ OP_CTZ,            MATCH_VARIABLE,       MATCH_VARIABLE,       MATCH_NIL,           &CCodeGen_AArch64::Emit_Ctz_VarVar                          },
 	
 	{ OP_RELTOREF,       MATCH_TMP_REF,        MATCH_CONSTANT,       MATCH_ANY,           &CCodeGen_AArch64::Emit_RelToRef_TmpCst                     },
 
@@ -288,6 +297,20 @@ CCodeGen_AArch64::CONSTMATCHER CCodeGen_AArch64::g_constMatchers[] =
 	//Cannot use MATCH_ANY here because it will match SYM_RELATIVE128
 	{ OP_STOREATREF,     MATCH_NIL,            MATCH_MEM_REF,        MATCH_VARIABLE,      &CCodeGen_AArch64::Emit_StoreAtRef_MemAny                   },
 	{ OP_STOREATREF,     MATCH_NIL,            MATCH_MEM_REF,        MATCH_CONSTANT,      &CCodeGen_AArch64::Emit_StoreAtRef_MemAny                   },
+
+	{ OP_LOAD8FROMREF,   MATCH_VARIABLE,       MATCH_MEM_REF,        MATCH_NIL,           &CCodeGen_AArch64::Emit_LoadSizedFromRef_VarMem             },
+	{ OP_LOAD8SFROMREF,  MATCH_VARIABLE,       MATCH_MEM_REF,        MATCH_NIL,           &CCodeGen_AArch64::Emit_LoadSizedFromRef_VarMem             },
+	{ OP_LOAD16FROMREF,  MATCH_VARIABLE,       MATCH_MEM_REF,        MATCH_NIL,           &CCodeGen_AArch64::Emit_LoadSizedFromRef_VarMem             },
+	{ OP_LOAD16SFROMREF, MATCH_VARIABLE,       MATCH_MEM_REF,        MATCH_NIL,           &CCodeGen_AArch64::Emit_LoadSizedFromRef_VarMem             },
+
+	{ OP_STORE8ATREF,    MATCH_NIL,            MATCH_MEM_REF,        MATCH_VARIABLE,      &CCodeGen_AArch64::Emit_StoreSizedAtRef_MemAny              },
+	{ OP_STORE8ATREF,    MATCH_NIL,            MATCH_MEM_REF,        MATCH_CONSTANT,      &CCodeGen_AArch64::Emit_StoreSizedAtRef_MemAny              },
+	{ OP_STORE16ATREF,   MATCH_NIL,            MATCH_MEM_REF,        MATCH_VARIABLE,      &CCodeGen_AArch64::Emit_StoreSizedAtRef_MemAny              },
+	{ OP_STORE16ATREF,   MATCH_NIL,            MATCH_MEM_REF,        MATCH_CONSTANT,      &CCodeGen_AArch64::Emit_StoreSizedAtRef_MemAny              },
+
+	{ OP_LOADFROMTLB,    MATCH_VARIABLE,       MATCH_ANY,            MATCH_CONSTANTPTR,   &CCodeGen_AArch64::Emit_LoadFromTlb_VarAny                  },
+	
+	{ OP_INCCOUNTER,     MATCH_NIL,            MATCH_CONSTANTPTR,    MATCH_NIL,           &CCodeGen_AArch64::Emit_IncCounter                          },
 	
 	{ OP_PARAM,          MATCH_NIL,            MATCH_CONTEXT,        MATCH_NIL,           &CCodeGen_AArch64::Emit_Param_Ctx                           },
 	{ OP_PARAM,          MATCH_NIL,            MATCH_REGISTER,       MATCH_NIL,           &CCodeGen_AArch64::Emit_Param_Reg                           },
@@ -317,10 +340,12 @@ CCodeGen_AArch64::CONSTMATCHER CCodeGen_AArch64::g_constMatchers[] =
 	{ OP_SLL,            MATCH_VARIABLE,       MATCH_ANY,            MATCH_VARIABLE,      &CCodeGen_AArch64::Emit_Shift_VarAnyVar<SHIFTOP_LSL>        },
 	{ OP_SRL,            MATCH_VARIABLE,       MATCH_ANY,            MATCH_VARIABLE,      &CCodeGen_AArch64::Emit_Shift_VarAnyVar<SHIFTOP_LSR>        },
 	{ OP_SRA,            MATCH_VARIABLE,       MATCH_ANY,            MATCH_VARIABLE,      &CCodeGen_AArch64::Emit_Shift_VarAnyVar<SHIFTOP_ASR>        },
+	{ OP_ROR,            MATCH_VARIABLE,       MATCH_ANY,            MATCH_VARIABLE,      &CCodeGen_AArch64::Emit_Shift_VarAnyVar<SHIFTOP_ROR>        },
 
 	{ OP_SLL,            MATCH_VARIABLE,       MATCH_VARIABLE,       MATCH_CONSTANT,      &CCodeGen_AArch64::Emit_Shift_VarVarCst<SHIFTOP_LSL>        },
 	{ OP_SRL,            MATCH_VARIABLE,       MATCH_VARIABLE,       MATCH_CONSTANT,      &CCodeGen_AArch64::Emit_Shift_VarVarCst<SHIFTOP_LSR>        },
 	{ OP_SRA,            MATCH_VARIABLE,       MATCH_VARIABLE,       MATCH_CONSTANT,      &CCodeGen_AArch64::Emit_Shift_VarVarCst<SHIFTOP_ASR>        },
+	{ OP_ROR,            MATCH_VARIABLE,       MATCH_VARIABLE,       MATCH_CONSTANT,      &CCodeGen_AArch64::Emit_Shift_VarVarCst<SHIFTOP_ROR>        },
 	
 	LOGIC_CONST_MATCHERS(OP_AND, LOGICOP_AND)
 	LOGIC_CONST_MATCHERS(OP_OR,  LOGICOP_OR )
@@ -388,6 +413,17 @@ bool CCodeGen_AArch64::CanHold128BitsReturnValueInRegisters() const
 	return true;
 }
 
+bool CCodeGen_AArch64::CanHandle256BitsMdOperations() const
+{
+	return false;
+}
+
+std::string CCodeGen_AArch64::GetConfigurationName() const
+{
+	//References from relocatable calls are PC relative, those can't be patched by PatchExternalSymbolReference
+	return m_generateRelocatableCalls ? "aarch64-relocatablecalls" : "aarch64";
+}
+
 void CCodeGen_AArch64::SetStream(Framework::CStream* stream)
 {
 	m_stream = stream;
@@ -408,6 +444,7 @@ void CCodeGen_AArch64::GenerateCode(const StatementList& statements, unsigned in
 	stackSize = (stackSize + 0xF) & ~0xF;
 
 	uint16 registerSave = GetSavedRegisterList(GetRegisterUsage(statements));
+	m_mdRegisterUsage = GetMdRegisterUsage(statements);
 
 	Emit_Prolog(statements, stackSize, registerSave);
 
@@ -436,9 +473,16 @@ void CCodeGen_AArch64::GenerateCode(const StatementList& statements, unsigned in
 	
 	Emit_Epilog(stackSize, registerSave);
 
+	//Slow paths are placed after the epilog to keep them out of the main flow
+	for(const auto& coldPathEmitter : m_coldPathEmitters)
+	{
+		coldPathEmitter();
+	}
+
 	m_assembler.ResolveLabelReferences();
 	m_assembler.ClearLabels();
 	m_labels.clear();
+	m_coldPathEmitters.clear();
 }
 
 uint32 CCodeGen_AArch64::GetMaxParamSpillSize(const StatementList& statements)
@@ -940,6 +984,73 @@ void CCodeGen_AArch64::Emit_Not_VarVar(const STATEMENT& statement)
 	CommitSymbolRegister(dst, dstReg);
 }
 
+void CCodeGen_AArch64::Emit_Ext_VarVar(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	auto dstReg = PrepareSymbolRegisterDef(dst, GetNextTempRegister());
+	auto src1Reg = PrepareSymbolRegisterUse(src1, GetNextTempRegister());
+	switch(statement.op)
+	{
+	case OP_SEXT8:
+		m_assembler.Sxtb(dstReg, src1Reg);
+		break;
+	case OP_SEXT16:
+		m_assembler.Sxth(dstReg, src1Reg);
+		break;
+	case OP_ZEXT8:
+		m_assembler.Uxtb(dstReg, src1Reg);
+		break;
+	case OP_ZEXT16:
+		m_assembler.Uxth(dstReg, src1Reg);
+		break;
+	default:
+		assert(false);
+		break;
+	}
+	CommitSymbolRegister(dst, dstReg);
+}
+
+void CCodeGen_AArch64::Emit_ByteSwap_VarVar(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	auto dstReg = PrepareSymbolRegisterDef(dst, GetNextTempRegister());
+	auto src1Reg = PrepareSymbolRegisterUse(src1, GetNextTempRegister());
+	m_assembler.Rev(dstReg, src1Reg);
+	CommitSymbolRegister(dst, dstReg);
+}
+
+void CCodeGen_AArch64::Emit_PopCount_VarVar(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	//No scalar popcount, count bits of each byte in a vector register and add them up
+	auto dstReg = PrepareSymbolRegisterDef(dst, GetNextTempRegister());
+	auto src1Reg = PrepareSymbolRegisterUse(src1, GetNextTempRegister());
+	auto tmpReg = GetNextTempRegisterMd();
+	m_assembler.Fmov_1s(tmpReg, src1Reg);
+	m_assembler.Cnt_8b(tmpReg, tmpReg);
+	m_assembler.Addv_8b(tmpReg, tmpReg);
+	m_assembler.Umov_1s(dstReg, tmpReg, 0);
+	CommitSymbolRegister(dst, dstReg);
+}
+
+void CCodeGen_AArch64::Emit_Ctz_VarVar(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	auto dstReg = PrepareSymbolRegisterDef(dst, GetNextTempRegister());
+	auto src1Reg = PrepareSymbolRegisterUse(src1, GetNextTempRegister());
+	m_assembler.Rbit(dstReg, src1Reg);
+	m_assembler.Clz(dstReg, dstReg);
+	CommitSymbolRegister(dst, dstReg);
+}
+
 void CCodeGen_AArch64::Emit_Lzc_VarVar(const STATEMENT& statement)
 {
 	auto dst = statement.dst->GetSymbol().get();
@@ -1042,6 +1153,176 @@ void CCodeGen_AArch64::Emit_StoreAtRef_MemAny(const STATEMENT& statement)
 	m_assembler.Str(valueReg, addressReg, 0);
 }
 
+void CCodeGen_AArch64::Emit_LoadSizedFromRef_VarMem(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	auto addressReg = GetNextTempRegister64();
+	auto dstReg = PrepareSymbolRegisterDef(dst, GetNextTempRegister());
+
+	LoadMemoryReferenceInRegister(addressReg, src1);
+	switch(statement.op)
+	{
+	case OP_LOAD8FROMREF:
+		m_assembler.Ldrb(dstReg, addressReg, 0);
+		break;
+	case OP_LOAD8SFROMREF:
+		m_assembler.Ldrsb(dstReg, addressReg, 0);
+		break;
+	case OP_LOAD16FROMREF:
+		m_assembler.Ldrh(dstReg, addressReg, 0);
+		break;
+	case OP_LOAD16SFROMREF:
+		m_assembler.Ldrsh(dstReg, addressReg, 0);
+		break;
+	default:
+		assert(false);
+		break;
+	}
+
+	CommitSymbolRegister(dst, dstReg);
+}
+
+void CCodeGen_AArch64::Emit_StoreSizedAtRef_MemAny(const STATEMENT& statement)
+{
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	auto addressReg = GetNextTempRegister64();
+	auto valueReg = PrepareSymbolRegisterUse(src2, GetNextTempRegister());
+
+	LoadMemoryReferenceInRegister(addressReg, src1);
+	switch(statement.op)
+	{
+	case OP_STORE8ATREF:
+		m_assembler.Strb(valueReg, addressReg, 0);
+		break;
+	case OP_STORE16ATREF:
+		m_assembler.Strh(valueReg, addressReg, 0);
+		break;
+	default:
+		assert(false);
+		break;
+	}
+}
+
+void CCodeGen_AArch64::Emit_LoadFromTlb_VarAny(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+	auto src3 = statement.src3->GetSymbol().get();
+
+	assert(src2->m_type == SYM_CONSTANTPTR);
+	assert(src3->m_type == SYM_CONSTANT64);
+
+	uint32 tableOffset = src3->m_valueLow;
+	uint8 pageShift = static_cast<uint8>(src3->m_valueHigh);
+	uintptr_t missHandler = src2->GetConstantPtr();
+
+	LOGICAL_IMM_PARAMS pageMaskParams;
+	bool pageMaskValid = TryGetLogicalImmParams((1 << pageShift) - 1, pageMaskParams);
+	assert(pageMaskValid);
+
+	auto addressReg = PrepareSymbolRegisterUse(src1, GetNextTempRegister());
+	auto dstReg = PrepareSymbolRegisterDef(dst, GetNextTempRegister());
+	auto indexReg = GetNextTempRegister64();
+	auto entryReg = GetNextTempRegister64();
+
+	auto missLabel = m_assembler.CreateLabel();
+	auto doneLabel = m_assembler.CreateLabel();
+
+	//Writing the 32-bits register clears the upper half, index can be used as a 64-bits register
+	m_assembler.Lsr(static_cast<CAArch64Assembler::REGISTER32>(indexReg), addressReg, pageShift);
+	m_assembler.Ldr(entryReg, g_baseRegister, tableOffset);
+	m_assembler.Ldr(entryReg, entryReg, indexReg, true);
+	m_assembler.Cmp(entryReg, 0, CAArch64Assembler::ADDSUB_IMM_SHIFT_LSL0);
+	m_assembler.BCc(CAArch64Assembler::CONDITION_EQ, missLabel);
+
+	m_assembler.And(static_cast<CAArch64Assembler::REGISTER32>(indexReg), addressReg,
+		pageMaskParams.n, pageMaskParams.immr, pageMaskParams.imms);
+	m_assembler.Ldr(dstReg, entryReg, indexReg, false);
+
+	m_assembler.MarkLabel(doneLabel);
+	CommitSymbolRegister(dst, dstReg);
+
+	m_coldPathEmitters.push_back(
+		[this, addressReg, dstReg, missLabel, doneLabel, missHandler] ()
+		{
+			//Most MD registers are caller saved, keep the ones we use alive across the call
+			uint32 savedMdRegisterCount = 0;
+			for(unsigned int i = 0; i < MAX_MDREGISTERS; i++)
+			{
+				if(m_mdRegisterUsage & (1 << i)) savedMdRegisterCount++;
+			}
+			uint16 frameSize = savedMdRegisterCount * 0x10;
+
+			m_assembler.MarkLabel(missLabel);
+			m_assembler.Mov(CAArch64Assembler::w1, addressReg);
+			m_assembler.Mov(CAArch64Assembler::x0, g_baseRegister);
+
+			if(frameSize != 0)
+			{
+				m_assembler.Sub(CAArch64Assembler::xSP, CAArch64Assembler::xSP, frameSize, CAArch64Assembler::ADDSUB_IMM_SHIFT_LSL0);
+			}
+
+			uint32 saveOffset = 0;
+			for(unsigned int i = 0; i < MAX_MDREGISTERS; i++)
+			{
+				if(!(m_mdRegisterUsage & (1 << i))) continue;
+				m_assembler.Str_1q(g_registersMd[i], CAArch64Assembler::xSP, saveOffset);
+				saveOffset += 0x10;
+			}
+
+			if(m_generateRelocatableCalls)
+			{
+				if(m_externalSymbolReferencedHandler)
+				{
+					auto position = m_stream->GetLength();
+					m_externalSymbolReferencedHandler(missHandler, position);
+				}
+				m_assembler.Bl(0);
+			}
+			else
+			{
+				auto fctAddressReg = GetNextTempRegister64();
+				LoadConstant64InRegister(fctAddressReg, missHandler);
+				m_assembler.Blr(fctAddressReg);
+			}
+
+			saveOffset = 0;
+			for(unsigned int i = 0; i < MAX_MDREGISTERS; i++)
+			{
+				if(!(m_mdRegisterUsage & (1 << i))) continue;
+				m_assembler.Ldr_1q(g_registersMd[i], CAArch64Assembler::xSP, saveOffset);
+				saveOffset += 0x10;
+			}
+
+			if(frameSize != 0)
+			{
+				m_assembler.Add(CAArch64Assembler::xSP, CAArch64Assembler::xSP, frameSize, CAArch64Assembler::ADDSUB_IMM_SHIFT_LSL0);
+			}
+
+			m_assembler.Mov(dstReg, CAArch64Assembler::w0);
+			m_assembler.B(doneLabel);
+		}
+	);
+}
+
+void CCodeGen_AArch64::Emit_IncCounter(const STATEMENT& statement)
+{
+	auto src1 = statement.src1->GetSymbol().get();
+
+	auto addressReg = GetNextTempRegister64();
+	auto counterReg = GetNextTempRegister();
+
+	LoadConstant64InRegister(addressReg, src1->GetConstantPtr());
+	m_assembler.Ldr(counterReg, addressReg, 0);
+	m_assembler.Add(counterReg, counterReg, 1, CAArch64Assembler::ADDSUB_IMM_SHIFT_LSL0);
+	m_assembler.Str(counterReg, addressReg, 0);
+}
+
 void CCodeGen_AArch64::Emit_Param_Ctx(const STATEMENT& statement)
 {
 	auto src1 = statement.src1->GetSymbol().get();
@@ -206,6 +206,29 @@ void CCodeGen_AArch64::Emit_MergeTo64_Mem64AnyAny(const STATEMENT& statement)
 	StoreRegistersInMemory64(dst, regLo, regHi);
 }
 
+void CCodeGen_AArch64::Emit_SignExtTo64_Mem64Var(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	auto dstReg = GetNextTempRegister64();
+	auto src1Reg = PrepareSymbolRegisterUse(src1, GetNextTempRegister());
+	m_assembler.Sxtw(dstReg, src1Reg);
+	StoreRegisterInMemory64(dst, dstReg);
+}
+
+void CCodeGen_AArch64::Emit_ZeroExtTo64_Mem64Var(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	//Writing to a 32-bit register clears the upper half of the 64-bit register
+	auto dstReg = GetNextTempRegister64();
+	auto src1Reg = PrepareSymbolRegisterUse(src1, GetNextTempRegister());
+	m_assembler.Mov(static_cast<CAArch64Assembler::REGISTER32>(dstReg), src1Reg);
+	StoreRegisterInMemory64(dst, dstReg);
+}
+
 void CCodeGen_AArch64::Emit_Add64_MemMemMem(const STATEMENT& statement)
 {
 	auto dst = statement.dst->GetSymbol().get();
@@ -351,7 +374,8 @@ void CCodeGen_AArch64::Emit_Cmp64_VarMemCst(const STATEMENT& statement)
 	CommitSymbolRegister(dst, dstReg);
 }
 
-void CCodeGen_AArch64::Emit_And64_MemMemMem(const STATEMENT& statement)
+template <typename ALU64OP>
+void CCodeGen_AArch64::Emit_Alu64_MemAnyAny(const STATEMENT& statement)
 {
 	auto dst = statement.dst->GetSymbol().get();
 	auto src1 = statement.src1->GetSymbol().get();
@@ -361,9 +385,22 @@ void CCodeGen_AArch64::Emit_And64_MemMemMem(const STATEMENT& statement)
 	auto src1Reg = GetNextTempRegister64();
 	auto src2Reg = GetNextTempRegister64();
 	
+	LoadSymbol64InRegister(src1Reg, src1);
+	LoadSymbol64InRegister(src2Reg, src2);
+	((m_assembler).*(ALU64OP::OpReg()))(dstReg, src1Reg, src2Reg);
+	StoreRegisterInMemory64(dst, dstReg);
+}
+
+void CCodeGen_AArch64::Emit_Not64_MemMem(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	auto dstReg = GetNextTempRegister64();
+	auto src1Reg = GetNextTempRegister64();
+
 	LoadMemory64InRegister(src1Reg, src1);
-	LoadMemory64InRegister(src2Reg, src2);
-	m_assembler.And(dstReg, src1Reg, src2Reg);
+	m_assembler.Mvn(dstReg, src1Reg);
 	StoreRegisterInMemory64(dst, dstReg);
 }
 
@@ -420,6 +457,32 @@ void CCodeGen_AArch64::Emit_Mov_Mem64Cst64(const STATEMENT& statement)
 	StoreRegisterInMemory64(dst, tmpReg);
 }
 
+void CCodeGen_AArch64::Emit_LoadFromRef_Mem64Mem(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	auto addressReg = GetNextTempRegister64();
+	auto valueReg = GetNextTempRegister64();
+
+	LoadMemoryReferenceInRegister(addressReg, src1);
+	m_assembler.Ldr(valueReg, addressReg, 0);
+	StoreRegisterInMemory64(dst, valueReg);
+}
+
+void CCodeGen_AArch64::Emit_StoreAtRef_MemAny64(const STATEMENT& statement)
+{
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	auto addressReg = GetNextTempRegister64();
+	auto valueReg = GetNextTempRegister64();
+
+	LoadMemoryReferenceInRegister(addressReg, src1);
+	LoadSymbol64InRegister(valueReg, src2);
+	m_assembler.Str(valueReg, addressReg, 0);
+}
+
 CCodeGen_AArch64::CONSTMATCHER CCodeGen_AArch64::g_64ConstMatchers[] =
 {
 	{ OP_EXTLOW64,       MATCH_VARIABLE,       MATCH_MEMORY64,       MATCH_NIL,           &CCodeGen_AArch64::Emit_ExtLow64VarMem64                    },
@@ -427,6 +490,9 @@ CCodeGen_AArch64::CONSTMATCHER CCodeGen_AArch64::g_64ConstMatchers[] =
 
 	{ OP_MERGETO64,      MATCH_MEMORY64,       MATCH_ANY,            MATCH_ANY,           &CCodeGen_AArch64::Emit_MergeTo64_Mem64AnyAny               },
 
+	{ OP_SEXTTO64,       MATCH_MEMORY64,       MATCH_VARIABLE,       MATCH_NIL,           &CCodeGen_AArch64::Emit_SignExtTo64_Mem64Var                },
+	{ OP_ZEXTTO64,       MATCH_MEMORY64,       MATCH_VARIABLE,       MATCH_NIL,           &CCodeGen_AArch64::Emit_ZeroExtTo64_Mem64Var                },
+
 	{ OP_ADD64,          MATCH_MEMORY64,       MATCH_MEMORY64,       MATCH_MEMORY64,      &CCodeGen_AArch64::Emit_Add64_MemMemMem                     },
 	{ OP_ADD64,          MATCH_MEMORY64,       MATCH_MEMORY64,       MATCH_CONSTANT64,    &CCodeGen_AArch64::Emit_Add64_MemMemCst                     },
 	
@@ -436,16 +502,29 @@ CCodeGen_AArch64::CONSTMATCHER CCodeGen_AArch64::g_64ConstMatchers[] =
 	{ OP_CMP64,          MATCH_VARIABLE,       MATCH_ANY,            MATCH_MEMORY64,      &CCodeGen_AArch64::Emit_Cmp64_VarAnyMem                     },
 	{ OP_CMP64,          MATCH_VARIABLE,       MATCH_ANY,            MATCH_CONSTANT64,    &CCodeGen_AArch64::Emit_Cmp64_VarMemCst                     },
 	
-	{ OP_AND64,          MATCH_MEMORY64,       MATCH_MEMORY64,       MATCH_MEMORY64,      &CCodeGen_AArch64::Emit_And64_MemMemMem                     },
+	{ OP_AND64,          MATCH_MEMORY64,       MATCH_ANY,            MATCH_ANY,           &CCodeGen_AArch64::Emit_Alu64_MemAnyAny<ALU64OP_AND>        },
+	{ OP_OR64,           MATCH_MEMORY64,       MATCH_ANY,            MATCH_ANY,           &CCodeGen_AArch64::Emit_Alu64_MemAnyAny<ALU64OP_OR>         },
+	{ OP_XOR64,          MATCH_MEMORY64,       MATCH_ANY,            MATCH_ANY,           &CCodeGen_AArch64::Emit_Alu64_MemAnyAny<ALU64OP_XOR>        },
+	{ OP_NOT64,          MATCH_MEMORY64,       MATCH_MEMORY64,       MATCH_NIL,           &CCodeGen_AArch64::Emit_Not64_MemMem                        },
+
+	{ OP_MUL64,          MATCH_MEMORY64,       MATCH_ANY,            MATCH_ANY,           &CCodeGen_AArch64::Emit_Alu64_MemAnyAny<ALU64OP_MUL>        },
+	{ OP_DIV64,          MATCH_MEMORY64,       MATCH_ANY,            MATCH_ANY,           &CCodeGen_AArch64::Emit_Alu64_MemAnyAny<ALU64OP_UDIV>       },
+	{ OP_DIVS64,         MATCH_MEMORY64,       MATCH_ANY,            MATCH_ANY,           &CCodeGen_AArch64::Emit_Alu64_MemAnyAny<ALU64OP_SDIV>       },
 	
 	{ OP_SLL64,          MATCH_MEMORY64,       MATCH_MEMORY64,       MATCH_VARIABLE,      &CCodeGen_AArch64::Emit_Shift64_MemMemVar<SHIFT64OP_LSL>    },
 	{ OP_SRL64,          MATCH_MEMORY64,       MATCH_MEMORY64,       MATCH_VARIABLE,      &CCodeGen_AArch64::Emit_Shift64_MemMemVar<SHIFT64OP_LSR>    },
 	{ OP_SRA64,          MATCH_MEMORY64,       MATCH_MEMORY64,       MATCH_VARIABLE,      &CCodeGen_AArch64::Emit_Shift64_MemMemVar<SHIFT64OP_ASR>    },
+	{ OP_ROR64,          MATCH_MEMORY64,       MATCH_MEMORY64,       MATCH_VARIABLE,      &CCodeGen_AArch64::Emit_Shift64_MemMemVar<SHIFT64OP_ROR>    },
 
 	{ OP_SLL64,          MATCH_MEMORY64,       MATCH_MEMORY64,       MATCH_CONSTANT,      &CCodeGen_AArch64::Emit_Shift64_MemMemCst<SHIFT64OP_LSL>    },
 	{ OP_SRL64,          MATCH_MEMORY64,       MATCH_MEMORY64,       MATCH_CONSTANT,      &CCodeGen_AArch64::Emit_Shift64_MemMemCst<SHIFT64OP_LSR>    },
 	{ OP_SRA64,          MATCH_MEMORY64,       MATCH_MEMORY64,       MATCH_CONSTANT,      &CCodeGen_AArch64::Emit_Shift64_MemMemCst<SHIFT64OP_ASR>    },
+	{ OP_ROR64,          MATCH_MEMORY64,       MATCH_MEMORY64,       MATCH_CONSTANT,      &CCodeGen_AArch64::Emit_Shift64_MemMemCst<SHIFT64OP_ROR>    },
 	
+	{ OP_LOADFROMREF,    MATCH_MEMORY64,       MATCH_MEM_REF,        MATCH_NIL,           &CCodeGen_AArch64::Emit_LoadFromRef_Mem64Mem                },
+	{ OP_STOREATREF,     MATCH_NIL,            MATCH_MEM_REF,        MATCH_MEMORY64,      &CCodeGen_AArch64::Emit_StoreAtRef_MemAny64                 },
+	{ OP_STOREATREF,     MATCH_NIL,            MATCH_MEM_REF,        MATCH_CONSTANT64,    &CCodeGen_AArch64::Emit_StoreAtRef_MemAny64                 },
+
 	{ OP_MOV,            MATCH_MEMORY64,       MATCH_MEMORY64,       MATCH_NIL,           &CCodeGen_AArch64::Emit_Mov_Mem64Mem64                      },
 	{ OP_MOV,            MATCH_MEMORY64,       MATCH_CONSTANT64,     MATCH_NIL,           &CCodeGen_AArch64::Emit_Mov_Mem64Cst64                      },
 };
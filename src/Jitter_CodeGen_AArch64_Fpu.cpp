@@ -34,6 +34,38 @@ void CCodeGen_AArch64::StoreRegisterInMemoryFpSingle(CSymbol* symbol, CAArch64As
 	}
 }
 
+void CCodeGen_AArch64::LoadMemoryFpDoubleInRegister(CAArch64Assembler::REGISTERMD reg, CSymbol* symbol)
+{
+	switch(symbol->m_type)
+	{
+	case SYM_FP_REL_DOUBLE:
+		m_assembler.Ldr_1d(reg, g_baseRegister, symbol->m_valueLow);
+		break;
+	case SYM_FP_TMP_DOUBLE:
+		m_assembler.Ldr_1d(reg, CAArch64Assembler::xSP, symbol->m_stackLocation);
+		break;
+	default:
+		assert(false);
+		break;
+	}
+}
+
+void CCodeGen_AArch64::StoreRegisterInMemoryFpDouble(CSymbol* symbol, CAArch64Assembler::REGISTERMD reg)
+{
+	switch(symbol->m_type)
+	{
+	case SYM_FP_REL_DOUBLE:
+		m_assembler.Str_1d(reg, g_baseRegister, symbol->m_valueLow);
+		break;
+	case SYM_FP_TMP_DOUBLE:
+		m_assembler.Str_1d(reg, CAArch64Assembler::xSP, symbol->m_stackLocation);
+		break;
+	default:
+		assert(false);
+		break;
+	}
+}
+
 template <typename FPUOP>
 void CCodeGen_AArch64::Emit_Fpu_MemMem(const STATEMENT& statement)
 {
@@ -65,6 +97,47 @@ void CCodeGen_AArch64::Emit_Fpu_MemMemMem(const STATEMENT& statement)
 	StoreRegisterInMemoryFpSingle(dst, dstReg);
 }
 
+template <typename FPUOP>
+void CCodeGen_AArch64::Emit_Fpu_MulAcc_MemMemMem(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+	auto src3 = statement.src3->GetSymbol().get();
+
+	auto resultReg = GetNextTempRegisterMd();
+	auto src1Reg = GetNextTempRegisterMd();
+	auto src2Reg = GetNextTempRegisterMd();
+	auto src3Reg = GetNextTempRegisterMd();
+
+	LoadMemoryFpSingleInRegister(src2Reg, src2);
+	LoadMemoryFpSingleInRegister(src3Reg, src3);
+	m_assembler.Fmul_1s(resultReg, src2Reg, src3Reg);
+	LoadMemoryFpSingleInRegister(src1Reg, src1);
+	((m_assembler).*(FPUOP::OpReg()))(resultReg, src1Reg, resultReg);
+	StoreRegisterInMemoryFpSingle(dst, resultReg);
+}
+
+template <typename FPUOP>
+void CCodeGen_AArch64::Emit_Fpu_FusedMulAcc_MemMemMem(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+	auto src3 = statement.src3->GetSymbol().get();
+
+	auto dstReg = GetNextTempRegisterMd();
+	auto src1Reg = GetNextTempRegisterMd();
+	auto src2Reg = GetNextTempRegisterMd();
+	auto src3Reg = GetNextTempRegisterMd();
+
+	LoadMemoryFpSingleInRegister(src1Reg, src1);
+	LoadMemoryFpSingleInRegister(src2Reg, src2);
+	LoadMemoryFpSingleInRegister(src3Reg, src3);
+	((m_assembler).*(FPUOP::OpReg()))(dstReg, src2Reg, src3Reg, src1Reg);
+	StoreRegisterInMemoryFpSingle(dst, dstReg);
+}
+
 void CCodeGen_AArch64::Emit_Fp_Cmp_AnyMemMem(const STATEMENT& statement)
 {
 	auto dst = statement.dst->GetSymbol().get();
@@ -141,6 +214,54 @@ void CCodeGen_AArch64::Emit_Fp_ToIntTrunc_MemMem(const STATEMENT& statement)
 	StoreRegisterInMemoryFpSingle(dst, dstReg);
 }
 
+void CCodeGen_AArch64::Emit_Fp_ToInt_MemMemCst(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	//Indexed by ROUNDMODE, these saturate and give 0 for NaNs
+	static const FPUOP_BASE2::OpRegType convertOps[] =
+	{
+		&CAArch64Assembler::Fcvtns_1s,
+		&CAArch64Assembler::Fcvtps_1s,
+		&CAArch64Assembler::Fcvtms_1s,
+		&CAArch64Assembler::Fcvtzs_1s,
+	};
+	assert(src2->m_valueLow < 4);
+
+	auto dstReg = GetNextTempRegisterMd();
+	auto src1Reg = GetNextTempRegisterMd();
+
+	LoadMemoryFpSingleInRegister(src1Reg, src1);
+	((m_assembler).*(convertOps[src2->m_valueLow]))(dstReg, src1Reg);
+	StoreRegisterInMemoryFpSingle(dst, dstReg);
+}
+
+void CCodeGen_AArch64::Emit_Fp_Round_MemMemCst(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	//Indexed by ROUNDMODE
+	static const FPUOP_BASE2::OpRegType roundOps[] =
+	{
+		&CAArch64Assembler::Frintn_1s,
+		&CAArch64Assembler::Frintp_1s,
+		&CAArch64Assembler::Frintm_1s,
+		&CAArch64Assembler::Frintz_1s,
+	};
+	assert(src2->m_valueLow < 4);
+
+	auto dstReg = GetNextTempRegisterMd();
+	auto src1Reg = GetNextTempRegisterMd();
+
+	LoadMemoryFpSingleInRegister(src1Reg, src1);
+	((m_assembler).*(roundOps[src2->m_valueLow]))(dstReg, src1Reg);
+	StoreRegisterInMemoryFpSingle(dst, dstReg);
+}
+
 void CCodeGen_AArch64::Emit_Fp_LdCst_TmpCst(const STATEMENT& statement)
 {
 	auto dst = statement.dst->GetSymbol().get();
@@ -155,6 +276,246 @@ void CCodeGen_AArch64::Emit_Fp_LdCst_TmpCst(const STATEMENT& statement)
 	m_assembler.Str(tmpReg, CAArch64Assembler::xSP, dst->m_stackLocation);
 }
 
+void CCodeGen_AArch64::Emit_Fp_ToDouble_MemMem(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	auto dstReg = GetNextTempRegisterMd();
+	auto src1Reg = GetNextTempRegisterMd();
+
+	LoadMemoryFpSingleInRegister(src1Reg, src1);
+	m_assembler.Fcvt_1d_1s(dstReg, src1Reg);
+	StoreRegisterInMemoryFpDouble(dst, dstReg);
+}
+
+void CCodeGen_AArch64::Emit_Fp_ToSingle_MemMem(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	auto dstReg = GetNextTempRegisterMd();
+	auto src1Reg = GetNextTempRegisterMd();
+
+	LoadMemoryFpDoubleInRegister(src1Reg, src1);
+	m_assembler.Fcvt_1s_1d(dstReg, src1Reg);
+	StoreRegisterInMemoryFpSingle(dst, dstReg);
+}
+
+void CCodeGen_AArch64::Emit_Fp_ToInt64Trunc_Mem64MemS(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	auto dstReg = GetNextTempRegister64();
+	auto src1Reg = GetNextTempRegisterMd();
+
+	LoadMemoryFpSingleInRegister(src1Reg, src1);
+	m_assembler.Fcvtzs_1s(dstReg, src1Reg);
+	StoreRegisterInMemory64(dst, dstReg);
+}
+
+template <typename FPUOP>
+void CCodeGen_AArch64::Emit_FpuD_MemMem(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	auto dstReg = GetNextTempRegisterMd();
+	auto src1Reg = GetNextTempRegisterMd();
+
+	LoadMemoryFpDoubleInRegister(src1Reg, src1);
+	((m_assembler).*(FPUOP::OpReg()))(dstReg, src1Reg);
+	StoreRegisterInMemoryFpDouble(dst, dstReg);
+}
+
+template <typename FPUOP>
+void CCodeGen_AArch64::Emit_FpuD_MemMemMem(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	auto dstReg = GetNextTempRegisterMd();
+	auto src1Reg = GetNextTempRegisterMd();
+	auto src2Reg = GetNextTempRegisterMd();
+
+	LoadMemoryFpDoubleInRegister(src1Reg, src1);
+	LoadMemoryFpDoubleInRegister(src2Reg, src2);
+	((m_assembler).*(FPUOP::OpReg()))(dstReg, src1Reg, src2Reg);
+	StoreRegisterInMemoryFpDouble(dst, dstReg);
+}
+
+template <typename FPUOP>
+void CCodeGen_AArch64::Emit_FpuD_MulAcc_MemMemMem(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+	auto src3 = statement.src3->GetSymbol().get();
+
+	auto resultReg = GetNextTempRegisterMd();
+	auto src1Reg = GetNextTempRegisterMd();
+	auto src2Reg = GetNextTempRegisterMd();
+	auto src3Reg = GetNextTempRegisterMd();
+
+	LoadMemoryFpDoubleInRegister(src2Reg, src2);
+	LoadMemoryFpDoubleInRegister(src3Reg, src3);
+	m_assembler.Fmul_1d(resultReg, src2Reg, src3Reg);
+	LoadMemoryFpDoubleInRegister(src1Reg, src1);
+	((m_assembler).*(FPUOP::OpReg()))(resultReg, src1Reg, resultReg);
+	StoreRegisterInMemoryFpDouble(dst, resultReg);
+}
+
+template <typename FPUOP>
+void CCodeGen_AArch64::Emit_FpuD_FusedMulAcc_MemMemMem(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+	auto src3 = statement.src3->GetSymbol().get();
+
+	auto dstReg = GetNextTempRegisterMd();
+	auto src1Reg = GetNextTempRegisterMd();
+	auto src2Reg = GetNextTempRegisterMd();
+	auto src3Reg = GetNextTempRegisterMd();
+
+	LoadMemoryFpDoubleInRegister(src1Reg, src1);
+	LoadMemoryFpDoubleInRegister(src2Reg, src2);
+	LoadMemoryFpDoubleInRegister(src3Reg, src3);
+	((m_assembler).*(FPUOP::OpReg()))(dstReg, src2Reg, src3Reg, src1Reg);
+	StoreRegisterInMemoryFpDouble(dst, dstReg);
+}
+
+void CCodeGen_AArch64::Emit_FpD_Cmp_AnyMemMem(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	auto dstReg = PrepareSymbolRegisterDef(dst, GetNextTempRegister());
+	auto src1Reg = GetNextTempRegisterMd();
+	auto src2Reg = GetNextTempRegisterMd();
+
+	LoadMemoryFpDoubleInRegister(src1Reg, src1);
+	LoadMemoryFpDoubleInRegister(src2Reg, src2);
+	m_assembler.Fcmp_1d(src1Reg, src2Reg);
+	Cmp_GetFlag(dstReg, statement.jmpCondition);
+	CommitSymbolRegister(dst, dstReg);
+}
+
+void CCodeGen_AArch64::Emit_FpD_Rcpl_MemMem(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	auto dstReg = GetNextTempRegisterMd();
+	auto src1Reg = GetNextTempRegisterMd();
+	auto oneReg = GetNextTempRegisterMd();
+
+	m_assembler.Fmov_1d(oneReg, 0x70);	//Loads 1.0
+	LoadMemoryFpDoubleInRegister(src1Reg, src1);
+	m_assembler.Fdiv_1d(dstReg, oneReg, src1Reg);
+	StoreRegisterInMemoryFpDouble(dst, dstReg);
+}
+
+void CCodeGen_AArch64::Emit_FpD_Rsqrt_MemMem(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	auto dstReg = GetNextTempRegisterMd();
+	auto src1Reg = GetNextTempRegisterMd();
+	auto oneReg = GetNextTempRegisterMd();
+
+	m_assembler.Fmov_1d(oneReg, 0x70);	//Loads 1.0
+	LoadMemoryFpDoubleInRegister(src1Reg, src1);
+	m_assembler.Fsqrt_1d(src1Reg, src1Reg);
+	m_assembler.Fdiv_1d(dstReg, oneReg, src1Reg);
+	StoreRegisterInMemoryFpDouble(dst, dstReg);
+}
+
+void CCodeGen_AArch64::Emit_FpD_Mov_MemMem(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	auto tmpReg = GetNextTempRegisterMd();
+
+	LoadMemoryFpDoubleInRegister(tmpReg, src1);
+	StoreRegisterInMemoryFpDouble(dst, tmpReg);
+}
+
+void CCodeGen_AArch64::Emit_FpD_Mov_MemDRelI32(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	assert(src1->m_type == SYM_FP_REL_INT32);
+
+	auto dstReg = GetNextTempRegisterMd();
+	auto src1Reg = GetNextTempRegister();
+
+	m_assembler.Ldr(src1Reg, g_baseRegister, src1->m_valueLow);
+	m_assembler.Scvtf_1d(dstReg, src1Reg);
+	StoreRegisterInMemoryFpDouble(dst, dstReg);
+}
+
+void CCodeGen_AArch64::Emit_FpD_ToIntTrunc_RelMem(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	assert(dst->m_type == SYM_FP_REL_SINGLE);
+
+	auto dstReg = GetNextTempRegister();
+	auto src1Reg = GetNextTempRegisterMd();
+
+	LoadMemoryFpDoubleInRegister(src1Reg, src1);
+	m_assembler.Fcvtzs_1d(dstReg, src1Reg);
+	m_assembler.Str(dstReg, g_baseRegister, dst->m_valueLow);
+}
+
+void CCodeGen_AArch64::Emit_FpD_ToInt64Trunc_Mem64Mem(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	auto dstReg = GetNextTempRegister64();
+	auto src1Reg = GetNextTempRegisterMd();
+
+	LoadMemoryFpDoubleInRegister(src1Reg, src1);
+	m_assembler.Fcvtzs_1d(dstReg, src1Reg);
+	StoreRegisterInMemory64(dst, dstReg);
+}
+
+void CCodeGen_AArch64::Emit_FpD_FromInt64_MemMem64(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	auto dstReg = GetNextTempRegisterMd();
+	auto src1Reg = GetNextTempRegister64();
+
+	LoadMemory64InRegister(src1Reg, src1);
+	m_assembler.Scvtf_1d(dstReg, src1Reg);
+	StoreRegisterInMemoryFpDouble(dst, dstReg);
+}
+
+void CCodeGen_AArch64::Emit_FpD_LdCst_TmpCst(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	assert(dst->m_type  == SYM_FP_TMP_DOUBLE);
+	assert(src1->m_type == SYM_CONSTANT64);
+
+	auto tmpReg = GetNextTempRegister64();
+
+	LoadConstant64InRegister(tmpReg, src1->GetConstant64());
+	m_assembler.Str(tmpReg, CAArch64Assembler::xSP, dst->m_stackLocation);
+}
+
 CCodeGen_AArch64::CONSTMATCHER CCodeGen_AArch64::g_fpuConstMatchers[] =
 {
 	{ OP_FP_ADD,            MATCH_MEMORY_FP_SINGLE,       MATCH_MEMORY_FP_SINGLE,     MATCH_MEMORY_FP_SINGLE,    &CCodeGen_AArch64::Emit_Fpu_MemMemMem<FPUOP_ADD>    },
@@ -162,6 +523,11 @@ CCodeGen_AArch64::CONSTMATCHER CCodeGen_AArch64::g_fpuConstMatchers[] =
 	{ OP_FP_MUL,            MATCH_MEMORY_FP_SINGLE,       MATCH_MEMORY_FP_SINGLE,     MATCH_MEMORY_FP_SINGLE,    &CCodeGen_AArch64::Emit_Fpu_MemMemMem<FPUOP_MUL>    },
 	{ OP_FP_DIV,            MATCH_MEMORY_FP_SINGLE,       MATCH_MEMORY_FP_SINGLE,     MATCH_MEMORY_FP_SINGLE,    &CCodeGen_AArch64::Emit_Fpu_MemMemMem<FPUOP_DIV>    },
 
+	{ OP_FP_MADD,           MATCH_MEMORY_FP_SINGLE,       MATCH_MEMORY_FP_SINGLE,     MATCH_MEMORY_FP_SINGLE,    &CCodeGen_AArch64::Emit_Fpu_MulAcc_MemMemMem<FPUOP_ADD>          },
+	{ OP_FP_MSUB,           MATCH_MEMORY_FP_SINGLE,       MATCH_MEMORY_FP_SINGLE,     MATCH_MEMORY_FP_SINGLE,    &CCodeGen_AArch64::Emit_Fpu_MulAcc_MemMemMem<FPUOP_SUB>          },
+	{ OP_FP_FMADD,          MATCH_MEMORY_FP_SINGLE,       MATCH_MEMORY_FP_SINGLE,     MATCH_MEMORY_FP_SINGLE,    &CCodeGen_AArch64::Emit_Fpu_FusedMulAcc_MemMemMem<FPUOP_FMADD>   },
+	{ OP_FP_FMSUB,          MATCH_MEMORY_FP_SINGLE,       MATCH_MEMORY_FP_SINGLE,     MATCH_MEMORY_FP_SINGLE,    &CCodeGen_AArch64::Emit_Fpu_FusedMulAcc_MemMemMem<FPUOP_FMSUB>   },
+
 	{ OP_FP_CMP,            MATCH_ANY,                    MATCH_MEMORY_FP_SINGLE,     MATCH_MEMORY_FP_SINGLE,    &CCodeGen_AArch64::Emit_Fp_Cmp_AnyMemMem            },
 
 	{ OP_FP_MIN,            MATCH_MEMORY_FP_SINGLE,       MATCH_MEMORY_FP_SINGLE,     MATCH_MEMORY_FP_SINGLE,    &CCodeGen_AArch64::Emit_Fpu_MemMemMem<FPUOP_MIN>    },
@@ -176,8 +542,45 @@ CCodeGen_AArch64::CONSTMATCHER CCodeGen_AArch64::g_fpuConstMatchers[] =
 
 	{ OP_MOV,               MATCH_MEMORY_FP_SINGLE,       MATCH_RELATIVE_FP_INT32,    MATCH_NIL,                 &CCodeGen_AArch64::Emit_Fp_Mov_MemSRelI32           },
 	{ OP_FP_TOINT_TRUNC,    MATCH_MEMORY_FP_SINGLE,       MATCH_MEMORY_FP_SINGLE,     MATCH_NIL,                 &CCodeGen_AArch64::Emit_Fp_ToIntTrunc_MemMem        },
+	{ OP_FP_TOINT,          MATCH_MEMORY_FP_SINGLE,       MATCH_MEMORY_FP_SINGLE,     MATCH_CONSTANT,            &CCodeGen_AArch64::Emit_Fp_ToInt_MemMemCst          },
+	{ OP_FP_TOINT_SAT,      MATCH_MEMORY_FP_SINGLE,       MATCH_MEMORY_FP_SINGLE,     MATCH_CONSTANT,            &CCodeGen_AArch64::Emit_Fp_ToInt_MemMemCst          },
+	{ OP_FP_ROUND,          MATCH_MEMORY_FP_SINGLE,       MATCH_MEMORY_FP_SINGLE,     MATCH_CONSTANT,            &CCodeGen_AArch64::Emit_Fp_Round_MemMemCst          },
 
 	{ OP_FP_LDCST,          MATCH_TEMPORARY_FP_SINGLE,    MATCH_CONSTANT,             MATCH_NIL,                 &CCodeGen_AArch64::Emit_Fp_LdCst_TmpCst             },
 
+	{ OP_FP_TODOUBLE,       MATCH_MEMORY_FP_DOUBLE,       MATCH_MEMORY_FP_SINGLE,     MATCH_NIL,                 &CCodeGen_AArch64::Emit_Fp_ToDouble_MemMem          },
+	{ OP_FP_TOSINGLE,       MATCH_MEMORY_FP_SINGLE,       MATCH_MEMORY_FP_DOUBLE,     MATCH_NIL,                 &CCodeGen_AArch64::Emit_Fp_ToSingle_MemMem          },
+	{ OP_FP_TOINT64_TRUNC,  MATCH_MEMORY64,               MATCH_MEMORY_FP_SINGLE,     MATCH_NIL,                 &CCodeGen_AArch64::Emit_Fp_ToInt64Trunc_Mem64MemS   },
+
+	{ OP_FP_ADD,            MATCH_MEMORY_FP_DOUBLE,       MATCH_MEMORY_FP_DOUBLE,     MATCH_MEMORY_FP_DOUBLE,    &CCodeGen_AArch64::Emit_FpuD_MemMemMem<FPUDOP_ADD>  },
+	{ OP_FP_SUB,            MATCH_MEMORY_FP_DOUBLE,       MATCH_MEMORY_FP_DOUBLE,     MATCH_MEMORY_FP_DOUBLE,    &CCodeGen_AArch64::Emit_FpuD_MemMemMem<FPUDOP_SUB>  },
+	{ OP_FP_MUL,            MATCH_MEMORY_FP_DOUBLE,       MATCH_MEMORY_FP_DOUBLE,     MATCH_MEMORY_FP_DOUBLE,    &CCodeGen_AArch64::Emit_FpuD_MemMemMem<FPUDOP_MUL>  },
+	{ OP_FP_DIV,            MATCH_MEMORY_FP_DOUBLE,       MATCH_MEMORY_FP_DOUBLE,     MATCH_MEMORY_FP_DOUBLE,    &CCodeGen_AArch64::Emit_FpuD_MemMemMem<FPUDOP_DIV>  },
+
+	{ OP_FP_MADD,           MATCH_MEMORY_FP_DOUBLE,       MATCH_MEMORY_FP_DOUBLE,     MATCH_MEMORY_FP_DOUBLE,    &CCodeGen_AArch64::Emit_FpuD_MulAcc_MemMemMem<FPUDOP_ADD>        },
+	{ OP_FP_MSUB,           MATCH_MEMORY_FP_DOUBLE,       MATCH_MEMORY_FP_DOUBLE,     MATCH_MEMORY_FP_DOUBLE,    &CCodeGen_AArch64::Emit_FpuD_MulAcc_MemMemMem<FPUDOP_SUB>        },
+	{ OP_FP_FMADD,          MATCH_MEMORY_FP_DOUBLE,       MATCH_MEMORY_FP_DOUBLE,     MATCH_MEMORY_FP_DOUBLE,    &CCodeGen_AArch64::Emit_FpuD_FusedMulAcc_MemMemMem<FPUDOP_FMADD> },
+	{ OP_FP_FMSUB,          MATCH_MEMORY_FP_DOUBLE,       MATCH_MEMORY_FP_DOUBLE,     MATCH_MEMORY_FP_DOUBLE,    &CCodeGen_AArch64::Emit_FpuD_FusedMulAcc_MemMemMem<FPUDOP_FMSUB> },
+
+	{ OP_FP_CMP,            MATCH_ANY,                    MATCH_MEMORY_FP_DOUBLE,     MATCH_MEMORY_FP_DOUBLE,    &CCodeGen_AArch64::Emit_FpD_Cmp_AnyMemMem           },
+
+	{ OP_FP_MIN,            MATCH_MEMORY_FP_DOUBLE,       MATCH_MEMORY_FP_DOUBLE,     MATCH_MEMORY_FP_DOUBLE,    &CCodeGen_AArch64::Emit_FpuD_MemMemMem<FPUDOP_MIN>  },
+	{ OP_FP_MAX,            MATCH_MEMORY_FP_DOUBLE,       MATCH_MEMORY_FP_DOUBLE,     MATCH_MEMORY_FP_DOUBLE,    &CCodeGen_AArch64::Emit_FpuD_MemMemMem<FPUDOP_MAX>  },
+
+	{ OP_FP_RCPL,           MATCH_MEMORY_FP_DOUBLE,       MATCH_MEMORY_FP_DOUBLE,     MATCH_NIL,                 &CCodeGen_AArch64::Emit_FpD_Rcpl_MemMem             },
+	{ OP_FP_SQRT,           MATCH_MEMORY_FP_DOUBLE,       MATCH_MEMORY_FP_DOUBLE,     MATCH_NIL,                 &CCodeGen_AArch64::Emit_FpuD_MemMem<FPUDOP_SQRT>    },
+	{ OP_FP_RSQRT,          MATCH_MEMORY_FP_DOUBLE,       MATCH_MEMORY_FP_DOUBLE,     MATCH_NIL,                 &CCodeGen_AArch64::Emit_FpD_Rsqrt_MemMem            },
+
+	{ OP_FP_ABS,            MATCH_MEMORY_FP_DOUBLE,       MATCH_MEMORY_FP_DOUBLE,     MATCH_NIL,                 &CCodeGen_AArch64::Emit_FpuD_MemMem<FPUDOP_ABS>     },
+	{ OP_FP_NEG,            MATCH_MEMORY_FP_DOUBLE,       MATCH_MEMORY_FP_DOUBLE,     MATCH_NIL,                 &CCodeGen_AArch64::Emit_FpuD_MemMem<FPUDOP_NEG>     },
+
+	{ OP_MOV,               MATCH_MEMORY_FP_DOUBLE,       MATCH_MEMORY_FP_DOUBLE,     MATCH_NIL,                 &CCodeGen_AArch64::Emit_FpD_Mov_MemMem              },
+	{ OP_MOV,               MATCH_MEMORY_FP_DOUBLE,       MATCH_RELATIVE_FP_INT32,    MATCH_NIL,                 &CCodeGen_AArch64::Emit_FpD_Mov_MemDRelI32          },
+	{ OP_FP_TOINT_TRUNC,    MATCH_RELATIVE_FP_SINGLE,     MATCH_MEMORY_FP_DOUBLE,     MATCH_NIL,                 &CCodeGen_AArch64::Emit_FpD_ToIntTrunc_RelMem       },
+	{ OP_FP_TOINT64_TRUNC,  MATCH_MEMORY64,               MATCH_MEMORY_FP_DOUBLE,     MATCH_NIL,                 &CCodeGen_AArch64::Emit_FpD_ToInt64Trunc_Mem64Mem   },
+	{ OP_FP_FROMINT64,      MATCH_MEMORY_FP_DOUBLE,       MATCH_MEMORY64,             MATCH_NIL,                 &CCodeGen_AArch64::Emit_FpD_FromInt64_MemMem64      },
+
+	{ OP_FP_LDCST,          MATCH_TEMPORARY_FP_DOUBLE,    MATCH_CONSTANT64,           MATCH_NIL,                 &CCodeGen_AArch64::Emit_FpD_LdCst_TmpCst            },
+
 	{ OP_MOV,               MATCH_NIL,                    MATCH_NIL,                  MATCH_NIL,                 nullptr                                             },
 };
@@ -161,6 +161,50 @@ void CCodeGen_AArch64::Emit_Md_VarVarVar(const STATEMENT& statement)
 	CommitSymbolRegisterMd(dst, dstReg);
 }
 
+template <typename MDOP>
+void CCodeGen_AArch64::Emit_Md_MulAcc_VarVarVarVar(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+	auto src3 = statement.src3->GetSymbol().get();
+
+	auto productReg = GetNextTempRegisterMd();
+	auto src2Reg = PrepareSymbolRegisterUseMd(src2, GetNextTempRegisterMd());
+	auto src3Reg = PrepareSymbolRegisterUseMd(src3, GetNextTempRegisterMd());
+	m_assembler.Fmul_4s(productReg, src2Reg, src3Reg);
+
+	auto src1Reg = PrepareSymbolRegisterUseMd(src1, GetNextTempRegisterMd());
+	auto dstReg = PrepareSymbolRegisterDefMd(dst, productReg);
+	((m_assembler).*(MDOP::OpReg()))(dstReg, src1Reg, productReg);
+
+	CommitSymbolRegisterMd(dst, dstReg);
+}
+
+template <typename MDOP>
+void CCodeGen_AArch64::Emit_Md_FusedMulAcc_VarVarVarVar(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+	auto src3 = statement.src3->GetSymbol().get();
+
+	//Accumulates in place, work on a copy in case dst is also a source
+	auto resultReg = GetNextTempRegisterMd();
+	auto src1Reg = PrepareSymbolRegisterUseMd(src1, GetNextTempRegisterMd());
+	auto src2Reg = PrepareSymbolRegisterUseMd(src2, GetNextTempRegisterMd());
+	auto src3Reg = PrepareSymbolRegisterUseMd(src3, GetNextTempRegisterMd());
+	m_assembler.Mov(resultReg, src1Reg);
+	((m_assembler).*(MDOP::OpReg()))(resultReg, src2Reg, src3Reg);
+
+	auto dstReg = PrepareSymbolRegisterDefMd(dst, resultReg);
+	if(dstReg != resultReg)
+	{
+		m_assembler.Mov(dstReg, resultReg);
+	}
+	CommitSymbolRegisterMd(dst, dstReg);
+}
+
 template <typename MDOP>
 void CCodeGen_AArch64::Emit_Md_VarVarVarRev(const STATEMENT& statement)
 {
@@ -369,6 +413,209 @@ void CCodeGen_AArch64::Emit_Md_Expand_VarCst(const STATEMENT& statement)
 	CommitSymbolRegisterMd(dst, dstReg);
 }
 
+void CCodeGen_AArch64::Emit_Md_Shuffle_VarVarCst(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	auto selector = static_cast<uint8>(src2->m_valueLow);
+	auto getLane = [selector] (unsigned int i) { return static_cast<uint8>((selector >> (i * 2)) & 3); };
+
+	bool isBroadcast = true;
+	bool isRotation = true;
+	for(unsigned int i = 1; i < 4; i++)
+	{
+		isBroadcast &= (getLane(i) == getLane(0));
+		isRotation &= (getLane(i) == ((getLane(0) + i) & 3));
+	}
+
+	auto src1Reg = PrepareSymbolRegisterUseMd(src1, GetNextTempRegisterMd());
+
+	if(isBroadcast || isRotation)
+	{
+		auto dstReg = PrepareSymbolRegisterDefMd(dst, GetNextTempRegisterMd());
+		if(isBroadcast)
+		{
+			m_assembler.Dup_4s(dstReg, src1Reg, getLane(0));
+		}
+		else
+		{
+			m_assembler.Ext_16b(dstReg, src1Reg, src1Reg, getLane(0) * 4);
+		}
+		CommitSymbolRegisterMd(dst, dstReg);
+		return;
+	}
+
+	//Lanes are moved one by one, work on a copy in case dst is also the source
+	auto resultReg = dst->Equals(src1) ? GetNextTempRegisterMd() : PrepareSymbolRegisterDefMd(dst, GetNextTempRegisterMd());
+	m_assembler.Mov(resultReg, src1Reg);
+	for(unsigned int i = 0; i < 4; i++)
+	{
+		if(getLane(i) == i) continue;
+		m_assembler.Ins_1s(resultReg, i, src1Reg, getLane(i));
+	}
+
+	auto dstReg = PrepareSymbolRegisterDefMd(dst, resultReg);
+	if(dstReg != resultReg)
+	{
+		m_assembler.Mov(dstReg, resultReg);
+	}
+	CommitSymbolRegisterMd(dst, dstReg);
+}
+
+void CCodeGen_AArch64::Emit_Md_InsertW_VarVarVar(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+	auto src3 = statement.src3->GetSymbol().get();
+
+	assert(src3->m_type == SYM_CONSTANT);
+
+	uint8 srcLane = (src3->m_valueLow >> 2) & 3;
+	uint8 dstLane = src3->m_valueLow & 3;
+
+	auto src1Reg = PrepareSymbolRegisterUseMd(src1, GetNextTempRegisterMd());
+	auto src2Reg = PrepareSymbolRegisterUseMd(src2, GetNextTempRegisterMd());
+
+	//Don't overwrite src2 before we're done reading from it
+	auto resultReg = dst->Equals(src2) ? GetNextTempRegisterMd() : PrepareSymbolRegisterDefMd(dst, GetNextTempRegisterMd());
+	if(resultReg != src1Reg)
+	{
+		m_assembler.Mov(resultReg, src1Reg);
+	}
+	m_assembler.Ins_1s(resultReg, dstLane, src2Reg, srcLane);
+
+	auto dstReg = PrepareSymbolRegisterDefMd(dst, resultReg);
+	if(dstReg != resultReg)
+	{
+		m_assembler.Mov(dstReg, resultReg);
+	}
+	CommitSymbolRegisterMd(dst, dstReg);
+}
+
+void CCodeGen_AArch64::Emit_Md_MulHiH_VarVarVar(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	auto src1Reg = PrepareSymbolRegisterUseMd(src1, GetNextTempRegisterMd());
+	auto src2Reg = PrepareSymbolRegisterUseMd(src2, GetNextTempRegisterMd());
+	auto lowReg = GetNextTempRegisterMd();
+	auto highReg = GetNextTempRegisterMd();
+
+	m_assembler.Smull_4s(lowReg, src1Reg, src2Reg);
+	m_assembler.Smull2_4s(highReg, src1Reg, src2Reg);
+
+	//Odd halfwords of the 32-bit products are the high halves
+	auto dstReg = PrepareSymbolRegisterDefMd(dst, lowReg);
+	m_assembler.Uzp2_8h(dstReg, lowReg, highReg);
+	CommitSymbolRegisterMd(dst, dstReg);
+}
+
+void CCodeGen_AArch64::Emit_Md_MulEvenUWD_VarVarVar(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	auto src1Reg = PrepareSymbolRegisterUseMd(src1, GetNextTempRegisterMd());
+	auto src2Reg = PrepareSymbolRegisterUseMd(src2, GetNextTempRegisterMd());
+	auto even1Reg = GetNextTempRegisterMd();
+	auto even2Reg = GetNextTempRegisterMd();
+
+	//Narrowing doublewords to words keeps lanes 0 and 2
+	m_assembler.Xtn1_2s(even1Reg, src1Reg);
+	m_assembler.Xtn1_2s(even2Reg, src2Reg);
+
+	auto dstReg = PrepareSymbolRegisterDefMd(dst, even1Reg);
+	m_assembler.Umull_2d(dstReg, even1Reg, even2Reg);
+	CommitSymbolRegisterMd(dst, dstReg);
+}
+
+void CCodeGen_AArch64::Emit_Md_MulAddPairsHW_VarVarVar(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	auto src1Reg = PrepareSymbolRegisterUseMd(src1, GetNextTempRegisterMd());
+	auto src2Reg = PrepareSymbolRegisterUseMd(src2, GetNextTempRegisterMd());
+	auto lowReg = GetNextTempRegisterMd();
+	auto highReg = GetNextTempRegisterMd();
+
+	m_assembler.Smull_4s(lowReg, src1Reg, src2Reg);
+	m_assembler.Smull2_4s(highReg, src1Reg, src2Reg);
+
+	auto dstReg = PrepareSymbolRegisterDefMd(dst, lowReg);
+	m_assembler.Addp_4s(dstReg, lowReg, highReg);
+	CommitSymbolRegisterMd(dst, dstReg);
+}
+
+void CCodeGen_AArch64::Emit_Md_ToWord_VarVarCst(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	//Indexed by ROUNDMODE, these saturate and give 0 for NaNs
+	static const MDOP_BASE2::OpRegType convertOps[] =
+	{
+		&CAArch64Assembler::Fcvtns_4s,
+		&CAArch64Assembler::Fcvtps_4s,
+		&CAArch64Assembler::Fcvtms_4s,
+		&CAArch64Assembler::Fcvtzs_4s,
+	};
+	assert(src2->m_valueLow < 4);
+
+	auto dstReg = PrepareSymbolRegisterDefMd(dst, GetNextTempRegisterMd());
+	auto src1Reg = PrepareSymbolRegisterUseMd(src1, GetNextTempRegisterMd());
+
+	((m_assembler).*(convertOps[src2->m_valueLow]))(dstReg, src1Reg);
+
+	CommitSymbolRegisterMd(dst, dstReg);
+}
+
+void CCodeGen_AArch64::Emit_Md_Round_VarVarCst(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	//Indexed by ROUNDMODE
+	static const MDOP_BASE2::OpRegType roundOps[] =
+	{
+		&CAArch64Assembler::Frintn_4s,
+		&CAArch64Assembler::Frintp_4s,
+		&CAArch64Assembler::Frintm_4s,
+		&CAArch64Assembler::Frintz_4s,
+	};
+	assert(src2->m_valueLow < 4);
+
+	auto dstReg = PrepareSymbolRegisterDefMd(dst, GetNextTempRegisterMd());
+	auto src1Reg = PrepareSymbolRegisterUseMd(src1, GetNextTempRegisterMd());
+
+	((m_assembler).*(roundOps[src2->m_valueLow]))(dstReg, src1Reg);
+
+	CommitSymbolRegisterMd(dst, dstReg);
+}
+
+void CCodeGen_AArch64::Emit_Md_ExtractW_VarVarCst(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	auto src1Reg = PrepareSymbolRegisterUseMd(src1, GetNextTempRegisterMd());
+	auto dstReg = PrepareSymbolRegisterDef(dst, GetNextTempRegister());
+
+	m_assembler.Umov_1s(dstReg, src1Reg, src2->m_valueLow & 3);
+
+	CommitSymbolRegister(dst, dstReg);
+}
+
 void CCodeGen_AArch64::Emit_Md_PackHB_VarVarVar(const STATEMENT& statement)
 {
 	auto dst = statement.dst->GetSymbol().get();
@@ -527,10 +774,20 @@ CCodeGen_AArch64::CONSTMATCHER CCodeGen_AArch64::g_mdConstMatchers[] =
 	{ OP_MD_MAX_H,              MATCH_VARIABLE128,    MATCH_VARIABLE128,    MATCH_VARIABLE128,      &CCodeGen_AArch64::Emit_Md_VarVarVar<MDOP_MAXH>                  },
 	{ OP_MD_MAX_W,              MATCH_VARIABLE128,    MATCH_VARIABLE128,    MATCH_VARIABLE128,      &CCodeGen_AArch64::Emit_Md_VarVarVar<MDOP_MAXW>                  },
 
+	{ OP_MD_MUL_H,              MATCH_VARIABLE128,    MATCH_VARIABLE128,    MATCH_VARIABLE128,      &CCodeGen_AArch64::Emit_Md_VarVarVar<MDOP_MULH>                  },
+	{ OP_MD_MUL_W,              MATCH_VARIABLE128,    MATCH_VARIABLE128,    MATCH_VARIABLE128,      &CCodeGen_AArch64::Emit_Md_VarVarVar<MDOP_MULW>                  },
+	{ OP_MD_MULHI_H,            MATCH_VARIABLE128,    MATCH_VARIABLE128,    MATCH_VARIABLE128,      &CCodeGen_AArch64::Emit_Md_MulHiH_VarVarVar                      },
+	{ OP_MD_MULEVEN_UWD,        MATCH_VARIABLE128,    MATCH_VARIABLE128,    MATCH_VARIABLE128,      &CCodeGen_AArch64::Emit_Md_MulEvenUWD_VarVarVar                  },
+	{ OP_MD_MULADDPAIRS_HW,     MATCH_VARIABLE128,    MATCH_VARIABLE128,    MATCH_VARIABLE128,      &CCodeGen_AArch64::Emit_Md_MulAddPairsHW_VarVarVar               },
+
 	{ OP_MD_ADD_S,              MATCH_VARIABLE128,    MATCH_VARIABLE128,    MATCH_VARIABLE128,      &CCodeGen_AArch64::Emit_Md_VarVarVar<MDOP_ADDS>                  },
 	{ OP_MD_SUB_S,              MATCH_VARIABLE128,    MATCH_VARIABLE128,    MATCH_VARIABLE128,      &CCodeGen_AArch64::Emit_Md_VarVarVar<MDOP_SUBS>                  },
 	{ OP_MD_MUL_S,              MATCH_VARIABLE128,    MATCH_VARIABLE128,    MATCH_VARIABLE128,      &CCodeGen_AArch64::Emit_Md_VarVarVar<MDOP_MULS>                  },
 	{ OP_MD_DIV_S,              MATCH_VARIABLE128,    MATCH_VARIABLE128,    MATCH_VARIABLE128,      &CCodeGen_AArch64::Emit_Md_VarVarVar<MDOP_DIVS>                  },
+	{ OP_MD_MADD_S,             MATCH_VARIABLE128,    MATCH_VARIABLE128,    MATCH_VARIABLE128,      &CCodeGen_AArch64::Emit_Md_MulAcc_VarVarVarVar<MDOP_ADDS>        },
+	{ OP_MD_MSUB_S,             MATCH_VARIABLE128,    MATCH_VARIABLE128,    MATCH_VARIABLE128,      &CCodeGen_AArch64::Emit_Md_MulAcc_VarVarVarVar<MDOP_SUBS>        },
+	{ OP_MD_FMADD_S,            MATCH_VARIABLE128,    MATCH_VARIABLE128,    MATCH_VARIABLE128,      &CCodeGen_AArch64::Emit_Md_FusedMulAcc_VarVarVarVar<MDOP_FMLAS>  },
+	{ OP_MD_FMSUB_S,            MATCH_VARIABLE128,    MATCH_VARIABLE128,    MATCH_VARIABLE128,      &CCodeGen_AArch64::Emit_Md_FusedMulAcc_VarVarVarVar<MDOP_FMLSS>  },
 
 	{ OP_MD_ABS_S,              MATCH_VARIABLE128,    MATCH_VARIABLE128,    MATCH_NIL,              &CCodeGen_AArch64::Emit_Md_VarVar<MDOP_ABSS>                     },
 	{ OP_MD_MIN_S,              MATCH_VARIABLE128,    MATCH_VARIABLE128,    MATCH_VARIABLE128,      &CCodeGen_AArch64::Emit_Md_VarVarVar<MDOP_MINS>                  },
@@ -551,14 +808,17 @@ CCodeGen_AArch64::CONSTMATCHER CCodeGen_AArch64::g_mdConstMatchers[] =
 	{ OP_MD_SRAH,               MATCH_VARIABLE128,    MATCH_VARIABLE128,    MATCH_CONSTANT,         &CCodeGen_AArch64::Emit_Md_Shift_VarVarCst<MDOP_SRAH>            },
 	{ OP_MD_SRAW,               MATCH_VARIABLE128,    MATCH_VARIABLE128,    MATCH_CONSTANT,         &CCodeGen_AArch64::Emit_Md_Shift_VarVarCst<MDOP_SRAW>            },
 	
-	{ OP_MD_SRL256,             MATCH_VARIABLE128,    MATCH_MEMORY256,      MATCH_VARIABLE,         &CCodeGen_AArch64::Emit_Md_Srl256_VarMemVar                      },
-	{ OP_MD_SRL256,             MATCH_VARIABLE128,    MATCH_MEMORY256,      MATCH_CONSTANT,         &CCodeGen_AArch64::Emit_Md_Srl256_VarMemCst                      },
+	{ OP_MD_SRL256,             MATCH_VARIABLE128,    MATCH_TEMPORARY256,   MATCH_VARIABLE,         &CCodeGen_AArch64::Emit_Md_Srl256_VarMemVar                      },
+	{ OP_MD_SRL256,             MATCH_VARIABLE128,    MATCH_TEMPORARY256,   MATCH_CONSTANT,         &CCodeGen_AArch64::Emit_Md_Srl256_VarMemCst                      },
 
 	{ OP_MD_ISNEGATIVE,         MATCH_VARIABLE,       MATCH_VARIABLE128,    MATCH_NIL,              &CCodeGen_AArch64::Emit_Md_Test_VarVar<MDOP_CMPLTZS>             },
 	{ OP_MD_ISZERO,             MATCH_VARIABLE,       MATCH_VARIABLE128,    MATCH_NIL,              &CCodeGen_AArch64::Emit_Md_Test_VarVar<MDOP_CMPEQZS>             },
 	
 	{ OP_MD_TOSINGLE,           MATCH_VARIABLE128,    MATCH_VARIABLE128,    MATCH_NIL,              &CCodeGen_AArch64::Emit_Md_VarVar<MDOP_TOSINGLE>                 },
 	{ OP_MD_TOWORD_TRUNCATE,    MATCH_VARIABLE128,    MATCH_VARIABLE128,    MATCH_NIL,              &CCodeGen_AArch64::Emit_Md_VarVar<MDOP_TOWORD>                   },
+	{ OP_MD_TOWORD,             MATCH_VARIABLE128,    MATCH_VARIABLE128,    MATCH_CONSTANT,         &CCodeGen_AArch64::Emit_Md_ToWord_VarVarCst                      },
+	{ OP_MD_TOWORD_SAT,         MATCH_VARIABLE128,    MATCH_VARIABLE128,    MATCH_CONSTANT,         &CCodeGen_AArch64::Emit_Md_ToWord_VarVarCst                      },
+	{ OP_MD_ROUND,              MATCH_VARIABLE128,    MATCH_VARIABLE128,    MATCH_CONSTANT,         &CCodeGen_AArch64::Emit_Md_Round_VarVarCst                       },
 
 	{ OP_LOADFROMREF,           MATCH_VARIABLE128,    MATCH_MEM_REF,        MATCH_NIL,              &CCodeGen_AArch64::Emit_Md_LoadFromRef_VarMem                    },
 	{ OP_STOREATREF,            MATCH_NIL,            MATCH_MEM_REF,        MATCH_VARIABLE128,      &CCodeGen_AArch64::Emit_Md_StoreAtRef_MemVar                     },
@@ -569,6 +829,10 @@ CCodeGen_AArch64::CONSTMATCHER CCodeGen_AArch64::g_mdConstMatchers[] =
 	{ OP_MD_EXPAND,             MATCH_VARIABLE128,    MATCH_MEMORY,         MATCH_NIL,              &CCodeGen_AArch64::Emit_Md_Expand_VarMem                         },
 	{ OP_MD_EXPAND,             MATCH_VARIABLE128,    MATCH_CONSTANT,       MATCH_NIL,              &CCodeGen_AArch64::Emit_Md_Expand_VarCst                         },
 
+	{ OP_MD_SHUFFLE_W,          MATCH_VARIABLE128,    MATCH_VARIABLE128,    MATCH_CONSTANT,         &CCodeGen_AArch64::Emit_Md_Shuffle_VarVarCst                     },
+	{ OP_MD_INSERT_W,           MATCH_VARIABLE128,    MATCH_VARIABLE128,    MATCH_VARIABLE128,      &CCodeGen_AArch64::Emit_Md_InsertW_VarVarVar                     },
+	{ OP_MD_EXTRACT_W,          MATCH_VARIABLE,       MATCH_VARIABLE128,    MATCH_CONSTANT,         &CCodeGen_AArch64::Emit_Md_ExtractW_VarVarCst                    },
+
 	{ OP_MD_PACK_HB,            MATCH_VARIABLE128,    MATCH_VARIABLE128,    MATCH_VARIABLE128,      &CCodeGen_AArch64::Emit_Md_PackHB_VarVarVar                      },
 	{ OP_MD_PACK_WH,            MATCH_VARIABLE128,    MATCH_VARIABLE128,    MATCH_VARIABLE128,      &CCodeGen_AArch64::Emit_Md_PackWH_VarVarVar                      },
 
@@ -585,7 +849,7 @@ CCodeGen_AArch64::CONSTMATCHER CCodeGen_AArch64::g_mdConstMatchers[] =
 	{ OP_MOV,                   MATCH_MEMORY128,      MATCH_REGISTER128,    MATCH_NIL,              &CCodeGen_AArch64::Emit_Md_Mov_MemReg                            },
 	{ OP_MOV,                   MATCH_MEMORY128,      MATCH_MEMORY128,      MATCH_NIL,              &CCodeGen_AArch64::Emit_Md_Mov_MemMem                            },
 	
-	{ OP_MERGETO256,            MATCH_MEMORY256,      MATCH_VARIABLE128,    MATCH_VARIABLE128,      &CCodeGen_AArch64::Emit_MergeTo256_MemVarVar                     },
+	{ OP_MERGETO256,            MATCH_TEMPORARY256,   MATCH_VARIABLE128,    MATCH_VARIABLE128,      &CCodeGen_AArch64::Emit_MergeTo256_MemVarVar                     },
 	
 	{ OP_MOV,                   MATCH_NIL,            MATCH_NIL,            MATCH_NIL,              nullptr                                                          },
 };
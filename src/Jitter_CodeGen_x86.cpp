@@ -44,9 +44,22 @@ CCodeGen_x86::CONSTMATCHER CCodeGen_x86::g_constMatchers[] =
 	{ OP_LZC,		MATCH_REGISTER,		MATCH_VARIABLE,		MATCH_NIL,			&CCodeGen_x86::Emit_Lzc_RegVar						},
 	{ OP_LZC,		MATCH_MEMORY,		MATCH_VARIABLE,		MATCH_NIL,			&CCodeGen_x86::Emit_Lzc_MemVar						},
 
+	{ OP_SEXT8,		MATCH_REGISTER,		MATCH_VARIABLE,		MATCH_NIL,			&CCodeGen_x86::Emit_Ext_RegVar						},
+	{ OP_SEXT8,		MATCH_MEMORY,		MATCH_VARIABLE,		MATCH_NIL,			&CCodeGen_x86::Emit_Ext_MemVar						},
+	{ OP_SEXT16,	MATCH_REGISTER,		MATCH_VARIABLE,		MATCH_NIL,			&CCodeGen_x86::Emit_Ext_RegVar						},
+	{ OP_SEXT16,	MATCH_MEMORY,		MATCH_VARIABLE,		MATCH_NIL,			&CCodeGen_x86::Emit_Ext_MemVar						},
+	{ OP_ZEXT8,		MATCH_REGISTER,		MATCH_VARIABLE,		MATCH_NIL,			&CCodeGen_x86::Emit_Ext_RegVar						},
+	{ OP_ZEXT8,		MATCH_MEMORY,		MATCH_VARIABLE,		MATCH_NIL,			&CCodeGen_x86::Emit_Ext_MemVar						},
+	{ OP_ZEXT16,	MATCH_REGISTER,		MATCH_VARIABLE,		MATCH_NIL,			&CCodeGen_x86::Emit_Ext_RegVar						},
+	{ OP_ZEXT16,	MATCH_MEMORY,		MATCH_VARIABLE,		MATCH_NIL,			&CCodeGen_x86::Emit_Ext_MemVar						},
+
+	{ OP_BSWAP,		MATCH_REGISTER,		MATCH_VARIABLE,		MATCH_NIL,			&CCodeGen_x86::Emit_ByteSwap_RegVar					},
+	{ OP_BSWAP,		MATCH_MEMORY,		MATCH_VARIABLE,		MATCH_NIL,			&CCodeGen_x86::Emit_ByteSwap_MemVar					},
+
 	SHIFT_CONST_MATCHERS(OP_SRL, SHIFTOP_SRL)
 	SHIFT_CONST_MATCHERS(OP_SRA, SHIFTOP_SRA)
 	SHIFT_CONST_MATCHERS(OP_SLL, SHIFTOP_SLL)
+	SHIFT_CONST_MATCHERS(OP_ROR, SHIFTOP_ROR)
 
 	{ OP_MOV,		MATCH_REGISTER,		MATCH_REGISTER,		MATCH_NIL,			&CCodeGen_x86::Emit_Mov_RegReg						},
 	{ OP_MOV,		MATCH_REGISTER,		MATCH_MEMORY,		MATCH_NIL,			&CCodeGen_x86::Emit_Mov_RegMem						},
@@ -105,9 +118,44 @@ CCodeGen_x86::CONSTMATCHER CCodeGen_x86::g_constMatchers[] =
 	{ OP_EXTHIGH64,	MATCH_REGISTER,		MATCH_TEMPORARY64,	MATCH_NIL,			&CCodeGen_x86::Emit_ExtHigh64RegTmp64				},
 	{ OP_EXTHIGH64,	MATCH_MEMORY,		MATCH_TEMPORARY64,	MATCH_NIL,			&CCodeGen_x86::Emit_ExtHigh64MemTmp64				},
 
+	{ OP_SEXTTO64,	MATCH_MEMORY64,		MATCH_VARIABLE,		MATCH_NIL,			&CCodeGen_x86::Emit_SignExtTo64_Mem64Var			},
+	{ OP_ZEXTTO64,	MATCH_MEMORY64,		MATCH_VARIABLE,		MATCH_NIL,			&CCodeGen_x86::Emit_ZeroExtTo64_Mem64Var			},
+
 	{ OP_MOV,		MATCH_NIL,			MATCH_NIL,			MATCH_NIL,			NULL												},
 };
 
+CCodeGen_x86::CONSTMATCHER CCodeGen_x86::g_popCountConstMatchers[] = 
+{
+	{ OP_POPCNT,	MATCH_REGISTER,		MATCH_VARIABLE,		MATCH_NIL,			&CCodeGen_x86::Emit_PopCount_RegVar					},
+	{ OP_POPCNT,	MATCH_MEMORY,		MATCH_VARIABLE,		MATCH_NIL,			&CCodeGen_x86::Emit_PopCount_MemVar					},
+
+	{ OP_MOV, MATCH_NIL, MATCH_NIL, MATCH_NIL, nullptr },
+};
+
+CCodeGen_x86::CONSTMATCHER CCodeGen_x86::g_popCountPopcntConstMatchers[] = 
+{
+	{ OP_POPCNT,	MATCH_REGISTER,		MATCH_VARIABLE,		MATCH_NIL,			&CCodeGen_x86::Emit_PopCount_Popcnt_RegVar			},
+	{ OP_POPCNT,	MATCH_MEMORY,		MATCH_VARIABLE,		MATCH_NIL,			&CCodeGen_x86::Emit_PopCount_Popcnt_MemVar			},
+
+	{ OP_MOV, MATCH_NIL, MATCH_NIL, MATCH_NIL, nullptr },
+};
+
+CCodeGen_x86::CONSTMATCHER CCodeGen_x86::g_ctzConstMatchers[] = 
+{
+	{ OP_CTZ,		MATCH_REGISTER,		MATCH_VARIABLE,		MATCH_NIL,			&CCodeGen_x86::Emit_Ctz_RegVar						},
+	{ OP_CTZ,		MATCH_MEMORY,		MATCH_VARIABLE,		MATCH_NIL,			&CCodeGen_x86::Emit_Ctz_MemVar						},
+
+	{ OP_MOV, MATCH_NIL, MATCH_NIL, MATCH_NIL, nullptr },
+};
+
+CCodeGen_x86::CONSTMATCHER CCodeGen_x86::g_ctzBmi1ConstMatchers[] = 
+{
+	{ OP_CTZ,		MATCH_REGISTER,		MATCH_VARIABLE,		MATCH_NIL,			&CCodeGen_x86::Emit_Ctz_Bmi1_RegVar					},
+	{ OP_CTZ,		MATCH_MEMORY,		MATCH_VARIABLE,		MATCH_NIL,			&CCodeGen_x86::Emit_Ctz_Bmi1_MemVar					},
+
+	{ OP_MOV, MATCH_NIL, MATCH_NIL, MATCH_NIL, nullptr },
+};
+
 CCodeGen_x86::CCodeGen_x86()
 {
 	SetGenerationFlags();
@@ -116,13 +164,40 @@ CCodeGen_x86::CCodeGen_x86()
 	InsertMatchers(g_fpuConstMatchers);
 	InsertMatchers(g_mdConstMatchers);
 
+	InsertMatchers(m_hasPopcnt ? g_popCountPopcntConstMatchers : g_popCountConstMatchers);
+	InsertMatchers(m_hasBmi1 ? g_ctzBmi1ConstMatchers : g_ctzConstMatchers);
+
 	if(m_hasSse41)
 	{
 		InsertMatchers(g_mdMinMaxWSse41ConstMatchers);
+		InsertMatchers(g_mdInsertWSse41ConstMatchers);
+		InsertMatchers(g_mdMulWSse41ConstMatchers);
 	}
 	else
 	{
 		InsertMatchers(g_mdMinMaxWConstMatchers);
+		InsertMatchers(g_mdInsertWConstMatchers);
+		InsertMatchers(g_mdMulWConstMatchers);
+	}
+
+	if(m_hasFma)
+	{
+		InsertMatchers(g_fpuFusedMulAddFmaConstMatchers);
+		InsertMatchers(g_mdFusedMulAddFmaConstMatchers);
+	}
+	else
+	{
+		InsertMatchers(g_fpuFusedMulAddConstMatchers);
+		InsertMatchers(g_mdFusedMulAddConstMatchers);
+	}
+
+	if(m_hasAvx2)
+	{
+		InsertMatchers(g_md256Avx2ConstMatchers);
+	}
+	else
+	{
+		InsertMatchers(g_md256ConstMatchers);
 	}
 }
 
@@ -137,10 +212,14 @@ void CCodeGen_x86::GenerateCode(const StatementList& statements, unsigned int st
 	assert(m_mdRegisters != nullptr);
 
 	uint32 registerUsage = GetRegisterUsage(statements);
+	m_mdRegisterUsage = GetMdRegisterUsage(statements);
+	m_md256RegisterUsage = GetMd256RegisterUsage(statements);
+	auto liveMd256Registers = GetLiveMd256Registers(statements);
 	
 	//Align stacksize
 	stackSize = (stackSize + 0xF) & ~0xF;
 	m_stackLevel = 0;
+	m_upperYmmDirty = false;
 
 	m_assembler.Begin();
 	{
@@ -149,8 +228,18 @@ void CCodeGen_x86::GenerateCode(const StatementList& statements, unsigned int st
 
 		Emit_Prolog(statements, stackSize, registerUsage);
 
+		auto liveMd256RegistersIterator = liveMd256Registers.begin();
 		for(const auto& statement : statements)
 		{
+			//A single Vzeroupper after a run of 256-bits statements, before SSE code, calls, jumps or labels.
+			//It can't be used while registers still hold 256-bits values, SSE code runs with dirty upper halves then.
+			bool hasLiveMd256Registers = (*liveMd256RegistersIterator++ != 0);
+			if(m_upperYmmDirty && !UsesYmmRegisters(statement) && !hasLiveMd256Registers)
+			{
+				m_assembler.Vzeroupper();
+				m_upperYmmDirty = false;
+			}
+
 			bool found = false;
 			auto begin = m_matchers.lower_bound(statement.op);
 			auto end = m_matchers.upper_bound(statement.op);
@@ -172,7 +261,19 @@ void CCodeGen_x86::GenerateCode(const StatementList& statements, unsigned int st
 			}
 		}
 
+		if(m_upperYmmDirty)
+		{
+			m_assembler.Vzeroupper();
+			m_upperYmmDirty = false;
+		}
+
 		Emit_Epilog(stackSize, registerUsage);
+
+		//Slow paths are placed after the epilog to keep them out of the main flow
+		for(const auto& coldPathEmitter : m_coldPathEmitters)
+		{
+			coldPathEmitter();
+		}
 	}
 	m_assembler.End();
 
@@ -187,6 +288,7 @@ void CCodeGen_x86::GenerateCode(const StatementList& statements, unsigned int st
 
 	m_labels.clear();
 	m_symbolReferenceLabels.clear();
+	m_coldPathEmitters.clear();
 }
 
 void CCodeGen_x86::InsertMatchers(const CONSTMATCHER* constMatchers)
@@ -206,10 +308,42 @@ void CCodeGen_x86::InsertMatchers(const CONSTMATCHER* constMatchers)
 void CCodeGen_x86::SetGenerationFlags()
 {
 #if defined(_WIN32) && (defined(_M_IX86) || defined(_M_X64))
+	static uint32 CPUID_FLAG_SSE3 = 0x000001;
+	static uint32 CPUID_FLAG_FMA = 0x001000;
 	static uint32 CPUID_FLAG_SSE41 = 0x080000;
+	static uint32 CPUID_FLAG_POPCNT = 0x800000;
+	static uint32 CPUID_FLAG_OSXSAVE = 0x8000000;
+	static uint32 CPUID_FLAG_AVX = 0x10000000;
+	static uint32 CPUID_EXT_FLAG_BMI1 = 0x08;
+	static uint32 CPUID_EXT_FLAG_AVX2 = 0x20;
 	std::array<int, 4> cpuInfo;
+	int extFlags = 0;
+	__cpuid(cpuInfo.data(), 0);
+	if(cpuInfo[0] >= 7)
+	{
+		__cpuidex(cpuInfo.data(), 7, 0);
+		extFlags = cpuInfo[1];
+		m_hasBmi1 = (extFlags & CPUID_EXT_FLAG_BMI1) != 0;
+	}
 	__cpuid(cpuInfo.data(), 1);
+	m_hasSse3 = (cpuInfo[2] & CPUID_FLAG_SSE3) != 0;
 	m_hasSse41 = (cpuInfo[2] & CPUID_FLAG_SSE41) != 0;
+	m_hasPopcnt = (cpuInfo[2] & CPUID_FLAG_POPCNT) != 0;
+	//VEX encoded instructions also need the OS to save the AVX state
+	uint32 avxFlags = CPUID_FLAG_OSXSAVE | CPUID_FLAG_AVX;
+	if(((cpuInfo[2] & avxFlags) == avxFlags) && ((_xgetbv(0) & 6) == 6))
+	{
+		m_hasFma = (cpuInfo[2] & CPUID_FLAG_FMA) != 0;
+		m_hasAvx2 = (extFlags & CPUID_EXT_FLAG_AVX2) != 0;
+	}
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__i386__) || defined(__x86_64__))
+	__builtin_cpu_init();
+	m_hasSse3 = __builtin_cpu_supports("sse3");
+	m_hasSse41 = __builtin_cpu_supports("sse4.1");
+	m_hasFma = __builtin_cpu_supports("fma");
+	m_hasPopcnt = __builtin_cpu_supports("popcnt");
+	m_hasBmi1 = __builtin_cpu_supports("bmi");
+	m_hasAvx2 = __builtin_cpu_supports("avx2");
 #endif
 }
 
@@ -223,6 +357,60 @@ void CCodeGen_x86::RegisterExternalSymbols(CObjectFile*) const
 	//Nothing to register
 }
 
+uint32 CCodeGen_x86::GetSavedMdRegistersSize() const
+{
+	uint32 size = 0;
+	for(unsigned int i = 0; i < 32; i++)
+	{
+		if(!(m_mdRegisterUsage & (1 << i))) continue;
+		size += (m_md256RegisterUsage & (1 << i)) ? 0x20 : 0x10;
+	}
+	return size;
+}
+
+void CCodeGen_x86::SaveMdRegisters(uint32 saveOffset)
+{
+	for(unsigned int i = 0; i < 32; i++)
+	{
+		if(!(m_mdRegisterUsage & (1 << i))) continue;
+		auto saveAddress = CX86Assembler::MakeIndRegOffAddress(CX86Assembler::rSP, saveOffset);
+		if(m_md256RegisterUsage & (1 << i))
+		{
+			m_assembler.VmovdquVqq(saveAddress, m_mdRegisters[i]);
+			saveOffset += 0x20;
+		}
+		else
+		{
+			m_assembler.MovdqaVo(saveAddress, m_mdRegisters[i]);
+			saveOffset += 0x10;
+		}
+	}
+	//Upper halves are saved, don't make the callee pay for them
+	if(m_md256RegisterUsage != 0)
+	{
+		m_assembler.Vzeroupper();
+	}
+}
+
+void CCodeGen_x86::RestoreMdRegisters(uint32 saveOffset)
+{
+	for(unsigned int i = 0; i < 32; i++)
+	{
+		if(!(m_mdRegisterUsage & (1 << i))) continue;
+		auto saveAddress = CX86Assembler::MakeIndRegOffAddress(CX86Assembler::rSP, saveOffset);
+		if(m_md256RegisterUsage & (1 << i))
+		{
+			m_assembler.VmovdquVqq(m_mdRegisters[i], saveAddress);
+			saveOffset += 0x20;
+		}
+		else
+		{
+			m_assembler.MovdqaVo(m_mdRegisters[i], saveAddress);
+			saveOffset += 0x10;
+		}
+	}
+}
+
 CX86Assembler::LABEL CCodeGen_x86::GetLabel(uint32 blockId)
 {
 	CX86Assembler::LABEL result;
@@ -519,6 +707,205 @@ void CCodeGen_x86::Emit_Lzc_MemVar(const STATEMENT& statement)
 	m_assembler.MovGd(MakeMemorySymbolAddress(dst), dstRegister);
 }
 
+void CCodeGen_x86::Emit_Ext(CX86Assembler::REGISTER dstRegister, const STATEMENT& statement)
+{
+	auto src1 = statement.src1->GetSymbol().get();
+
+	auto srcAddress = MakeVariableSymbolAddress(src1);
+	bool isByte = (statement.op == OP_SEXT8) || (statement.op == OP_ZEXT8);
+	if(isByte && (src1->m_type == SYM_REGISTER))
+	{
+		//Allocated registers might not have a byte form
+		m_assembler.MovEd(CX86Assembler::rAX, srcAddress);
+		srcAddress = CX86Assembler::MakeByteRegisterAddress(CX86Assembler::rAX);
+	}
+
+	switch(statement.op)
+	{
+	case OP_SEXT8:
+		m_assembler.MovsxEb(dstRegister, srcAddress);
+		break;
+	case OP_SEXT16:
+		m_assembler.MovsxEw(dstRegister, srcAddress);
+		break;
+	case OP_ZEXT8:
+		m_assembler.MovzxEb(dstRegister, srcAddress);
+		break;
+	case OP_ZEXT16:
+		m_assembler.MovzxEw(dstRegister, srcAddress);
+		break;
+	default:
+		assert(false);
+		break;
+	}
+}
+
+void CCodeGen_x86::Emit_Ext_RegVar(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+
+	Emit_Ext(m_registers[dst->m_valueLow], statement);
+}
+
+void CCodeGen_x86::Emit_Ext_MemVar(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+
+	auto dstRegister = CX86Assembler::rAX;
+
+	Emit_Ext(dstRegister, statement);
+	m_assembler.MovGd(MakeMemorySymbolAddress(dst), dstRegister);
+}
+
+void CCodeGen_x86::Emit_ByteSwap_RegVar(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	auto dstRegister = m_registers[dst->m_valueLow];
+
+	m_assembler.MovEd(dstRegister, MakeVariableSymbolAddress(src1));
+	m_assembler.Bswap(dstRegister);
+}
+
+void CCodeGen_x86::Emit_ByteSwap_MemVar(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	auto dstRegister = CX86Assembler::rAX;
+
+	m_assembler.MovEd(dstRegister, MakeVariableSymbolAddress(src1));
+	m_assembler.Bswap(dstRegister);
+	m_assembler.MovGd(MakeMemorySymbolAddress(dst), dstRegister);
+}
+
+void CCodeGen_x86::Emit_PopCount(CX86Assembler::REGISTER dstRegister, const CX86Assembler::CAddress& srcAddress)
+{
+	//Parallel bit count, used when popcnt is not available
+	auto tmpRegister = CX86Assembler::rCX;
+	auto dstAddress = CX86Assembler::MakeRegisterAddress(dstRegister);
+	auto tmpAddress = CX86Assembler::MakeRegisterAddress(tmpRegister);
+
+	m_assembler.MovEd(dstRegister, srcAddress);
+
+	//x = x - ((x >> 1) & 0x55555555)
+	m_assembler.MovEd(tmpRegister, dstAddress);
+	m_assembler.ShrEd(tmpAddress, 1);
+	m_assembler.AndId(tmpAddress, 0x55555555);
+	m_assembler.SubEd(dstRegister, tmpAddress);
+
+	//x = (x & 0x33333333) + ((x >> 2) & 0x33333333)
+	m_assembler.MovEd(tmpRegister, dstAddress);
+	m_assembler.AndId(tmpAddress, 0x33333333);
+	m_assembler.ShrEd(dstAddress, 2);
+	m_assembler.AndId(dstAddress, 0x33333333);
+	m_assembler.AddEd(dstRegister, tmpAddress);
+
+	//x = (x + (x >> 4)) & 0x0F0F0F0F
+	m_assembler.MovEd(tmpRegister, dstAddress);
+	m_assembler.ShrEd(tmpAddress, 4);
+	m_assembler.AddEd(dstRegister, tmpAddress);
+	m_assembler.AndId(dstAddress, 0x0F0F0F0F);
+
+	//x = (x * 0x01010101) >> 24
+	m_assembler.MovEd(tmpRegister, dstAddress);
+	m_assembler.ShlEd(tmpAddress, 8);
+	m_assembler.AddEd(dstRegister, tmpAddress);
+	m_assembler.MovEd(tmpRegister, dstAddress);
+	m_assembler.ShlEd(tmpAddress, 16);
+	m_assembler.AddEd(dstRegister, tmpAddress);
+	m_assembler.ShrEd(dstAddress, 24);
+}
+
+void CCodeGen_x86::Emit_PopCount_RegVar(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	Emit_PopCount(m_registers[dst->m_valueLow], MakeVariableSymbolAddress(src1));
+}
+
+void CCodeGen_x86::Emit_PopCount_MemVar(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	auto dstRegister = CX86Assembler::rAX;
+
+	Emit_PopCount(dstRegister, MakeVariableSymbolAddress(src1));
+	m_assembler.MovGd(MakeMemorySymbolAddress(dst), dstRegister);
+}
+
+void CCodeGen_x86::Emit_PopCount_Popcnt_RegVar(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	m_assembler.PopcntEd(m_registers[dst->m_valueLow], MakeVariableSymbolAddress(src1));
+}
+
+void CCodeGen_x86::Emit_PopCount_Popcnt_MemVar(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	auto dstRegister = CX86Assembler::rAX;
+
+	m_assembler.PopcntEd(dstRegister, MakeVariableSymbolAddress(src1));
+	m_assembler.MovGd(MakeMemorySymbolAddress(dst), dstRegister);
+}
+
+void CCodeGen_x86::Emit_Ctz(CX86Assembler::REGISTER dstRegister, const CX86Assembler::CAddress& srcAddress)
+{
+	//bsf leaves the destination undefined when the source is 0
+	auto doneLabel = m_assembler.CreateLabel();
+
+	m_assembler.BsfEd(dstRegister, srcAddress);
+	m_assembler.JnzJx(doneLabel);
+	m_assembler.MovId(dstRegister, 32);
+
+	m_assembler.MarkLabel(doneLabel);
+}
+
+void CCodeGen_x86::Emit_Ctz_RegVar(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	Emit_Ctz(m_registers[dst->m_valueLow], MakeVariableSymbolAddress(src1));
+}
+
+void CCodeGen_x86::Emit_Ctz_MemVar(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	auto dstRegister = CX86Assembler::rAX;
+
+	Emit_Ctz(dstRegister, MakeVariableSymbolAddress(src1));
+	m_assembler.MovGd(MakeMemorySymbolAddress(dst), dstRegister);
+}
+
+void CCodeGen_x86::Emit_Ctz_Bmi1_RegVar(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	m_assembler.TzcntEd(m_registers[dst->m_valueLow], MakeVariableSymbolAddress(src1));
+}
+
+void CCodeGen_x86::Emit_Ctz_Bmi1_MemVar(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	auto dstRegister = CX86Assembler::rAX;
+
+	m_assembler.TzcntEd(dstRegister, MakeVariableSymbolAddress(src1));
+	m_assembler.MovGd(MakeMemorySymbolAddress(dst), dstRegister);
+}
+
 void CCodeGen_x86::Emit_Mov_RegReg(const STATEMENT& statement)
 {
 	auto dst = statement.dst->GetSymbol().get();
@@ -700,6 +1087,27 @@ void CCodeGen_x86::Emit_ExtHigh64MemTmp64(const STATEMENT& statement)
 	m_assembler.MovGd(MakeMemorySymbolAddress(dst), CX86Assembler::rAX);
 }
 
+void CCodeGen_x86::Emit_SignExtTo64_Mem64Var(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	m_assembler.MovEd(CX86Assembler::rAX, MakeVariableSymbolAddress(src1));
+	m_assembler.Cdq();
+	m_assembler.MovGd(MakeMemory64SymbolLoAddress(dst), CX86Assembler::rAX);
+	m_assembler.MovGd(MakeMemory64SymbolHiAddress(dst), CX86Assembler::rDX);
+}
+
+void CCodeGen_x86::Emit_ZeroExtTo64_Mem64Var(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	m_assembler.MovEd(CX86Assembler::rAX, MakeVariableSymbolAddress(src1));
+	m_assembler.MovGd(MakeMemory64SymbolLoAddress(dst), CX86Assembler::rAX);
+	m_assembler.MovId(MakeMemory64SymbolHiAddress(dst), 0);
+}
+
 void CCodeGen_x86::Cmp_GetFlag(const CX86Assembler::CAddress& dst, CONDITION flag)
 {
 	switch(flag)
@@ -1,4 +1,6 @@
 #include "Jitter_CodeGen_x86_32.h"
+#include "Jitter_CodeGen_x86_32_Div.h"
+#include "ObjectFile.h"
 #include <algorithm>
 
 using namespace Jitter;
@@ -47,7 +49,31 @@ CCodeGen_x86_32::CONSTMATCHER CCodeGen_x86_32::g_constMatchers[] =
 	{ OP_SUB64,			MATCH_MEMORY64,		MATCH_MEMORY64,		MATCH_CONSTANT64,	&CCodeGen_x86_32::Emit_Sub64_MemMemCst			},
 	{ OP_SUB64,			MATCH_MEMORY64,		MATCH_CONSTANT64,	MATCH_MEMORY64,		&CCodeGen_x86_32::Emit_Sub64_MemCstMem			},
 
-	{ OP_AND64,			MATCH_MEMORY64,		MATCH_MEMORY64,		MATCH_MEMORY64,		&CCodeGen_x86_32::Emit_And64_MemMemMem			},
+	{ OP_AND64,			MATCH_MEMORY64,		MATCH_MEMORY64,		MATCH_MEMORY64,		&CCodeGen_x86_32::Emit_Logic64_MemMemAny<ALUOP_AND>	},
+	{ OP_AND64,			MATCH_MEMORY64,		MATCH_MEMORY64,		MATCH_CONSTANT64,	&CCodeGen_x86_32::Emit_Logic64_MemMemAny<ALUOP_AND>	},
+	{ OP_AND64,			MATCH_MEMORY64,		MATCH_CONSTANT64,	MATCH_MEMORY64,		&CCodeGen_x86_32::Emit_Logic64_MemCstMem<ALUOP_AND>	},
+
+	{ OP_OR64,			MATCH_MEMORY64,		MATCH_MEMORY64,		MATCH_MEMORY64,		&CCodeGen_x86_32::Emit_Logic64_MemMemAny<ALUOP_OR>	},
+	{ OP_OR64,			MATCH_MEMORY64,		MATCH_MEMORY64,		MATCH_CONSTANT64,	&CCodeGen_x86_32::Emit_Logic64_MemMemAny<ALUOP_OR>	},
+	{ OP_OR64,			MATCH_MEMORY64,		MATCH_CONSTANT64,	MATCH_MEMORY64,		&CCodeGen_x86_32::Emit_Logic64_MemCstMem<ALUOP_OR>	},
+
+	{ OP_XOR64,			MATCH_MEMORY64,		MATCH_MEMORY64,		MATCH_MEMORY64,		&CCodeGen_x86_32::Emit_Logic64_MemMemAny<ALUOP_XOR>	},
+	{ OP_XOR64,			MATCH_MEMORY64,		MATCH_MEMORY64,		MATCH_CONSTANT64,	&CCodeGen_x86_32::Emit_Logic64_MemMemAny<ALUOP_XOR>	},
+	{ OP_XOR64,			MATCH_MEMORY64,		MATCH_CONSTANT64,	MATCH_MEMORY64,		&CCodeGen_x86_32::Emit_Logic64_MemCstMem<ALUOP_XOR>	},
+
+	{ OP_NOT64,			MATCH_MEMORY64,		MATCH_MEMORY64,		MATCH_NIL,			&CCodeGen_x86_32::Emit_Not64_MemMem				},
+
+	{ OP_MUL64,			MATCH_MEMORY64,		MATCH_MEMORY64,		MATCH_MEMORY64,		&CCodeGen_x86_32::Emit_Mul64_MemMemAny			},
+	{ OP_MUL64,			MATCH_MEMORY64,		MATCH_MEMORY64,		MATCH_CONSTANT64,	&CCodeGen_x86_32::Emit_Mul64_MemMemAny			},
+	{ OP_MUL64,			MATCH_MEMORY64,		MATCH_CONSTANT64,	MATCH_MEMORY64,		&CCodeGen_x86_32::Emit_Mul64_MemCstMem			},
+
+	{ OP_DIV64,			MATCH_MEMORY64,		MATCH_MEMORY64,		MATCH_MEMORY64,		&CCodeGen_x86_32::Emit_Div64_MemAnyAny<false>	},
+	{ OP_DIV64,			MATCH_MEMORY64,		MATCH_MEMORY64,		MATCH_CONSTANT64,	&CCodeGen_x86_32::Emit_Div64_MemAnyAny<false>	},
+	{ OP_DIV64,			MATCH_MEMORY64,		MATCH_CONSTANT64,	MATCH_MEMORY64,		&CCodeGen_x86_32::Emit_Div64_MemAnyAny<false>	},
+
+	{ OP_DIVS64,		MATCH_MEMORY64,		MATCH_MEMORY64,		MATCH_MEMORY64,		&CCodeGen_x86_32::Emit_Div64_MemAnyAny<true>	},
+	{ OP_DIVS64,		MATCH_MEMORY64,		MATCH_MEMORY64,		MATCH_CONSTANT64,	&CCodeGen_x86_32::Emit_Div64_MemAnyAny<true>	},
+	{ OP_DIVS64,		MATCH_MEMORY64,		MATCH_CONSTANT64,	MATCH_MEMORY64,		&CCodeGen_x86_32::Emit_Div64_MemAnyAny<true>	},
 
 	{ OP_SRL64,			MATCH_MEMORY64,		MATCH_MEMORY64,		MATCH_REGISTER,		&CCodeGen_x86_32::Emit_Srl64_MemMemReg			},
 	{ OP_SRL64,			MATCH_MEMORY64,		MATCH_MEMORY64,		MATCH_MEMORY,		&CCodeGen_x86_32::Emit_Srl64_MemMemMem			},
@@ -61,6 +87,10 @@ CCodeGen_x86_32::CONSTMATCHER CCodeGen_x86_32::g_constMatchers[] =
 	{ OP_SLL64,			MATCH_MEMORY64,		MATCH_MEMORY64,		MATCH_MEMORY,		&CCodeGen_x86_32::Emit_Sll64_MemMemMem			},
 	{ OP_SLL64,			MATCH_MEMORY64,		MATCH_MEMORY64,		MATCH_CONSTANT,		&CCodeGen_x86_32::Emit_Sll64_MemMemCst			},
 
+	{ OP_ROR64,			MATCH_MEMORY64,		MATCH_MEMORY64,		MATCH_REGISTER,		&CCodeGen_x86_32::Emit_Ror64_MemMemReg			},
+	{ OP_ROR64,			MATCH_MEMORY64,		MATCH_MEMORY64,		MATCH_MEMORY,		&CCodeGen_x86_32::Emit_Ror64_MemMemMem			},
+	{ OP_ROR64,			MATCH_MEMORY64,		MATCH_MEMORY64,		MATCH_CONSTANT,		&CCodeGen_x86_32::Emit_Ror64_MemMemCst			},
+
 	{ OP_CMP64,			MATCH_REGISTER,		MATCH_RELATIVE64,	MATCH_RELATIVE64,	&CCodeGen_x86_32::Emit_Cmp64_RegRelRel			},
 	{ OP_CMP64,			MATCH_RELATIVE,		MATCH_RELATIVE64,	MATCH_RELATIVE64,	&CCodeGen_x86_32::Emit_Cmp64_RelRelRel			},
 	{ OP_CMP64,			MATCH_REGISTER,		MATCH_RELATIVE64,	MATCH_CONSTANT64,	&CCodeGen_x86_32::Emit_Cmp64_RegRelCst			},
@@ -78,12 +108,34 @@ CCodeGen_x86_32::CONSTMATCHER CCodeGen_x86_32::g_constMatchers[] =
 	{ OP_LOADFROMREF,	MATCH_MEMORY,		MATCH_TMP_REF,		MATCH_NIL,			&CCodeGen_x86_32::Emit_LoadFromRef_MemTmp		},
 	{ OP_LOADFROMREF,	MATCH_REGISTER128,	MATCH_MEM_REF,		MATCH_NIL,			&CCodeGen_x86_32::Emit_LoadFromRef_Md_RegMem	},
 	{ OP_LOADFROMREF,	MATCH_MEMORY128,	MATCH_MEM_REF,		MATCH_NIL,			&CCodeGen_x86_32::Emit_LoadFromRef_Md_MemMem	},
+	{ OP_LOADFROMREF,	MATCH_MEMORY64,		MATCH_MEM_REF,		MATCH_NIL,			&CCodeGen_x86_32::Emit_LoadFromRef_64_MemMem	},
+
+	{ OP_LOAD8FROMREF,		MATCH_VARIABLE,	MATCH_MEM_REF,		MATCH_NIL,			&CCodeGen_x86_32::Emit_LoadSizedFromRef_VarMem	},
+	{ OP_LOAD8SFROMREF,		MATCH_VARIABLE,	MATCH_MEM_REF,		MATCH_NIL,			&CCodeGen_x86_32::Emit_LoadSizedFromRef_VarMem	},
+	{ OP_LOAD16FROMREF,		MATCH_VARIABLE,	MATCH_MEM_REF,		MATCH_NIL,			&CCodeGen_x86_32::Emit_LoadSizedFromRef_VarMem	},
+	{ OP_LOAD16SFROMREF,	MATCH_VARIABLE,	MATCH_MEM_REF,		MATCH_NIL,			&CCodeGen_x86_32::Emit_LoadSizedFromRef_VarMem	},
 
 	{ OP_STOREATREF,	MATCH_NIL,			MATCH_TMP_REF,		MATCH_REGISTER,		&CCodeGen_x86_32::Emit_StoreAtRef_TmpReg		},
 	{ OP_STOREATREF,	MATCH_NIL,			MATCH_TMP_REF,		MATCH_MEMORY,		&CCodeGen_x86_32::Emit_StoreAtRef_TmpMem		},
 	{ OP_STOREATREF,	MATCH_NIL,			MATCH_TMP_REF,		MATCH_CONSTANT,		&CCodeGen_x86_32::Emit_StoreAtRef_TmpCst		},
 	{ OP_STOREATREF,	MATCH_NIL,			MATCH_MEM_REF,		MATCH_REGISTER128,	&CCodeGen_x86_32::Emit_StoreAtRef_Md_MemReg		},
 	{ OP_STOREATREF,	MATCH_NIL,			MATCH_MEM_REF,		MATCH_MEMORY128,	&CCodeGen_x86_32::Emit_StoreAtRef_Md_MemMem		},
+	{ OP_STOREATREF,	MATCH_NIL,			MATCH_MEM_REF,		MATCH_MEMORY64,		&CCodeGen_x86_32::Emit_StoreAtRef_64_MemMem		},
+	{ OP_STOREATREF,	MATCH_NIL,			MATCH_MEM_REF,		MATCH_CONSTANT64,	&CCodeGen_x86_32::Emit_StoreAtRef_64_MemCst		},
+
+	{ OP_STORE8ATREF,	MATCH_NIL,			MATCH_MEM_REF,		MATCH_VARIABLE,		&CCodeGen_x86_32::Emit_StoreSizedAtRef_MemVar	},
+	{ OP_STORE8ATREF,	MATCH_NIL,			MATCH_MEM_REF,		MATCH_CONSTANT,		&CCodeGen_x86_32::Emit_StoreSizedAtRef_MemCst	},
+	{ OP_STORE16ATREF,	MATCH_NIL,			MATCH_MEM_REF,		MATCH_VARIABLE,		&CCodeGen_x86_32::Emit_StoreSizedAtRef_MemVar	},
+	{ OP_STORE16ATREF,	MATCH_NIL,			MATCH_MEM_REF,		MATCH_CONSTANT,		&CCodeGen_x86_32::Emit_StoreSizedAtRef_MemCst	},
+
+	{ OP_LOADFROMTLB,	MATCH_VARIABLE,		MATCH_VARIABLE,		MATCH_CONSTANTPTR,	&CCodeGen_x86_32::Emit_LoadFromTlb_VarVar		},
+	{ OP_LOADFROMTLB,	MATCH_VARIABLE,		MATCH_CONSTANT,		MATCH_CONSTANTPTR,	&CCodeGen_x86_32::Emit_LoadFromTlb_VarCst		},
+
+	{ OP_FP_TOINT64_TRUNC,	MATCH_MEMORY64,	MATCH_MEMORY_FP_SINGLE,	MATCH_NIL,		&CCodeGen_x86_32::Emit_Fp_ToInt64Trunc_Mem64MemS			},
+	{ OP_FP_TOINT64_TRUNC,	MATCH_MEMORY64,	MATCH_MEMORY_FP_DOUBLE,	MATCH_NIL,		&CCodeGen_x86_32::Emit_Fp_ToInt64Trunc_Mem64MemD			},
+	{ OP_FP_FROMINT64,		MATCH_MEMORY_FP_DOUBLE,	MATCH_MEMORY64,	MATCH_NIL,		&CCodeGen_x86_32::Emit_Fp_FromInt64_MemDMem64				},
+
+	{ OP_INCCOUNTER,	MATCH_NIL,			MATCH_CONSTANTPTR,	MATCH_NIL,			&CCodeGen_x86_32::Emit_IncCounter				},
 
 	{ OP_MOV,			MATCH_NIL,			MATCH_NIL,			MATCH_NIL,			NULL											},
 };
@@ -255,6 +307,29 @@ bool CCodeGen_x86_32::CanHold128BitsReturnValueInRegisters() const
 	return false;
 }
 
+bool CCodeGen_x86_32::CanHandle256BitsMdOperations() const
+{
+	return m_hasAvx2;
+}
+
+std::string CCodeGen_x86_32::GetConfigurationName() const
+{
+	std::string name = "x86_32";
+	if(m_implicitRetValueParamFixUpRequired) name += "-retvaluefixup";
+	if(m_hasSse41) name += "+sse41";
+	if(m_hasFma) name += "+fma";
+	if(m_hasPopcnt) name += "+popcnt";
+	if(m_hasBmi1) name += "+bmi1";
+	if(m_hasAvx2) name += "+avx2";
+	return name;
+}
+
+void CCodeGen_x86_32::RegisterExternalSymbols(CObjectFile* objectFile) const
+{
+	objectFile->AddExternalSymbol("_CodeGen_x86_32_div64_unsigned",	reinterpret_cast<uintptr_t>(&CodeGen_x86_32_div64_unsigned));
+	objectFile->AddExternalSymbol("_CodeGen_x86_32_div64_signed",	reinterpret_cast<uintptr_t>(&CodeGen_x86_32_div64_signed));
+}
+
 void CCodeGen_x86_32::Emit_Param_Ctx(const STATEMENT& statement)
 {
 	m_params.push_back(
@@ -535,22 +610,181 @@ void CCodeGen_x86_32::Emit_Sub64_MemCstMem(const STATEMENT& statement)
 	m_assembler.MovGd(MakeMemory64SymbolHiAddress(dst), CX86Assembler::rDX);
 }
 
-void CCodeGen_x86_32::Emit_And64_MemMemMem(const STATEMENT& statement)
+//Logic operations are commutative, constants are always used as the second operand
+template <typename ALUOP>
+void CCodeGen_x86_32::Logic64_MemAny(CSymbol* dst, CSymbol* src1, CSymbol* src2)
+{
+	m_assembler.MovEd(CX86Assembler::rAX, MakeMemory64SymbolLoAddress(src1));
+	m_assembler.MovEd(CX86Assembler::rDX, MakeMemory64SymbolHiAddress(src1));
+
+	if(src2->m_type == SYM_CONSTANT64)
+	{
+		((m_assembler).*(ALUOP::OpId()))(CX86Assembler::MakeRegisterAddress(CX86Assembler::rAX), src2->m_valueLow);
+		((m_assembler).*(ALUOP::OpId()))(CX86Assembler::MakeRegisterAddress(CX86Assembler::rDX), src2->m_valueHigh);
+	}
+	else
+	{
+		((m_assembler).*(ALUOP::OpEd()))(CX86Assembler::rAX, MakeMemory64SymbolLoAddress(src2));
+		((m_assembler).*(ALUOP::OpEd()))(CX86Assembler::rDX, MakeMemory64SymbolHiAddress(src2));
+	}
+
+	m_assembler.MovGd(MakeMemory64SymbolLoAddress(dst), CX86Assembler::rAX);
+	m_assembler.MovGd(MakeMemory64SymbolHiAddress(dst), CX86Assembler::rDX);
+}
+
+template <typename ALUOP>
+void CCodeGen_x86_32::Emit_Logic64_MemMemAny(const STATEMENT& statement)
 {
 	auto dst = statement.dst->GetSymbol().get();
 	auto src1 = statement.src1->GetSymbol().get();
 	auto src2 = statement.src2->GetSymbol().get();
 
+	Logic64_MemAny<ALUOP>(dst, src1, src2);
+}
+
+template <typename ALUOP>
+void CCodeGen_x86_32::Emit_Logic64_MemCstMem(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	assert(src1->m_type == SYM_CONSTANT64);
+
+	Logic64_MemAny<ALUOP>(dst, src2, src1);
+}
+
+//---------------------------------------------------------------------------------
+//NOT64
+//---------------------------------------------------------------------------------
+
+void CCodeGen_x86_32::Emit_Not64_MemMem(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
 	m_assembler.MovEd(CX86Assembler::rAX, MakeMemory64SymbolLoAddress(src1));
 	m_assembler.MovEd(CX86Assembler::rDX, MakeMemory64SymbolHiAddress(src1));
 
-	m_assembler.AndEd(CX86Assembler::rAX, MakeMemory64SymbolLoAddress(src2));
-	m_assembler.AndEd(CX86Assembler::rDX, MakeMemory64SymbolHiAddress(src2));
+	m_assembler.NotEd(CX86Assembler::MakeRegisterAddress(CX86Assembler::rAX));
+	m_assembler.NotEd(CX86Assembler::MakeRegisterAddress(CX86Assembler::rDX));
 
 	m_assembler.MovGd(MakeMemory64SymbolLoAddress(dst), CX86Assembler::rAX);
 	m_assembler.MovGd(MakeMemory64SymbolHiAddress(dst), CX86Assembler::rDX);
 }
 
+//---------------------------------------------------------------------------------
+//MUL64
+//---------------------------------------------------------------------------------
+
+//Low 64 bits of the product: (lo1 * lo2) + ((lo1 * hi2 + hi1 * lo2) << 32)
+void CCodeGen_x86_32::Mul64_MemAny(CSymbol* dst, CSymbol* src1, CSymbol* src2)
+{
+	auto loadSrc2 =
+		[&] (CX86Assembler::REGISTER registerId, bool high)
+		{
+			if(src2->m_type == SYM_CONSTANT64)
+			{
+				m_assembler.MovId(registerId, high ? src2->m_valueHigh : src2->m_valueLow);
+			}
+			else
+			{
+				m_assembler.MovEd(registerId, high ? MakeMemory64SymbolHiAddress(src2) : MakeMemory64SymbolLoAddress(src2));
+			}
+		};
+
+	loadSrc2(CX86Assembler::rCX, true);
+	m_assembler.ImulEd(CX86Assembler::rCX, MakeMemory64SymbolLoAddress(src1));
+	loadSrc2(CX86Assembler::rAX, false);
+	m_assembler.ImulEd(CX86Assembler::rAX, MakeMemory64SymbolHiAddress(src1));
+	m_assembler.AddEd(CX86Assembler::rCX, CX86Assembler::MakeRegisterAddress(CX86Assembler::rAX));
+
+	loadSrc2(CX86Assembler::rAX, false);
+	m_assembler.MulEd(MakeMemory64SymbolLoAddress(src1));
+	m_assembler.AddEd(CX86Assembler::rDX, CX86Assembler::MakeRegisterAddress(CX86Assembler::rCX));
+
+	m_assembler.MovGd(MakeMemory64SymbolLoAddress(dst), CX86Assembler::rAX);
+	m_assembler.MovGd(MakeMemory64SymbolHiAddress(dst), CX86Assembler::rDX);
+}
+
+void CCodeGen_x86_32::Emit_Mul64_MemMemAny(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	Mul64_MemAny(dst, src1, src2);
+}
+
+void CCodeGen_x86_32::Emit_Mul64_MemCstMem(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	assert(src1->m_type == SYM_CONSTANT64);
+
+	Mul64_MemAny(dst, src2, src1);
+}
+
+//---------------------------------------------------------------------------------
+//DIV64
+//---------------------------------------------------------------------------------
+
+//There is no 64-bit divide instruction on x86-32, call a helper instead
+template <bool isSigned>
+void CCodeGen_x86_32::Emit_Div64_MemAnyAny(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	auto divFct = isSigned ?
+		reinterpret_cast<uintptr_t>(&CodeGen_x86_32_div64_signed) : reinterpret_cast<uintptr_t>(&CodeGen_x86_32_div64_unsigned);
+
+	//MD registers are caller saved, keep the ones we use alive across the call
+	uint32 frameSize = 0x10 + GetSavedMdRegistersSize();
+
+	m_assembler.SubId(CX86Assembler::MakeRegisterAddress(CX86Assembler::rSP), frameSize);
+	m_stackLevel += frameSize;
+
+	auto storeParam =
+		[&] (CSymbol* symbol, uint32 paramOffset)
+		{
+			if(symbol->m_type == SYM_CONSTANT64)
+			{
+				m_assembler.MovId(CX86Assembler::MakeIndRegOffAddress(CX86Assembler::rSP, paramOffset + 0), symbol->m_valueLow);
+				m_assembler.MovId(CX86Assembler::MakeIndRegOffAddress(CX86Assembler::rSP, paramOffset + 4), symbol->m_valueHigh);
+			}
+			else
+			{
+				m_assembler.MovEd(CX86Assembler::rAX, MakeMemory64SymbolLoAddress(symbol));
+				m_assembler.MovEd(CX86Assembler::rDX, MakeMemory64SymbolHiAddress(symbol));
+				m_assembler.MovGd(CX86Assembler::MakeIndRegOffAddress(CX86Assembler::rSP, paramOffset + 0), CX86Assembler::rAX);
+				m_assembler.MovGd(CX86Assembler::MakeIndRegOffAddress(CX86Assembler::rSP, paramOffset + 4), CX86Assembler::rDX);
+			}
+		};
+
+	storeParam(src1, 0);
+	storeParam(src2, 8);
+
+	SaveMdRegisters(0x10);
+
+	m_assembler.MovId(CX86Assembler::rAX, static_cast<uint32>(divFct));
+	auto symbolRefLabel = m_assembler.CreateLabel();
+	m_assembler.MarkLabel(symbolRefLabel, -4);
+	m_symbolReferenceLabels.push_back(std::make_pair(divFct, symbolRefLabel));
+	m_assembler.CallEd(CX86Assembler::MakeRegisterAddress(CX86Assembler::rAX));
+
+	RestoreMdRegisters(0x10);
+
+	m_assembler.MovGd(MakeMemory64SymbolLoAddress(dst), CX86Assembler::rAX);
+	m_assembler.MovGd(MakeMemory64SymbolHiAddress(dst), CX86Assembler::rDX);
+
+	m_stackLevel -= frameSize;
+	m_assembler.AddId(CX86Assembler::MakeRegisterAddress(CX86Assembler::rSP), frameSize);
+}
+
 //---------------------------------------------------------------------------------
 //SR64
 //---------------------------------------------------------------------------------
@@ -879,6 +1113,109 @@ void CCodeGen_x86_32::Emit_Sll64_MemMemCst(const STATEMENT& statement)
 	m_assembler.MovGd(MakeMemory64SymbolHiAddress(dst), regHi);
 }
 
+//---------------------------------------------------------------------------------
+//ROR64
+//---------------------------------------------------------------------------------
+
+void CCodeGen_x86_32::Emit_Ror64_MemMemVar(const STATEMENT& statement, CX86Assembler::REGISTER shiftRegister)
+{
+	CSymbol* dst = statement.dst->GetSymbol().get();
+	CSymbol* src1 = statement.src1->GetSymbol().get();
+
+	CX86Assembler::LABEL swapLabel = m_assembler.CreateLabel();
+	CX86Assembler::LABEL loadedLabel = m_assembler.CreateLabel();
+
+	CX86Assembler::REGISTER amountReg = CX86Assembler::rCX;
+	CX86Assembler::REGISTER regLo = CX86Assembler::rAX;
+	CX86Assembler::REGISTER regHi = CX86Assembler::rDX;
+
+	if(shiftRegister != amountReg)
+	{
+		m_assembler.MovEd(amountReg, CX86Assembler::MakeRegisterAddress(shiftRegister));
+	}
+
+	//Rotating by 32 or more swaps both halves, shrd takes care of the rest of the amount
+	m_assembler.MovEd(regLo, CX86Assembler::MakeRegisterAddress(amountReg));
+	m_assembler.AndId(CX86Assembler::MakeRegisterAddress(regLo), 0x20);
+	m_assembler.JnzJx(swapLabel);
+
+	m_assembler.MovEd(regLo, MakeMemory64SymbolLoAddress(src1));
+	m_assembler.MovEd(regHi, MakeMemory64SymbolHiAddress(src1));
+	m_assembler.JmpJx(loadedLabel);
+
+//$swap
+	m_assembler.MarkLabel(swapLabel);
+
+	m_assembler.MovEd(regLo, MakeMemory64SymbolHiAddress(src1));
+	m_assembler.MovEd(regHi, MakeMemory64SymbolLoAddress(src1));
+
+//$loaded
+	m_assembler.MarkLabel(loadedLabel);
+
+	m_assembler.MovGd(MakeMemory64SymbolLoAddress(dst), regLo);
+	m_assembler.MovGd(MakeMemory64SymbolHiAddress(dst), regHi);
+
+	m_assembler.ShrdEd(MakeMemory64SymbolLoAddress(dst), regHi);
+	m_assembler.ShrdEd(MakeMemory64SymbolHiAddress(dst), regLo);
+}
+
+void CCodeGen_x86_32::Emit_Ror64_MemMemReg(const STATEMENT& statement)
+{
+	CSymbol* src2 = statement.src2->GetSymbol().get();
+
+	assert(src2->m_type == SYM_REGISTER);
+
+	Emit_Ror64_MemMemVar(statement, g_registers[src2->m_valueLow]);
+}
+
+void CCodeGen_x86_32::Emit_Ror64_MemMemMem(const STATEMENT& statement)
+{
+	CSymbol* src2 = statement.src2->GetSymbol().get();
+
+	CX86Assembler::REGISTER shiftAmount = CX86Assembler::rCX;
+
+	m_assembler.MovEd(shiftAmount, MakeMemorySymbolAddress(src2));
+
+	Emit_Ror64_MemMemVar(statement, shiftAmount);
+}
+
+void CCodeGen_x86_32::Emit_Ror64_MemMemCst(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	assert(src2->m_type == SYM_CONSTANT);
+
+	uint8 shiftAmount = static_cast<uint8>(src2->m_valueLow & 0x3F);
+
+	auto regLo = CX86Assembler::rAX;
+	auto regHi = CX86Assembler::rDX;
+	auto regTmp = CX86Assembler::rCX;
+
+	if(shiftAmount >= 32)
+	{
+		m_assembler.MovEd(regLo, MakeMemory64SymbolHiAddress(src1));
+		m_assembler.MovEd(regHi, MakeMemory64SymbolLoAddress(src1));
+	}
+	else
+	{
+		m_assembler.MovEd(regLo, MakeMemory64SymbolLoAddress(src1));
+		m_assembler.MovEd(regHi, MakeMemory64SymbolHiAddress(src1));
+	}
+
+	shiftAmount &= 0x1F;
+	if(shiftAmount != 0)
+	{
+		m_assembler.MovEd(regTmp, CX86Assembler::MakeRegisterAddress(regLo));
+		m_assembler.ShrdEd(CX86Assembler::MakeRegisterAddress(regLo), regHi, shiftAmount);
+		m_assembler.ShrdEd(CX86Assembler::MakeRegisterAddress(regHi), regTmp, shiftAmount);
+	}
+
+	m_assembler.MovGd(MakeMemory64SymbolLoAddress(dst), regLo);
+	m_assembler.MovGd(MakeMemory64SymbolHiAddress(dst), regHi);
+}
+
 //---------------------------------------------------------------------------------
 //CMP64
 //---------------------------------------------------------------------------------
@@ -1325,6 +1662,56 @@ void CCodeGen_x86_32::Emit_LoadFromRef_Md_MemMem(const STATEMENT& statement)
 	m_assembler.MovapsVo(MakeMemory128SymbolAddress(dst), valueReg);
 }
 
+void CCodeGen_x86_32::Emit_LoadFromRef_64_MemMem(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	auto addressReg = CX86Assembler::rAX;
+	auto valueReg = CX86Assembler::rDX;
+
+	m_assembler.MovEd(addressReg, MakeMemoryReferenceSymbolAddress(src1));
+	m_assembler.MovEd(valueReg, CX86Assembler::MakeIndRegAddress(addressReg));
+	m_assembler.MovGd(MakeMemory64SymbolLoAddress(dst), valueReg);
+	m_assembler.MovEd(valueReg, CX86Assembler::MakeIndRegOffAddress(addressReg, 4));
+	m_assembler.MovGd(MakeMemory64SymbolHiAddress(dst), valueReg);
+}
+
+void CCodeGen_x86_32::Emit_LoadSizedFromRef_VarMem(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	auto addressReg = CX86Assembler::rAX;
+	auto valueReg = (dst->m_type == SYM_REGISTER) ? m_registers[dst->m_valueLow] : CX86Assembler::rDX;
+
+	m_assembler.MovEd(addressReg, MakeMemoryReferenceSymbolAddress(src1));
+	auto valueAddress = CX86Assembler::MakeIndRegAddress(addressReg);
+	switch(statement.op)
+	{
+	case OP_LOAD8FROMREF:
+		m_assembler.MovzxEb(valueReg, valueAddress);
+		break;
+	case OP_LOAD8SFROMREF:
+		m_assembler.MovsxEb(valueReg, valueAddress);
+		break;
+	case OP_LOAD16FROMREF:
+		m_assembler.MovzxEw(valueReg, valueAddress);
+		break;
+	case OP_LOAD16SFROMREF:
+		m_assembler.MovsxEw(valueReg, valueAddress);
+		break;
+	default:
+		assert(false);
+		break;
+	}
+
+	if(dst->m_type != SYM_REGISTER)
+	{
+		m_assembler.MovGd(MakeMemorySymbolAddress(dst), valueReg);
+	}
+}
+
 void CCodeGen_x86_32::Emit_StoreAtRef_TmpReg(const STATEMENT& statement)
 {
 	CSymbol* src1 = statement.src1->GetSymbol().get();
@@ -1390,3 +1777,224 @@ void CCodeGen_x86_32::Emit_StoreAtRef_Md_MemMem(const STATEMENT& statement)
 	m_assembler.MovapsVo(valueReg, MakeMemory128SymbolAddress(src2));
 	m_assembler.MovapsVo(CX86Assembler::MakeIndRegAddress(addressReg), valueReg);
 }
+
+void CCodeGen_x86_32::Emit_StoreAtRef_64_MemMem(const STATEMENT& statement)
+{
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	auto addressReg = CX86Assembler::rAX;
+	auto valueReg = CX86Assembler::rDX;
+
+	m_assembler.MovEd(addressReg, MakeMemoryReferenceSymbolAddress(src1));
+	m_assembler.MovEd(valueReg, MakeMemory64SymbolLoAddress(src2));
+	m_assembler.MovGd(CX86Assembler::MakeIndRegAddress(addressReg), valueReg);
+	m_assembler.MovEd(valueReg, MakeMemory64SymbolHiAddress(src2));
+	m_assembler.MovGd(CX86Assembler::MakeIndRegOffAddress(addressReg, 4), valueReg);
+}
+
+void CCodeGen_x86_32::Emit_StoreAtRef_64_MemCst(const STATEMENT& statement)
+{
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	assert(src2->m_type == SYM_CONSTANT64);
+
+	auto addressReg = CX86Assembler::rAX;
+
+	m_assembler.MovEd(addressReg, MakeMemoryReferenceSymbolAddress(src1));
+	m_assembler.MovId(CX86Assembler::MakeIndRegAddress(addressReg), src2->m_valueLow);
+	m_assembler.MovId(CX86Assembler::MakeIndRegOffAddress(addressReg, 4), src2->m_valueHigh);
+}
+
+void CCodeGen_x86_32::Emit_StoreSizedAtRef_MemVar(const STATEMENT& statement)
+{
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	//Value goes through rDX since allocated registers might not have a byte form
+	auto addressReg = CX86Assembler::rAX;
+	auto valueReg = CX86Assembler::rDX;
+
+	m_assembler.MovEd(addressReg, MakeMemoryReferenceSymbolAddress(src1));
+	m_assembler.MovEd(valueReg, MakeVariableSymbolAddress(src2));
+	switch(statement.op)
+	{
+	case OP_STORE8ATREF:
+		m_assembler.MovGb(CX86Assembler::MakeIndRegAddress(addressReg), valueReg);
+		break;
+	case OP_STORE16ATREF:
+		m_assembler.MovGw(CX86Assembler::MakeIndRegAddress(addressReg), valueReg);
+		break;
+	default:
+		assert(false);
+		break;
+	}
+}
+
+void CCodeGen_x86_32::Emit_StoreSizedAtRef_MemCst(const STATEMENT& statement)
+{
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	assert(src2->m_type == SYM_CONSTANT);
+
+	auto addressReg = CX86Assembler::rAX;
+
+	m_assembler.MovEd(addressReg, MakeMemoryReferenceSymbolAddress(src1));
+	switch(statement.op)
+	{
+	case OP_STORE8ATREF:
+		m_assembler.MovIb(CX86Assembler::MakeIndRegAddress(addressReg), static_cast<uint8>(src2->m_valueLow));
+		break;
+	case OP_STORE16ATREF:
+		m_assembler.MovIw(CX86Assembler::MakeIndRegAddress(addressReg), static_cast<uint16>(src2->m_valueLow));
+		break;
+	default:
+		assert(false);
+		break;
+	}
+}
+
+void CCodeGen_x86_32::LoadFromTlb(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+	auto src3 = statement.src3->GetSymbol().get();
+
+	assert(src2->m_type == SYM_CONSTANTPTR);
+	assert(src3->m_type == SYM_CONSTANT64);
+
+	uint32 tableOffset = src3->m_valueLow;
+	uint8 pageShift = static_cast<uint8>(src3->m_valueHigh);
+	uintptr_t missHandler = src2->GetConstantPtr();
+
+	//Address is expected to be in rAX
+	auto addressReg = CX86Assembler::rAX;
+	auto pageReg = CX86Assembler::rCX;
+	auto entryReg = CX86Assembler::rDX;
+
+	auto missLabel = m_assembler.CreateLabel();
+	auto doneLabel = m_assembler.CreateLabel();
+
+	m_assembler.MovEd(pageReg, CX86Assembler::MakeRegisterAddress(addressReg));
+	m_assembler.ShrEd(CX86Assembler::MakeRegisterAddress(pageReg), pageShift);
+	m_assembler.MovEd(entryReg, CX86Assembler::MakeIndRegOffAddress(CX86Assembler::rBP, tableOffset));
+	m_assembler.MovEd(entryReg, CX86Assembler::MakeBaseIndexScaleAddress(entryReg, pageReg, 4));
+	m_assembler.TestEd(entryReg, CX86Assembler::MakeRegisterAddress(entryReg));
+	m_assembler.JzJx(missLabel);
+
+	m_assembler.AndId(CX86Assembler::MakeRegisterAddress(addressReg), (1 << pageShift) - 1);
+	m_assembler.MovEd(addressReg, CX86Assembler::MakeBaseIndexScaleAddress(entryReg, addressReg, 1));
+
+	m_assembler.MarkLabel(doneLabel);
+	m_assembler.MovGd(MakeVariableSymbolAddress(dst), addressReg);
+
+	m_coldPathEmitters.push_back(
+		[this, addressReg, missLabel, doneLabel, missHandler] ()
+		{
+			//MD registers are caller saved, keep the ones we use alive across the call
+			uint32 frameSize = 0x10 + GetSavedMdRegistersSize();
+
+			m_assembler.MarkLabel(missLabel);
+			m_assembler.SubId(CX86Assembler::MakeRegisterAddress(CX86Assembler::rSP), frameSize);
+			m_assembler.MovGd(CX86Assembler::MakeIndRegOffAddress(CX86Assembler::rSP, 0), CX86Assembler::rBP);
+			m_assembler.MovGd(CX86Assembler::MakeIndRegOffAddress(CX86Assembler::rSP, 4), addressReg);
+
+			SaveMdRegisters(0x10);
+
+			m_assembler.MovId(CX86Assembler::rAX, static_cast<uint32>(missHandler));
+			auto symbolRefLabel = m_assembler.CreateLabel();
+			m_assembler.MarkLabel(symbolRefLabel, -4);
+			m_symbolReferenceLabels.push_back(std::make_pair(missHandler, symbolRefLabel));
+			m_assembler.CallEd(CX86Assembler::MakeRegisterAddress(CX86Assembler::rAX));
+
+			RestoreMdRegisters(0x10);
+
+			m_assembler.AddId(CX86Assembler::MakeRegisterAddress(CX86Assembler::rSP), frameSize);
+			m_assembler.JmpJx(doneLabel);
+		}
+	);
+}
+
+void CCodeGen_x86_32::Emit_LoadFromTlb_VarVar(const STATEMENT& statement)
+{
+	auto src1 = statement.src1->GetSymbol().get();
+
+	m_assembler.MovEd(CX86Assembler::rAX, MakeVariableSymbolAddress(src1));
+	LoadFromTlb(statement);
+}
+
+void CCodeGen_x86_32::Emit_LoadFromTlb_VarCst(const STATEMENT& statement)
+{
+	auto src1 = statement.src1->GetSymbol().get();
+
+	assert(src1->m_type == SYM_CONSTANT);
+
+	m_assembler.MovId(CX86Assembler::rAX, src1->m_valueLow);
+	LoadFromTlb(statement);
+}
+
+void CCodeGen_x86_32::Emit_IncCounter(const STATEMENT& statement)
+{
+	auto src1 = statement.src1->GetSymbol().get();
+
+	m_assembler.MovId(CX86Assembler::rAX, static_cast<uint32>(src1->GetConstantPtr()));
+	m_assembler.AddId(CX86Assembler::MakeIndRegAddress(CX86Assembler::rAX), 1);
+}
+
+//There are no SSE instructions dealing with 64-bit integers on 32-bit hosts, go through the x87 FPU
+//Pops ST(0) into dst, truncating it
+void CCodeGen_x86_32::Fp_StoreInt64Trunc(CSymbol* dst)
+{
+	if(m_hasSse3)
+	{
+		m_assembler.FisttpEq(MakeMemory64SymbolAddress(dst));
+		return;
+	}
+
+	//No FISTTP (SSE3), switch the FPU to truncation while storing: control word is saved
+	//at [esp] and the truncating one is built at [esp + 2]. Keep temporaries 8 bytes aligned.
+	auto savedControlWordAddress = CX86Assembler::MakeIndRegAddress(CX86Assembler::rSP);
+	auto truncControlWordAddress = CX86Assembler::MakeIndRegOffAddress(CX86Assembler::rSP, 2);
+	m_assembler.SubId(CX86Assembler::MakeRegisterAddress(CX86Assembler::rSP), 8);
+	m_stackLevel += 8;
+
+	m_assembler.FnstcwEw(savedControlWordAddress);
+	m_assembler.MovzxEw(CX86Assembler::rAX, savedControlWordAddress);
+	m_assembler.OrId(CX86Assembler::MakeRegisterAddress(CX86Assembler::rAX), 0x0C00);
+	m_assembler.MovGw(truncControlWordAddress, CX86Assembler::rAX);
+	m_assembler.FldcwEw(truncControlWordAddress);
+	m_assembler.FistpEq(MakeMemory64SymbolAddress(dst));
+	m_assembler.FldcwEw(savedControlWordAddress);
+
+	m_assembler.AddId(CX86Assembler::MakeRegisterAddress(CX86Assembler::rSP), 8);
+	m_stackLevel -= 8;
+}
+
+void CCodeGen_x86_32::Emit_Fp_ToInt64Trunc_Mem64MemS(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	m_assembler.FldEd(MakeMemoryFpSingleSymbolAddress(src1));
+	Fp_StoreInt64Trunc(dst);
+}
+
+void CCodeGen_x86_32::Emit_Fp_ToInt64Trunc_Mem64MemD(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	m_assembler.FldEq(MakeMemoryFpDoubleSymbolAddress(src1));
+	Fp_StoreInt64Trunc(dst);
+}
+
+void CCodeGen_x86_32::Emit_Fp_FromInt64_MemDMem64(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	m_assembler.FildEq(MakeMemory64SymbolAddress(src1));
+	m_assembler.FstpEq(MakeMemoryFpDoubleSymbolAddress(dst));
+}
@@ -0,0 +1,11 @@
+#pragma once
+
+extern "C" uint64 CodeGen_x86_32_div64_unsigned(uint64 a, uint64 b)
+{
+	return a / b;
+}
+
+extern "C" int64 CodeGen_x86_32_div64_signed(int64 a, int64 b)
+{
+	return a / b;
+}
@@ -128,70 +128,153 @@ void CCodeGen_x86_64::Emit_Alu64_MemCstMem(const STATEMENT& statement)
 	{ ALUOP_CST,	MATCH_MEMORY64,		MATCH_MEMORY64,		MATCH_CONSTANT64,	&CCodeGen_x86_64::Emit_Alu64_MemMemCst<ALUOP>	}, \
 	{ ALUOP_CST,	MATCH_MEMORY64,		MATCH_CONSTANT64,	MATCH_MEMORY64,		&CCodeGen_x86_64::Emit_Alu64_MemCstMem<ALUOP>	},
 
+void CCodeGen_x86_64::Emit_Not64_MemMem(const STATEMENT& statement)
+{
+	CSymbol* dst = statement.dst->GetSymbol().get();
+	CSymbol* src1 = statement.src1->GetSymbol().get();
+
+	CX86Assembler::REGISTER tmpReg = CX86Assembler::rAX;
+
+	m_assembler.MovEq(tmpReg, MakeMemory64SymbolAddress(src1));
+	m_assembler.NotEq(CX86Assembler::MakeRegisterAddress(tmpReg));
+	m_assembler.MovGq(MakeMemory64SymbolAddress(dst), tmpReg);
+}
+
+void CCodeGen_x86_64::Emit_Mul64_MemMemCst(const STATEMENT& statement)
+{
+	CSymbol* dst = statement.dst->GetSymbol().get();
+	CSymbol* src1 = statement.src1->GetSymbol().get();
+	CSymbol* src2 = statement.src2->GetSymbol().get();
+
+	assert(src2->m_type == SYM_CONSTANT64);
+
+	CX86Assembler::REGISTER tmpReg = CX86Assembler::rAX;
+	uint64 constant = CombineConstant64(src2->m_valueLow, src2->m_valueHigh);
+
+	m_assembler.MovIq(tmpReg, constant);
+	m_assembler.ImulEq(tmpReg, MakeMemory64SymbolAddress(src1));
+	m_assembler.MovGq(MakeMemory64SymbolAddress(dst), tmpReg);
+}
+
+//Dividend must be in rAX, quotient is stored in dst
+template <bool isSigned>
+void CCodeGen_x86_64::Div64(CSymbol* dst, const CX86Assembler::CAddress& divisorAddress)
+{
+	if(isSigned)
+	{
+		m_assembler.Cqo();
+		m_assembler.IdivEq(divisorAddress);
+	}
+	else
+	{
+		m_assembler.XorGd(CX86Assembler::MakeRegisterAddress(CX86Assembler::rDX), CX86Assembler::rDX);
+		m_assembler.DivEq(divisorAddress);
+	}
+	m_assembler.MovGq(MakeMemory64SymbolAddress(dst), CX86Assembler::rAX);
+}
+
+template <bool isSigned>
+void CCodeGen_x86_64::Emit_Div64_MemMemMem(const STATEMENT& statement)
+{
+	CSymbol* dst = statement.dst->GetSymbol().get();
+	CSymbol* src1 = statement.src1->GetSymbol().get();
+	CSymbol* src2 = statement.src2->GetSymbol().get();
+
+	m_assembler.MovEq(CX86Assembler::rAX, MakeMemory64SymbolAddress(src1));
+	Div64<isSigned>(dst, MakeMemory64SymbolAddress(src2));
+}
+
+template <bool isSigned>
+void CCodeGen_x86_64::Emit_Div64_MemMemCst(const STATEMENT& statement)
+{
+	CSymbol* dst = statement.dst->GetSymbol().get();
+	CSymbol* src1 = statement.src1->GetSymbol().get();
+	CSymbol* src2 = statement.src2->GetSymbol().get();
+
+	assert(src2->m_type == SYM_CONSTANT64);
+
+	auto divisorReg = CX86Assembler::rCX;
+
+	m_assembler.MovEq(CX86Assembler::rAX, MakeMemory64SymbolAddress(src1));
+	m_assembler.MovIq(divisorReg, CombineConstant64(src2->m_valueLow, src2->m_valueHigh));
+	Div64<isSigned>(dst, CX86Assembler::MakeRegisterAddress(divisorReg));
+}
+
+template <bool isSigned>
+void CCodeGen_x86_64::Emit_Div64_MemCstMem(const STATEMENT& statement)
+{
+	CSymbol* dst = statement.dst->GetSymbol().get();
+	CSymbol* src1 = statement.src1->GetSymbol().get();
+	CSymbol* src2 = statement.src2->GetSymbol().get();
+
+	assert(src1->m_type == SYM_CONSTANT64);
+
+	m_assembler.MovIq(CX86Assembler::rAX, CombineConstant64(src1->m_valueLow, src1->m_valueHigh));
+	Div64<isSigned>(dst, MakeMemory64SymbolAddress(src2));
+}
+
+#define DIV64_CONST_MATCHERS(DIVOP_CST, isSigned) \
+	{ DIVOP_CST,	MATCH_MEMORY64,		MATCH_MEMORY64,		MATCH_MEMORY64,		&CCodeGen_x86_64::Emit_Div64_MemMemMem<isSigned>	}, \
+	{ DIVOP_CST,	MATCH_MEMORY64,		MATCH_MEMORY64,		MATCH_CONSTANT64,	&CCodeGen_x86_64::Emit_Div64_MemMemCst<isSigned>	}, \
+	{ DIVOP_CST,	MATCH_MEMORY64,		MATCH_CONSTANT64,	MATCH_MEMORY64,		&CCodeGen_x86_64::Emit_Div64_MemCstMem<isSigned>	},
+
 //SHIFTOP
 //-------------------------------------------------------------------
 
 template <typename SHIFTOP>
-void CCodeGen_x86_64::Emit_Shift64_RelRelReg(const STATEMENT& statement)
+void CCodeGen_x86_64::Emit_Shift64_MemMemReg(const STATEMENT& statement)
 {
 	CSymbol* dst = statement.dst->GetSymbol().get();
 	CSymbol* src1 = statement.src1->GetSymbol().get();
 	CSymbol* src2 = statement.src2->GetSymbol().get();
 
-	assert(dst->m_type  == SYM_RELATIVE64);
-	assert(src1->m_type == SYM_RELATIVE64);
 	assert(src2->m_type == SYM_REGISTER);
 
 	CX86Assembler::REGISTER tmpReg = CX86Assembler::rAX;
 	CX86Assembler::REGISTER shiftReg = CX86Assembler::rCX;
 
-	m_assembler.MovEq(tmpReg, MakeRelative64SymbolAddress(src1));
+	m_assembler.MovEq(tmpReg, MakeMemory64SymbolAddress(src1));
 	m_assembler.MovEd(shiftReg, CX86Assembler::MakeRegisterAddress(m_registers[src2->m_valueLow]));
 	((m_assembler).*(SHIFTOP::OpVar()))(CX86Assembler::MakeRegisterAddress(tmpReg));
-	m_assembler.MovGq(MakeRelative64SymbolAddress(dst), tmpReg);
+	m_assembler.MovGq(MakeMemory64SymbolAddress(dst), tmpReg);
 }
 
 template <typename SHIFTOP>
-void CCodeGen_x86_64::Emit_Shift64_RelRelMem(const STATEMENT& statement)
+void CCodeGen_x86_64::Emit_Shift64_MemMemMem(const STATEMENT& statement)
 {
 	CSymbol* dst = statement.dst->GetSymbol().get();
 	CSymbol* src1 = statement.src1->GetSymbol().get();
 	CSymbol* src2 = statement.src2->GetSymbol().get();
 
-	assert(dst->m_type  == SYM_RELATIVE64);
-	assert(src1->m_type == SYM_RELATIVE64);
-
 	CX86Assembler::REGISTER tmpReg = CX86Assembler::rAX;
 	CX86Assembler::REGISTER shiftReg = CX86Assembler::rCX;
 
-	m_assembler.MovEq(tmpReg, MakeRelative64SymbolAddress(src1));
+	m_assembler.MovEq(tmpReg, MakeMemory64SymbolAddress(src1));
 	m_assembler.MovEd(shiftReg, MakeMemorySymbolAddress(src2));
 	((m_assembler).*(SHIFTOP::OpVar()))(CX86Assembler::MakeRegisterAddress(tmpReg));
-	m_assembler.MovGq(MakeRelative64SymbolAddress(dst), tmpReg);
+	m_assembler.MovGq(MakeMemory64SymbolAddress(dst), tmpReg);
 }
 
 template <typename SHIFTOP>
-void CCodeGen_x86_64::Emit_Shift64_RelRelCst(const STATEMENT& statement)
+void CCodeGen_x86_64::Emit_Shift64_MemMemCst(const STATEMENT& statement)
 {
 	CSymbol* dst = statement.dst->GetSymbol().get();
 	CSymbol* src1 = statement.src1->GetSymbol().get();
 	CSymbol* src2 = statement.src2->GetSymbol().get();
 
-	assert(dst->m_type  == SYM_RELATIVE64);
-	assert(src1->m_type == SYM_RELATIVE64);
 	assert(src2->m_type == SYM_CONSTANT);
 
 	CX86Assembler::REGISTER tmpReg = CX86Assembler::rAX;
 
-	m_assembler.MovEq(tmpReg, MakeRelative64SymbolAddress(src1));
+	m_assembler.MovEq(tmpReg, MakeMemory64SymbolAddress(src1));
 	((m_assembler).*(SHIFTOP::OpCst()))(CX86Assembler::MakeRegisterAddress(tmpReg), static_cast<uint8>(src2->m_valueLow));
-	m_assembler.MovGq(MakeRelative64SymbolAddress(dst), tmpReg);
+	m_assembler.MovGq(MakeMemory64SymbolAddress(dst), tmpReg);
 }
 
 #define SHIFT64_CONST_MATCHERS(SHIFTOP_CST, SHIFTOP) \
-	{ SHIFTOP_CST,	MATCH_RELATIVE64,	MATCH_RELATIVE64,	MATCH_REGISTER,		&CCodeGen_x86_64::Emit_Shift64_RelRelReg<SHIFTOP>		}, \
-	{ SHIFTOP_CST,	MATCH_RELATIVE64,	MATCH_RELATIVE64,	MATCH_MEMORY,		&CCodeGen_x86_64::Emit_Shift64_RelRelMem<SHIFTOP>		}, \
-	{ SHIFTOP_CST,	MATCH_RELATIVE64,	MATCH_RELATIVE64,	MATCH_CONSTANT,		&CCodeGen_x86_64::Emit_Shift64_RelRelCst<SHIFTOP>		},
+	{ SHIFTOP_CST,	MATCH_MEMORY64,		MATCH_MEMORY64,		MATCH_REGISTER,		&CCodeGen_x86_64::Emit_Shift64_MemMemReg<SHIFTOP>		}, \
+	{ SHIFTOP_CST,	MATCH_MEMORY64,		MATCH_MEMORY64,		MATCH_MEMORY,		&CCodeGen_x86_64::Emit_Shift64_MemMemMem<SHIFTOP>		}, \
+	{ SHIFTOP_CST,	MATCH_MEMORY64,		MATCH_MEMORY64,		MATCH_CONSTANT,		&CCodeGen_x86_64::Emit_Shift64_MemMemCst<SHIFTOP>		},
 
 CCodeGen_x86_64::CONSTMATCHER CCodeGen_x86_64::g_constMatchers[] = 
 {
@@ -215,15 +298,27 @@ CCodeGen_x86_64::CONSTMATCHER CCodeGen_x86_64::g_constMatchers[] =
 	{ OP_RETVAL,		MATCH_MEMORY128,	MATCH_NIL,			MATCH_NIL,			&CCodeGen_x86_64::Emit_RetVal_Mem128						},
 
 	{ OP_MOV,			MATCH_MEMORY64,		MATCH_MEMORY64,		MATCH_NIL,			&CCodeGen_x86_64::Emit_Mov_Mem64Mem64						},
-	{ OP_MOV,			MATCH_RELATIVE64,	MATCH_CONSTANT64,	MATCH_NIL,			&CCodeGen_x86_64::Emit_Mov_Rel64Cst64						},
+	{ OP_MOV,			MATCH_MEMORY64,		MATCH_CONSTANT64,	MATCH_NIL,			&CCodeGen_x86_64::Emit_Mov_Mem64Cst64						},
 
 	ALU64_CONST_MATCHERS(OP_ADD64, ALUOP64_ADD)
 	ALU64_CONST_MATCHERS(OP_SUB64, ALUOP64_SUB)
 	ALU64_CONST_MATCHERS(OP_AND64, ALUOP64_AND)
+	ALU64_CONST_MATCHERS(OP_OR64, ALUOP64_OR)
+	ALU64_CONST_MATCHERS(OP_XOR64, ALUOP64_XOR)
+
+	{ OP_NOT64,			MATCH_MEMORY64,		MATCH_MEMORY64,		MATCH_NIL,			&CCodeGen_x86_64::Emit_Not64_MemMem							},
+
+	{ OP_MUL64,			MATCH_MEMORY64,		MATCH_MEMORY64,		MATCH_MEMORY64,		&CCodeGen_x86_64::Emit_Alu64_MemMemMem<ALUOP64_MUL>			},
+	{ OP_MUL64,			MATCH_MEMORY64,		MATCH_MEMORY64,		MATCH_CONSTANT64,	&CCodeGen_x86_64::Emit_Mul64_MemMemCst						},
+	{ OP_MUL64,			MATCH_MEMORY64,		MATCH_CONSTANT64,	MATCH_MEMORY64,		&CCodeGen_x86_64::Emit_Alu64_MemCstMem<ALUOP64_MUL>			},
+
+	DIV64_CONST_MATCHERS(OP_DIV64, false)
+	DIV64_CONST_MATCHERS(OP_DIVS64, true)
 
 	SHIFT64_CONST_MATCHERS(OP_SLL64, SHIFTOP64_SLL)
 	SHIFT64_CONST_MATCHERS(OP_SRL64, SHIFTOP64_SRL)
 	SHIFT64_CONST_MATCHERS(OP_SRA64, SHIFTOP64_SRA)
+	SHIFT64_CONST_MATCHERS(OP_ROR64, SHIFTOP64_ROR)
 
 	{ OP_CMP64,			MATCH_REGISTER,		MATCH_RELATIVE64,	MATCH_RELATIVE64,	&CCodeGen_x86_64::Emit_Cmp64_RegRelRel						},
 	{ OP_CMP64,			MATCH_REGISTER,		MATCH_RELATIVE64,	MATCH_CONSTANT64,	&CCodeGen_x86_64::Emit_Cmp64_RegRelCst						},
@@ -240,12 +335,34 @@ CCodeGen_x86_64::CONSTMATCHER CCodeGen_x86_64::g_constMatchers[] =
 	{ OP_LOADFROMREF,	MATCH_MEMORY,		MATCH_MEM_REF,		MATCH_NIL,			&CCodeGen_x86_64::Emit_LoadFromRef_MemMem					},
 	{ OP_LOADFROMREF,	MATCH_REGISTER128,	MATCH_MEM_REF,		MATCH_NIL,			&CCodeGen_x86_64::Emit_LoadFromRef_Md_RegMem				},
 	{ OP_LOADFROMREF,	MATCH_MEMORY128,	MATCH_MEM_REF,		MATCH_NIL,			&CCodeGen_x86_64::Emit_LoadFromRef_Md_MemMem				},
+	{ OP_LOADFROMREF,	MATCH_MEMORY64,		MATCH_MEM_REF,		MATCH_NIL,			&CCodeGen_x86_64::Emit_LoadFromRef_64_MemMem				},
+
+	{ OP_LOAD8FROMREF,		MATCH_VARIABLE,	MATCH_MEM_REF,		MATCH_NIL,			&CCodeGen_x86_64::Emit_LoadSizedFromRef_VarMem				},
+	{ OP_LOAD8SFROMREF,		MATCH_VARIABLE,	MATCH_MEM_REF,		MATCH_NIL,			&CCodeGen_x86_64::Emit_LoadSizedFromRef_VarMem				},
+	{ OP_LOAD16FROMREF,		MATCH_VARIABLE,	MATCH_MEM_REF,		MATCH_NIL,			&CCodeGen_x86_64::Emit_LoadSizedFromRef_VarMem				},
+	{ OP_LOAD16SFROMREF,	MATCH_VARIABLE,	MATCH_MEM_REF,		MATCH_NIL,			&CCodeGen_x86_64::Emit_LoadSizedFromRef_VarMem				},
 
 	{ OP_STOREATREF,	MATCH_NIL,			MATCH_MEM_REF,		MATCH_REGISTER,		&CCodeGen_x86_64::Emit_StoreAtRef_MemReg					},
 	{ OP_STOREATREF,	MATCH_NIL,			MATCH_MEM_REF,		MATCH_MEMORY,		&CCodeGen_x86_64::Emit_StoreAtRef_MemMem					},
 	{ OP_STOREATREF,	MATCH_NIL,			MATCH_MEM_REF,		MATCH_CONSTANT,		&CCodeGen_x86_64::Emit_StoreAtRef_MemCst					},
 	{ OP_STOREATREF,	MATCH_NIL,			MATCH_MEM_REF,		MATCH_REGISTER128,	&CCodeGen_x86_64::Emit_StoreAtRef_Md_MemReg					},
 	{ OP_STOREATREF,	MATCH_NIL,			MATCH_MEM_REF,		MATCH_MEMORY128,	&CCodeGen_x86_64::Emit_StoreAtRef_Md_MemMem					},
+	{ OP_STOREATREF,	MATCH_NIL,			MATCH_MEM_REF,		MATCH_MEMORY64,		&CCodeGen_x86_64::Emit_StoreAtRef_64_MemMem					},
+	{ OP_STOREATREF,	MATCH_NIL,			MATCH_MEM_REF,		MATCH_CONSTANT64,	&CCodeGen_x86_64::Emit_StoreAtRef_64_MemCst					},
+
+	{ OP_STORE8ATREF,	MATCH_NIL,			MATCH_MEM_REF,		MATCH_VARIABLE,		&CCodeGen_x86_64::Emit_StoreSizedAtRef_MemVar				},
+	{ OP_STORE8ATREF,	MATCH_NIL,			MATCH_MEM_REF,		MATCH_CONSTANT,		&CCodeGen_x86_64::Emit_StoreSizedAtRef_MemCst				},
+	{ OP_STORE16ATREF,	MATCH_NIL,			MATCH_MEM_REF,		MATCH_VARIABLE,		&CCodeGen_x86_64::Emit_StoreSizedAtRef_MemVar				},
+	{ OP_STORE16ATREF,	MATCH_NIL,			MATCH_MEM_REF,		MATCH_CONSTANT,		&CCodeGen_x86_64::Emit_StoreSizedAtRef_MemCst				},
+
+	{ OP_LOADFROMTLB,	MATCH_VARIABLE,		MATCH_VARIABLE,		MATCH_CONSTANTPTR,	&CCodeGen_x86_64::Emit_LoadFromTlb_VarVar					},
+	{ OP_LOADFROMTLB,	MATCH_VARIABLE,		MATCH_CONSTANT,		MATCH_CONSTANTPTR,	&CCodeGen_x86_64::Emit_LoadFromTlb_VarCst					},
+
+	{ OP_FP_TOINT64_TRUNC,	MATCH_MEMORY64,	MATCH_MEMORY_FP_SINGLE,	MATCH_NIL,		&CCodeGen_x86_64::Emit_Fp_ToInt64Trunc_Mem64MemS					},
+	{ OP_FP_TOINT64_TRUNC,	MATCH_MEMORY64,	MATCH_MEMORY_FP_DOUBLE,	MATCH_NIL,		&CCodeGen_x86_64::Emit_Fp_ToInt64Trunc_Mem64MemD					},
+	{ OP_FP_FROMINT64,		MATCH_MEMORY_FP_DOUBLE,	MATCH_MEMORY64,	MATCH_NIL,		&CCodeGen_x86_64::Emit_Fp_FromInt64_MemDMem64						},
+
+	{ OP_INCCOUNTER,	MATCH_NIL,			MATCH_CONSTANTPTR,	MATCH_NIL,			&CCodeGen_x86_64::Emit_IncCounter							},
 
 	{ OP_MOV,			MATCH_NIL,			MATCH_NIL,			MATCH_NIL,			NULL														},
 };
@@ -312,6 +429,30 @@ bool CCodeGen_x86_64::CanHold128BitsReturnValueInRegisters() const
 	return m_hasMdRegRetValues;
 }
 
+bool CCodeGen_x86_64::CanHandle256BitsMdOperations() const
+{
+	return m_hasAvx2;
+}
+
+std::string CCodeGen_x86_64::GetConfigurationName() const
+{
+	std::string name = (m_platformAbi == PLATFORM_ABI_WIN32) ? "x86_64-win32" : "x86_64-systemv";
+	if(m_hasSse41) name += "+sse41";
+	if(m_hasFma) name += "+fma";
+	if(m_hasPopcnt) name += "+popcnt";
+	if(m_hasBmi1) name += "+bmi1";
+	if(m_hasAvx2) name += "+avx2";
+	return name;
+}
+
+bool CCodeGen_x86_64::PatchExternalSymbolReference(uint8* code, uint32 offset, uintptr_t value) const
+{
+	//References come from 64-bits immediate moves
+	uint64 address = value;
+	memcpy(code + offset, &address, sizeof(uint64));
+	return true;
+}
+
 void CCodeGen_x86_64::Emit_Prolog(const StatementList& statements, unsigned int stackSize, uint32 registerUsage)
 {
 	m_params.clear();
@@ -593,12 +734,11 @@ void CCodeGen_x86_64::Emit_Mov_Mem64Mem64(const STATEMENT& statement)
 	m_assembler.MovGq(MakeMemory64SymbolAddress(dst), CX86Assembler::rAX);
 }
 
-void CCodeGen_x86_64::Emit_Mov_Rel64Cst64(const STATEMENT& statement)
+void CCodeGen_x86_64::Emit_Mov_Mem64Cst64(const STATEMENT& statement)
 {
 	CSymbol* dst = statement.dst->GetSymbol().get();
 	CSymbol* src1 = statement.src1->GetSymbol().get();
 
-	assert(dst->m_type  == SYM_RELATIVE64);
 	assert(src1->m_type == SYM_CONSTANT64);
 
 	uint64 constant = CombineConstant64(src1->m_valueLow, src1->m_valueHigh);
@@ -612,7 +752,7 @@ void CCodeGen_x86_64::Emit_Mov_Rel64Cst64(const STATEMENT& statement)
 	{
 		m_assembler.MovIq(tmpReg, constant);
 	}
-	m_assembler.MovGq(MakeRelative64SymbolAddress(dst), tmpReg);
+	m_assembler.MovGq(MakeMemory64SymbolAddress(dst), tmpReg);
 }
 
 void CCodeGen_x86_64::Cmp64_RelRel(CX86Assembler::REGISTER dstReg, const STATEMENT& statement)
@@ -797,6 +937,54 @@ void CCodeGen_x86_64::Emit_LoadFromRef_Md_MemMem(const STATEMENT& statement)
 	m_assembler.MovapsVo(MakeMemory128SymbolAddress(dst), valueReg);
 }
 
+void CCodeGen_x86_64::Emit_LoadFromRef_64_MemMem(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	auto addressReg = CX86Assembler::rAX;
+	auto valueReg = CX86Assembler::rDX;
+
+	m_assembler.MovEq(addressReg, MakeMemoryReferenceSymbolAddress(src1));
+	m_assembler.MovEq(valueReg, CX86Assembler::MakeIndRegAddress(addressReg));
+	m_assembler.MovGq(MakeMemory64SymbolAddress(dst), valueReg);
+}
+
+void CCodeGen_x86_64::Emit_LoadSizedFromRef_VarMem(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	auto addressReg = CX86Assembler::rAX;
+	auto valueReg = (dst->m_type == SYM_REGISTER) ? m_registers[dst->m_valueLow] : CX86Assembler::rDX;
+
+	m_assembler.MovEq(addressReg, MakeMemoryReferenceSymbolAddress(src1));
+	auto valueAddress = CX86Assembler::MakeIndRegAddress(addressReg);
+	switch(statement.op)
+	{
+	case OP_LOAD8FROMREF:
+		m_assembler.MovzxEb(valueReg, valueAddress);
+		break;
+	case OP_LOAD8SFROMREF:
+		m_assembler.MovsxEb(valueReg, valueAddress);
+		break;
+	case OP_LOAD16FROMREF:
+		m_assembler.MovzxEw(valueReg, valueAddress);
+		break;
+	case OP_LOAD16SFROMREF:
+		m_assembler.MovsxEw(valueReg, valueAddress);
+		break;
+	default:
+		assert(false);
+		break;
+	}
+
+	if(dst->m_type != SYM_REGISTER)
+	{
+		m_assembler.MovGd(MakeMemorySymbolAddress(dst), valueReg);
+	}
+}
+
 void CCodeGen_x86_64::Emit_StoreAtRef_MemReg(const STATEMENT& statement)
 {
 	CSymbol* src1 = statement.src1->GetSymbol().get();
@@ -857,3 +1045,194 @@ void CCodeGen_x86_64::Emit_StoreAtRef_Md_MemMem(const STATEMENT& statement)
 	m_assembler.MovapsVo(valueReg, MakeMemory128SymbolAddress(src2));
 	m_assembler.MovapsVo(CX86Assembler::MakeIndRegAddress(addressReg), valueReg);
 }
+
+void CCodeGen_x86_64::Emit_StoreAtRef_64_MemMem(const STATEMENT& statement)
+{
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	auto addressReg = CX86Assembler::rAX;
+	auto valueReg = CX86Assembler::rDX;
+
+	m_assembler.MovEq(addressReg, MakeMemoryReferenceSymbolAddress(src1));
+	m_assembler.MovEq(valueReg, MakeMemory64SymbolAddress(src2));
+	m_assembler.MovGq(CX86Assembler::MakeIndRegAddress(addressReg), valueReg);
+}
+
+void CCodeGen_x86_64::Emit_StoreAtRef_64_MemCst(const STATEMENT& statement)
+{
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	assert(src2->m_type == SYM_CONSTANT64);
+
+	auto addressReg = CX86Assembler::rAX;
+	auto valueReg = CX86Assembler::rDX;
+
+	m_assembler.MovEq(addressReg, MakeMemoryReferenceSymbolAddress(src1));
+	m_assembler.MovIq(valueReg, src2->GetConstant64());
+	m_assembler.MovGq(CX86Assembler::MakeIndRegAddress(addressReg), valueReg);
+}
+
+void CCodeGen_x86_64::Emit_StoreSizedAtRef_MemVar(const STATEMENT& statement)
+{
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	//Value goes through rDX since allocated registers might not have a byte form
+	auto addressReg = CX86Assembler::rAX;
+	auto valueReg = CX86Assembler::rDX;
+
+	m_assembler.MovEq(addressReg, MakeMemoryReferenceSymbolAddress(src1));
+	m_assembler.MovEd(valueReg, MakeVariableSymbolAddress(src2));
+	switch(statement.op)
+	{
+	case OP_STORE8ATREF:
+		m_assembler.MovGb(CX86Assembler::MakeIndRegAddress(addressReg), valueReg);
+		break;
+	case OP_STORE16ATREF:
+		m_assembler.MovGw(CX86Assembler::MakeIndRegAddress(addressReg), valueReg);
+		break;
+	default:
+		assert(false);
+		break;
+	}
+}
+
+void CCodeGen_x86_64::Emit_StoreSizedAtRef_MemCst(const STATEMENT& statement)
+{
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	assert(src2->m_type == SYM_CONSTANT);
+
+	auto addressReg = CX86Assembler::rAX;
+
+	m_assembler.MovEq(addressReg, MakeMemoryReferenceSymbolAddress(src1));
+	switch(statement.op)
+	{
+	case OP_STORE8ATREF:
+		m_assembler.MovIb(CX86Assembler::MakeIndRegAddress(addressReg), static_cast<uint8>(src2->m_valueLow));
+		break;
+	case OP_STORE16ATREF:
+		m_assembler.MovIw(CX86Assembler::MakeIndRegAddress(addressReg), static_cast<uint16>(src2->m_valueLow));
+		break;
+	default:
+		assert(false);
+		break;
+	}
+}
+
+void CCodeGen_x86_64::LoadFromTlb(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+	auto src3 = statement.src3->GetSymbol().get();
+
+	assert(src2->m_type == SYM_CONSTANTPTR);
+	assert(src3->m_type == SYM_CONSTANT64);
+
+	uint32 tableOffset = src3->m_valueLow;
+	uint8 pageShift = static_cast<uint8>(src3->m_valueHigh);
+	uintptr_t missHandler = src2->GetConstantPtr();
+
+	//Address is expected to be in rAX
+	auto addressReg = CX86Assembler::rAX;
+	auto pageReg = CX86Assembler::rCX;
+	auto entryReg = CX86Assembler::rDX;
+
+	auto missLabel = m_assembler.CreateLabel();
+	auto doneLabel = m_assembler.CreateLabel();
+
+	m_assembler.MovEd(pageReg, CX86Assembler::MakeRegisterAddress(addressReg));
+	m_assembler.ShrEd(CX86Assembler::MakeRegisterAddress(pageReg), pageShift);
+	m_assembler.MovEq(entryReg, CX86Assembler::MakeIndRegOffAddress(CX86Assembler::rBP, tableOffset));
+	m_assembler.MovEq(entryReg, CX86Assembler::MakeBaseIndexScaleAddress(entryReg, pageReg, 8));
+	m_assembler.TestEq(entryReg, CX86Assembler::MakeRegisterAddress(entryReg));
+	m_assembler.JzJx(missLabel);
+
+	m_assembler.AndId(CX86Assembler::MakeRegisterAddress(addressReg), (1 << pageShift) - 1);
+	m_assembler.MovEd(addressReg, CX86Assembler::MakeBaseIndexScaleAddress(entryReg, addressReg, 1));
+
+	m_assembler.MarkLabel(doneLabel);
+	m_assembler.MovGd(MakeVariableSymbolAddress(dst), addressReg);
+
+	m_coldPathEmitters.push_back(
+		[this, addressReg, missLabel, doneLabel, missHandler] ()
+		{
+			//MD registers are caller saved, keep the ones we use alive across the call
+			uint32 frameSize = 0x20 + GetSavedMdRegistersSize();
+
+			m_assembler.MarkLabel(missLabel);
+			m_assembler.MovEd(m_paramRegs[1], CX86Assembler::MakeRegisterAddress(addressReg));
+			m_assembler.MovEq(m_paramRegs[0], CX86Assembler::MakeRegisterAddress(CX86Assembler::rBP));
+			m_assembler.SubIq(CX86Assembler::MakeRegisterAddress(CX86Assembler::rSP), frameSize);
+
+			SaveMdRegisters(0x20);
+
+			m_assembler.MovIq(CX86Assembler::rAX, missHandler);
+			auto symbolRefLabel = m_assembler.CreateLabel();
+			m_assembler.MarkLabel(symbolRefLabel, -8);
+			m_symbolReferenceLabels.push_back(std::make_pair(missHandler, symbolRefLabel));
+			m_assembler.CallEd(CX86Assembler::MakeRegisterAddress(CX86Assembler::rAX));
+
+			RestoreMdRegisters(0x20);
+
+			m_assembler.AddIq(CX86Assembler::MakeRegisterAddress(CX86Assembler::rSP), frameSize);
+			m_assembler.JmpJx(doneLabel);
+		}
+	);
+}
+
+void CCodeGen_x86_64::Emit_LoadFromTlb_VarVar(const STATEMENT& statement)
+{
+	auto src1 = statement.src1->GetSymbol().get();
+
+	m_assembler.MovEd(CX86Assembler::rAX, MakeVariableSymbolAddress(src1));
+	LoadFromTlb(statement);
+}
+
+void CCodeGen_x86_64::Emit_LoadFromTlb_VarCst(const STATEMENT& statement)
+{
+	auto src1 = statement.src1->GetSymbol().get();
+
+	assert(src1->m_type == SYM_CONSTANT);
+
+	m_assembler.MovId(CX86Assembler::rAX, src1->m_valueLow);
+	LoadFromTlb(statement);
+}
+
+void CCodeGen_x86_64::Emit_IncCounter(const STATEMENT& statement)
+{
+	auto src1 = statement.src1->GetSymbol().get();
+
+	m_assembler.MovIq(CX86Assembler::rAX, src1->GetConstantPtr());
+	m_assembler.AddId(CX86Assembler::MakeIndRegAddress(CX86Assembler::rAX), 1);
+}
+
+void CCodeGen_x86_64::Emit_Fp_ToInt64Trunc_Mem64MemS(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	m_assembler.Cvttss2siEq(CX86Assembler::rAX, MakeMemoryFpSingleSymbolAddress(src1));
+	m_assembler.MovGq(MakeMemory64SymbolAddress(dst), CX86Assembler::rAX);
+}
+
+void CCodeGen_x86_64::Emit_Fp_ToInt64Trunc_Mem64MemD(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	m_assembler.Cvttsd2siEq(CX86Assembler::rAX, MakeMemoryFpDoubleSymbolAddress(src1));
+	m_assembler.MovGq(MakeMemory64SymbolAddress(dst), CX86Assembler::rAX);
+}
+
+void CCodeGen_x86_64::Emit_Fp_FromInt64_MemDMem64(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	m_assembler.Cvtsi2sdEq(CX86Assembler::xMM0, MakeMemory64SymbolAddress(src1));
+	m_assembler.MovsdEd(MakeMemoryFpDoubleSymbolAddress(dst), CX86Assembler::xMM0);
+}
@@ -32,6 +32,35 @@ CX86Assembler::CAddress CCodeGen_x86::MakeMemoryFpSingleSymbolAddress(CSymbol* s
 	}
 }
 
+CX86Assembler::CAddress CCodeGen_x86::MakeRelativeFpDoubleSymbolAddress(CSymbol* symbol)
+{
+	assert(symbol->m_type == SYM_FP_REL_DOUBLE);
+	assert((symbol->m_valueLow & 0x7) == 0);
+	return CX86Assembler::MakeIndRegOffAddress(CX86Assembler::rBP, symbol->m_valueLow);
+}
+
+CX86Assembler::CAddress CCodeGen_x86::MakeTemporaryFpDoubleSymbolAddress(CSymbol* symbol)
+{
+	assert(symbol->m_type == SYM_FP_TMP_DOUBLE);
+	return CX86Assembler::MakeIndRegOffAddress(CX86Assembler::rSP, symbol->m_stackLocation + m_stackLevel);
+}
+
+CX86Assembler::CAddress CCodeGen_x86::MakeMemoryFpDoubleSymbolAddress(CSymbol* symbol)
+{
+	switch(symbol->m_type)
+	{
+	case SYM_FP_REL_DOUBLE:
+		return MakeRelativeFpDoubleSymbolAddress(symbol);
+		break;
+	case SYM_FP_TMP_DOUBLE:
+		return MakeTemporaryFpDoubleSymbolAddress(symbol);
+		break;
+	default:
+		throw std::exception();
+		break;
+	}
+}
+
 template <typename FPUOP>
 void CCodeGen_x86::Emit_Fpu_MemMem(const STATEMENT& statement)
 {
@@ -201,6 +230,40 @@ void CCodeGen_x86::Emit_Fp_ToIntTrunc_RelRel(const STATEMENT& statement)
 	m_assembler.MovGd(CX86Assembler::MakeIndRegOffAddress(CX86Assembler::rBP, dst->m_valueLow), CX86Assembler::rAX);
 }
 
+void CCodeGen_x86::Emit_Fp_ToInt_MemMemCst(const STATEMENT& statement)
+{
+	CSymbol* dst = statement.dst->GetSymbol().get();
+	CSymbol* src1 = statement.src1->GetSymbol().get();
+	CSymbol* src2 = statement.src2->GetSymbol().get();
+
+	//Upper lanes are cleared by movss, the packed operations used by Emit_Md_ToWord are harmless on them
+	m_assembler.MovssEd(CX86Assembler::xMM0, MakeMemoryFpSingleSymbolAddress(src1));
+	Emit_Md_ToWord(CX86Assembler::xMM0, static_cast<ROUNDMODE>(src2->m_valueLow));
+	m_assembler.MovssEd(MakeMemoryFpSingleSymbolAddress(dst), CX86Assembler::xMM0);
+}
+
+void CCodeGen_x86::Emit_Fp_ToIntSat_MemMemCst(const STATEMENT& statement)
+{
+	CSymbol* dst = statement.dst->GetSymbol().get();
+	CSymbol* src1 = statement.src1->GetSymbol().get();
+	CSymbol* src2 = statement.src2->GetSymbol().get();
+
+	m_assembler.MovssEd(CX86Assembler::xMM0, MakeMemoryFpSingleSymbolAddress(src1));
+	Emit_Md_ToWordSat(CX86Assembler::xMM0, static_cast<ROUNDMODE>(src2->m_valueLow));
+	m_assembler.MovssEd(MakeMemoryFpSingleSymbolAddress(dst), CX86Assembler::xMM0);
+}
+
+void CCodeGen_x86::Emit_Fp_Round_MemMemCst(const STATEMENT& statement)
+{
+	CSymbol* dst = statement.dst->GetSymbol().get();
+	CSymbol* src1 = statement.src1->GetSymbol().get();
+	CSymbol* src2 = statement.src2->GetSymbol().get();
+
+	m_assembler.MovssEd(CX86Assembler::xMM0, MakeMemoryFpSingleSymbolAddress(src1));
+	Emit_Md_Round(CX86Assembler::xMM0, static_cast<ROUNDMODE>(src2->m_valueLow));
+	m_assembler.MovssEd(MakeMemoryFpSingleSymbolAddress(dst), CX86Assembler::xMM0);
+}
+
 void CCodeGen_x86::Emit_Fp_LdCst_MemCst(const STATEMENT& statement)
 {
 	CSymbol* dst = statement.dst->GetSymbol().get();
@@ -214,6 +277,238 @@ void CCodeGen_x86::Emit_Fp_LdCst_MemCst(const STATEMENT& statement)
 	m_assembler.MovGd(MakeMemoryFpSingleSymbolAddress(dst), tmpRegister);
 }
 
+void CCodeGen_x86::Emit_Fp_ToDouble_MemMem(const STATEMENT& statement)
+{
+	CSymbol* dst = statement.dst->GetSymbol().get();
+	CSymbol* src1 = statement.src1->GetSymbol().get();
+
+	m_assembler.Cvtss2sdEd(CX86Assembler::xMM0, MakeMemoryFpSingleSymbolAddress(src1));
+	m_assembler.MovsdEd(MakeMemoryFpDoubleSymbolAddress(dst), CX86Assembler::xMM0);
+}
+
+void CCodeGen_x86::Emit_Fp_ToSingle_MemMem(const STATEMENT& statement)
+{
+	CSymbol* dst = statement.dst->GetSymbol().get();
+	CSymbol* src1 = statement.src1->GetSymbol().get();
+
+	m_assembler.Cvtsd2ssEd(CX86Assembler::xMM0, MakeMemoryFpDoubleSymbolAddress(src1));
+	m_assembler.MovssEd(MakeMemoryFpSingleSymbolAddress(dst), CX86Assembler::xMM0);
+}
+
+template <typename FPUOP>
+void CCodeGen_x86::Emit_FpuD_MemMem(const STATEMENT& statement)
+{
+	CSymbol* dst = statement.dst->GetSymbol().get();
+	CSymbol* src1 = statement.src1->GetSymbol().get();
+
+	((m_assembler).*(FPUOP::OpEd()))(CX86Assembler::xMM0, MakeMemoryFpDoubleSymbolAddress(src1));
+	m_assembler.MovsdEd(MakeMemoryFpDoubleSymbolAddress(dst), CX86Assembler::xMM0);
+}
+
+template <typename FPUOP>
+void CCodeGen_x86::Emit_FpuD_MemMemMem(const STATEMENT& statement)
+{
+	CSymbol* dst = statement.dst->GetSymbol().get();
+	CSymbol* src1 = statement.src1->GetSymbol().get();
+	CSymbol* src2 = statement.src2->GetSymbol().get();
+
+	m_assembler.MovsdEd(CX86Assembler::xMM0, MakeMemoryFpDoubleSymbolAddress(src1));
+	((m_assembler).*(FPUOP::OpEd()))(CX86Assembler::xMM0, MakeMemoryFpDoubleSymbolAddress(src2));
+	m_assembler.MovsdEd(MakeMemoryFpDoubleSymbolAddress(dst), CX86Assembler::xMM0);
+}
+
+void CCodeGen_x86::Emit_FpD_Cmp_MemMem(CX86Assembler::REGISTER dstReg, const STATEMENT& statement)
+{
+	CSymbol* src1 = statement.src1->GetSymbol().get();
+	CSymbol* src2 = statement.src2->GetSymbol().get();
+
+	CX86Assembler::SSE_CMP_TYPE conditionCode(GetSseConditionCode(statement.jmpCondition));
+	m_assembler.MovsdEd(CX86Assembler::xMM0, MakeMemoryFpDoubleSymbolAddress(src1));
+	m_assembler.CmpsdEd(CX86Assembler::xMM0, MakeMemoryFpDoubleSymbolAddress(src2), conditionCode);
+	m_assembler.MovdVo(CX86Assembler::MakeRegisterAddress(dstReg), CX86Assembler::xMM0);
+}
+
+void CCodeGen_x86::Emit_FpD_Cmp_SymMemMem(const STATEMENT& statement)
+{
+	CSymbol* dst = statement.dst->GetSymbol().get();
+
+	switch(dst->m_type)
+	{
+	case SYM_REGISTER:
+		Emit_FpD_Cmp_MemMem(m_registers[dst->m_valueLow], statement);
+		break;
+	case SYM_RELATIVE:
+	case SYM_TEMPORARY:
+		Emit_FpD_Cmp_MemMem(CX86Assembler::rAX, statement);
+		m_assembler.MovGd(MakeMemorySymbolAddress(dst), CX86Assembler::rAX);
+		break;
+	default:
+		assert(0);
+		break;
+	}
+}
+
+void CCodeGen_x86::Emit_FpD_Abs_MemMem(const STATEMENT& statement)
+{
+	CSymbol* dst = statement.dst->GetSymbol().get();
+	CSymbol* src1 = statement.src1->GetSymbol().get();
+
+	//Build 0x7FFFFFFFFFFFFFFF mask
+	m_assembler.PcmpeqdVo(CX86Assembler::xMM1, CX86Assembler::MakeXmmRegisterAddress(CX86Assembler::xMM1));
+	m_assembler.PsrlqVo(CX86Assembler::xMM1, 1);
+
+	m_assembler.MovsdEd(CX86Assembler::xMM0, MakeMemoryFpDoubleSymbolAddress(src1));
+	m_assembler.PandVo(CX86Assembler::xMM0, CX86Assembler::MakeXmmRegisterAddress(CX86Assembler::xMM1));
+	m_assembler.MovsdEd(MakeMemoryFpDoubleSymbolAddress(dst), CX86Assembler::xMM0);
+}
+
+void CCodeGen_x86::Emit_FpD_Neg_MemMem(const STATEMENT& statement)
+{
+	CSymbol* dst = statement.dst->GetSymbol().get();
+	CSymbol* src1 = statement.src1->GetSymbol().get();
+
+	//Build 0x8000000000000000 mask
+	m_assembler.PcmpeqdVo(CX86Assembler::xMM1, CX86Assembler::MakeXmmRegisterAddress(CX86Assembler::xMM1));
+	m_assembler.PsllqVo(CX86Assembler::xMM1, 63);
+
+	m_assembler.MovsdEd(CX86Assembler::xMM0, MakeMemoryFpDoubleSymbolAddress(src1));
+	m_assembler.PxorVo(CX86Assembler::xMM0, CX86Assembler::MakeXmmRegisterAddress(CX86Assembler::xMM1));
+	m_assembler.MovsdEd(MakeMemoryFpDoubleSymbolAddress(dst), CX86Assembler::xMM0);
+}
+
+void CCodeGen_x86::Emit_FpD_Rcpl_MemMem(const STATEMENT& statement)
+{
+	CSymbol* dst = statement.dst->GetSymbol().get();
+	CSymbol* src1 = statement.src1->GetSymbol().get();
+
+	//No approximation instruction for doubles, do a full division
+	m_assembler.MovId(CX86Assembler::rAX, 1);
+	m_assembler.Cvtsi2sdEd(CX86Assembler::xMM0, CX86Assembler::MakeRegisterAddress(CX86Assembler::rAX));
+	m_assembler.DivsdEd(CX86Assembler::xMM0, MakeMemoryFpDoubleSymbolAddress(src1));
+	m_assembler.MovsdEd(MakeMemoryFpDoubleSymbolAddress(dst), CX86Assembler::xMM0);
+}
+
+void CCodeGen_x86::Emit_FpD_Rsqrt_MemMem(const STATEMENT& statement)
+{
+	CSymbol* dst = statement.dst->GetSymbol().get();
+	CSymbol* src1 = statement.src1->GetSymbol().get();
+
+	m_assembler.SqrtsdEd(CX86Assembler::xMM1, MakeMemoryFpDoubleSymbolAddress(src1));
+	m_assembler.MovId(CX86Assembler::rAX, 1);
+	m_assembler.Cvtsi2sdEd(CX86Assembler::xMM0, CX86Assembler::MakeRegisterAddress(CX86Assembler::rAX));
+	m_assembler.DivsdEd(CX86Assembler::xMM0, CX86Assembler::MakeXmmRegisterAddress(CX86Assembler::xMM1));
+	m_assembler.MovsdEd(MakeMemoryFpDoubleSymbolAddress(dst), CX86Assembler::xMM0);
+}
+
+void CCodeGen_x86::Emit_FpD_Mov_MemMem(const STATEMENT& statement)
+{
+	CSymbol* dst = statement.dst->GetSymbol().get();
+	CSymbol* src1 = statement.src1->GetSymbol().get();
+
+	m_assembler.MovsdEd(CX86Assembler::xMM0, MakeMemoryFpDoubleSymbolAddress(src1));
+	m_assembler.MovsdEd(MakeMemoryFpDoubleSymbolAddress(dst), CX86Assembler::xMM0);
+}
+
+void CCodeGen_x86::Emit_FpD_Mov_RelDRelI32(const STATEMENT& statement)
+{
+	CSymbol* dst = statement.dst->GetSymbol().get();
+	CSymbol* src1 = statement.src1->GetSymbol().get();
+
+	assert(dst->m_type  == SYM_FP_REL_DOUBLE);
+	assert(src1->m_type == SYM_FP_REL_INT32);
+
+	m_assembler.Cvtsi2sdEd(CX86Assembler::xMM0, CX86Assembler::MakeIndRegOffAddress(CX86Assembler::rBP, src1->m_valueLow));
+	m_assembler.MovsdEd(MakeRelativeFpDoubleSymbolAddress(dst), CX86Assembler::xMM0);
+}
+
+void CCodeGen_x86::Emit_FpD_ToIntTrunc_RelRel(const STATEMENT& statement)
+{
+	CSymbol* dst = statement.dst->GetSymbol().get();
+	CSymbol* src1 = statement.src1->GetSymbol().get();
+
+	assert(dst->m_type  == SYM_FP_REL_SINGLE);
+	assert(src1->m_type == SYM_FP_REL_DOUBLE);
+
+	m_assembler.Cvttsd2siEd(CX86Assembler::rAX, MakeRelativeFpDoubleSymbolAddress(src1));
+	m_assembler.MovGd(CX86Assembler::MakeIndRegOffAddress(CX86Assembler::rBP, dst->m_valueLow), CX86Assembler::rAX);
+}
+
+void CCodeGen_x86::Emit_FpD_LdCst_MemCst(const STATEMENT& statement)
+{
+	CSymbol* dst = statement.dst->GetSymbol().get();
+	CSymbol* src1 = statement.src1->GetSymbol().get();
+
+	assert(src1->m_type == SYM_CONSTANT64);
+
+	//Assemble both halves in a XMM register to keep this usable on 32-bit hosts
+	CX86Assembler::REGISTER tmpRegister = CX86Assembler::rAX;
+
+	m_assembler.MovId(tmpRegister, src1->m_valueLow);
+	m_assembler.MovdVo(CX86Assembler::xMM0, CX86Assembler::MakeRegisterAddress(tmpRegister));
+	m_assembler.MovId(tmpRegister, src1->m_valueHigh);
+	m_assembler.MovdVo(CX86Assembler::xMM1, CX86Assembler::MakeRegisterAddress(tmpRegister));
+	m_assembler.PunpckldqVo(CX86Assembler::xMM0, CX86Assembler::MakeXmmRegisterAddress(CX86Assembler::xMM1));
+	m_assembler.MovsdEd(MakeMemoryFpDoubleSymbolAddress(dst), CX86Assembler::xMM0);
+}
+
+template <typename FPUOP>
+void CCodeGen_x86::Emit_Fp_MulAcc_MemMemMem(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+	auto src3 = statement.src3->GetSymbol().get();
+
+	m_assembler.MovssEd(CX86Assembler::xMM1, MakeMemoryFpSingleSymbolAddress(src2));
+	m_assembler.MulssEd(CX86Assembler::xMM1, MakeMemoryFpSingleSymbolAddress(src3));
+	m_assembler.MovssEd(CX86Assembler::xMM0, MakeMemoryFpSingleSymbolAddress(src1));
+	((m_assembler).*(FPUOP::OpEd()))(CX86Assembler::xMM0, CX86Assembler::MakeXmmRegisterAddress(CX86Assembler::xMM1));
+	m_assembler.MovssEd(MakeMemoryFpSingleSymbolAddress(dst), CX86Assembler::xMM0);
+}
+
+template <typename FMAOP>
+void CCodeGen_x86::Emit_Fp_FusedMulAcc_MemMemMem(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+	auto src3 = statement.src3->GetSymbol().get();
+
+	m_assembler.MovssEd(CX86Assembler::xMM0, MakeMemoryFpSingleSymbolAddress(src1));
+	m_assembler.MovssEd(CX86Assembler::xMM1, MakeMemoryFpSingleSymbolAddress(src2));
+	((m_assembler).*(FMAOP::Op()))(CX86Assembler::xMM0, CX86Assembler::xMM1, MakeMemoryFpSingleSymbolAddress(src3));
+	m_assembler.MovssEd(MakeMemoryFpSingleSymbolAddress(dst), CX86Assembler::xMM0);
+}
+
+template <typename FPUDOP>
+void CCodeGen_x86::Emit_FpD_MulAcc_MemMemMem(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+	auto src3 = statement.src3->GetSymbol().get();
+
+	m_assembler.MovsdEd(CX86Assembler::xMM1, MakeMemoryFpDoubleSymbolAddress(src2));
+	m_assembler.MulsdEd(CX86Assembler::xMM1, MakeMemoryFpDoubleSymbolAddress(src3));
+	m_assembler.MovsdEd(CX86Assembler::xMM0, MakeMemoryFpDoubleSymbolAddress(src1));
+	((m_assembler).*(FPUDOP::OpEd()))(CX86Assembler::xMM0, CX86Assembler::MakeXmmRegisterAddress(CX86Assembler::xMM1));
+	m_assembler.MovsdEd(MakeMemoryFpDoubleSymbolAddress(dst), CX86Assembler::xMM0);
+}
+
+template <typename FMAOP>
+void CCodeGen_x86::Emit_FpD_FusedMulAcc_MemMemMem(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+	auto src3 = statement.src3->GetSymbol().get();
+
+	m_assembler.MovsdEd(CX86Assembler::xMM0, MakeMemoryFpDoubleSymbolAddress(src1));
+	m_assembler.MovsdEd(CX86Assembler::xMM1, MakeMemoryFpDoubleSymbolAddress(src2));
+	((m_assembler).*(FMAOP::Op()))(CX86Assembler::xMM0, CX86Assembler::xMM1, MakeMemoryFpDoubleSymbolAddress(src3));
+	m_assembler.MovsdEd(MakeMemoryFpDoubleSymbolAddress(dst), CX86Assembler::xMM0);
+}
+
 CCodeGen_x86::CONSTMATCHER CCodeGen_x86::g_fpuConstMatchers[] = 
 { 
 	{ OP_FP_ADD,			MATCH_MEMORY_FP_SINGLE,		MATCH_MEMORY_FP_SINGLE,			MATCH_MEMORY_FP_SINGLE,		&CCodeGen_x86::Emit_Fpu_MemMemMem<FPUOP_ADD>		},
@@ -223,6 +518,9 @@ CCodeGen_x86::CONSTMATCHER CCodeGen_x86::g_fpuConstMatchers[] =
 	{ OP_FP_MAX,			MATCH_MEMORY_FP_SINGLE,		MATCH_MEMORY_FP_SINGLE,			MATCH_MEMORY_FP_SINGLE,		&CCodeGen_x86::Emit_Fpu_MemMemMem<FPUOP_MAX>		},
 	{ OP_FP_MIN,			MATCH_MEMORY_FP_SINGLE,		MATCH_MEMORY_FP_SINGLE,			MATCH_MEMORY_FP_SINGLE,		&CCodeGen_x86::Emit_Fpu_MemMemMem<FPUOP_MIN>		},
 
+	{ OP_FP_MADD,			MATCH_MEMORY_FP_SINGLE,		MATCH_MEMORY_FP_SINGLE,			MATCH_MEMORY_FP_SINGLE,		&CCodeGen_x86::Emit_Fp_MulAcc_MemMemMem<FPUOP_ADD>	},
+	{ OP_FP_MSUB,			MATCH_MEMORY_FP_SINGLE,		MATCH_MEMORY_FP_SINGLE,			MATCH_MEMORY_FP_SINGLE,		&CCodeGen_x86::Emit_Fp_MulAcc_MemMemMem<FPUOP_SUB>	},
+
 	{ OP_FP_CMP,			MATCH_REGISTER,				MATCH_MEMORY_FP_SINGLE,			MATCH_MEMORY_FP_SINGLE,		&CCodeGen_x86::Emit_Fp_Cmp_SymMemMem				},
 	{ OP_FP_CMP,			MATCH_MEMORY,				MATCH_MEMORY_FP_SINGLE,			MATCH_MEMORY_FP_SINGLE,		&CCodeGen_x86::Emit_Fp_Cmp_SymMemMem				},
 	{ OP_FP_CMP,			MATCH_REGISTER,				MATCH_MEMORY_FP_SINGLE,			MATCH_CONSTANT,				&CCodeGen_x86::Emit_Fp_Cmp_SymMemCst				},
@@ -237,8 +535,60 @@ CCodeGen_x86::CONSTMATCHER CCodeGen_x86::g_fpuConstMatchers[] =
 
 	{ OP_MOV,				MATCH_RELATIVE_FP_SINGLE,	MATCH_RELATIVE_FP_INT32,		MATCH_NIL,					&CCodeGen_x86::Emit_Fp_Mov_RelSRelI32				},
 	{ OP_FP_TOINT_TRUNC,	MATCH_RELATIVE_FP_SINGLE,	MATCH_RELATIVE_FP_SINGLE,		MATCH_NIL,					&CCodeGen_x86::Emit_Fp_ToIntTrunc_RelRel			},
+	{ OP_FP_TOINT,			MATCH_MEMORY_FP_SINGLE,		MATCH_MEMORY_FP_SINGLE,			MATCH_CONSTANT,				&CCodeGen_x86::Emit_Fp_ToInt_MemMemCst				},
+	{ OP_FP_TOINT_SAT,		MATCH_MEMORY_FP_SINGLE,		MATCH_MEMORY_FP_SINGLE,			MATCH_CONSTANT,				&CCodeGen_x86::Emit_Fp_ToIntSat_MemMemCst			},
+	{ OP_FP_ROUND,			MATCH_MEMORY_FP_SINGLE,		MATCH_MEMORY_FP_SINGLE,			MATCH_CONSTANT,				&CCodeGen_x86::Emit_Fp_Round_MemMemCst				},
 
 	{ OP_FP_LDCST,			MATCH_MEMORY_FP_SINGLE,		MATCH_CONSTANT,					MATCH_NIL,					&CCodeGen_x86::Emit_Fp_LdCst_MemCst					},
 
+	{ OP_FP_TODOUBLE,		MATCH_MEMORY_FP_DOUBLE,		MATCH_MEMORY_FP_SINGLE,			MATCH_NIL,					&CCodeGen_x86::Emit_Fp_ToDouble_MemMem				},
+	{ OP_FP_TOSINGLE,		MATCH_MEMORY_FP_SINGLE,		MATCH_MEMORY_FP_DOUBLE,			MATCH_NIL,					&CCodeGen_x86::Emit_Fp_ToSingle_MemMem				},
+
+	{ OP_FP_ADD,			MATCH_MEMORY_FP_DOUBLE,		MATCH_MEMORY_FP_DOUBLE,			MATCH_MEMORY_FP_DOUBLE,		&CCodeGen_x86::Emit_FpuD_MemMemMem<FPUDOP_ADD>		},
+	{ OP_FP_SUB,			MATCH_MEMORY_FP_DOUBLE,		MATCH_MEMORY_FP_DOUBLE,			MATCH_MEMORY_FP_DOUBLE,		&CCodeGen_x86::Emit_FpuD_MemMemMem<FPUDOP_SUB>		},
+	{ OP_FP_MUL,			MATCH_MEMORY_FP_DOUBLE,		MATCH_MEMORY_FP_DOUBLE,			MATCH_MEMORY_FP_DOUBLE,		&CCodeGen_x86::Emit_FpuD_MemMemMem<FPUDOP_MUL>		},
+	{ OP_FP_DIV,			MATCH_MEMORY_FP_DOUBLE,		MATCH_MEMORY_FP_DOUBLE,			MATCH_MEMORY_FP_DOUBLE,		&CCodeGen_x86::Emit_FpuD_MemMemMem<FPUDOP_DIV>		},
+	{ OP_FP_MAX,			MATCH_MEMORY_FP_DOUBLE,		MATCH_MEMORY_FP_DOUBLE,			MATCH_MEMORY_FP_DOUBLE,		&CCodeGen_x86::Emit_FpuD_MemMemMem<FPUDOP_MAX>		},
+	{ OP_FP_MIN,			MATCH_MEMORY_FP_DOUBLE,		MATCH_MEMORY_FP_DOUBLE,			MATCH_MEMORY_FP_DOUBLE,		&CCodeGen_x86::Emit_FpuD_MemMemMem<FPUDOP_MIN>		},
+
+	{ OP_FP_MADD,			MATCH_MEMORY_FP_DOUBLE,		MATCH_MEMORY_FP_DOUBLE,			MATCH_MEMORY_FP_DOUBLE,		&CCodeGen_x86::Emit_FpD_MulAcc_MemMemMem<FPUDOP_ADD>	},
+	{ OP_FP_MSUB,			MATCH_MEMORY_FP_DOUBLE,		MATCH_MEMORY_FP_DOUBLE,			MATCH_MEMORY_FP_DOUBLE,		&CCodeGen_x86::Emit_FpD_MulAcc_MemMemMem<FPUDOP_SUB>	},
+
+	{ OP_FP_CMP,			MATCH_REGISTER,				MATCH_MEMORY_FP_DOUBLE,			MATCH_MEMORY_FP_DOUBLE,		&CCodeGen_x86::Emit_FpD_Cmp_SymMemMem				},
+	{ OP_FP_CMP,			MATCH_MEMORY,				MATCH_MEMORY_FP_DOUBLE,			MATCH_MEMORY_FP_DOUBLE,		&CCodeGen_x86::Emit_FpD_Cmp_SymMemMem				},
+
+	{ OP_FP_SQRT,			MATCH_MEMORY_FP_DOUBLE,		MATCH_MEMORY_FP_DOUBLE,			MATCH_NIL,					&CCodeGen_x86::Emit_FpuD_MemMem<FPUDOP_SQRT>		},
+	{ OP_FP_RSQRT,			MATCH_MEMORY_FP_DOUBLE,		MATCH_MEMORY_FP_DOUBLE,			MATCH_NIL,					&CCodeGen_x86::Emit_FpD_Rsqrt_MemMem				},
+	{ OP_FP_RCPL,			MATCH_MEMORY_FP_DOUBLE,		MATCH_MEMORY_FP_DOUBLE,			MATCH_NIL,					&CCodeGen_x86::Emit_FpD_Rcpl_MemMem					},
+
+	{ OP_FP_ABS,			MATCH_MEMORY_FP_DOUBLE,		MATCH_MEMORY_FP_DOUBLE,			MATCH_NIL,					&CCodeGen_x86::Emit_FpD_Abs_MemMem					},
+	{ OP_FP_NEG,			MATCH_MEMORY_FP_DOUBLE,		MATCH_MEMORY_FP_DOUBLE,			MATCH_NIL,					&CCodeGen_x86::Emit_FpD_Neg_MemMem					},
+
+	{ OP_MOV,				MATCH_MEMORY_FP_DOUBLE,		MATCH_MEMORY_FP_DOUBLE,			MATCH_NIL,					&CCodeGen_x86::Emit_FpD_Mov_MemMem					},
+	{ OP_MOV,				MATCH_RELATIVE_FP_DOUBLE,	MATCH_RELATIVE_FP_INT32,		MATCH_NIL,					&CCodeGen_x86::Emit_FpD_Mov_RelDRelI32				},
+	{ OP_FP_TOINT_TRUNC,	MATCH_RELATIVE_FP_SINGLE,	MATCH_RELATIVE_FP_DOUBLE,		MATCH_NIL,					&CCodeGen_x86::Emit_FpD_ToIntTrunc_RelRel			},
+
+	{ OP_FP_LDCST,			MATCH_MEMORY_FP_DOUBLE,		MATCH_CONSTANT64,				MATCH_NIL,					&CCodeGen_x86::Emit_FpD_LdCst_MemCst				},
+
 	{ OP_MOV,				MATCH_NIL,					MATCH_NIL,						MATCH_NIL,					NULL												},
 };
+
+CCodeGen_x86::CONSTMATCHER CCodeGen_x86::g_fpuFusedMulAddConstMatchers[] = 
+{
+	{ OP_FP_FMADD,			MATCH_MEMORY_FP_SINGLE,		MATCH_MEMORY_FP_SINGLE,			MATCH_MEMORY_FP_SINGLE,		&CCodeGen_x86::Emit_Fp_MulAcc_MemMemMem<FPUOP_ADD>	},
+	{ OP_FP_FMSUB,			MATCH_MEMORY_FP_SINGLE,		MATCH_MEMORY_FP_SINGLE,			MATCH_MEMORY_FP_SINGLE,		&CCodeGen_x86::Emit_Fp_MulAcc_MemMemMem<FPUOP_SUB>	},
+	{ OP_FP_FMADD,			MATCH_MEMORY_FP_DOUBLE,		MATCH_MEMORY_FP_DOUBLE,			MATCH_MEMORY_FP_DOUBLE,		&CCodeGen_x86::Emit_FpD_MulAcc_MemMemMem<FPUDOP_ADD>	},
+	{ OP_FP_FMSUB,			MATCH_MEMORY_FP_DOUBLE,		MATCH_MEMORY_FP_DOUBLE,			MATCH_MEMORY_FP_DOUBLE,		&CCodeGen_x86::Emit_FpD_MulAcc_MemMemMem<FPUDOP_SUB>	},
+
+	{ OP_MOV,				MATCH_NIL,					MATCH_NIL,						MATCH_NIL,					nullptr												},
+};
+
+CCodeGen_x86::CONSTMATCHER CCodeGen_x86::g_fpuFusedMulAddFmaConstMatchers[] = 
+{
+	{ OP_FP_FMADD,			MATCH_MEMORY_FP_SINGLE,		MATCH_MEMORY_FP_SINGLE,			MATCH_MEMORY_FP_SINGLE,		&CCodeGen_x86::Emit_Fp_FusedMulAcc_MemMemMem<FMAOP_MADDS>	},
+	{ OP_FP_FMSUB,			MATCH_MEMORY_FP_SINGLE,		MATCH_MEMORY_FP_SINGLE,			MATCH_MEMORY_FP_SINGLE,		&CCodeGen_x86::Emit_Fp_FusedMulAcc_MemMemMem<FMAOP_MSUBS>	},
+	{ OP_FP_FMADD,			MATCH_MEMORY_FP_DOUBLE,		MATCH_MEMORY_FP_DOUBLE,			MATCH_MEMORY_FP_DOUBLE,		&CCodeGen_x86::Emit_FpD_FusedMulAcc_MemMemMem<FMAOP_MADDD>	},
+	{ OP_FP_FMSUB,			MATCH_MEMORY_FP_DOUBLE,		MATCH_MEMORY_FP_DOUBLE,			MATCH_MEMORY_FP_DOUBLE,		&CCodeGen_x86::Emit_FpD_FusedMulAcc_MemMemMem<FMAOP_MSUBD>	},
+
+	{ OP_MOV,				MATCH_NIL,					MATCH_NIL,						MATCH_NIL,					nullptr												},
+};
@@ -23,6 +23,35 @@ CX86Assembler::CAddress CCodeGen_x86::MakeTemporary256SymbolElementAddress(CSymb
 	return CX86Assembler::MakeIndRegOffAddress(CX86Assembler::rSP, symbol->m_stackLocation + m_stackLevel + elementIdx);
 }
 
+CX86Assembler::CAddress CCodeGen_x86::MakeMemory256SymbolAddress(CSymbol* symbol)
+{
+	switch(symbol->m_type)
+	{
+	case SYM_RELATIVE256:
+		return CX86Assembler::MakeIndRegOffAddress(CX86Assembler::rBP, symbol->m_valueLow);
+		break;
+	case SYM_TEMPORARY256:
+		return MakeTemporary256SymbolElementAddress(symbol, 0);
+		break;
+	default:
+		throw std::exception();
+		break;
+	}
+}
+
+CX86Assembler::CAddress CCodeGen_x86::MakeVariable256SymbolAddress(CSymbol* symbol)
+{
+	switch(symbol->m_type)
+	{
+	case SYM_REGISTER256:
+		return CX86Assembler::MakeXmmRegisterAddress(m_mdRegisters[symbol->m_valueLow]);
+		break;
+	default:
+		return MakeMemory256SymbolAddress(symbol);
+		break;
+	}
+}
+
 CX86Assembler::CAddress CCodeGen_x86::MakeVariable128SymbolAddress(CSymbol* symbol)
 {
 	switch(symbol->m_type)
@@ -195,6 +224,35 @@ void CCodeGen_x86::Emit_Md_VarVarVarRev(const STATEMENT& statement)
 	m_assembler.MovapsVo(MakeVariable128SymbolAddress(dst), dstRegister);
 }
 
+template <typename MDOP>
+void CCodeGen_x86::Emit_Md_MulAcc_VarVarVarVar(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+	auto src3 = statement.src3->GetSymbol().get();
+
+	m_assembler.MovapsVo(CX86Assembler::xMM1, MakeVariable128SymbolAddress(src2));
+	m_assembler.MulpsVo(CX86Assembler::xMM1, MakeVariable128SymbolAddress(src3));
+	m_assembler.MovapsVo(CX86Assembler::xMM0, MakeVariable128SymbolAddress(src1));
+	((m_assembler).*(MDOP::OpVo()))(CX86Assembler::xMM0, CX86Assembler::MakeXmmRegisterAddress(CX86Assembler::xMM1));
+	m_assembler.MovapsVo(MakeVariable128SymbolAddress(dst), CX86Assembler::xMM0);
+}
+
+template <typename FMAOP>
+void CCodeGen_x86::Emit_Md_FusedMulAcc_VarVarVarVar(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+	auto src3 = statement.src3->GetSymbol().get();
+
+	m_assembler.MovapsVo(CX86Assembler::xMM0, MakeVariable128SymbolAddress(src1));
+	m_assembler.MovapsVo(CX86Assembler::xMM1, MakeVariable128SymbolAddress(src2));
+	((m_assembler).*(FMAOP::Op()))(CX86Assembler::xMM0, CX86Assembler::xMM1, MakeVariable128SymbolAddress(src3));
+	m_assembler.MovapsVo(MakeVariable128SymbolAddress(dst), CX86Assembler::xMM0);
+}
+
 template <typename MDOPSHIFT, uint8 SAMASK>
 void CCodeGen_x86::Emit_Md_Shift_RegVarCst(const STATEMENT& statement)
 {
@@ -529,6 +587,31 @@ void CCodeGen_x86::Emit_Md_MaxW_VarVarVar(const STATEMENT& statement)
 	m_assembler.MovdqaVo(MakeVariable128SymbolAddress(dst), mask1Register);
 }
 
+void CCodeGen_x86::Emit_Md_MulW_VarVarVar(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	auto evenRegister = CX86Assembler::xMM0;
+	auto oddRegister = CX86Assembler::xMM1;
+	auto tmpRegister = CX86Assembler::xMM2;
+
+	//pmuludq only multiplies even lanes, odd lanes are moved in even lanes to get their products
+	m_assembler.MovdqaVo(evenRegister, MakeVariable128SymbolAddress(src1));
+	m_assembler.PshufdVo(oddRegister, MakeVariable128SymbolAddress(src1), 0xF5);
+	m_assembler.PshufdVo(tmpRegister, MakeVariable128SymbolAddress(src2), 0xF5);
+	m_assembler.PmuludqVo(evenRegister, MakeVariable128SymbolAddress(src2));
+	m_assembler.PmuludqVo(oddRegister, CX86Assembler::MakeXmmRegisterAddress(tmpRegister));
+
+	//Gather the lower halves of the products
+	m_assembler.PshufdVo(evenRegister, CX86Assembler::MakeXmmRegisterAddress(evenRegister), 0x08);
+	m_assembler.PshufdVo(oddRegister, CX86Assembler::MakeXmmRegisterAddress(oddRegister), 0x08);
+	m_assembler.PunpckldqVo(evenRegister, CX86Assembler::MakeXmmRegisterAddress(oddRegister));
+
+	m_assembler.MovdqaVo(MakeVariable128SymbolAddress(dst), evenRegister);
+}
+
 void CCodeGen_x86::Emit_Md_PackHB_VarVarVar(const STATEMENT& statement)
 {
 	auto dst = statement.dst->GetSymbol().get();
@@ -741,6 +824,148 @@ void CCodeGen_x86::Emit_Md_IsZero(CX86Assembler::REGISTER dstRegister, const CX8
 	m_assembler.AndId(CX86Assembler::MakeRegisterAddress(dstRegister), 0x0F);
 }
 
+void CCodeGen_x86::Emit_Md_LoadConstant(CX86Assembler::XMMREGISTER dstRegister, uint32 constant)
+{
+	m_assembler.MovId(CX86Assembler::rAX, constant);
+	m_assembler.MovdVo(dstRegister, CX86Assembler::MakeRegisterAddress(CX86Assembler::rAX));
+	m_assembler.PshufdVo(dstRegister, CX86Assembler::MakeXmmRegisterAddress(dstRegister), 0x00);
+}
+
+void CCodeGen_x86::Emit_Md_ToWordSat(CX86Assembler::XMMREGISTER valueRegister, ROUNDMODE roundMode)
+{
+	auto tmpRegister = CX86Assembler::xMM1;
+	auto overflowRegister = CX86Assembler::xMM3;
+
+	assert(valueRegister != tmpRegister);
+	assert(valueRegister != overflowRegister);
+
+	//NaNs become 0
+	m_assembler.MovapsVo(tmpRegister, CX86Assembler::MakeXmmRegisterAddress(valueRegister));
+	m_assembler.CmppsVo(tmpRegister, CX86Assembler::MakeXmmRegisterAddress(valueRegister), CX86Assembler::SSE_CMP_ORD);
+	m_assembler.PandVo(valueRegister, CX86Assembler::MakeXmmRegisterAddress(tmpRegister));
+
+	//Values below -2^31 are clamped, they then convert to 0x80000000
+	Emit_Md_LoadConstant(tmpRegister, 0xCF000000);
+	m_assembler.MaxpsVo(valueRegister, CX86Assembler::MakeXmmRegisterAddress(tmpRegister));
+
+	//overflow = (2^31 <= value), these lanes don't convert properly
+	Emit_Md_LoadConstant(overflowRegister, 0x4F000000);
+	m_assembler.CmppsVo(overflowRegister, CX86Assembler::MakeXmmRegisterAddress(valueRegister), CX86Assembler::SSE_CMP_LE);
+
+	Emit_Md_ToWord(valueRegister, roundMode);
+
+	//Overflowing lanes become 0xFFFFFFFF ^ 0x80000000
+	m_assembler.PorVo(valueRegister, CX86Assembler::MakeXmmRegisterAddress(overflowRegister));
+	m_assembler.PslldVo(overflowRegister, 31);
+	m_assembler.PxorVo(valueRegister, CX86Assembler::MakeXmmRegisterAddress(overflowRegister));
+}
+
+void CCodeGen_x86::Emit_Md_ToWord(CX86Assembler::XMMREGISTER valueRegister, ROUNDMODE roundMode)
+{
+	auto srcRegister = CX86Assembler::xMM1;
+	auto truncRegister = CX86Assembler::xMM2;
+
+	assert(valueRegister != srcRegister);
+	assert(valueRegister != truncRegister);
+
+	if(m_hasSse41)
+	{
+		m_assembler.RoundpsVo(valueRegister, CX86Assembler::MakeXmmRegisterAddress(valueRegister), GetSseRoundingMode(roundMode));
+		m_assembler.Cvttps2dqVo(valueRegister, CX86Assembler::MakeXmmRegisterAddress(valueRegister));
+		return;
+	}
+
+	switch(roundMode)
+	{
+	case ROUND_NEAREST:
+		//Uses MXCSR's rounding mode, which is expected to be left to its default (nearest)
+		m_assembler.Cvtps2dqVo(valueRegister, CX86Assembler::MakeXmmRegisterAddress(valueRegister));
+		break;
+	case ROUND_TRUNCATE:
+		m_assembler.Cvttps2dqVo(valueRegister, CX86Assembler::MakeXmmRegisterAddress(valueRegister));
+		break;
+	case ROUND_MINUSINFINITY:
+	case ROUND_PLUSINFINITY:
+		//Truncate and move lanes that went the wrong way by one
+		m_assembler.MovapsVo(srcRegister, CX86Assembler::MakeXmmRegisterAddress(valueRegister));
+		m_assembler.Cvttps2dqVo(valueRegister, CX86Assembler::MakeXmmRegisterAddress(valueRegister));
+		m_assembler.Cvtdq2psVo(truncRegister, CX86Assembler::MakeXmmRegisterAddress(valueRegister));
+		if(roundMode == ROUND_MINUSINFINITY)
+		{
+			//res += -(src < trunc)
+			m_assembler.CmppsVo(srcRegister, CX86Assembler::MakeXmmRegisterAddress(truncRegister), CX86Assembler::SSE_CMP_LT);
+			m_assembler.PadddVo(valueRegister, CX86Assembler::MakeXmmRegisterAddress(srcRegister));
+		}
+		else
+		{
+			//res -= -(trunc < src)
+			m_assembler.CmppsVo(truncRegister, CX86Assembler::MakeXmmRegisterAddress(srcRegister), CX86Assembler::SSE_CMP_LT);
+			m_assembler.PsubdVo(valueRegister, CX86Assembler::MakeXmmRegisterAddress(truncRegister));
+		}
+		break;
+	default:
+		assert(false);
+		break;
+	}
+}
+
+void CCodeGen_x86::Emit_Md_Round(CX86Assembler::XMMREGISTER valueRegister, ROUNDMODE roundMode)
+{
+	auto maskRegister = CX86Assembler::xMM1;
+	auto tmpRegister = CX86Assembler::xMM2;
+	auto srcRegister = CX86Assembler::xMM3;
+
+	assert(valueRegister != maskRegister);
+	assert(valueRegister != tmpRegister);
+	assert(valueRegister != srcRegister);
+
+	if(m_hasSse41)
+	{
+		m_assembler.RoundpsVo(valueRegister, CX86Assembler::MakeXmmRegisterAddress(valueRegister), GetSseRoundingMode(roundMode));
+		return;
+	}
+
+	m_assembler.MovapsVo(srcRegister, CX86Assembler::MakeXmmRegisterAddress(valueRegister));
+	Emit_Md_ToWord(valueRegister, roundMode);
+	m_assembler.Cvtdq2psVo(valueRegister, CX86Assembler::MakeXmmRegisterAddress(valueRegister));
+
+	//Values with a magnitude of 2^23 or more are already integral and might not fit in a word, keep them (and NaNs) as is
+	m_assembler.PcmpeqdVo(tmpRegister, CX86Assembler::MakeXmmRegisterAddress(tmpRegister));
+	m_assembler.PsrldVo(tmpRegister, 1);
+	m_assembler.MovapsVo(maskRegister, CX86Assembler::MakeXmmRegisterAddress(srcRegister));
+	m_assembler.PandVo(maskRegister, CX86Assembler::MakeXmmRegisterAddress(tmpRegister));
+	Emit_Md_LoadConstant(tmpRegister, 0x4B000000);
+	m_assembler.CmppsVo(maskRegister, CX86Assembler::MakeXmmRegisterAddress(tmpRegister), CX86Assembler::SSE_CMP_LT);
+	m_assembler.PandVo(valueRegister, CX86Assembler::MakeXmmRegisterAddress(maskRegister));
+	m_assembler.PandnVo(maskRegister, CX86Assembler::MakeXmmRegisterAddress(srcRegister));
+	m_assembler.PorVo(valueRegister, CX86Assembler::MakeXmmRegisterAddress(maskRegister));
+
+	//Copy the sign of the source, negative values rounded to zero give -0
+	m_assembler.PcmpeqdVo(tmpRegister, CX86Assembler::MakeXmmRegisterAddress(tmpRegister));
+	m_assembler.PslldVo(tmpRegister, 31);
+	m_assembler.PandVo(tmpRegister, CX86Assembler::MakeXmmRegisterAddress(srcRegister));
+	m_assembler.PorVo(valueRegister, CX86Assembler::MakeXmmRegisterAddress(tmpRegister));
+}
+
+uint8 CCodeGen_x86::GetSseRoundingMode(ROUNDMODE roundMode)
+{
+	//Rounding control of roundps, bit 3 suppresses precision exceptions
+	switch(roundMode)
+	{
+	case ROUND_NEAREST:
+		return 0x08;
+	case ROUND_MINUSINFINITY:
+		return 0x09;
+	case ROUND_PLUSINFINITY:
+		return 0x0A;
+	case ROUND_TRUNCATE:
+		return 0x0B;
+	default:
+		assert(false);
+		return 0x0B;
+	}
+}
+
 void CCodeGen_x86::Emit_Md_Expand_RegReg(const STATEMENT& statement)
 {
 	auto dst = statement.dst->GetSymbol().get();
@@ -856,6 +1081,322 @@ void CCodeGen_x86::Emit_Md_Srl256_VarMemCst(const STATEMENT& statement)
 	m_assembler.MovdqaVo(MakeVariable128SymbolAddress(dst), resultRegister);
 }
 
+template <typename MDOP256>
+void CCodeGen_x86::Emit_Md256_VarVarVar(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	auto dstRegister = (dst->m_type == SYM_REGISTER256) ? m_mdRegisters[dst->m_valueLow] : CX86Assembler::xMM0;
+	auto src1Register = CX86Assembler::xMM1;
+
+	if(src1->m_type == SYM_REGISTER256)
+	{
+		src1Register = m_mdRegisters[src1->m_valueLow];
+	}
+	else
+	{
+		m_assembler.VmovdquVqq(src1Register, MakeMemory256SymbolAddress(src1));
+	}
+
+	((m_assembler).*(MDOP256::Op()))(dstRegister, src1Register, MakeVariable256SymbolAddress(src2));
+
+	if(dst->m_type != SYM_REGISTER256)
+	{
+		m_assembler.VmovdquVqq(MakeMemory256SymbolAddress(dst), dstRegister);
+	}
+	m_upperYmmDirty = true;
+}
+
+void CCodeGen_x86::Emit_Md256_Mov_VarVar(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	if(dst->m_type == SYM_REGISTER256)
+	{
+		m_assembler.VmovdquVqq(m_mdRegisters[dst->m_valueLow], MakeVariable256SymbolAddress(src1));
+	}
+	else if(src1->m_type == SYM_REGISTER256)
+	{
+		m_assembler.VmovdquVqq(MakeMemory256SymbolAddress(dst), m_mdRegisters[src1->m_valueLow]);
+	}
+	else
+	{
+		auto tmpRegister = CX86Assembler::xMM0;
+		m_assembler.VmovdquVqq(tmpRegister, MakeMemory256SymbolAddress(src1));
+		m_assembler.VmovdquVqq(MakeMemory256SymbolAddress(dst), tmpRegister);
+	}
+	m_upperYmmDirty = true;
+}
+
+void CCodeGen_x86::Emit_MergeTo256_Avx2_RegVarVar(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	assert(dst->m_type == SYM_REGISTER256);
+
+	auto dstRegister = m_mdRegisters[dst->m_valueLow];
+	auto lowerRegister = CX86Assembler::xMM0;
+
+	//Lower half needs to be in a register, upper one is inserted from anywhere
+	if(src1->m_type == SYM_REGISTER128)
+	{
+		lowerRegister = m_mdRegisters[src1->m_valueLow];
+	}
+	else
+	{
+		m_assembler.MovdqaVo(lowerRegister, MakeMemory128SymbolAddress(src1));
+	}
+	m_assembler.Vinserti128Vqq(dstRegister, lowerRegister, MakeVariable128SymbolAddress(src2), 1);
+	m_upperYmmDirty = true;
+}
+
+void CCodeGen_x86::Emit_Md_Srl256_Avx2_VarVarCst(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	auto resultRegister = CX86Assembler::xMM0;
+	auto valueRegister = CX86Assembler::xMM1;
+
+	assert(src2->m_type == SYM_CONSTANT);
+
+	uint8 offset = static_cast<uint8>((src2->m_valueLow & 0x7F) / 8);
+
+	if(src1->m_type == SYM_REGISTER256)
+	{
+		valueRegister = m_mdRegisters[src1->m_valueLow];
+	}
+	else
+	{
+		//MERGETO256 writes temporaries left in memory as two halves, load them the same way so both loads are forwarded
+		assert(src1->m_type == SYM_TEMPORARY256);
+		m_assembler.MovdqaVo(valueRegister, MakeTemporary256SymbolElementAddress(src1, 0x00));
+		m_assembler.Vinserti128Vqq(valueRegister, valueRegister, MakeTemporary256SymbolElementAddress(src1, 0x10), 1);
+	}
+
+	//Swap the 128-bits lanes, the lower lane of the byte alignment is then (upper || lower) >> offset
+	m_assembler.VpermqVqq(resultRegister, CX86Assembler::MakeXmmRegisterAddress(valueRegister), 0x4E);
+	m_assembler.VpalignrVqq(resultRegister, resultRegister, CX86Assembler::MakeXmmRegisterAddress(valueRegister), offset);
+	m_assembler.MovdqaVo(MakeVariable128SymbolAddress(dst), resultRegister);
+	m_upperYmmDirty = true;
+}
+
+bool CCodeGen_x86::UsesYmmRegisters(const STATEMENT& statement)
+{
+	bool result = false;
+	statement.VisitOperands(
+		[&result] (const SymbolRefPtr& symbolRef, bool)
+		{
+			auto symbolType = symbolRef->GetSymbol()->m_type;
+			result |= (symbolType == SYM_RELATIVE256) || (symbolType == SYM_TEMPORARY256) || (symbolType == SYM_REGISTER256);
+		}
+	);
+	return result;
+}
+
+std::vector<uint32> CCodeGen_x86::GetLiveMd256Registers(const StatementList& statements)
+{
+	//For every statement, registers holding 256-bits values that are read by a later statement
+	std::vector<uint32> result(statements.size(), 0);
+	uint32 liveRegisters = 0;
+	auto resultIterator = result.rbegin();
+	for(auto statementIterator = statements.rbegin(); statementIterator != statements.rend(); statementIterator++, resultIterator++)
+	{
+		const auto& statement = *statementIterator;
+		*resultIterator = liveRegisters;
+		if(CSymbol* dst = dynamic_symbolref_cast(SYM_REGISTER256, statement.dst))
+		{
+			liveRegisters &= ~(1 << dst->m_valueLow);
+		}
+		statement.VisitSources(
+			[&liveRegisters] (const SymbolRefPtr& symbolRef, bool)
+			{
+				auto symbol = symbolRef->GetSymbol();
+				if(symbol->m_type != SYM_REGISTER256) return;
+				liveRegisters |= (1 << symbol->m_valueLow);
+			}
+		);
+	}
+	return result;
+}
+
+void CCodeGen_x86::Emit_Md_Shuffle_RegVarCst(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	m_assembler.PshufdVo(m_mdRegisters[dst->m_valueLow], MakeVariable128SymbolAddress(src1), static_cast<uint8>(src2->m_valueLow));
+}
+
+void CCodeGen_x86::Emit_Md_Shuffle_MemVarCst(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	auto resultRegister = CX86Assembler::xMM0;
+
+	m_assembler.PshufdVo(resultRegister, MakeVariable128SymbolAddress(src1), static_cast<uint8>(src2->m_valueLow));
+	m_assembler.MovapsVo(MakeMemory128SymbolAddress(dst), resultRegister);
+}
+
+void CCodeGen_x86::Emit_Md_InsertW_VarVarVar(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+	auto src3 = statement.src3->GetSymbol().get();
+
+	assert(src3->m_type == SYM_CONSTANT);
+
+	uint8 srcLane = (src3->m_valueLow >> 2) & 3;
+	uint8 dstLane = src3->m_valueLow & 3;
+
+	auto valueRegister = CX86Assembler::xMM0;
+	auto maskRegister = CX86Assembler::xMM1;
+
+	//Broadcast the source lane
+	m_assembler.PshufdVo(valueRegister, MakeVariable128SymbolAddress(src2), srcLane * 0x55);
+
+	//Build a mask selecting the destination lane (movd clears the upper lanes)
+	uint8 maskSelector = 0;
+	for(unsigned int i = 0; i < 4; i++)
+	{
+		if(i != dstLane)
+		{
+			maskSelector |= (0x01) << (i * 2);
+		}
+	}
+	m_assembler.MovId(CX86Assembler::rAX, ~0);
+	m_assembler.MovdVo(maskRegister, CX86Assembler::MakeRegisterAddress(CX86Assembler::rAX));
+	m_assembler.PshufdVo(maskRegister, CX86Assembler::MakeXmmRegisterAddress(maskRegister), maskSelector);
+
+	m_assembler.PandVo(valueRegister, CX86Assembler::MakeXmmRegisterAddress(maskRegister));
+	m_assembler.PandnVo(maskRegister, MakeVariable128SymbolAddress(src1));
+	m_assembler.PorVo(valueRegister, CX86Assembler::MakeXmmRegisterAddress(maskRegister));
+
+	m_assembler.MovdqaVo(MakeVariable128SymbolAddress(dst), valueRegister);
+}
+
+void CCodeGen_x86::Emit_Md_InsertW_Sse41_VarVarVar(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+	auto src3 = statement.src3->GetSymbol().get();
+
+	assert(src3->m_type == SYM_CONSTANT);
+
+	uint8 srcLane = (src3->m_valueLow >> 2) & 3;
+	uint8 dstLane = src3->m_valueLow & 3;
+
+	//Work in place if dst is a register that won't be read from afterwards
+	bool inPlace = (dst->m_type == SYM_REGISTER128) && !dst->Equals(src2);
+	auto resultRegister = inPlace ? m_mdRegisters[dst->m_valueLow] : CX86Assembler::xMM0;
+
+	if(!inPlace || !dst->Equals(src1))
+	{
+		m_assembler.MovapsVo(resultRegister, MakeVariable128SymbolAddress(src1));
+	}
+
+	if(src2->m_type == SYM_REGISTER128)
+	{
+		m_assembler.InsertpsVo(resultRegister, 
+			CX86Assembler::MakeXmmRegisterAddress(m_mdRegisters[src2->m_valueLow]), (srcLane << 6) | (dstLane << 4));
+	}
+	else
+	{
+		//Source lane selection is ignored when inserting from memory
+		m_assembler.InsertpsVo(resultRegister, MakeMemory128SymbolElementAddress(src2, srcLane), (dstLane << 4));
+	}
+
+	if(!inPlace)
+	{
+		m_assembler.MovapsVo(MakeVariable128SymbolAddress(dst), resultRegister);
+	}
+}
+
+void CCodeGen_x86::Emit_Md_ExtractW_VarRegCst(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	uint8 lane = src2->m_valueLow & 3;
+	auto srcRegister = m_mdRegisters[src1->m_valueLow];
+
+	if(lane != 0)
+	{
+		m_assembler.PshufdVo(CX86Assembler::xMM0, CX86Assembler::MakeXmmRegisterAddress(srcRegister), lane);
+		srcRegister = CX86Assembler::xMM0;
+	}
+
+	m_assembler.MovdVo(MakeVariableSymbolAddress(dst), srcRegister);
+}
+
+void CCodeGen_x86::Emit_Md_ExtractW_VarMemCst(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	uint8 lane = src2->m_valueLow & 3;
+	auto dstRegister = (dst->m_type == SYM_REGISTER) ? m_registers[dst->m_valueLow] : CX86Assembler::rAX;
+
+	m_assembler.MovEd(dstRegister, MakeMemory128SymbolElementAddress(src1, lane));
+
+	if(dst->m_type != SYM_REGISTER)
+	{
+		m_assembler.MovGd(MakeVariableSymbolAddress(dst), dstRegister);
+	}
+}
+
+void CCodeGen_x86::Emit_Md_ToWord_VarVarCst(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	auto valueRegister = CX86Assembler::xMM0;
+
+	m_assembler.MovdqaVo(valueRegister, MakeVariable128SymbolAddress(src1));
+	Emit_Md_ToWord(valueRegister, static_cast<ROUNDMODE>(src2->m_valueLow));
+	m_assembler.MovdqaVo(MakeVariable128SymbolAddress(dst), valueRegister);
+}
+
+void CCodeGen_x86::Emit_Md_ToWordSat_VarVarCst(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	auto valueRegister = CX86Assembler::xMM0;
+
+	m_assembler.MovdqaVo(valueRegister, MakeVariable128SymbolAddress(src1));
+	Emit_Md_ToWordSat(valueRegister, static_cast<ROUNDMODE>(src2->m_valueLow));
+	m_assembler.MovdqaVo(MakeVariable128SymbolAddress(dst), valueRegister);
+}
+
+void CCodeGen_x86::Emit_Md_Round_VarVarCst(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	auto valueRegister = CX86Assembler::xMM0;
+
+	m_assembler.MovdqaVo(valueRegister, MakeVariable128SymbolAddress(src1));
+	Emit_Md_Round(valueRegister, static_cast<ROUNDMODE>(src2->m_valueLow));
+	m_assembler.MovdqaVo(MakeVariable128SymbolAddress(dst), valueRegister);
+}
+
 void CCodeGen_x86::Emit_MergeTo256_MemVarVar(const STATEMENT& statement)
 {
 	auto dst = statement.dst->GetSymbol().get();
@@ -932,6 +1473,11 @@ CCodeGen_x86::CONSTMATCHER CCodeGen_x86::g_mdConstMatchers[] =
 
 	MD_CONST_MATCHERS_3OPS(OP_MD_MAX_H,		MDOP_MAXH)
 
+	MD_CONST_MATCHERS_3OPS(OP_MD_MUL_H,		MDOP_MULH)
+	MD_CONST_MATCHERS_3OPS(OP_MD_MULHI_H,	MDOP_MULHIH)
+	MD_CONST_MATCHERS_3OPS(OP_MD_MULEVEN_UWD,	MDOP_MULEVENUWD)
+	MD_CONST_MATCHERS_3OPS(OP_MD_MULADDPAIRS_HW,	MDOP_MULADDPAIRSHW)
+
 	MD_CONST_MATCHERS_3OPS(OP_MD_AND,		MDOP_AND)
 	MD_CONST_MATCHERS_3OPS(OP_MD_OR,		MDOP_OR)
 	MD_CONST_MATCHERS_3OPS(OP_MD_XOR,		MDOP_XOR)
@@ -944,8 +1490,7 @@ CCodeGen_x86::CONSTMATCHER CCodeGen_x86::g_mdConstMatchers[] =
 	MD_CONST_MATCHERS_SHIFT(OP_MD_SRAW,		MDOP_SRAW, 0x1F)
 	MD_CONST_MATCHERS_SHIFT(OP_MD_SLLW,		MDOP_SLLW, 0x1F)
 
-	{ OP_MD_SRL256,				MATCH_VARIABLE128,			MATCH_MEMORY256,			MATCH_VARIABLE,			&CCodeGen_x86::Emit_Md_Srl256_VarMemVar						},
-	{ OP_MD_SRL256,				MATCH_VARIABLE128,			MATCH_MEMORY256,			MATCH_CONSTANT,			&CCodeGen_x86::Emit_Md_Srl256_VarMemCst						},
+	{ OP_MD_SRL256,				MATCH_VARIABLE128,			MATCH_TEMPORARY256,			MATCH_VARIABLE,			&CCodeGen_x86::Emit_Md_Srl256_VarMemVar						},
 
 	{ OP_MD_EXPAND,				MATCH_REGISTER128,			MATCH_REGISTER,				MATCH_NIL,				&CCodeGen_x86::Emit_Md_Expand_RegReg						},
 	{ OP_MD_EXPAND,				MATCH_REGISTER128,			MATCH_MEMORY,				MATCH_NIL,				&CCodeGen_x86::Emit_Md_Expand_RegMem						},
@@ -954,6 +1499,12 @@ CCodeGen_x86::CONSTMATCHER CCodeGen_x86::g_mdConstMatchers[] =
 	{ OP_MD_EXPAND,				MATCH_MEMORY128,			MATCH_MEMORY,				MATCH_NIL,				&CCodeGen_x86::Emit_Md_Expand_MemMem						},
 	{ OP_MD_EXPAND,				MATCH_MEMORY128,			MATCH_CONSTANT,				MATCH_NIL,				&CCodeGen_x86::Emit_Md_Expand_MemCst						},
 
+	{ OP_MD_SHUFFLE_W,			MATCH_REGISTER128,			MATCH_VARIABLE128,			MATCH_CONSTANT,			&CCodeGen_x86::Emit_Md_Shuffle_RegVarCst					},
+	{ OP_MD_SHUFFLE_W,			MATCH_MEMORY128,			MATCH_VARIABLE128,			MATCH_CONSTANT,			&CCodeGen_x86::Emit_Md_Shuffle_MemVarCst					},
+
+	{ OP_MD_EXTRACT_W,			MATCH_VARIABLE,				MATCH_REGISTER128,			MATCH_CONSTANT,			&CCodeGen_x86::Emit_Md_ExtractW_VarRegCst					},
+	{ OP_MD_EXTRACT_W,			MATCH_VARIABLE,				MATCH_MEMORY128,			MATCH_CONSTANT,			&CCodeGen_x86::Emit_Md_ExtractW_VarMemCst					},
+
 	{ OP_MD_PACK_HB,			MATCH_VARIABLE128,			MATCH_VARIABLE128,			MATCH_VARIABLE128,		&CCodeGen_x86::Emit_Md_PackHB_VarVarVar,					},
 	{ OP_MD_PACK_WH,			MATCH_VARIABLE128,			MATCH_VARIABLE128,			MATCH_VARIABLE128,		&CCodeGen_x86::Emit_Md_PackWH_VarVarVar,					},
 
@@ -968,6 +1519,8 @@ CCodeGen_x86::CONSTMATCHER CCodeGen_x86::g_mdConstMatchers[] =
 	MD_CONST_MATCHERS_3OPS(OP_MD_ADD_S, MDOP_ADDS)
 	MD_CONST_MATCHERS_3OPS(OP_MD_SUB_S, MDOP_SUBS)
 	MD_CONST_MATCHERS_3OPS(OP_MD_MUL_S, MDOP_MULS)
+	{ OP_MD_MADD_S,				MATCH_VARIABLE128,			MATCH_VARIABLE128,			MATCH_VARIABLE128,		&CCodeGen_x86::Emit_Md_MulAcc_VarVarVarVar<MDOP_ADDS>		},
+	{ OP_MD_MSUB_S,				MATCH_VARIABLE128,			MATCH_VARIABLE128,			MATCH_VARIABLE128,		&CCodeGen_x86::Emit_Md_MulAcc_VarVarVarVar<MDOP_SUBS>		},
 	MD_CONST_MATCHERS_3OPS(OP_MD_DIV_S, MDOP_DIVS)
 
 	MD_CONST_MATCHERS_3OPS(OP_MD_MIN_S, MDOP_MINS)
@@ -983,6 +1536,11 @@ CCodeGen_x86::CONSTMATCHER CCodeGen_x86::g_mdConstMatchers[] =
 	{ OP_MD_ISZERO,				MATCH_MEMORY,				MATCH_VARIABLE128,			MATCH_NIL,				&CCodeGen_x86::Emit_Md_GetFlag_MemVar<MDOP_ISZERO>			},
 
 	MD_CONST_MATCHERS_2OPS(OP_MD_TOWORD_TRUNCATE,	MDOP_TOWORD_TRUNCATE)
+
+	{ OP_MD_TOWORD,				MATCH_VARIABLE128,			MATCH_VARIABLE128,			MATCH_CONSTANT,			&CCodeGen_x86::Emit_Md_ToWord_VarVarCst						},
+	{ OP_MD_TOWORD_SAT,			MATCH_VARIABLE128,			MATCH_VARIABLE128,			MATCH_CONSTANT,			&CCodeGen_x86::Emit_Md_ToWordSat_VarVarCst					},
+	{ OP_MD_ROUND,				MATCH_VARIABLE128,			MATCH_VARIABLE128,			MATCH_CONSTANT,			&CCodeGen_x86::Emit_Md_Round_VarVarCst						},
+
 	MD_CONST_MATCHERS_2OPS(OP_MD_TOSINGLE,			MDOP_TOSINGLE)
 
 	{ OP_MOV,					MATCH_REGISTER128,			MATCH_VARIABLE128,			MATCH_NIL,				&CCodeGen_x86::Emit_Md_Mov_RegVar,							},
@@ -990,8 +1548,6 @@ CCodeGen_x86::CONSTMATCHER CCodeGen_x86::g_mdConstMatchers[] =
 	{ OP_MOV,					MATCH_MEMORY128,			MATCH_MEMORY128,			MATCH_NIL,				&CCodeGen_x86::Emit_Md_Mov_MemMem							},
 	{ OP_MD_MOV_MASKED,			MATCH_VARIABLE128,			MATCH_VARIABLE128,			MATCH_VARIABLE128,		&CCodeGen_x86::Emit_Md_MovMasked_VarVarVar					},
 
-	{ OP_MERGETO256,			MATCH_MEMORY256,			MATCH_VARIABLE128,			MATCH_VARIABLE128,		&CCodeGen_x86::Emit_MergeTo256_MemVarVar					},
-
 	{ OP_MOV,					MATCH_NIL,					MATCH_NIL,					MATCH_NIL,				NULL														},
 };
 
@@ -1010,3 +1566,81 @@ CCodeGen_x86::CONSTMATCHER CCodeGen_x86::g_mdMinMaxWSse41ConstMatchers[] =
 
 	{ OP_MOV, MATCH_NIL, MATCH_NIL, MATCH_NIL, nullptr },
 };
+
+CCodeGen_x86::CONSTMATCHER CCodeGen_x86::g_mdInsertWConstMatchers[] = 
+{
+	{ OP_MD_INSERT_W,			MATCH_VARIABLE128,			MATCH_VARIABLE128,			MATCH_VARIABLE128,		&CCodeGen_x86::Emit_Md_InsertW_VarVarVar					},
+
+	{ OP_MOV, MATCH_NIL, MATCH_NIL, MATCH_NIL, nullptr },
+};
+
+CCodeGen_x86::CONSTMATCHER CCodeGen_x86::g_mdInsertWSse41ConstMatchers[] = 
+{
+	{ OP_MD_INSERT_W,			MATCH_VARIABLE128,			MATCH_VARIABLE128,			MATCH_VARIABLE128,		&CCodeGen_x86::Emit_Md_InsertW_Sse41_VarVarVar				},
+
+	{ OP_MOV, MATCH_NIL, MATCH_NIL, MATCH_NIL, nullptr },
+};
+
+CCodeGen_x86::CONSTMATCHER CCodeGen_x86::g_mdMulWConstMatchers[] = 
+{
+	{ OP_MD_MUL_W,	MATCH_VARIABLE128,	MATCH_VARIABLE128,	MATCH_VARIABLE128,	&CCodeGen_x86::Emit_Md_MulW_VarVarVar	},
+
+	{ OP_MOV, MATCH_NIL, MATCH_NIL, MATCH_NIL, nullptr },
+};
+
+CCodeGen_x86::CONSTMATCHER CCodeGen_x86::g_mdMulWSse41ConstMatchers[] = 
+{
+	MD_CONST_MATCHERS_3OPS(OP_MD_MUL_W,		MDOP_MULW)
+
+	{ OP_MOV, MATCH_NIL, MATCH_NIL, MATCH_NIL, nullptr },
+};
+
+CCodeGen_x86::CONSTMATCHER CCodeGen_x86::g_mdFusedMulAddConstMatchers[] = 
+{
+	{ OP_MD_FMADD_S,			MATCH_VARIABLE128,			MATCH_VARIABLE128,			MATCH_VARIABLE128,		&CCodeGen_x86::Emit_Md_MulAcc_VarVarVarVar<MDOP_ADDS>		},
+	{ OP_MD_FMSUB_S,			MATCH_VARIABLE128,			MATCH_VARIABLE128,			MATCH_VARIABLE128,		&CCodeGen_x86::Emit_Md_MulAcc_VarVarVarVar<MDOP_SUBS>		},
+
+	{ OP_MOV, MATCH_NIL, MATCH_NIL, MATCH_NIL, nullptr },
+};
+
+CCodeGen_x86::CONSTMATCHER CCodeGen_x86::g_mdFusedMulAddFmaConstMatchers[] = 
+{
+	{ OP_MD_FMADD_S,			MATCH_VARIABLE128,			MATCH_VARIABLE128,			MATCH_VARIABLE128,		&CCodeGen_x86::Emit_Md_FusedMulAcc_VarVarVarVar<FMAOP_MADDPS>	},
+	{ OP_MD_FMSUB_S,			MATCH_VARIABLE128,			MATCH_VARIABLE128,			MATCH_VARIABLE128,		&CCodeGen_x86::Emit_Md_FusedMulAcc_VarVarVarVar<FMAOP_MSUBPS>	},
+
+	{ OP_MOV, MATCH_NIL, MATCH_NIL, MATCH_NIL, nullptr },
+};
+
+CCodeGen_x86::CONSTMATCHER CCodeGen_x86::g_md256ConstMatchers[] = 
+{
+	{ OP_MD_SRL256,				MATCH_VARIABLE128,			MATCH_TEMPORARY256,			MATCH_CONSTANT,			&CCodeGen_x86::Emit_Md_Srl256_VarMemCst						},
+	{ OP_MERGETO256,			MATCH_TEMPORARY256,			MATCH_VARIABLE128,			MATCH_VARIABLE128,		&CCodeGen_x86::Emit_MergeTo256_MemVarVar					},
+
+	{ OP_MOV, MATCH_NIL, MATCH_NIL, MATCH_NIL, nullptr },
+};
+
+CCodeGen_x86::CONSTMATCHER CCodeGen_x86::g_md256Avx2ConstMatchers[] = 
+{
+	{ OP_MD_ADD_B,				MATCH_VARIABLE256,			MATCH_VARIABLE256,			MATCH_VARIABLE256,		&CCodeGen_x86::Emit_Md256_VarVarVar<MDOP256_ADDB>			},
+	{ OP_MD_ADD_H,				MATCH_VARIABLE256,			MATCH_VARIABLE256,			MATCH_VARIABLE256,		&CCodeGen_x86::Emit_Md256_VarVarVar<MDOP256_ADDH>			},
+	{ OP_MD_ADD_W,				MATCH_VARIABLE256,			MATCH_VARIABLE256,			MATCH_VARIABLE256,		&CCodeGen_x86::Emit_Md256_VarVarVar<MDOP256_ADDW>			},
+	{ OP_MD_SUB_B,				MATCH_VARIABLE256,			MATCH_VARIABLE256,			MATCH_VARIABLE256,		&CCodeGen_x86::Emit_Md256_VarVarVar<MDOP256_SUBB>			},
+	{ OP_MD_SUB_H,				MATCH_VARIABLE256,			MATCH_VARIABLE256,			MATCH_VARIABLE256,		&CCodeGen_x86::Emit_Md256_VarVarVar<MDOP256_SUBH>			},
+	{ OP_MD_SUB_W,				MATCH_VARIABLE256,			MATCH_VARIABLE256,			MATCH_VARIABLE256,		&CCodeGen_x86::Emit_Md256_VarVarVar<MDOP256_SUBW>			},
+
+	{ OP_MD_AND,				MATCH_VARIABLE256,			MATCH_VARIABLE256,			MATCH_VARIABLE256,		&CCodeGen_x86::Emit_Md256_VarVarVar<MDOP256_AND>			},
+	{ OP_MD_OR,					MATCH_VARIABLE256,			MATCH_VARIABLE256,			MATCH_VARIABLE256,		&CCodeGen_x86::Emit_Md256_VarVarVar<MDOP256_OR>				},
+	{ OP_MD_XOR,				MATCH_VARIABLE256,			MATCH_VARIABLE256,			MATCH_VARIABLE256,		&CCodeGen_x86::Emit_Md256_VarVarVar<MDOP256_XOR>			},
+
+	{ OP_MD_ADD_S,				MATCH_VARIABLE256,			MATCH_VARIABLE256,			MATCH_VARIABLE256,		&CCodeGen_x86::Emit_Md256_VarVarVar<MDOP256_ADDS>			},
+	{ OP_MD_SUB_S,				MATCH_VARIABLE256,			MATCH_VARIABLE256,			MATCH_VARIABLE256,		&CCodeGen_x86::Emit_Md256_VarVarVar<MDOP256_SUBS>			},
+	{ OP_MD_MUL_S,				MATCH_VARIABLE256,			MATCH_VARIABLE256,			MATCH_VARIABLE256,		&CCodeGen_x86::Emit_Md256_VarVarVar<MDOP256_MULS>			},
+
+	{ OP_MOV,					MATCH_VARIABLE256,			MATCH_VARIABLE256,			MATCH_NIL,				&CCodeGen_x86::Emit_Md256_Mov_VarVar						},
+
+	{ OP_MD_SRL256,				MATCH_VARIABLE128,			MATCH_VARIABLE256,			MATCH_CONSTANT,			&CCodeGen_x86::Emit_Md_Srl256_Avx2_VarVarCst				},
+	{ OP_MERGETO256,			MATCH_REGISTER256,			MATCH_VARIABLE128,			MATCH_VARIABLE128,		&CCodeGen_x86::Emit_MergeTo256_Avx2_RegVarVar				},
+	{ OP_MERGETO256,			MATCH_TEMPORARY256,			MATCH_VARIABLE128,			MATCH_VARIABLE128,		&CCodeGen_x86::Emit_MergeTo256_MemVarVar					},
+
+	{ OP_MOV, MATCH_NIL, MATCH_NIL, MATCH_NIL, nullptr },
+};
@@ -0,0 +1,248 @@
+#include <assert.h>
+#include <algorithm>
+#include <stdexcept>
+#include <unordered_map>
+#include "Jitter.h"
+
+using namespace Jitter;
+
+//Captured functions are stored one after the other, each one being:
+//- Header: magic (uint32), version (uint32)
+//- Next temporary, next block id, label count followed by (label, block id) pairs
+//- Block count followed by blocks:
+//  - Id, flags, symbol count followed by (type, value low, value high) triplets
+//  - Statement count followed by (op, condition, jump block + 1, operand mask, operand symbol indices)
+//All values following the header are encoded as LEB128 variable length integers.
+
+namespace
+{
+	enum
+	{
+		IR_MAGIC = 0x3152494A,	//'JIR1'
+		IR_VERSION = 12,
+	};
+
+	enum BLOCK_FLAG
+	{
+		BLOCK_FLAG_OPTIMIZED = 0x01,
+		BLOCK_FLAG_HASJUMPREF = 0x02,
+		BLOCK_FLAG_COLD = 0x04,
+	};
+
+	void WriteVarInt(Framework::CStream& stream, uint64 value)
+	{
+		uint8 buffer[10];
+		unsigned int size = 0;
+		do
+		{
+			uint8 byte = static_cast<uint8>(value & 0x7F);
+			value >>= 7;
+			if(value != 0) byte |= 0x80;
+			buffer[size++] = byte;
+		} while(value != 0);
+		stream.Write(buffer, size);
+	}
+
+	uint64 ReadVarInt(Framework::CStream& stream)
+	{
+		uint64 result = 0;
+		for(unsigned int shift = 0; shift < 64; shift += 7)
+		{
+			uint8 byte = 0;
+			if(stream.Read(&byte, 1) != 1)
+			{
+				throw std::runtime_error("Unexpected end of IR stream.");
+			}
+			result |= static_cast<uint64>(byte & 0x7F) << shift;
+			if((byte & 0x80) == 0) return result;
+		}
+		throw std::runtime_error("Invalid integer in IR stream.");
+	}
+
+	uint32 ReadVarInt32(Framework::CStream& stream)
+	{
+		auto value = ReadVarInt(stream);
+		if(value > UINT32_MAX)
+		{
+			throw std::runtime_error("Invalid integer in IR stream.");
+		}
+		return static_cast<uint32>(value);
+	}
+}
+
+void CJitter::WriteIr(Framework::CStream& stream) const
+{
+	stream.Write32(IR_MAGIC);
+	stream.Write32(IR_VERSION);
+
+	WriteVarInt(stream, m_nextTemporary);
+	WriteVarInt(stream, m_nextBlockId);
+	WriteVarInt(stream, m_labels.size());
+	for(const auto& labelPair : m_labels)
+	{
+		WriteVarInt(stream, labelPair.first);
+		WriteVarInt(stream, labelPair.second);
+	}
+
+	WriteVarInt(stream, m_basicBlocks.size());
+	for(const auto& basicBlock : m_basicBlocks)
+	{
+		//Symbols are numbered by first use to keep the output independent of the symbol table's ordering,
+		//unused symbols are kept so that the table can be rebuilt as is
+		std::vector<const CSymbol*> symbols;
+		std::unordered_map<const CSymbol*, uint32> symbolIndices;
+		auto addSymbol =
+			[&] (const CSymbol* symbol)
+			{
+				if(symbolIndices.find(symbol) != std::end(symbolIndices)) return;
+				symbolIndices.insert(std::make_pair(symbol, static_cast<uint32>(symbols.size())));
+				symbols.push_back(symbol);
+			};
+		for(const auto& statement : basicBlock.statements)
+		{
+			statement.VisitOperands(
+				[&] (const SymbolRefPtr& symbolRef, bool)
+				{
+					addSymbol(symbolRef->GetSymbol().get());
+				}
+			);
+		}
+		std::vector<const CSymbol*> unusedSymbols;
+		for(const auto& symbol : basicBlock.symbolTable.GetSymbols())
+		{
+			if(symbolIndices.find(symbol.get()) != std::end(symbolIndices)) continue;
+			unusedSymbols.push_back(symbol.get());
+		}
+		std::sort(std::begin(unusedSymbols), std::end(unusedSymbols),
+			[] (const CSymbol* symbol1, const CSymbol* symbol2)
+			{
+				if(symbol1->m_type != symbol2->m_type) return symbol1->m_type < symbol2->m_type;
+				if(symbol1->m_valueLow != symbol2->m_valueLow) return symbol1->m_valueLow < symbol2->m_valueLow;
+				return symbol1->m_valueHigh < symbol2->m_valueHigh;
+			}
+		);
+		for(const auto& symbol : unusedSymbols)
+		{
+			addSymbol(symbol);
+		}
+
+		uint32 flags = 0;
+		if(basicBlock.optimized) flags |= BLOCK_FLAG_OPTIMIZED;
+		if(basicBlock.hasJumpRef) flags |= BLOCK_FLAG_HASJUMPREF;
+		if(basicBlock.cold) flags |= BLOCK_FLAG_COLD;
+
+		WriteVarInt(stream, basicBlock.id);
+		WriteVarInt(stream, flags);
+		WriteVarInt(stream, symbols.size());
+		for(const auto& symbol : symbols)
+		{
+			WriteVarInt(stream, symbol->m_type);
+			WriteVarInt(stream, symbol->m_valueLow);
+			WriteVarInt(stream, symbol->m_valueHigh);
+		}
+
+		WriteVarInt(stream, basicBlock.statements.size());
+		for(const auto& statement : basicBlock.statements)
+		{
+			const SymbolRefPtr* operands[] = { &statement.dst, &statement.src1, &statement.src2, &statement.src3 };
+			uint32 operandMask = 0;
+			for(unsigned int i = 0; i < 4; i++)
+			{
+				if(*operands[i]) operandMask |= (1 << i);
+			}
+
+			WriteVarInt(stream, statement.op);
+			WriteVarInt(stream, statement.jmpCondition);
+			//Most statements don't jump, store their block (-1) as 0
+			WriteVarInt(stream, statement.jmpBlock + 1);
+			WriteVarInt(stream, operandMask);
+			for(const auto& operand : operands)
+			{
+				if(!*operand) continue;
+				WriteVarInt(stream, symbolIndices[(*operand)->GetSymbol().get()]);
+			}
+		}
+	}
+}
+
+bool CJitter::BeginFromIr(Framework::CStream& stream)
+{
+	assert(m_blockStarted == false);
+
+	uint32 magic = 0;
+	auto magicSize = stream.Read(&magic, sizeof(magic));
+	if(magicSize == 0) return false;
+	if((magicSize != sizeof(magic)) || (magic != IR_MAGIC))
+	{
+		throw std::runtime_error("Invalid IR stream.");
+	}
+	if(stream.Read32() != IR_VERSION)
+	{
+		throw std::runtime_error("Unsupported IR stream version.");
+	}
+
+	Begin();
+	m_basicBlocks.clear();
+	m_labels.clear();
+
+	m_nextTemporary = ReadVarInt32(stream);
+	m_nextBlockId = ReadVarInt32(stream);
+	auto labelCount = ReadVarInt(stream);
+	for(uint64 i = 0; i < labelCount; i++)
+	{
+		auto label = ReadVarInt32(stream);
+		auto blockId = ReadVarInt32(stream);
+		m_labels[label] = blockId;
+		m_nextLabelId = std::max<LABEL>(m_nextLabelId, label + 1);
+	}
+
+	auto blockCount = ReadVarInt(stream);
+	if(blockCount == 0)
+	{
+		throw std::runtime_error("Invalid IR stream.");
+	}
+	for(uint64 blockIndex = 0; blockIndex < blockCount; blockIndex++)
+	{
+		auto& basicBlock = *m_basicBlocks.emplace(m_basicBlocks.end(), BASIC_BLOCK());
+		basicBlock.id = ReadVarInt32(stream);
+		auto flags = ReadVarInt32(stream);
+		basicBlock.optimized = (flags & BLOCK_FLAG_OPTIMIZED) != 0;
+		basicBlock.hasJumpRef = (flags & BLOCK_FLAG_HASJUMPREF) != 0;
+		basicBlock.cold = (flags & BLOCK_FLAG_COLD) != 0;
+
+		std::vector<SymbolPtr> symbols;
+		auto symbolCount = ReadVarInt(stream);
+		for(uint64 i = 0; i < symbolCount; i++)
+		{
+			auto type = static_cast<SYM_TYPE>(ReadVarInt32(stream));
+			auto valueLow = ReadVarInt32(stream);
+			auto valueHigh = ReadVarInt32(stream);
+			symbols.push_back(basicBlock.symbolTable.MakeSymbol(type, valueLow, valueHigh));
+		}
+
+		auto statementCount = ReadVarInt(stream);
+		for(uint64 i = 0; i < statementCount; i++)
+		{
+			STATEMENT statement;
+			statement.op = static_cast<OPERATION>(ReadVarInt32(stream));
+			statement.jmpCondition = static_cast<CONDITION>(ReadVarInt32(stream));
+			statement.jmpBlock = ReadVarInt32(stream) - 1;
+			auto operandMask = ReadVarInt32(stream);
+			SymbolRefPtr* operands[] = { &statement.dst, &statement.src1, &statement.src2, &statement.src3 };
+			for(unsigned int operandIndex = 0; operandIndex < 4; operandIndex++)
+			{
+				if((operandMask & (1 << operandIndex)) == 0) continue;
+				auto symbolIndex = ReadVarInt(stream);
+				if(symbolIndex >= symbols.size())
+				{
+					throw std::runtime_error("Invalid symbol index in IR stream.");
+				}
+				*operands[operandIndex] = MakeSymbolRef(symbols[symbolIndex]);
+			}
+			basicBlock.statements.push_back(statement);
+		}
+	}
+
+	m_currentBlock = &m_basicBlocks.back();
+	return true;
+}
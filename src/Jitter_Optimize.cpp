@@ -1,5 +1,12 @@
 #include <assert.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+#include <unordered_map>
 #include <vector>
+#include <iterator>
 #include "Jitter.h"
 #include "BitManip.h"
 
@@ -48,7 +55,7 @@ static uint32 GetPowerOf2(uint32 x)
 
 static uint64 MergeConstant64(uint32 lo, uint32 hi)
 {
-	uint64 result = static_cast<uint64>(lo) | (static_cast<uint64>(hi) >> 32);
+	uint64 result = static_cast<uint64>(lo) | (static_cast<uint64>(hi) << 32);
 	return result;
 }
 
@@ -94,6 +101,7 @@ CJitter::VERSIONED_STATEMENT_LIST CJitter::GenerateVersionedStatementList(const
 
 		ReplaceUse()(newStatement.src1, result.relativeVersions);
 		ReplaceUse()(newStatement.src2, result.relativeVersions);
+		ReplaceUse()(newStatement.src3, result.relativeVersions);
 
 		if(CSymbol* dst = dynamic_symbolref_cast(SYM_RELATIVE, newStatement.dst))
 		{
@@ -109,6 +117,11 @@ CJitter::VERSIONED_STATEMENT_LIST CJitter::GenerateVersionedStatementList(const
 		{
 			result.relativeVersions.IncrementRelativeVersion(dst->m_valueLow);
 		}
+		else if(CSymbol* dst = dynamic_symbolref_cast(SYM_FP_REL_DOUBLE, newStatement.dst))
+		{
+			result.relativeVersions.IncrementRelativeVersion(dst->m_valueLow + 0);
+			result.relativeVersions.IncrementRelativeVersion(dst->m_valueLow + 4);
+		}
 		else if(CSymbol* dst = dynamic_symbolref_cast(SYM_RELATIVE64, newStatement.dst))
 		{
 			result.relativeVersions.IncrementRelativeVersion(dst->m_valueLow + 0);
@@ -127,6 +140,13 @@ CJitter::VERSIONED_STATEMENT_LIST CJitter::GenerateVersionedStatementList(const
 			if(mask & 0x04) result.relativeVersions.IncrementRelativeVersion(dst->m_valueLow + 8);
 			if(mask & 0x08) result.relativeVersions.IncrementRelativeVersion(dst->m_valueLow + 12);
 		}
+		else if(CSymbol* dst = dynamic_symbolref_cast(SYM_RELATIVE256, newStatement.dst))
+		{
+			for(uint32 offset = 0; offset < 32; offset += 4)
+			{
+				result.relativeVersions.IncrementRelativeVersion(dst->m_valueLow + offset);
+			}
+		}
 
 		result.statements.push_back(newStatement);
 	}
@@ -152,6 +172,11 @@ StatementList CJitter::CollapseVersionedStatementList(const VERSIONED_STATEMENT_
 			newStatement.src2 = std::make_shared<CSymbolRef>(src2->GetSymbol());
 		}
 
+		if(VersionedSymbolRefPtr src3 = std::dynamic_pointer_cast<CVersionedSymbolRef>(newStatement.src3))
+		{
+			newStatement.src3 = std::make_shared<CSymbolRef>(src3->GetSymbol());
+		}
+
 		if(VersionedSymbolRefPtr dst = std::dynamic_pointer_cast<CVersionedSymbolRef>(newStatement.dst))
 		{
 			newStatement.dst = std::make_shared<CSymbolRef>(dst->GetSymbol());
@@ -162,58 +187,232 @@ StatementList CJitter::CollapseVersionedStatementList(const VERSIONED_STATEMENT_
 	return result;
 }
 
-void CJitter::Compile()
+CJitter::PASS_PIPELINE CJitter::MakePassPipeline(OPTIMIZATION_LEVEL level)
 {
-	while(1)
+	PASS_PIPELINE pipeline;
+	pipeline.blockPasses =
 	{
-		for(auto& basicBlock : m_basicBlocks)
+		OPTIMIZATION_PASS_CONSTANT_PROPAGATION,
+		OPTIMIZATION_PASS_CONSTANT_FOLDING,
+		OPTIMIZATION_PASS_COPY_PROPAGATION,
+		OPTIMIZATION_PASS_DEADCODE_ELIMINATION,
+	};
+	switch(level)
+	{
+	case OPTIMIZATION_LEVEL_NONE:
+		pipeline.maxBlockIterations = 1;
+		break;
+	case OPTIMIZATION_LEVEL_FAST:
+		pipeline.maxBlockIterations = 2;
+		pipeline.flowPasses = { OPTIMIZATION_PASS_PRUNE_BLOCKS, OPTIMIZATION_PASS_MERGE_BLOCKS };
+		pipeline.maxFlowIterations = 1;
+		pipeline.allocateRegisters = true;
+		break;
+	case OPTIMIZATION_LEVEL_FULL:
+		pipeline.blockPasses.push_back(OPTIMIZATION_PASS_FUSE_MULTIPLY_ADD);
+		pipeline.flowPasses = { OPTIMIZATION_PASS_PRUNE_BLOCKS, OPTIMIZATION_PASS_MERGE_BLOCKS };
+		pipeline.coalesceTemporaries = true;
+		pipeline.allocateRegisters = true;
+		break;
+	default:
+		throw std::runtime_error("Unknown optimization level.");
+	}
+	return pipeline;
+}
+
+void CJitter::SetOptimizationLevel(OPTIMIZATION_LEVEL level)
+{
+	SetPassPipeline(MakePassPipeline(level));
+}
+
+void CJitter::SetPassPipeline(const PASS_PIPELINE& pipeline)
+{
+	for(const auto& pass : pipeline.blockPasses)
+	{
+		if(pass > OPTIMIZATION_PASS_FUSE_MULTIPLY_ADD)
 		{
-			if(!basicBlock.optimized)
-			{
-				m_currentBlock = &basicBlock;
+			throw std::runtime_error("Invalid block pass in pipeline.");
+		}
+	}
+	for(const auto& pass : pipeline.flowPasses)
+	{
+		if((pass != OPTIMIZATION_PASS_PRUNE_BLOCKS) && (pass != OPTIMIZATION_PASS_MERGE_BLOCKS))
+		{
+			throw std::runtime_error("Invalid flow pass in pipeline.");
+		}
+	}
+	if(std::find(std::begin(pipeline.blockPasses), std::end(pipeline.blockPasses), OPTIMIZATION_PASS_CONSTANT_FOLDING) == std::end(pipeline.blockPasses))
+	{
+		throw std::runtime_error("Pipeline must fold constants.");
+	}
+	m_passPipeline = pipeline;
+}
 
-				//DumpStatementList(m_currentBlock->statements);
+const CJitter::PASS_PIPELINE& CJitter::GetPassPipeline() const
+{
+	return m_passPipeline;
+}
 
-				VERSIONED_STATEMENT_LIST versionedStatements = GenerateVersionedStatementList(basicBlock.statements);
+void CJitter::SetPassStatsEnabled(bool passStatsEnabled)
+{
+	m_passStatsEnabled = passStatsEnabled;
+}
 
-				while(1)
-				{
-					bool dirty = false;
-					dirty |= ConstantPropagation(versionedStatements.statements);
-					dirty |= ConstantFolding(versionedStatements.statements);
-					dirty |= CopyPropagation(versionedStatements.statements);
-					dirty |= DeadcodeElimination(versionedStatements);
+const CJitter::PassStatsArray& CJitter::GetPassStats() const
+{
+	return m_passStats;
+}
 
-					if(!dirty) break;
-				}
+void CJitter::ResetPassStats()
+{
+	m_passStats = PassStatsArray();
+}
 
-				basicBlock.statements = CollapseVersionedStatementList(versionedStatements);
-				FixFlowControl(basicBlock.statements);
-				basicBlock.optimized = true;
-			}
-		}
+const char* CJitter::GetPassName(OPTIMIZATION_PASS pass)
+{
+	switch(pass)
+	{
+	case OPTIMIZATION_PASS_CONSTANT_PROPAGATION:
+		return "ConstantPropagation";
+	case OPTIMIZATION_PASS_CONSTANT_FOLDING:
+		return "ConstantFolding";
+	case OPTIMIZATION_PASS_COPY_PROPAGATION:
+		return "CopyPropagation";
+	case OPTIMIZATION_PASS_DEADCODE_ELIMINATION:
+		return "DeadcodeElimination";
+	case OPTIMIZATION_PASS_FUSE_MULTIPLY_ADD:
+		return "FuseMultiplyAdd";
+	case OPTIMIZATION_PASS_PRUNE_BLOCKS:
+		return "PruneBlocks";
+	case OPTIMIZATION_PASS_MERGE_BLOCKS:
+		return "MergeBlocks";
+	case OPTIMIZATION_PASS_COALESCE_TEMPORARIES:
+		return "CoalesceTemporaries";
+	case OPTIMIZATION_PASS_ALLOCATE_REGISTERS:
+		return "AllocateRegisters";
+	default:
+		return "Unknown";
+	}
+}
 
-		bool dirty = false;
-		dirty |= PruneBlocks();
-		dirty |= MergeBlocks();
+const CJitter::COMPILE_STATS& CJitter::GetCompileStats() const
+{
+	return m_compileStats;
+}
 
-		if(!dirty) break;
+void CJitter::ResetCompileStats()
+{
+	m_compileStats = COMPILE_STATS();
+}
+
+const char* CJitter::GetCompilePhaseName(COMPILE_PHASE phase)
+{
+	switch(phase)
+	{
+	case COMPILE_PHASE_OPTIMIZE:
+		return "Optimize";
+	case COMPILE_PHASE_ALLOCATE_REGISTERS:
+		return "AllocateRegisters";
+	case COMPILE_PHASE_LAYOUT:
+		return "Layout";
+	case COMPILE_PHASE_GENERATE_CODE:
+		return "GenerateCode";
+	default:
+		return "Unknown";
+	}
+}
+
+void CJitter::SetCompileTraceWriter(CCompileTraceWriter* compileTraceWriter)
+{
+	m_compileTraceWriter = compileTraceWriter;
+}
+
+const CJitter::PASS_PIPELINE& CJitter::GetCompilePassPipeline() const
+{
+	static const auto baselinePipeline = MakePassPipeline(OPTIMIZATION_LEVEL_NONE);
+	return (m_compileTier == COMPILE_TIER_OPTIMIZING) ? m_passPipeline : baselinePipeline;
+}
+
+template <typename CountFunction, typename PassFunction>
+bool CJitter::RunPass(OPTIMIZATION_PASS pass, const CountFunction& countStatements, const PassFunction& runPass)
+{
+	if(!m_passStatsEnabled) return runPass();
+
+	auto statementCount = countStatements();
+	auto startTime = std::chrono::steady_clock::now();
+	bool changed = runPass();
+	auto passTime = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - startTime);
+
+	auto& stats = m_passStats[pass];
+	stats.runCount++;
+	stats.time += passTime.count();
+	stats.statementsRemoved += static_cast<int64>(statementCount) - static_cast<int64>(countStatements());
+	return changed;
+}
+
+void CJitter::Compile()
+{
+	//Phase boundaries
+	std::chrono::steady_clock::time_point phaseTimes[COMPILE_PHASE_COUNT + 1];
+	phaseTimes[COMPILE_PHASE_OPTIMIZE] = std::chrono::steady_clock::now();
+
+	auto statementsIn = GetStatementCount();
+	auto codeStart = m_stream ? m_stream->Tell() : 0;
+
+	if(!m_codeGen->CanHandle256BitsMdOperations())
+	{
+		Split256BitsMdStatements();
+	}
+
+	const auto& pipeline = GetCompilePassPipeline();
+	OptimizeBlocks(pipeline);
+
+	ApplyBlockFrequencies();
+
+	if(m_profileCounters)
+	{
+		InstrumentBlocks();
+	}
+
+	if(m_entryCounter)
+	{
+		InstrumentEntry();
 	}
 
+	phaseTimes[COMPILE_PHASE_ALLOCATE_REGISTERS] = std::chrono::steady_clock::now();
+
 	//Allocate registers
 	for(auto& basicBlock : m_basicBlocks)
 	{
 		m_currentBlock = &basicBlock;
+		auto countStatements = [&] () { return basicBlock.statements.size(); };
 
-		CoalesceTemporaries(basicBlock);
+		if(pipeline.coalesceTemporaries)
+		{
+			RunPass(OPTIMIZATION_PASS_COALESCE_TEMPORARIES, countStatements,
+				[&] () { CoalesceTemporaries(basicBlock); return false; });
+		}
 		RemoveSelfAssignments(basicBlock);
 		PruneSymbols(basicBlock);
 
-		AllocateRegisters(basicBlock);
+		if(pipeline.allocateRegisters)
+		{
+			RunPass(OPTIMIZATION_PASS_ALLOCATE_REGISTERS, countStatements,
+				[&] () { AllocateRegisters(basicBlock); return false; });
+		}
 
 		NormalizeStatements(basicBlock);
 	}
 
+	phaseTimes[COMPILE_PHASE_LAYOUT] = std::chrono::steady_clock::now();
+
+	LayoutBlocks();
+
+	for(const auto& basicBlock : m_basicBlocks)
+	{
+		m_blockLayout.push_back(basicBlock.id);
+	}
+
 	auto result = ConcatBlocks(m_basicBlocks);
 
 #ifdef DUMP_STATEMENTS
@@ -222,9 +421,141 @@ void CJitter::Compile()
 #endif
 
 	unsigned int stackSize = AllocateStack(result);
+
+	phaseTimes[COMPILE_PHASE_GENERATE_CODE] = std::chrono::steady_clock::now();
+
 	m_codeGen->GenerateCode(result.statements, stackSize);
 
+	phaseTimes[COMPILE_PHASE_COUNT] = std::chrono::steady_clock::now();
+
 	m_labels.clear();
+
+	auto& stats = m_compileStats;
+	auto codeSize = m_stream ? (m_stream->Tell() - codeStart) : 0;
+	stats.functionCount++;
+	stats.statementsIn += statementsIn;
+	stats.statementsOut += result.statements.size();
+	stats.blockCount += m_basicBlocks.size();
+	stats.stackSize += stackSize;
+	stats.maxStackSize = std::max<uint32>(stats.maxStackSize, stackSize);
+	stats.codeSize += codeSize;
+	for(unsigned int i = 0; i < COMPILE_PHASE_COUNT; i++)
+	{
+		stats.phaseTimes[i] += std::chrono::duration_cast<std::chrono::nanoseconds>(phaseTimes[i + 1] - phaseTimes[i]).count();
+	}
+
+	if(m_compileTraceWriter)
+	{
+		CCompileTraceWriter::ArgumentArray arguments;
+		arguments.push_back(std::make_pair("statementsIn", statementsIn));
+		arguments.push_back(std::make_pair("statementsOut", static_cast<uint64>(result.statements.size())));
+		arguments.push_back(std::make_pair("blocks", static_cast<uint64>(m_basicBlocks.size())));
+		arguments.push_back(std::make_pair("stackSize", static_cast<uint64>(stackSize)));
+		arguments.push_back(std::make_pair("codeSize", static_cast<uint64>(codeSize)));
+		m_compileTraceWriter->WriteEvent("Compile", phaseTimes[0], phaseTimes[COMPILE_PHASE_COUNT], arguments);
+		for(unsigned int i = 0; i < COMPILE_PHASE_COUNT; i++)
+		{
+			m_compileTraceWriter->WriteEvent(GetCompilePhaseName(static_cast<COMPILE_PHASE>(i)), phaseTimes[i], phaseTimes[i + 1]);
+		}
+	}
+}
+
+void CJitter::OptimizeBlocks(const PASS_PIPELINE& pipeline)
+{
+	//Merging blocks relies on jump references found by HarmonizeBlocks (also done by PruneBlocks)
+	bool harmonized = false;
+	for(unsigned int flowIteration = 0; ; flowIteration++)
+	{
+		for(auto& basicBlock : m_basicBlocks)
+		{
+			if(basicBlock.optimized) continue;
+
+			m_currentBlock = &basicBlock;
+
+			VERSIONED_STATEMENT_LIST versionedStatements = GenerateVersionedStatementList(basicBlock.statements);
+			auto countStatements = [&] () { return versionedStatements.statements.size(); };
+
+			for(unsigned int blockIteration = 0; (pipeline.maxBlockIterations == 0) || (blockIteration < pipeline.maxBlockIterations); blockIteration++)
+			{
+				bool dirty = false;
+				for(const auto& pass : pipeline.blockPasses)
+				{
+					dirty |= RunPass(pass, countStatements, [&] () { return RunBlockPass(pass, versionedStatements); });
+				}
+
+				if(!dirty) break;
+			}
+
+			basicBlock.statements = CollapseVersionedStatementList(versionedStatements);
+			FixFlowControl(basicBlock.statements);
+			basicBlock.optimized = true;
+		}
+
+		if(pipeline.flowPasses.empty()) break;
+		if((pipeline.maxFlowIterations != 0) && (flowIteration == pipeline.maxFlowIterations)) break;
+
+		bool dirty = false;
+		for(const auto& pass : pipeline.flowPasses)
+		{
+			if((pass == OPTIMIZATION_PASS_MERGE_BLOCKS) && !harmonized)
+			{
+				HarmonizeBlocks();
+			}
+			harmonized = true;
+			dirty |= RunPass(pass, [this] () { return GetStatementCount(); }, [&] () { return RunFlowPass(pass); });
+		}
+
+		if(!dirty) break;
+	}
+
+	if(!harmonized)
+	{
+		HarmonizeBlocks();
+	}
+}
+
+bool CJitter::RunBlockPass(OPTIMIZATION_PASS pass, VERSIONED_STATEMENT_LIST& versionedStatements)
+{
+	switch(pass)
+	{
+	case OPTIMIZATION_PASS_CONSTANT_PROPAGATION:
+		return ConstantPropagation(versionedStatements.statements);
+	case OPTIMIZATION_PASS_CONSTANT_FOLDING:
+		return ConstantFolding(versionedStatements.statements);
+	case OPTIMIZATION_PASS_COPY_PROPAGATION:
+		return CopyPropagation(versionedStatements.statements);
+	case OPTIMIZATION_PASS_DEADCODE_ELIMINATION:
+		return DeadcodeElimination(versionedStatements);
+	case OPTIMIZATION_PASS_FUSE_MULTIPLY_ADD:
+		return FuseMultiplyAdd(versionedStatements.statements);
+	default:
+		assert(false);
+		return false;
+	}
+}
+
+bool CJitter::RunFlowPass(OPTIMIZATION_PASS pass)
+{
+	switch(pass)
+	{
+	case OPTIMIZATION_PASS_PRUNE_BLOCKS:
+		return PruneBlocks();
+	case OPTIMIZATION_PASS_MERGE_BLOCKS:
+		return MergeBlocks();
+	default:
+		assert(false);
+		return false;
+	}
+}
+
+size_t CJitter::GetStatementCount() const
+{
+	size_t statementCount = 0;
+	for(const auto& basicBlock : m_basicBlocks)
+	{
+		statementCount += basicBlock.statements.size();
+	}
+	return statementCount;
 }
 
 void CJitter::InsertStatement(const STATEMENT& statement)
@@ -258,6 +589,12 @@ SymbolPtr CJitter::MakeConstant64(uint64 value)
 	return MakeSymbol(m_currentBlock, SYM_CONSTANT64, valueLo, valueHi);
 }
 
+SymbolPtr CJitter::MakeFpTemporarySymbol(const SymbolPtr& srcSymbol)
+{
+	bool isDouble = (srcSymbol->m_type == SYM_FP_REL_DOUBLE) || (srcSymbol->m_type == SYM_FP_TMP_DOUBLE);
+	return MakeSymbol(isDouble ? SYM_FP_TMP_DOUBLE : SYM_FP_TMP_SINGLE, m_nextTemporary++);
+}
+
 SymbolPtr CJitter::MakeSymbol(BASIC_BLOCK* basicBlock, SYM_TYPE type, uint32 valueLo, uint32 valueHi)
 {
 	CSymbolTable& currentSymbolTable(basicBlock->symbolTable);
@@ -356,6 +693,18 @@ bool CJitter::FoldConstantOperation(STATEMENT& statement)
 			statement.src2.reset();
 			changed = true;
 		}
+		else if(
+			(src1cst && ((src1cst->m_valueLow == 0xFF) || (src1cst->m_valueLow == 0xFFFF))) ||
+			(src2cst && ((src2cst->m_valueLow == 0xFF) || (src2cst->m_valueLow == 0xFFFF)))
+		)
+		{
+			//Anding with 0xFF or 0xFFFF is a zero extension
+			if(src1cst) std::swap(statement.src1, statement.src2);
+			auto maskCst = dynamic_symbolref_cast(SYM_CONSTANT, statement.src2);
+			statement.op = (maskCst->m_valueLow == 0xFF) ? OP_ZEXT8 : OP_ZEXT16;
+			statement.src2.reset();
+			changed = true;
+		}
 	}
 	else if(statement.op == OP_OR)
 	{
@@ -471,6 +820,32 @@ bool CJitter::FoldConstantOperation(STATEMENT& statement)
 			changed = true;
 		}
 	}
+	else if(statement.op == OP_ROR)
+	{
+		if(src1cst && src2cst)
+		{
+			uint32 amount = src2cst->m_valueLow & 0x1F;
+			uint32 result = src1cst->m_valueLow;
+			if(amount != 0)
+			{
+				result = (result >> amount) | (result << (32 - amount));
+			}
+			statement.op = OP_MOV;
+			statement.src1 = MakeSymbolRef(MakeSymbol(SYM_CONSTANT, result));
+			statement.src2.reset();
+			changed = true;
+		}
+		else if(
+			(src2cst && ((src2cst->m_valueLow & 0x1F) == 0)) ||
+			(src1cst && ((src1cst->m_valueLow == 0) || (src1cst->m_valueLow == ~0U)))
+		)
+		{
+			//Rotating by 0 or rotating a value with all bits equal
+			statement.op = OP_MOV;
+			statement.src2.reset();
+			changed = true;
+		}
+	}
 	else if(statement.op == OP_LZC)
 	{
 		if(src1cst)
@@ -491,6 +866,82 @@ bool CJitter::FoldConstantOperation(STATEMENT& statement)
 			changed = true;
 		}
 	}
+	else if(
+		(statement.op == OP_SEXT8) || (statement.op == OP_SEXT16) ||
+		(statement.op == OP_ZEXT8) || (statement.op == OP_ZEXT16)
+	)
+	{
+		if(src1cst)
+		{
+			uint32 result = src1cst->m_valueLow;
+			switch(statement.op)
+			{
+			case OP_SEXT8:
+				result = static_cast<int8>(result);
+				break;
+			case OP_SEXT16:
+				result = static_cast<int16>(result);
+				break;
+			case OP_ZEXT8:
+				result = static_cast<uint8>(result);
+				break;
+			case OP_ZEXT16:
+				result = static_cast<uint16>(result);
+				break;
+			default:
+				assert(false);
+				break;
+			}
+			statement.op = OP_MOV;
+			statement.src1 = MakeSymbolRef(MakeSymbol(SYM_CONSTANT, result));
+			changed = true;
+		}
+	}
+	else if(statement.op == OP_BSWAP)
+	{
+		if(src1cst)
+		{
+			uint32 value = src1cst->m_valueLow;
+			uint32 result =
+				(value >> 24) | ((value >> 8) & 0xFF00) |
+				((value << 8) & 0xFF0000) | (value << 24);
+			statement.op = OP_MOV;
+			statement.src1 = MakeSymbolRef(MakeSymbol(SYM_CONSTANT, result));
+			changed = true;
+		}
+	}
+	else if(statement.op == OP_POPCNT)
+	{
+		if(src1cst)
+		{
+			uint32 result = __builtin_popcount(src1cst->m_valueLow);
+			statement.op = OP_MOV;
+			statement.src1 = MakeSymbolRef(MakeSymbol(SYM_CONSTANT, result));
+			changed = true;
+		}
+	}
+	else if(statement.op == OP_CTZ)
+	{
+		if(src1cst)
+		{
+			uint32 result = (src1cst->m_valueLow == 0) ? 32 : __builtin_ctz(src1cst->m_valueLow);
+			statement.op = OP_MOV;
+			statement.src1 = MakeSymbolRef(MakeSymbol(SYM_CONSTANT, result));
+			changed = true;
+		}
+	}
+	else if((statement.op == OP_SEXTTO64) || (statement.op == OP_ZEXTTO64))
+	{
+		if(src1cst)
+		{
+			uint64 result = (statement.op == OP_SEXTTO64) ?
+				static_cast<uint64>(static_cast<int64>(static_cast<int32>(src1cst->m_valueLow))) :
+				static_cast<uint64>(src1cst->m_valueLow);
+			statement.op = OP_MOV;
+			statement.src1 = MakeSymbolRef(MakeConstant64(result));
+			changed = true;
+		}
+	}
 	else if(statement.op == OP_MUL)
 	{
 		if(src1cst && src2cst)
@@ -662,16 +1113,106 @@ bool CJitter::FoldConstant64Operation(STATEMENT& statement)
 			statement.src2.reset();
 			changed = true;
 		}
-	}
-	else if(statement.op == OP_AND64)
-	{
-		if(src1cst && src2cst)
+	}
+	else if(statement.op == OP_AND64)
+	{
+		if(src1cst && src2cst)
+		{
+			uint64 cst1 = MergeConstant64(src1cst->m_valueLow, src1cst->m_valueHigh);
+			uint64 cst2 = MergeConstant64(src2cst->m_valueLow, src2cst->m_valueHigh);
+			uint64 result = cst1 & cst2;
+			statement.op = OP_MOV;
+			statement.src1 = MakeSymbolRef(MakeConstant64(result));
+			statement.src2.reset();
+			changed = true;
+		}
+	}
+	else if((statement.op == OP_OR64) || (statement.op == OP_XOR64))
+	{
+		if(src1cst && src2cst)
+		{
+			uint64 cst1 = MergeConstant64(src1cst->m_valueLow, src1cst->m_valueHigh);
+			uint64 cst2 = MergeConstant64(src2cst->m_valueLow, src2cst->m_valueHigh);
+			uint64 result = (statement.op == OP_OR64) ? (cst1 | cst2) : (cst1 ^ cst2);
+			statement.op = OP_MOV;
+			statement.src1 = MakeSymbolRef(MakeConstant64(result));
+			statement.src2.reset();
+			changed = true;
+		}
+		else if(src1cst && (src1cst->m_valueLow == 0) && (src1cst->m_valueHigh == 0))
+		{
+			statement.op = OP_MOV;
+			statement.src1 = statement.src2;
+			statement.src2.reset();
+			changed = true;
+		}
+		else if(src2cst && (src2cst->m_valueLow == 0) && (src2cst->m_valueHigh == 0))
+		{
+			statement.op = OP_MOV;
+			statement.src2.reset();
+			changed = true;
+		}
+	}
+	else if(statement.op == OP_NOT64)
+	{
+		if(src1cst)
+		{
+			uint64 cst1 = MergeConstant64(src1cst->m_valueLow, src1cst->m_valueHigh);
+			statement.op = OP_MOV;
+			statement.src1 = MakeSymbolRef(MakeConstant64(~cst1));
+			changed = true;
+		}
+	}
+	else if(statement.op == OP_MUL64)
+	{
+		if(src1cst && src2cst)
+		{
+			uint64 cst1 = MergeConstant64(src1cst->m_valueLow, src1cst->m_valueHigh);
+			uint64 cst2 = MergeConstant64(src2cst->m_valueLow, src2cst->m_valueHigh);
+			statement.op = OP_MOV;
+			statement.src1 = MakeSymbolRef(MakeConstant64(cst1 * cst2));
+			statement.src2.reset();
+			changed = true;
+		}
+		else if(src2cst && (src2cst->m_valueLow == 1) && (src2cst->m_valueHigh == 0))
+		{
+			statement.op = OP_MOV;
+			statement.src2.reset();
+			changed = true;
+		}
+	}
+	else if((statement.op == OP_DIV64) || (statement.op == OP_DIVS64))
+	{
+		if(src1cst && src2cst)
+		{
+			uint64 cst1 = MergeConstant64(src1cst->m_valueLow, src1cst->m_valueHigh);
+			uint64 cst2 = MergeConstant64(src2cst->m_valueLow, src2cst->m_valueHigh);
+			//Result is undefined when dividing by zero, overflowing signed division wraps around
+			uint64 result = 0;
+			if(cst2 == 0)
+			{
+				result = 0;
+			}
+			else if((statement.op == OP_DIVS64) && (cst1 == 0x8000000000000000ULL) && (cst2 == ~0ULL))
+			{
+				result = cst1;
+			}
+			else if(statement.op == OP_DIVS64)
+			{
+				result = static_cast<uint64>(static_cast<int64>(cst1) / static_cast<int64>(cst2));
+			}
+			else
+			{
+				result = cst1 / cst2;
+			}
+			statement.op = OP_MOV;
+			statement.src1 = MakeSymbolRef(MakeConstant64(result));
+			statement.src2.reset();
+			changed = true;
+		}
+		else if(src2cst && (src2cst->m_valueLow == 1) && (src2cst->m_valueHigh == 0))
 		{
-			uint64 cst1 = MergeConstant64(src1cst->m_valueLow, src1cst->m_valueHigh);
-			uint64 cst2 = MergeConstant64(src2cst->m_valueLow, src2cst->m_valueHigh);
-			uint64 result = cst1 & cst2;
 			statement.op = OP_MOV;
-			statement.src1 = MakeSymbolRef(MakeConstant64(result));
 			statement.src2.reset();
 			changed = true;
 		}
@@ -733,12 +1274,52 @@ bool CJitter::FoldConstant6432Operation(STATEMENT& statement)
 			changed = true;
 		}
 	}
+	else if(statement.op == OP_ROR64)
+	{
+		if(src1cst && src2cst)
+		{
+			uint32 amount = src2cst->m_valueLow & 0x3F;
+			uint64 result = MergeConstant64(src1cst->m_valueLow, src1cst->m_valueHigh);
+			if(amount != 0)
+			{
+				result = (result >> amount) | (result << (64 - amount));
+			}
+			statement.op = OP_MOV;
+			statement.src1 = MakeSymbolRef(MakeConstant64(result));
+			statement.src2.reset();
+			changed = true;
+		}
+		else if(
+			(src2cst && ((src2cst->m_valueLow & 0x3F) == 0)) ||
+			(src1cst && (src1cst->m_valueLow == src1cst->m_valueHigh) && ((src1cst->m_valueLow == 0) || (src1cst->m_valueLow == ~0U)))
+		)
+		{
+			statement.op = OP_MOV;
+			statement.src2.reset();
+			changed = true;
+		}
+	}
 
 	return changed;
 }
 
 bool CJitter::FoldConstant12832Operation(STATEMENT& statement)
 {
+	if(statement.op == OP_MD_INSERT_W)
+	{
+		//Inserting a lane back in the same place of the same vector
+		auto src3cst = dynamic_symbolref_cast(SYM_CONSTANT, statement.src3);
+		if(src3cst && statement.src1->Equals(statement.src2.get()) && 
+			(((src3cst->m_valueLow >> 2) & 3) == (src3cst->m_valueLow & 3)))
+		{
+			statement.op = OP_MOV;
+			statement.src2.reset();
+			statement.src3.reset();
+			return true;
+		}
+		return false;
+	}
+
 	auto src2cst = dynamic_symbolref_cast(SYM_CONSTANT, statement.src2);
 
 	//Nothing we can do
@@ -770,13 +1351,148 @@ bool CJitter::FoldConstant12832Operation(STATEMENT& statement)
 			changed = true;
 		}
 	}
+	else if(statement.op == OP_MD_SHUFFLE_W)
+	{
+		//Identity selector (3, 2, 1, 0)
+		if((src2cst->m_valueLow & 0xFF) == 0xE4)
+		{
+			statement.op = OP_MOV;
+			statement.src2.reset();
+			changed = true;
+		}
+	}
 
 	return changed;
 }
 
+bool CJitter::FoldConstantFpOperation(STATEMENT& statement, FpConstantMap& fpConstants)
+{
+	//Only double precision values are tracked, and only normal values are folded
+	//to make sure we get the same results as the host FPU would regardless of its flush modes
+	auto isFoldable =
+		[] (double value)
+		{
+			auto category = std::fpclassify(value);
+			return (category == FP_NORMAL) || (category == FP_ZERO);
+		};
+	auto toDouble =
+		[] (uint64 bits)
+		{
+			double value = 0;
+			memcpy(&value, &bits, sizeof(double));
+			return value;
+		};
+	auto toBits =
+		[] (double value)
+		{
+			uint64 bits = 0;
+			memcpy(&bits, &value, sizeof(double));
+			return bits;
+		};
+	auto getConstant =
+		[&] (const SymbolRefPtr& symbolRef, double& value)
+		{
+			if(!symbolRef) return false;
+			auto constantIterator = fpConstants.find(symbolRef->GetSymbol().get());
+			if(constantIterator == std::end(fpConstants)) return false;
+			value = toDouble(constantIterator->second);
+			return isFoldable(value);
+		};
+
+	auto dst = dynamic_symbolref_cast(SYM_FP_TMP_DOUBLE, statement.dst);
+
+	if(statement.op == OP_FP_LDCST)
+	{
+		auto srcCst = dynamic_symbolref_cast(SYM_CONSTANT64, statement.src1);
+		if(!dst) return false;
+		if(srcCst)
+		{
+			fpConstants[dst] = srcCst->GetConstant64();
+		}
+		else
+		{
+			fpConstants.erase(dst);
+		}
+		return false;
+	}
+	else if(statement.op == OP_FP_FROMINT64)
+	{
+		//Backends expect a value in memory here
+		auto srcCst = dynamic_symbolref_cast(SYM_CONSTANT64, statement.src1);
+		if(!dst || !srcCst) return false;
+		auto result = toBits(static_cast<double>(static_cast<int64>(srcCst->GetConstant64())));
+		statement.op = OP_FP_LDCST;
+		statement.src1 = MakeSymbolRef(MakeConstant64(result));
+		fpConstants[dst] = result;
+		return true;
+	}
+	else if(statement.op == OP_FP_TOSINGLE)
+	{
+		double src1 = 0;
+		if(!getConstant(statement.src1, src1)) return false;
+		auto result = static_cast<float>(src1);
+		if(!isFoldable(result)) return false;
+		uint32 resultBits = 0;
+		memcpy(&resultBits, &result, sizeof(float));
+		statement.op = OP_FP_LDCST;
+		statement.src1 = MakeSymbolRef(MakeSymbol(SYM_CONSTANT, resultBits));
+		return true;
+	}
+
+	if(!dst) return false;
+
+	double src1 = 0, src2 = 0;
+	bool hasSrc1 = getConstant(statement.src1, src1);
+	bool hasSrc2 = getConstant(statement.src2, src2);
+
+	//Temporaries can be written more than once, forget whatever we knew about this one
+	fpConstants.erase(dst);
+	if(!hasSrc1) return false;
+
+	bool folded = false;
+	double result = 0;
+	switch(statement.op)
+	{
+	case OP_FP_ADD:
+		if(hasSrc2) { result = src1 + src2; folded = true; }
+		break;
+	case OP_FP_SUB:
+		if(hasSrc2) { result = src1 - src2; folded = true; }
+		break;
+	case OP_FP_MUL:
+		if(hasSrc2) { result = src1 * src2; folded = true; }
+		break;
+	case OP_FP_DIV:
+		if(hasSrc2 && (src2 != 0)) { result = src1 / src2; folded = true; }
+		break;
+	case OP_FP_NEG:
+		result = -src1;
+		folded = true;
+		break;
+	case OP_FP_ABS:
+		result = std::fabs(src1);
+		folded = true;
+		break;
+	case OP_FP_SQRT:
+		if(src1 >= 0) { result = std::sqrt(src1); folded = true; }
+		break;
+	default:
+		break;
+	}
+
+	if(!folded || !isFoldable(result)) return false;
+
+	statement.op = OP_FP_LDCST;
+	statement.src1 = MakeSymbolRef(MakeConstant64(toBits(result)));
+	statement.src2.reset();
+	fpConstants[dst] = toBits(result);
+	return true;
+}
+
 bool CJitter::ConstantFolding(StatementList& statements)
 {
 	bool changed = false;
+	FpConstantMap fpConstants;
 
 	for(auto statementIterator(std::begin(statements));
 		std::end(statements) != statementIterator; statementIterator++)
@@ -786,10 +1502,71 @@ bool CJitter::ConstantFolding(StatementList& statements)
 		changed |= FoldConstant64Operation(statement);
 		changed |= FoldConstant6432Operation(statement);
 		changed |= FoldConstant12832Operation(statement);
+		changed |= FoldConstantFpOperation(statement, fpConstants);
+		changed |= FoldExtensionShifts(statements, statementIterator);
 	}
 	return changed;
 }
 
+bool CJitter::FoldExtensionShifts(StatementList& statements, const StatementList::iterator& shiftStatementIterator)
+{
+	//Replaces (x << 24) >> 24 and (x << 16) >> 16 by the equivalent extension of x,
+	//the left shift is left in place and removed by dead code elimination if it's not used anymore
+	auto& shiftStatement(*shiftStatementIterator);
+	if((shiftStatement.op != OP_SRA) && (shiftStatement.op != OP_SRL)) return false;
+
+	auto shiftCst = dynamic_symbolref_cast(SYM_CONSTANT, shiftStatement.src2);
+	if(!shiftCst) return false;
+
+	bool isSigned = (shiftStatement.op == OP_SRA);
+	OPERATION extOp = OP_NOP;
+	switch(shiftCst->m_valueLow & 0x1F)
+	{
+	case 24:
+		extOp = isSigned ? OP_SEXT8 : OP_ZEXT8;
+		break;
+	case 16:
+		extOp = isSigned ? OP_SEXT16 : OP_ZEXT16;
+		break;
+	default:
+		return false;
+	}
+
+	auto valueSymbol = shiftStatement.src1->GetSymbol();
+	if(!valueSymbol->IsTemporary()) return false;
+
+	//Temporaries are only defined once at this point
+	auto sllStatementIterator = shiftStatementIterator;
+	while(1)
+	{
+		if(sllStatementIterator == std::begin(statements)) return false;
+		--sllStatementIterator;
+		const auto& statement(*sllStatementIterator);
+		if(statement.dst && statement.dst->GetSymbol()->Equals(valueSymbol.get())) break;
+	}
+
+	const auto& sllStatement(*sllStatementIterator);
+	if(sllStatement.op != OP_SLL) return false;
+	auto sllCst = dynamic_symbolref_cast(SYM_CONSTANT, sllStatement.src2);
+	if(!sllCst || ((sllCst->m_valueLow & 0x1F) != (shiftCst->m_valueLow & 0x1F))) return false;
+
+	//The shifted value is moved to the extension, it must not change in between
+	auto srcSymbol = sllStatement.src1->GetSymbol();
+	for(auto statementIterator = std::next(sllStatementIterator);
+		statementIterator != shiftStatementIterator; ++statementIterator)
+	{
+		const auto& statement(*statementIterator);
+		if(!statement.dst || (statement.op == OP_CALL)) return false;
+		auto dstSymbol = statement.dst->GetSymbol();
+		if(dstSymbol->Equals(srcSymbol.get()) || dstSymbol->Aliases(srcSymbol.get())) return false;
+	}
+
+	shiftStatement.op = extOp;
+	shiftStatement.src1 = sllStatement.src1;
+	shiftStatement.src2.reset();
+	return true;
+}
+
 void CJitter::FixFlowControl(StatementList& statements)
 {
 	//Resolve GOTO instructions
@@ -852,12 +1629,267 @@ void CJitter::MergeBasicBlocks(BASIC_BLOCK& dstBlock, const BASIC_BLOCK& srcBloc
 			statement.src2 = std::make_shared<CSymbolRef>(dstSymbolTable.MakeSymbol(symbol));
 		}
 
+		if(statement.src3)
+		{
+			SymbolPtr symbol(statement.src3->GetSymbol());
+			statement.src3 = std::make_shared<CSymbolRef>(dstSymbolTable.MakeSymbol(symbol));
+		}
+
 		dstBlock.statements.push_back(statement);
 	}
 
 	dstBlock.optimized = false;
 }
 
+void CJitter::ApplyBlockFrequencies()
+{
+	//Blocks executed less than this fraction of the entry count are considered cold
+	static const uint64 COLD_FREQUENCY_RATIO = 32;
+
+	if(m_blockFrequencies.empty()) return;
+
+	auto entryFrequencyIterator = m_blockFrequencies.find(m_basicBlocks.front().id);
+	if(entryFrequencyIterator == std::end(m_blockFrequencies)) return;
+
+	uint64 entryFrequency = entryFrequencyIterator->second;
+	if(entryFrequency == 0) return;
+
+	for(auto& basicBlock : m_basicBlocks)
+	{
+		//Keep the hints of blocks we don't have a profile for
+		auto blockFrequencyIterator = m_blockFrequencies.find(basicBlock.id);
+		if(blockFrequencyIterator == std::end(m_blockFrequencies)) continue;
+
+		uint64 blockFrequency = blockFrequencyIterator->second;
+		basicBlock.cold = (blockFrequency * COLD_FREQUENCY_RATIO) < entryFrequency;
+	}
+}
+
+void CJitter::Split256BitsMdStatements()
+{
+	//Every 256-bits temporary gets replaced by a pair of 128-bits temporaries
+	std::unordered_map<uint32, std::pair<uint32, uint32>> temporaryHalves;
+
+	for(auto& basicBlock : m_basicBlocks)
+	{
+		auto makeHalf =
+			[&] (const SymbolRefPtr& symbolRef, unsigned int half) -> SymbolRefPtr
+			{
+				if(!symbolRef) return symbolRef;
+				auto symbol = symbolRef->GetSymbol();
+				switch(symbol->m_type)
+				{
+				case SYM_RELATIVE256:
+					return MakeSymbolRef(MakeSymbol(&basicBlock, SYM_RELATIVE128, symbol->m_valueLow + (half * 0x10), 0));
+				case SYM_TEMPORARY256:
+					{
+						auto halvesIterator = temporaryHalves.find(symbol->m_valueLow);
+						if(halvesIterator == std::end(temporaryHalves))
+						{
+							uint32 lowerTemporary = m_nextTemporary++;
+							uint32 upperTemporary = m_nextTemporary++;
+							halvesIterator = temporaryHalves.insert(std::make_pair(symbol->m_valueLow, std::make_pair(lowerTemporary, upperTemporary))).first;
+						}
+						uint32 temporary = (half == 0) ? halvesIterator->second.first : halvesIterator->second.second;
+						return MakeSymbolRef(MakeSymbol(&basicBlock, SYM_TEMPORARY128, temporary, 0));
+					}
+				default:
+					return symbolRef;
+				}
+			};
+
+		StatementList statements;
+		for(const auto& statement : basicBlock.statements)
+		{
+			//MERGETO256 results are only used by MD_SRL256, which works on 128-bits values everywhere
+			bool split =
+				statement.dst &&
+				(statement.op != OP_MERGETO256) &&
+				((statement.dst->GetSymbol()->m_type == SYM_RELATIVE256) || (statement.dst->GetSymbol()->m_type == SYM_TEMPORARY256));
+			if(!split)
+			{
+				statements.push_back(statement);
+				continue;
+			}
+			for(unsigned int half = 0; half < 2; half++)
+			{
+				auto halfStatement = statement;
+				halfStatement.dst = makeHalf(statement.dst, half);
+				halfStatement.src1 = makeHalf(statement.src1, half);
+				halfStatement.src2 = makeHalf(statement.src2, half);
+				halfStatement.src3 = makeHalf(statement.src3, half);
+				statements.push_back(halfStatement);
+			}
+		}
+		basicBlock.statements = std::move(statements);
+	}
+}
+
+void CJitter::InstrumentBlocks()
+{
+	//One counter per block, one more for the fall through edge of conditional jumps
+	m_requiredProfileCounterCount = 0;
+	for(auto blockIterator = m_basicBlocks.begin();
+		blockIterator != m_basicBlocks.end(); blockIterator++)
+	{
+		m_requiredProfileCounterCount++;
+		const auto& statements = blockIterator->statements;
+		bool hasFallThroughEdge = !statements.empty() && (statements.back().op == OP_CONDJMP) && (std::next(blockIterator) != m_basicBlocks.end());
+		if(hasFallThroughEdge) m_requiredProfileCounterCount++;
+	}
+
+	//A partial profile would mark uninstrumented blocks as cold, leave the function uninstrumented instead
+	if(m_requiredProfileCounterCount > m_profileCounterCount) return;
+
+	auto makeCounterStatement =
+		[&] (uint32 blockId, uint32 targetBlockId)
+		{
+			size_t counterIndex = m_profileCounterInfos.size();
+			assert(counterIndex < m_profileCounterCount);
+
+			PROFILE_COUNTER counterInfo;
+			counterInfo.blockId = blockId;
+			counterInfo.targetBlockId = targetBlockId;
+			m_profileCounterInfos.push_back(counterInfo);
+
+			STATEMENT statement;
+			statement.op	= OP_INCCOUNTER;
+			statement.src1	= MakeSymbolRef(MakeConstantPtr(reinterpret_cast<uintptr_t>(m_profileCounters + counterIndex)));
+			return statement;
+		};
+
+	for(auto blockIterator = m_basicBlocks.begin();
+		blockIterator != m_basicBlocks.end(); blockIterator++)
+	{
+		auto& basicBlock(*blockIterator);
+		m_currentBlock = &basicBlock;
+		basicBlock.statements.push_front(makeCounterStatement(basicBlock.id, 0));
+
+		//Count the fall through edge of conditional jumps in a block inserted before the next one,
+		//the taken count can be deduced from the block count
+		if(basicBlock.statements.back().op != OP_CONDJMP) continue;
+
+		auto nextBlockIterator = std::next(blockIterator);
+		assert(nextBlockIterator != m_basicBlocks.end());
+		if(nextBlockIterator == m_basicBlocks.end()) continue;
+
+		auto edgeBlockIterator = m_basicBlocks.emplace(nextBlockIterator, BASIC_BLOCK());
+		auto& edgeBlock(*edgeBlockIterator);
+		edgeBlock.id = m_nextBlockId++;
+		edgeBlock.cold = nextBlockIterator->cold;
+		edgeBlock.optimized = true;
+
+		m_currentBlock = &edgeBlock;
+		edgeBlock.statements.push_back(makeCounterStatement(basicBlock.id, nextBlockIterator->id));
+
+		blockIterator = edgeBlockIterator;
+	}
+}
+
+void CJitter::InstrumentEntry()
+{
+	auto& entryBlock = m_basicBlocks.front();
+	m_currentBlock = &entryBlock;
+
+	STATEMENT statement;
+	statement.op	= OP_INCCOUNTER;
+	statement.src1	= MakeSymbolRef(MakeConstantPtr(reinterpret_cast<uintptr_t>(m_entryCounter)));
+	entryBlock.statements.push_front(statement);
+}
+
+void CJitter::LayoutBlocks()
+{
+	//Move runs of cold blocks at the end of the function so that the hot path falls through
+	BasicBlockList coldBlocks;
+
+	auto blockIterator = m_basicBlocks.begin();
+	while(blockIterator != m_basicBlocks.end())
+	{
+		//First block is always the entry point
+		if(!blockIterator->cold || (blockIterator == m_basicBlocks.begin()))
+		{
+			blockIterator++;
+			continue;
+		}
+
+		auto runBeginIterator = blockIterator;
+		auto runEndIterator = blockIterator;
+		while((runEndIterator != m_basicBlocks.end()) && runEndIterator->cold)
+		{
+			runEndIterator++;
+		}
+		blockIterator = runEndIterator;
+
+		//Already at the end
+		if(runEndIterator == m_basicBlocks.end()) break;
+
+		auto& prevBlock = *std::prev(runBeginIterator);
+		auto& lastColdBlock = *std::prev(runEndIterator);
+		const auto& nextBlock = *runEndIterator;
+
+		//Previous block must not fall through in the run, unless it branches over it
+		if(prevBlock.statements.empty()) continue;
+		auto& prevStatement = prevBlock.statements.back();
+		bool prevJumps = (prevStatement.op == OP_JMP);
+		bool prevBranchesOver = (prevStatement.op == OP_CONDJMP) && (prevStatement.jmpBlock == nextBlock.id);
+		if(!prevJumps && !prevBranchesOver) continue;
+
+		//Last block of the run will need an explicit jump to its successor
+		bool lastJumps = false;
+		if(!lastColdBlock.statements.empty())
+		{
+			const auto& lastStatement = lastColdBlock.statements.back();
+			if(lastStatement.op == OP_CONDJMP) continue;
+			lastJumps = (lastStatement.op == OP_JMP);
+		}
+
+		if(prevBranchesOver)
+		{
+			prevStatement.jmpCondition = GetReverseCondition(prevStatement.jmpCondition);
+			prevStatement.jmpBlock = runBeginIterator->id;
+		}
+
+		if(!lastJumps)
+		{
+			STATEMENT statement;
+			statement.op		= OP_JMP;
+			statement.jmpBlock	= nextBlock.id;
+			lastColdBlock.statements.push_back(statement);
+		}
+
+		coldBlocks.splice(coldBlocks.end(), m_basicBlocks, runBeginIterator, runEndIterator);
+	}
+
+	if(coldBlocks.empty()) return;
+
+	//Hot path must now jump over the cold blocks to reach the exit
+	uint32 exitBlockId = m_nextBlockId++;
+
+	STATEMENT exitStatement;
+	exitStatement.op		= OP_JMP;
+	exitStatement.jmpBlock	= exitBlockId;
+
+	auto& lastHotBlock = m_basicBlocks.back();
+	auto lastHotOp = lastHotBlock.statements.empty() ? OP_NOP : lastHotBlock.statements.back().op;
+	if(lastHotOp == OP_CONDJMP)
+	{
+		BASIC_BLOCK exitJumpBlock;
+		exitJumpBlock.id = m_nextBlockId++;
+		exitJumpBlock.statements.push_back(exitStatement);
+		m_basicBlocks.push_back(exitJumpBlock);
+	}
+	else if(lastHotOp != OP_JMP)
+	{
+		lastHotBlock.statements.push_back(exitStatement);
+	}
+
+	m_basicBlocks.splice(m_basicBlocks.end(), coldBlocks);
+
+	BASIC_BLOCK exitBlock;
+	exitBlock.id = exitBlockId;
+	m_basicBlocks.push_back(exitBlock);
+}
+
 CJitter::BASIC_BLOCK CJitter::ConcatBlocks(const BasicBlockList& blocks)
 {
 	BASIC_BLOCK result;
@@ -1096,6 +2128,13 @@ bool CJitter::ConstantPropagation(StatementList& statements)
 				changed = true;
 				continue;
 			}
+
+			if(innerStatement.src3 && innerStatement.src3->Equals(outerStatement.dst.get()))
+			{
+				innerStatement.src3 = outerStatement.src1;
+				changed = true;
+				continue;
+			}
 		}
 	}
 	return changed;
@@ -1133,7 +2172,8 @@ bool CJitter::CopyPropagation(StatementList& statements)
 
 			if(
 				(innerStatement.src1 && innerStatement.src1->Equals(outerDstSymbol)) || 
-				(innerStatement.src2 && innerStatement.src2->Equals(outerDstSymbol))
+				(innerStatement.src2 && innerStatement.src2->Equals(outerDstSymbol)) ||
+				(innerStatement.src3 && innerStatement.src3->Equals(outerDstSymbol))
 				)
 			{
 				useCount++;
@@ -1159,6 +2199,7 @@ bool CJitter::CopyPropagation(StatementList& statements)
 					innerStatement.op = outerStatement.op;
 					innerStatement.src1 = outerStatement.src1;
 					innerStatement.src2 = outerStatement.src2;
+					innerStatement.src3 = outerStatement.src3;
 					innerStatement.jmpCondition = outerStatement.jmpCondition;
 					changed = true;
 				}
@@ -1238,6 +2279,20 @@ bool CJitter::DeadcodeElimination(VERSIONED_STATEMENT_LIST& versionedStatementLi
 					break;
 				}
 			}
+			if(innerStatement.src3)
+			{
+				if(innerStatement.src3->Equals(symbolRef.get()))
+				{
+					used = true;
+					break;
+				}
+				SymbolPtr symbol(innerStatement.src3->GetSymbol());
+				if(!symbol->Equals(candidate) && symbol->Aliases(candidate))
+				{
+					used = true;
+					break;
+				}
+			}
 		}
 
 		if(!used)
@@ -1257,6 +2312,123 @@ bool CJitter::DeadcodeElimination(VERSIONED_STATEMENT_LIST& versionedStatementLi
 	return changed;
 }
 
+bool CJitter::FuseMultiplyAdd(StatementList& statements)
+{
+	//Only produces unfused operations, results are the same as the original sequence
+	bool changed = false;
+
+	for(auto mulStatementIterator(statements.begin());
+		statements.end() != mulStatementIterator; )
+	{
+		const auto& mulStatement(*mulStatementIterator);
+
+		OPERATION addOp = OP_NOP, subOp = OP_NOP, maddOp = OP_NOP, msubOp = OP_NOP;
+		switch(mulStatement.op)
+		{
+		case OP_FP_MUL:
+			addOp = OP_FP_ADD;
+			subOp = OP_FP_SUB;
+			maddOp = OP_FP_MADD;
+			msubOp = OP_FP_MSUB;
+			break;
+		case OP_MD_MUL_S:
+			addOp = OP_MD_ADD_S;
+			subOp = OP_MD_SUB_S;
+			maddOp = OP_MD_MADD_S;
+			msubOp = OP_MD_MSUB_S;
+			break;
+		default:
+			break;
+		}
+
+		auto productSymbol = mulStatement.dst.get();
+		if((maddOp == OP_NOP) || !productSymbol->GetSymbol()->IsTemporary())
+		{
+			++mulStatementIterator;
+			continue;
+		}
+
+		auto isUsing =
+			[&] (const STATEMENT& statement)
+			{
+				return
+					(statement.src1 && statement.src1->Equals(productSymbol)) ||
+					(statement.src2 && statement.src2->Equals(productSymbol)) ||
+					(statement.src3 && statement.src3->Equals(productSymbol));
+			};
+
+		auto isWritingFactor =
+			[&] (const STATEMENT& statement)
+			{
+				for(const auto& factor : { mulStatement.src1, mulStatement.src2 })
+				{
+					auto factorSymbol = factor->GetSymbol();
+					auto dstSymbol = statement.dst->GetSymbol();
+					if(dstSymbol->Equals(factorSymbol.get()) || dstSymbol->Aliases(factorSymbol.get())) return true;
+				}
+				return false;
+			};
+
+		//The multiply is moved to the add, its factors must not change in between
+		auto addStatementIterator = std::next(mulStatementIterator);
+		for(; statements.end() != addStatementIterator; ++addStatementIterator)
+		{
+			const auto& statement(*addStatementIterator);
+			if(isUsing(statement)) break;
+			if(!statement.dst || (statement.op == OP_CALL) || isWritingFactor(statement))
+			{
+				addStatementIterator = statements.end();
+				break;
+			}
+		}
+		if(addStatementIterator == statements.end())
+		{
+			++mulStatementIterator;
+			continue;
+		}
+
+		auto& addStatement(*addStatementIterator);
+		SymbolRefPtr accumulator;
+		OPERATION fusedOp = OP_NOP;
+		if((addStatement.op == addOp) && addStatement.src2->Equals(productSymbol))
+		{
+			accumulator = addStatement.src1;
+			fusedOp = maddOp;
+		}
+		else if((addStatement.op == addOp) && addStatement.src1->Equals(productSymbol))
+		{
+			accumulator = addStatement.src2;
+			fusedOp = maddOp;
+		}
+		else if((addStatement.op == subOp) && addStatement.src2->Equals(productSymbol))
+		{
+			accumulator = addStatement.src1;
+			fusedOp = msubOp;
+		}
+
+		bool otherUse = (fusedOp == OP_NOP) || accumulator->Equals(productSymbol);
+		for(auto statementIterator = std::next(addStatementIterator);
+			!otherUse && (statements.end() != statementIterator); ++statementIterator)
+		{
+			otherUse = isUsing(*statementIterator);
+		}
+		if(otherUse)
+		{
+			++mulStatementIterator;
+			continue;
+		}
+
+		addStatement.op = fusedOp;
+		addStatement.src3 = mulStatement.src2;
+		addStatement.src2 = mulStatement.src1;
+		addStatement.src1 = accumulator;
+		mulStatementIterator = statements.erase(mulStatementIterator);
+		changed = true;
+	}
+
+	return changed;
+}
+
 void CJitter::CoalesceTemporaries(BASIC_BLOCK& basicBlock)
 {
 	typedef std::vector<CSymbol*> EncounteredTempList;
@@ -1315,6 +2487,15 @@ void CJitter::CoalesceTemporaries(BASIC_BLOCK& basicBlock)
 						break;
 					}
 				}
+				if(innerStatement.src3)
+				{
+					auto symbol(innerStatement.src3->GetSymbol());
+					if(symbol->Equals(encounteredTemp))
+					{
+						used = true;
+						break;
+					}
+				}
 			}
 
 			if(!used)
@@ -1366,6 +2547,14 @@ void CJitter::CoalesceTemporaries(BASIC_BLOCK& basicBlock)
 						innerStatement.src2 = MakeSymbolRef(candidatePtr);
 					}
 				}
+				if(innerStatement.src3)
+				{
+					auto symbol(innerStatement.src3->GetSymbol());
+					if(symbol->Equals(tempSymbol))
+					{
+						innerStatement.src3 = MakeSymbolRef(candidatePtr);
+					}
+				}
 			}
 		}
 	}
@@ -1442,7 +2631,7 @@ unsigned int CJitter::AllocateStack(BASIC_BLOCK& basicBlock)
 			symbol->m_stackLocation = stackAlloc;
 			stackAlloc += symbolSize;
 		}
-		else if(symbol->m_type == SYM_TEMPORARY64)
+		else if((symbol->m_type == SYM_TEMPORARY64) || (symbol->m_type == SYM_FP_TMP_DOUBLE))
 		{
 			if((stackAlloc & 7) != 0)
 			{
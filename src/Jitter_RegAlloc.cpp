@@ -31,7 +31,7 @@ void CJitter::AllocateRegisters(BASIC_BLOCK& basicBlock)
 
 		MarkAliasedSymbols(basicBlock, allocRange, symbolRegAllocs);
 
-		AssociateSymbolsToRegisters(symbolRegAllocs);
+		AssociateSymbolsToRegisters(symbolRegAllocs, basicBlock.cold);
 
 		//Replace all references to symbols by references to allocated registers
 		for(const auto& statementInfo : IndexedStatementList(basicBlock.statements))
@@ -141,6 +141,7 @@ void CJitter::AllocateRegisters(BASIC_BLOCK& basicBlock)
 		{
 			const auto& statement(statementIterator->second);
 			basicBlock.statements.insert(loadPoint.second, statement);
+			m_compileStats.registerLoadCount++;
 		}
 	}
 
@@ -154,6 +155,7 @@ void CJitter::AllocateRegisters(BASIC_BLOCK& basicBlock)
 		{
 			const auto& statement(statementIterator->second);
 			basicBlock.statements.insert(spillPoint.second, statement);
+			m_compileStats.registerSpillCount++;
 		}
 	}
 
@@ -163,8 +165,11 @@ void CJitter::AllocateRegisters(BASIC_BLOCK& basicBlock)
 #endif
 }
 
-void CJitter::AssociateSymbolsToRegisters(SymbolRegAllocInfo& symbolRegAllocs) const
+void CJitter::AssociateSymbolsToRegisters(SymbolRegAllocInfo& symbolRegAllocs, bool coldBlock) const
 {
+	//In cold blocks, relatives need to be used enough to pay for their load and spill
+	static const unsigned int COLD_RELATIVE_MIN_USECOUNT = 3;
+
 	std::multimap<SYM_TYPE, unsigned int> availableRegisters;
 	{
 		unsigned int regCount = m_codeGen->GetAvailableRegisterCount();
@@ -182,12 +187,16 @@ void CJitter::AssociateSymbolsToRegisters(SymbolRegAllocInfo& symbolRegAllocs) c
 		}
 	}
 
+	//256-bits values share MD registers with 128-bits ones, on hosts that can hold them
+	bool canAllocate256 = m_codeGen->CanHandle256BitsMdOperations();
+
 	auto isRegisterAllocatable =
-		[] (SYM_TYPE symbolType)
+		[canAllocate256] (SYM_TYPE symbolType)
 		{
 			return 
 				(symbolType == SYM_RELATIVE) || (symbolType == SYM_TEMPORARY) ||
-				(symbolType == SYM_RELATIVE128) || (symbolType == SYM_TEMPORARY128);
+				(symbolType == SYM_RELATIVE128) || (symbolType == SYM_TEMPORARY128) ||
+				(canAllocate256 && ((symbolType == SYM_RELATIVE256) || (symbolType == SYM_TEMPORARY256)));
 		};
 
 	//Sort symbols by usage count
@@ -198,6 +207,8 @@ void CJitter::AssociateSymbolsToRegisters(SymbolRegAllocInfo& symbolRegAllocs) c
 		const auto& symbolRegAlloc(symbolRegAllocPair.second);
 		if(!isRegisterAllocatable(symbol->m_type)) continue;
 		if(symbolRegAlloc.aliased) continue;
+		if(coldBlock && (symbolRegAlloc.useCount < COLD_RELATIVE_MIN_USECOUNT) &&
+			((symbol->m_type == SYM_RELATIVE) || (symbol->m_type == SYM_RELATIVE128) || (symbol->m_type == SYM_RELATIVE256))) continue;
 		sortedSymbols.push_back(&symbolRegAllocPair);
 	}
 	sortedSymbols.sort(
@@ -245,9 +256,15 @@ void CJitter::AssociateSymbolsToRegisters(SymbolRegAllocInfo& symbolRegAllocs) c
 			registerIterator = availableRegisters.lower_bound(SYM_REGISTER128);
 			registerIteratorEnd = availableRegisters.upper_bound(SYM_REGISTER128);
 		}
+		else if((symbol->m_type == SYM_RELATIVE256) || (symbol->m_type == SYM_TEMPORARY256))
+		{
+			registerIterator = availableRegisters.lower_bound(SYM_REGISTER128);
+			registerIteratorEnd = availableRegisters.upper_bound(SYM_REGISTER128);
+		}
 		if(registerIterator != registerIteratorEnd)
 		{
-			symbolRegAlloc.registerType = registerIterator->first;
+			bool is256 = (symbol->m_type == SYM_RELATIVE256) || (symbol->m_type == SYM_TEMPORARY256);
+			symbolRegAlloc.registerType = is256 ? SYM_REGISTER256 : registerIterator->first;
 			symbolRegAlloc.registerId = registerIterator->second;
 			availableRegisters.erase(registerIterator);
 		}
@@ -328,6 +345,12 @@ void CJitter::MarkAliasedSymbols(const BASIC_BLOCK& basicBlock, const Allocation
 			auto& symbolRegAlloc = symbolRegAllocs[statement.src1->GetSymbol()];
 			symbolRegAlloc.aliased = true;
 		}
+		if((statement.op == OP_MD_SRL256) && !statement.src2->GetSymbol()->IsConstant())
+		{
+			//This symbol is read at a variable offset, it needs to stay in memory
+			auto& symbolRegAlloc = symbolRegAllocs[statement.src1->GetSymbol()];
+			symbolRegAlloc.aliased = true;
+		}
 		for(auto& symbolRegAlloc : symbolRegAllocs)
 		{
 			if(symbolRegAlloc.second.aliased) continue;
@@ -74,11 +74,14 @@ void Jitter::DumpStatementList(std::ostream& outputStream, const StatementList&
 			break;
 		case OP_MUL:
 		case OP_MULS:
+		case OP_MUL64:
 		case OP_FP_MUL:
 			outputStream << " * ";
 			break;
 		case OP_DIV:
 		case OP_DIVS:
+		case OP_DIV64:
+		case OP_DIVS64:
 		case OP_FP_DIV:
 			outputStream << " / ";
 			break;
@@ -90,15 +93,43 @@ void Jitter::DumpStatementList(std::ostream& outputStream, const StatementList&
 		case OP_LZC:
 			outputStream << " LZC";
 			break;
+		case OP_SEXT8:
+			outputStream << " SEXT8";
+			break;
+		case OP_SEXT16:
+			outputStream << " SEXT16";
+			break;
+		case OP_ZEXT8:
+			outputStream << " ZEXT8";
+			break;
+		case OP_ZEXT16:
+			outputStream << " ZEXT16";
+			break;
+		case OP_ROR:
+		case OP_ROR64:
+			outputStream << " ROR ";
+			break;
+		case OP_BSWAP:
+			outputStream << " BSWAP";
+			break;
+		case OP_POPCNT:
+			outputStream << " POPCNT";
+			break;
+		case OP_CTZ:
+			outputStream << " CTZ";
+			break;
 		case OP_OR:
+		case OP_OR64:
 		case OP_MD_OR:
 			outputStream << " | ";
 			break;
 		case OP_XOR:
+		case OP_XOR64:
 		case OP_MD_XOR:
 			outputStream << " ^ ";
 			break;
 		case OP_NOT:
+		case OP_NOT64:
 		case OP_MD_NOT:
 			outputStream << " ! ";
 			break;
@@ -125,6 +156,30 @@ void Jitter::DumpStatementList(std::ostream& outputStream, const StatementList&
 		case OP_LOADFROMREF:
 			outputStream << " LOADFROM ";
 			break;
+		case OP_LOAD8FROMREF:
+			outputStream << " LOAD8FROM ";
+			break;
+		case OP_LOAD8SFROMREF:
+			outputStream << " LOAD8SFROM ";
+			break;
+		case OP_LOAD16FROMREF:
+			outputStream << " LOAD16FROM ";
+			break;
+		case OP_LOAD16SFROMREF:
+			outputStream << " LOAD16SFROM ";
+			break;
+		case OP_STORE8ATREF:
+			outputStream << " <-8 ";
+			break;
+		case OP_STORE16ATREF:
+			outputStream << " <-16 ";
+			break;
+		case OP_LOADFROMTLB:
+			outputStream << " LOADFROMTLB ";
+			break;
+		case OP_INCCOUNTER:
+			outputStream << " INCCOUNTER ";
+			break;
 		case OP_RELTOREF:
 			outputStream << " TOREF ";
 			break;
@@ -153,6 +208,12 @@ void Jitter::DumpStatementList(std::ostream& outputStream, const StatementList&
 		case OP_EXTHIGH64:
 			outputStream << " EXTHIGH64";
 			break;
+		case OP_SEXTTO64:
+			outputStream << " SEXTTO64";
+			break;
+		case OP_ZEXTTO64:
+			outputStream << " ZEXTTO64";
+			break;
 		case OP_MERGETO64:
 			outputStream << " MERGETO64 ";
 			break;
@@ -183,6 +244,27 @@ void Jitter::DumpStatementList(std::ostream& outputStream, const StatementList&
 		case OP_FP_TOINT_TRUNC:
 			outputStream << " INT(TRUNC)";
 			break;
+		case OP_FP_TOINT:
+			outputStream << " INT ";
+			break;
+		case OP_FP_TOINT_SAT:
+			outputStream << " INT(SAT) ";
+			break;
+		case OP_FP_ROUND:
+			outputStream << " ROUND ";
+			break;
+		case OP_FP_TOINT64_TRUNC:
+			outputStream << " INT64(TRUNC)";
+			break;
+		case OP_FP_FROMINT64:
+			outputStream << " FROMINT64";
+			break;
+		case OP_FP_TOSINGLE:
+			outputStream << " SINGLE";
+			break;
+		case OP_FP_TODOUBLE:
+			outputStream << " DOUBLE";
+			break;
 		case OP_FP_LDCST:
 			outputStream << " LOAD ";
 			break;
@@ -195,6 +277,15 @@ void Jitter::DumpStatementList(std::ostream& outputStream, const StatementList&
 		case OP_MD_PACK_WH:
 			outputStream << " PACK_WH ";
 			break;
+		case OP_MD_SHUFFLE_W:
+			outputStream << " SHUFFLE(W) ";
+			break;
+		case OP_MD_INSERT_W:
+			outputStream << " INSERT(W) ";
+			break;
+		case OP_MD_EXTRACT_W:
+			outputStream << " EXTRACT(W) ";
+			break;
 		case OP_MD_UNPACK_LOWER_BH:
 			outputStream << " UNPACK_LOWER_BH ";
 			break;
@@ -291,6 +382,30 @@ void Jitter::DumpStatementList(std::ostream& outputStream, const StatementList&
 		case OP_MD_DIV_S:
 			outputStream << " /(S) ";
 			break;
+		case OP_MD_MADD_S:
+			outputStream << " MADD(S) ";
+			break;
+		case OP_MD_MSUB_S:
+			outputStream << " MSUB(S) ";
+			break;
+		case OP_MD_FMADD_S:
+			outputStream << " FMADD(S) ";
+			break;
+		case OP_MD_FMSUB_S:
+			outputStream << " FMSUB(S) ";
+			break;
+		case OP_FP_MADD:
+			outputStream << " MADD ";
+			break;
+		case OP_FP_MSUB:
+			outputStream << " MSUB ";
+			break;
+		case OP_FP_FMADD:
+			outputStream << " FMADD ";
+			break;
+		case OP_FP_FMSUB:
+			outputStream << " FMSUB ";
+			break;
 		case OP_MD_MIN_H:
 			outputStream << " MIN(H) ";
 			break;
@@ -309,6 +424,21 @@ void Jitter::DumpStatementList(std::ostream& outputStream, const StatementList&
 		case OP_MD_MAX_S:
 			outputStream << " MAX(S) ";
 			break;
+		case OP_MD_MUL_H:
+			outputStream << " *(H) ";
+			break;
+		case OP_MD_MUL_W:
+			outputStream << " *(W) ";
+			break;
+		case OP_MD_MULHI_H:
+			outputStream << " *HI(H) ";
+			break;
+		case OP_MD_MULEVEN_UWD:
+			outputStream << " *EVEN(UWD) ";
+			break;
+		case OP_MD_MULADDPAIRS_HW:
+			outputStream << " MADDPAIRS(HW) ";
+			break;
 		case OP_MD_ABS_S:
 			outputStream << " ABS(S)";
 			break;
@@ -327,6 +457,15 @@ void Jitter::DumpStatementList(std::ostream& outputStream, const StatementList&
 		case OP_MD_TOWORD_TRUNCATE:
 			outputStream << " TOWORD_TRUNCATE";
 			break;
+		case OP_MD_TOWORD:
+			outputStream << " TOWORD ";
+			break;
+		case OP_MD_TOWORD_SAT:
+			outputStream << " TOWORD(SAT) ";
+			break;
+		case OP_MD_ROUND:
+			outputStream << " ROUND(S) ";
+			break;
 		default:
 			outputStream << " ?? ";
 			break;
@@ -337,6 +476,12 @@ void Jitter::DumpStatementList(std::ostream& outputStream, const StatementList&
 			outputStream << statement.src2->ToString();
 		}
 
+		if(statement.src3)
+		{
+			outputStream << ", ";
+			outputStream << statement.src3->ToString();
+		}
+
 		outputStream << std::endl;
 	}
 }
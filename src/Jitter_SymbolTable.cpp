@@ -18,6 +18,11 @@ CSymbolTable::SymbolSet& CSymbolTable::GetSymbols()
 	return m_symbols;
 }
 
+const CSymbolTable::SymbolSet& CSymbolTable::GetSymbols() const
+{
+	return m_symbols;
+}
+
 CSymbolTable::SymbolIterator CSymbolTable::RemoveSymbol(const SymbolIterator& symbolIterator)
 {
 	return m_symbols.erase(symbolIterator);
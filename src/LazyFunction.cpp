@@ -0,0 +1,175 @@
+#include <cassert>
+#include <algorithm>
+#include <cstring>
+#include <vector>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#include "LazyFunction.h"
+#include "MemStream.h"
+
+#ifdef _MSC_VER
+#define LAZY_FUNCTION_RETURN_ADDRESS() _ReturnAddress()
+#else
+#define LAZY_FUNCTION_RETURN_ADDRESS() __builtin_return_address(0)
+#endif
+
+using namespace Jitter;
+
+namespace
+{
+	//Stubs only receive their function's index in this table, pointers can't be passed as call parameters
+	std::mutex g_lazyFunctionsMutex;
+	std::vector<CLazyFunction*> g_lazyFunctions;
+
+	//Builds a jump from the start of the stub to the compiled code, returns the size of the jump
+	//or 0 if the host isn't supported, in which case calls keep going through the resolver.
+	size_t MakeStubJump(uint8* buffer, const void* stub, const void* target)
+	{
+#if defined(_M_X64) || defined(__x86_64__)
+		auto displacement = reinterpret_cast<intptr_t>(target) - (reinterpret_cast<intptr_t>(stub) + 5);
+		if(displacement == static_cast<int32>(displacement))
+		{
+			//jmp rel32
+			auto displacement32 = static_cast<int32>(displacement);
+			buffer[0] = 0xE9;
+			memcpy(buffer + 1, &displacement32, 4);
+			return 5;
+		}
+		else
+		{
+			//mov rax, imm64; jmp rax
+			auto address = static_cast<uint64>(reinterpret_cast<uintptr_t>(target));
+			buffer[0] = 0x48;
+			buffer[1] = 0xB8;
+			memcpy(buffer + 2, &address, 8);
+			buffer[10] = 0xFF;
+			buffer[11] = 0xE0;
+			return 12;
+		}
+#elif defined(_M_IX86) || defined(__i386__)
+		//jmp rel32
+		auto displacement = static_cast<int32>(reinterpret_cast<intptr_t>(target) - (reinterpret_cast<intptr_t>(stub) + 5));
+		buffer[0] = 0xE9;
+		memcpy(buffer + 1, &displacement, 4);
+		return 5;
+#elif defined(__aarch64__)
+		//ldr x16, #8; br x16; .quad target
+		uint32 instructions[2] = { 0x58000050, 0xD61F0200 };
+		auto address = static_cast<uint64>(reinterpret_cast<uintptr_t>(target));
+		memcpy(buffer, instructions, 8);
+		memcpy(buffer + 8, &address, 8);
+		return 16;
+#elif defined(__arm__)
+		//ldr pc, [pc, #-4]; .word target
+		uint32 instructions[2] = { 0xE51FF004, static_cast<uint32>(reinterpret_cast<uintptr_t>(target)) };
+		memcpy(buffer, instructions, 8);
+		return 8;
+#else
+		return 0;
+#endif
+	}
+}
+
+CLazyFunction::CLazyFunction(CJitter& jitter, const FunctionEmitter& emitter)
+: m_jitter(jitter)
+, m_emitter(emitter)
+{
+	{
+		std::lock_guard<std::mutex> lazyFunctionsLock(g_lazyFunctionsMutex);
+		auto slotIterator = std::find(std::begin(g_lazyFunctions), std::end(g_lazyFunctions), nullptr);
+		if(slotIterator == std::end(g_lazyFunctions))
+		{
+			slotIterator = g_lazyFunctions.insert(slotIterator, nullptr);
+		}
+		*slotIterator = this;
+		m_stubIndex = static_cast<uint32>(slotIterator - std::begin(g_lazyFunctions));
+	}
+
+	Framework::CMemStream stream;
+	m_jitter.SetStream(&stream);
+	m_jitter.Begin();
+	{
+		m_jitter.PushCtx();
+		m_jitter.PushCst(m_stubIndex);
+		m_jitter.Call(reinterpret_cast<void*>(&CLazyFunction::ResolveAndRun), 2, CJitter::RETURN_VALUE_NONE);
+	}
+	m_jitter.End();
+	m_stub = CMemoryFunction(stream.GetBuffer(), stream.GetSize());
+}
+
+CLazyFunction::~CLazyFunction()
+{
+	std::lock_guard<std::mutex> lazyFunctionsLock(g_lazyFunctionsMutex);
+	g_lazyFunctions[m_stubIndex] = nullptr;
+}
+
+bool CLazyFunction::IsCompiled() const
+{
+	std::lock_guard<std::mutex> compileLock(m_compileMutex);
+	return !m_function.IsEmpty();
+}
+
+void CLazyFunction::Compile()
+{
+	CompileAndPatch(nullptr);
+}
+
+void CLazyFunction::CompileAndPatch(const void* stubReturnAddress)
+{
+	std::lock_guard<std::mutex> compileLock(m_compileMutex);
+	if(!m_function.IsEmpty()) return;
+
+	Framework::CMemStream stream;
+	m_jitter.SetStream(&stream);
+	m_jitter.Begin();
+	m_emitter(m_jitter);
+	m_jitter.End();
+	m_function = CMemoryFunction(stream.GetBuffer(), stream.GetSize());
+
+	PatchStub(stubReturnAddress);
+}
+
+void CLazyFunction::operator()(void* context)
+{
+	m_stub(context);
+}
+
+void* CLazyFunction::GetCode() const
+{
+	return m_stub.GetCode();
+}
+
+void CLazyFunction::ResolveAndRun(void* context, uint32 stubIndex)
+{
+	//Only called from stubs, this points in the stub right after its call to us
+	auto stubReturnAddress = LAZY_FUNCTION_RETURN_ADDRESS();
+	CLazyFunction* function = nullptr;
+	{
+		std::lock_guard<std::mutex> lazyFunctionsLock(g_lazyFunctionsMutex);
+		assert(stubIndex < g_lazyFunctions.size());
+		function = g_lazyFunctions[stubIndex];
+	}
+	assert(function);
+	function->CompileAndPatch(stubReturnAddress);
+	reinterpret_cast<FunctionType>(function->m_function.GetCode())(context);
+}
+
+void CLazyFunction::PatchStub(const void* stubReturnAddress)
+{
+	uint8 jump[16];
+	auto jumpSize = MakeStubJump(jump, m_stub.GetCode(), m_function.GetCode());
+	if((jumpSize == 0) || (jumpSize > m_stub.GetSize())) return;
+	if(stubReturnAddress)
+	{
+		//The stub's frame is live and resumes after its call once we return, the jump must only
+		//overwrite code that already ran. Backends are expected to emit a stub prolog and call
+		//sequence at least as large as their jump (5, 12, 16 or 8 bytes), if not the stub is left
+		//as is and calls keep going through the resolver.
+		auto returnOffset = reinterpret_cast<const uint8*>(stubReturnAddress) - reinterpret_cast<const uint8*>(m_stub.GetCode());
+		assert((returnOffset > 0) && (static_cast<size_t>(returnOffset) <= m_stub.GetSize()));
+		assert(static_cast<size_t>(returnOffset) >= jumpSize);
+		if((returnOffset <= 0) || (static_cast<size_t>(returnOffset) < jumpSize)) return;
+	}
+	m_stub.Patch(0, jump, jumpSize);
+}
@@ -28,8 +28,9 @@ void CMachoObjectFile<MachoTraits>::Write(Framework::CStream& stream)
 	FillStringTable(stringTable, m_internalSymbols, internalSymbolInfos);
 	FillStringTable(stringTable, m_externalSymbols, externalSymbolInfos);
 
-	auto textSection = BuildSection(m_internalSymbols, internalSymbolInfos, INTERNAL_SYMBOL_LOCATION_TEXT);
-	auto dataSection = BuildSection(m_internalSymbols, internalSymbolInfos, INTERNAL_SYMBOL_LOCATION_DATA);
+	auto internalSymbolAliases = GetInternalSymbolAliases();
+	auto textSection = BuildSection(m_internalSymbols, internalSymbolInfos, internalSymbolAliases, INTERNAL_SYMBOL_LOCATION_TEXT);
+	auto dataSection = BuildSection(m_internalSymbols, internalSymbolInfos, internalSymbolAliases, INTERNAL_SYMBOL_LOCATION_DATA);
 	
 	//Make sure section size is aligned
 	textSection.data.resize((textSection.data.size() + 0x03) & ~0x03);
@@ -195,7 +196,7 @@ void CMachoObjectFile<MachoTraits>::FillStringTable(StringTable& stringTable, co
 }
 
 template <typename MachoTraits>
-typename CMachoObjectFile<MachoTraits>::SECTION CMachoObjectFile<MachoTraits>::BuildSection(const InternalSymbolArray& internalSymbols, InternalSymbolInfoArray& internalSymbolInfos, INTERNAL_SYMBOL_LOCATION location)
+typename CMachoObjectFile<MachoTraits>::SECTION CMachoObjectFile<MachoTraits>::BuildSection(const InternalSymbolArray& internalSymbols, InternalSymbolInfoArray& internalSymbolInfos, const InternalSymbolAliasArray& internalSymbolAliases, INTERNAL_SYMBOL_LOCATION location)
 {
 	SECTION section;
 	auto& sectionData(section.data);
@@ -211,6 +212,12 @@ typename CMachoObjectFile<MachoTraits>::SECTION CMachoObjectFile<MachoTraits>::B
 		if(internalSymbol.location != location) continue;
 
 		auto& internalSymbolInfo = internalSymbolInfos[i];
+		if(internalSymbolAliases[i] != i)
+		{
+			//Folded, share the code of the first identical symbol
+			internalSymbolInfo.dataOffset = internalSymbolInfos[internalSymbolAliases[i]].dataOffset;
+			continue;
+		}
 		internalSymbolInfo.dataOffset = static_cast<uint32>(sectionData.size());
 		for(const auto& symbolReference : internalSymbol.symbolReferences)
 		{
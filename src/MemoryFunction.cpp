@@ -2,7 +2,13 @@
 #include <string.h>
 #include <assert.h>
 #include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <stdexcept>
+#include <unordered_map>
 #include "MemoryFunction.h"
+#include "PerfJitWriter.h"
+#include "GdbJitRegistrar.h"
 
 #ifdef _WIN32
 
@@ -28,54 +34,186 @@ CMemoryFunction::CMemoryFunction()
 
 }
 
-CMemoryFunction::CMemoryFunction(const void* code, size_t size)
+CMemoryFunction::CMemoryFunction(CMemoryFunction&& rhs)
 : m_code(nullptr)
+, m_size(0)
+{
+	(*this) = std::move(rhs);
+}
+
+struct CMemoryFunction::SHARED_CODE
+{
+	uint64			hash = 0;
+	void*			code = nullptr;
+	size_t			codeSize = 0;
+	size_t			allocSize = 0;
+	unsigned int	refCount = 0;
+};
+
+static std::mutex g_sharedCodeMutex;
+static std::unordered_multimap<uint64, CMemoryFunction::SHARED_CODE*> g_sharedCodes;
+static std::atomic<bool> g_codeFoldingEnabled(false);
+static std::atomic<size_t> g_foldedSize(0);
+
+static uint64 HashCode(const void* code, size_t size)
+{
+	//FNV-1a
+	uint64 hash = 0xCBF29CE484222325ULL;
+	auto bytes = reinterpret_cast<const uint8*>(code);
+	for(size_t i = 0; i < size; i++)
+	{
+		hash = (hash ^ bytes[i]) * 0x100000001B3ULL;
+	}
+	return hash;
+}
+
+CMemoryFunction::CMemoryFunction(const void* code, size_t size, const std::string& name)
+: m_code(nullptr)
+, m_size(0)
+{
+	if(g_codeFoldingEnabled)
+	{
+		auto hash = HashCode(code, size);
+
+		std::lock_guard<std::mutex> sharedCodeLock(g_sharedCodeMutex);
+		auto sharedCodeRange = g_sharedCodes.equal_range(hash);
+		for(auto sharedCodeIterator = sharedCodeRange.first; sharedCodeIterator != sharedCodeRange.second; sharedCodeIterator++)
+		{
+			auto sharedCode = sharedCodeIterator->second;
+			if((sharedCode->codeSize != size) || (memcmp(sharedCode->code, code, size) != 0)) continue;
+			sharedCode->refCount++;
+			g_foldedSize += size;
+			m_code = sharedCode->code;
+			m_size = sharedCode->allocSize;
+			m_sharedCode = sharedCode;
+			//Already known to profilers and debuggers under the name of the first function
+			return;
+		}
+
+		m_code = AllocateCode(code, size, m_size);
+		m_sharedCode = new SHARED_CODE();
+		m_sharedCode->hash = hash;
+		m_sharedCode->code = m_code;
+		m_sharedCode->codeSize = size;
+		m_sharedCode->allocSize = m_size;
+		m_sharedCode->refCount = 1;
+		g_sharedCodes.insert(std::make_pair(hash, m_sharedCode));
+	}
+	else
+	{
+		m_code = AllocateCode(code, size, m_size);
+	}
+
+	auto& perfJitWriter = CPerfJitWriter::GetInstance();
+	if(perfJitWriter.IsEnabled())
+	{
+		perfJitWriter.RegisterCode(m_code, size, name);
+	}
+
+	auto& gdbJitRegistrar = CGdbJitRegistrar::GetInstance();
+	if(gdbJitRegistrar.IsEnabled())
+	{
+		gdbJitRegistrar.RegisterCode(m_code, size, name);
+	}
+}
+
+CMemoryFunction::~CMemoryFunction()
+{
+	Reset();
+}
+
+void CMemoryFunction::SetCodeFoldingEnabled(bool codeFoldingEnabled)
 {
+	g_codeFoldingEnabled = codeFoldingEnabled;
+}
+
+size_t CMemoryFunction::GetFoldedSize()
+{
+	return g_foldedSize;
+}
+
+static void UnregisterSharedCode(CMemoryFunction::SHARED_CODE* sharedCode)
+{
+	auto sharedCodeRange = g_sharedCodes.equal_range(sharedCode->hash);
+	for(auto sharedCodeIterator = sharedCodeRange.first; sharedCodeIterator != sharedCodeRange.second; sharedCodeIterator++)
+	{
+		if(sharedCodeIterator->second != sharedCode) continue;
+		g_sharedCodes.erase(sharedCodeIterator);
+		break;
+	}
+	delete sharedCode;
+}
+
+void* CMemoryFunction::AllocateCode(const void* code, size_t size, size_t& allocSize)
+{
+	void* result = nullptr;
 #ifdef _WIN32
-	m_size = size;
-	m_code = malloc(size);
-	memcpy(m_code, code, size);
+	allocSize = size;
+	result = malloc(size);
+	memcpy(result, code, size);
 	
 	DWORD oldProtect = 0;
-	BOOL result = VirtualProtect(m_code, size, PAGE_EXECUTE_READWRITE, &oldProtect);
-	assert(result == TRUE);
+	BOOL protectResult = VirtualProtect(result, size, PAGE_EXECUTE_READWRITE, &oldProtect);
+	assert(protectResult == TRUE);
 #elif defined(__APPLE__)
 	vm_size_t page_size = 0;
 	host_page_size(mach_task_self(), &page_size);
-	unsigned int allocSize = ((size + page_size - 1) / page_size) * page_size;
-	vm_allocate(mach_task_self(), reinterpret_cast<vm_address_t*>(&m_code), allocSize, TRUE); 
-	memcpy(m_code, code, size);
-	sys_icache_invalidate(m_code, size);
-	kern_return_t result = vm_protect(mach_task_self(), reinterpret_cast<vm_address_t>(m_code), size, 0, VM_PROT_READ | VM_PROT_EXECUTE);
-	assert(result == 0);
-	m_size = allocSize;
+	allocSize = ((size + page_size - 1) / page_size) * page_size;
+	vm_allocate(mach_task_self(), reinterpret_cast<vm_address_t*>(&result), allocSize, TRUE); 
+	memcpy(result, code, size);
+	sys_icache_invalidate(result, size);
+	kern_return_t protectResult = vm_protect(mach_task_self(), reinterpret_cast<vm_address_t>(result), size, 0, VM_PROT_READ | VM_PROT_EXECUTE);
+	assert(protectResult == 0);
 #elif defined(__ANDROID__) || defined(__linux__) || defined(__FreeBSD__)
-	m_size = size;
-	m_code = mmap(nullptr, size, PROT_WRITE | PROT_EXEC, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
-	assert(m_code != MAP_FAILED);
-	memcpy(m_code, code, size);
+	allocSize = size;
+	result = mmap(nullptr, size, PROT_WRITE | PROT_EXEC, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	assert(result != MAP_FAILED);
+	memcpy(result, code, size);
 #if defined(__arm__) || defined(__aarch64__)
-	__clear_cache(m_code, reinterpret_cast<uint8*>(m_code) + size);
+	__clear_cache(result, reinterpret_cast<uint8*>(result) + size);
 #endif
 #endif
+	return result;
 }
 
-CMemoryFunction::~CMemoryFunction()
+void CMemoryFunction::FreeCode(void* code, size_t allocSize)
 {
-	Reset();
+#ifdef WIN32
+	free(code);
+#elif defined(__APPLE__)
+	vm_deallocate(mach_task_self(), reinterpret_cast<vm_address_t>(code), allocSize);
+#elif defined(__ANDROID__) || defined(__linux__) || defined(__FreeBSD__)
+	munmap(code, allocSize);
+#endif
 }
 
 void CMemoryFunction::Reset()
 {
+	if(m_sharedCode != nullptr)
+	{
+		std::lock_guard<std::mutex> sharedCodeLock(g_sharedCodeMutex);
+		assert(m_sharedCode->refCount != 0);
+		m_sharedCode->refCount--;
+		if(m_sharedCode->refCount != 0)
+		{
+			//Still used by other functions
+			g_foldedSize -= m_sharedCode->codeSize;
+			m_code = nullptr;
+		}
+		else
+		{
+			UnregisterSharedCode(m_sharedCode);
+		}
+		m_sharedCode = nullptr;
+	}
 	if(m_code != nullptr)
 	{
-#ifdef WIN32
-		free(m_code);
-#elif defined(__APPLE__)
-		vm_deallocate(mach_task_self(), reinterpret_cast<vm_address_t>(m_code), m_size);
-#elif defined(__ANDROID__) || defined(__linux__) || defined(__FreeBSD__)
-		munmap(m_code, m_size);
-#endif
+		auto& gdbJitRegistrar = CGdbJitRegistrar::GetInstance();
+		if(gdbJitRegistrar.IsEnabled())
+		{
+			gdbJitRegistrar.UnregisterCode(m_code);
+		}
+		FreeCode(m_code, m_size);
 	}
 	m_code = nullptr;
 	m_size = 0;
@@ -91,6 +229,7 @@ CMemoryFunction& CMemoryFunction::operator =(CMemoryFunction&& rhs)
 	Reset();
 	std::swap(m_code, rhs.m_code);
 	std::swap(m_size, rhs.m_size);
+	std::swap(m_sharedCode, rhs.m_sharedCode);
 	return (*this);
 }
 
@@ -101,6 +240,39 @@ void CMemoryFunction::operator()(void* context)
 	fct(context);
 }
 
+void CMemoryFunction::Patch(size_t offset, const void* data, size_t size)
+{
+	assert((offset + size) <= m_size);
+	if(m_sharedCode != nullptr)
+	{
+		//Code stops being a candidate for folding once it's been modified
+		std::lock_guard<std::mutex> sharedCodeLock(g_sharedCodeMutex);
+		if(m_sharedCode->refCount != 1)
+		{
+			throw std::runtime_error("Cannot patch code shared with other functions.");
+		}
+		UnregisterSharedCode(m_sharedCode);
+		m_sharedCode = nullptr;
+	}
+	auto target = reinterpret_cast<uint8*>(m_code) + offset;
+#ifdef _WIN32
+	memcpy(target, data, size);
+	FlushInstructionCache(GetCurrentProcess(), target, size);
+#elif defined(__APPLE__)
+	kern_return_t protectResult = vm_protect(mach_task_self(), reinterpret_cast<vm_address_t>(m_code), m_size, 0, VM_PROT_READ | VM_PROT_WRITE);
+	assert(protectResult == 0);
+	memcpy(target, data, size);
+	sys_icache_invalidate(target, size);
+	protectResult = vm_protect(mach_task_self(), reinterpret_cast<vm_address_t>(m_code), m_size, 0, VM_PROT_READ | VM_PROT_EXECUTE);
+	assert(protectResult == 0);
+#elif defined(__ANDROID__) || defined(__linux__) || defined(__FreeBSD__)
+	memcpy(target, data, size);
+#if defined(__arm__) || defined(__aarch64__)
+	__clear_cache(target, target + size);
+#endif
+#endif
+}
+
 void* CMemoryFunction::GetCode() const
 {
 	return m_code;
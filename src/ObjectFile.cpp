@@ -18,20 +18,14 @@ CObjectFile::~CObjectFile()
 
 unsigned int CObjectFile::AddInternalSymbol(const INTERNAL_SYMBOL& internalSymbol)
 {
+	unsigned int symbolIndex = static_cast<unsigned int>(m_internalSymbols.size());
+	//Lookup through the index map, object files can hold tens of thousands of symbols
+	if(!m_internalSymbolIndices.insert(std::make_pair(internalSymbol.name, symbolIndex)).second)
 	{
-		auto symbolIterator = std::find_if(std::begin(m_internalSymbols), std::end(m_internalSymbols), 
-			[&] (const INTERNAL_SYMBOL& symbol) 
-			{
-				return symbol.name == internalSymbol.name;
-			}
-		);
-		if(symbolIterator != std::end(m_internalSymbols))
-		{
-			throw std::runtime_error("Symbol already exists.");
-		}
+		throw std::runtime_error("Symbol already exists.");
 	}
 	m_internalSymbols.push_back(internalSymbol);
-	return m_internalSymbols.size() - 1;
+	return symbolIndex;
 }
 
 unsigned int CObjectFile::AddExternalSymbol(const EXTERNAL_SYMBOL& externalSymbol)
@@ -61,3 +55,84 @@ unsigned int CObjectFile::GetExternalSymbolIndexByValue(uintptr_t value) const
 	}
 	return externalSymbolIterator - std::begin(m_externalSymbols);
 }
+
+void CObjectFile::SetCodeFoldingEnabled(bool codeFoldingEnabled)
+{
+	m_codeFoldingEnabled = codeFoldingEnabled;
+}
+
+uint32 CObjectFile::GetFoldedSize() const
+{
+	auto aliases = GetInternalSymbolAliases();
+	uint32 foldedSize = 0;
+	for(unsigned int i = 0; i < m_internalSymbols.size(); i++)
+	{
+		if(aliases[i] == i) continue;
+		foldedSize += static_cast<uint32>(m_internalSymbols[i].data.size());
+	}
+	return foldedSize;
+}
+
+static uint64 HashInternalSymbol(const CObjectFile::INTERNAL_SYMBOL& symbol)
+{
+	//FNV-1a
+	uint64 hash = 0xCBF29CE484222325ULL;
+	auto hashValue =
+		[&hash] (uint32 value)
+		{
+			hash = (hash ^ value) * 0x100000001B3ULL;
+		};
+	for(auto value : symbol.data)
+	{
+		hashValue(value);
+	}
+	for(const auto& symbolReference : symbol.symbolReferences)
+	{
+		hashValue(symbolReference.type);
+		hashValue(symbolReference.symbolIndex);
+		hashValue(symbolReference.offset);
+	}
+	return hash;
+}
+
+static bool AreInternalSymbolsIdentical(const CObjectFile::INTERNAL_SYMBOL& symbol1, const CObjectFile::INTERNAL_SYMBOL& symbol2)
+{
+	if(symbol1.data != symbol2.data) return false;
+	if(symbol1.symbolReferences.size() != symbol2.symbolReferences.size()) return false;
+	return std::equal(std::begin(symbol1.symbolReferences), std::end(symbol1.symbolReferences), std::begin(symbol2.symbolReferences),
+		[] (const CObjectFile::SYMBOL_REFERENCE& reference1, const CObjectFile::SYMBOL_REFERENCE& reference2)
+		{
+			return (reference1.type == reference2.type) &&
+				(reference1.symbolIndex == reference2.symbolIndex) &&
+				(reference1.offset == reference2.offset);
+		}
+	);
+}
+
+CObjectFile::InternalSymbolAliasArray CObjectFile::GetInternalSymbolAliases() const
+{
+	InternalSymbolAliasArray aliases(m_internalSymbols.size());
+	std::unordered_multimap<uint64, unsigned int> symbolsByHash;
+	for(unsigned int i = 0; i < m_internalSymbols.size(); i++)
+	{
+		const auto& internalSymbol = m_internalSymbols[i];
+		aliases[i] = i;
+		//Data symbols can be written to and need their own storage
+		if(!m_codeFoldingEnabled || (internalSymbol.location != INTERNAL_SYMBOL_LOCATION_TEXT)) continue;
+		auto hash = HashInternalSymbol(internalSymbol);
+		auto symbolRange = symbolsByHash.equal_range(hash);
+		for(auto symbolIterator = symbolRange.first; symbolIterator != symbolRange.second; symbolIterator++)
+		{
+			if(AreInternalSymbolsIdentical(m_internalSymbols[symbolIterator->second], internalSymbol))
+			{
+				aliases[i] = symbolIterator->second;
+				break;
+			}
+		}
+		if(aliases[i] == i)
+		{
+			symbolsByHash.insert(std::make_pair(hash, i));
+		}
+	}
+	return aliases;
+}
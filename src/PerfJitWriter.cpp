@@ -0,0 +1,299 @@
+#include <assert.h>
+#include <string.h>
+#include "PerfJitWriter.h"
+
+#if defined(__linux__)
+#include <time.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#define PERFJIT_SUPPORTED
+#endif
+
+namespace
+{
+	//Format described in tools/perf/Documentation/jitdump-specification.txt
+	enum
+	{
+		JITDUMP_MAGIC = 0x4A695444,
+		JITDUMP_VERSION = 1,
+		JITDUMP_CODE_LOAD = 0,
+	};
+
+	enum
+	{
+		ELF_MACHINE_386 = 3,
+		ELF_MACHINE_ARM = 40,
+		ELF_MACHINE_X86_64 = 62,
+		ELF_MACHINE_AARCH64 = 183,
+	};
+
+#pragma pack(push, 1)
+	struct JITDUMP_HEADER
+	{
+		uint32		magic;
+		uint32		version;
+		uint32		totalSize;
+		uint32		elfMachine;
+		uint32		padding;
+		uint32		pid;
+		uint64		timestamp;
+		uint64		flags;
+	};
+	static_assert(sizeof(JITDUMP_HEADER) == 0x28, "Size of JITDUMP_HEADER must be 40 bytes.");
+
+	struct JITDUMP_CODE_LOAD_RECORD
+	{
+		uint32		id;
+		uint32		totalSize;
+		uint64		timestamp;
+		uint32		pid;
+		uint32		tid;
+		uint64		vma;
+		uint64		codeAddress;
+		uint64		codeSize;
+		uint64		codeIndex;
+	};
+	static_assert(sizeof(JITDUMP_CODE_LOAD_RECORD) == 0x38, "Size of JITDUMP_CODE_LOAD_RECORD must be 56 bytes.");
+#pragma pack(pop)
+}
+
+CPerfJitWriter& CPerfJitWriter::GetInstance()
+{
+	static CPerfJitWriter instance;
+	return instance;
+}
+
+CPerfJitWriter::~CPerfJitWriter()
+{
+	Disable();
+}
+
+void CPerfJitWriter::Enable(uint32 flags, const std::string& directory)
+{
+#ifdef PERFJIT_SUPPORTED
+	Disable();
+
+	m_flags = flags;
+	m_directory = directory;
+	m_nextCodeIndex = 0;
+
+	if(m_flags & FLAG_PERF_MAP)
+	{
+		m_perfMapFile = fopen(GetPerfMapPath().c_str(), "w");
+		assert(m_perfMapFile != nullptr);
+	}
+
+	if(m_flags & FLAG_JITDUMP)
+	{
+		m_jitDumpFile = fopen(GetJitDumpPath().c_str(), "w+");
+		assert(m_jitDumpFile != nullptr);
+		if(m_jitDumpFile != nullptr)
+		{
+			//perf finds the jitdump file through an executable mapping of it
+			long pageSize = sysconf(_SC_PAGESIZE);
+			m_jitDumpMarker = mmap(nullptr, pageSize, PROT_READ | PROT_EXEC, MAP_PRIVATE, fileno(m_jitDumpFile), 0);
+			if(m_jitDumpMarker == MAP_FAILED)
+			{
+				m_jitDumpMarker = nullptr;
+			}
+			WriteJitDumpHeader();
+		}
+	}
+
+	m_stopping = false;
+	m_writerThread = std::thread([this] () { WriterThreadProc(); });
+	m_enabled = true;
+#endif
+}
+
+void CPerfJitWriter::Disable()
+{
+	if(!m_enabled) return;
+	m_enabled = false;
+
+	{
+		std::unique_lock<std::mutex> queueLock(m_mutex);
+		m_stopping = true;
+	}
+	m_queueCondition.notify_one();
+	m_writerThread.join();
+
+#ifdef PERFJIT_SUPPORTED
+	if(m_perfMapFile)
+	{
+		fclose(m_perfMapFile);
+		m_perfMapFile = nullptr;
+	}
+	if(m_jitDumpMarker)
+	{
+		munmap(m_jitDumpMarker, sysconf(_SC_PAGESIZE));
+		m_jitDumpMarker = nullptr;
+	}
+	if(m_jitDumpFile)
+	{
+		fclose(m_jitDumpFile);
+		m_jitDumpFile = nullptr;
+	}
+#endif
+}
+
+bool CPerfJitWriter::IsEnabled() const
+{
+	return m_enabled;
+}
+
+void CPerfJitWriter::RegisterCode(const void* code, size_t size, const std::string& name)
+{
+	if(!m_enabled) return;
+
+	CODE_ENTRY entry;
+	entry.address = reinterpret_cast<uintptr_t>(code);
+	entry.size = size;
+	entry.timestamp = GetTimestamp();
+	entry.threadId = GetThreadId();
+	entry.name = name;
+	if(entry.name.empty())
+	{
+		char defaultName[32];
+		snprintf(defaultName, sizeof(defaultName), "CodeGen_%llx", static_cast<unsigned long long>(entry.address));
+		entry.name = defaultName;
+	}
+	if(m_flags & FLAG_JITDUMP)
+	{
+		//Code might be gone by the time the writer thread gets to it
+		auto codeBytes = reinterpret_cast<const uint8*>(code);
+		entry.code.assign(codeBytes, codeBytes + size);
+	}
+
+	{
+		std::unique_lock<std::mutex> queueLock(m_mutex);
+		m_queue.push_back(std::move(entry));
+	}
+	m_queueCondition.notify_one();
+}
+
+void CPerfJitWriter::Flush()
+{
+	std::unique_lock<std::mutex> queueLock(m_mutex);
+	m_flushCondition.wait(queueLock, [this] () { return m_queue.empty() && !m_writing; });
+}
+
+std::string CPerfJitWriter::GetPerfMapPath() const
+{
+#ifdef PERFJIT_SUPPORTED
+	return m_directory + "/perf-" + std::to_string(getpid()) + ".map";
+#else
+	return std::string();
+#endif
+}
+
+std::string CPerfJitWriter::GetJitDumpPath() const
+{
+#ifdef PERFJIT_SUPPORTED
+	return m_directory + "/jit-" + std::to_string(getpid()) + ".dump";
+#else
+	return std::string();
+#endif
+}
+
+void CPerfJitWriter::WriterThreadProc()
+{
+	while(1)
+	{
+		CodeEntryQueue entries;
+		{
+			std::unique_lock<std::mutex> queueLock(m_mutex);
+			m_queueCondition.wait(queueLock, [this] () { return !m_queue.empty() || m_stopping; });
+			if(m_queue.empty() && m_stopping) break;
+			std::swap(entries, m_queue);
+			m_writing = true;
+		}
+
+		for(const auto& entry : entries)
+		{
+			WriteEntry(entry);
+		}
+		if(m_perfMapFile) fflush(m_perfMapFile);
+		if(m_jitDumpFile) fflush(m_jitDumpFile);
+
+		{
+			std::unique_lock<std::mutex> queueLock(m_mutex);
+			m_writing = false;
+		}
+		m_flushCondition.notify_all();
+	}
+	m_flushCondition.notify_all();
+}
+
+void CPerfJitWriter::WriteEntry(const CODE_ENTRY& entry)
+{
+#ifdef PERFJIT_SUPPORTED
+	if(m_perfMapFile)
+	{
+		fprintf(m_perfMapFile, "%llx %llx %s\n",
+			static_cast<unsigned long long>(entry.address), static_cast<unsigned long long>(entry.size), entry.name.c_str());
+	}
+
+	if(m_jitDumpFile)
+	{
+		JITDUMP_CODE_LOAD_RECORD record = {};
+		record.id			= JITDUMP_CODE_LOAD;
+		record.totalSize	= static_cast<uint32>(sizeof(record) + entry.name.size() + 1 + entry.code.size());
+		record.timestamp	= entry.timestamp;
+		record.pid			= getpid();
+		record.tid			= entry.threadId;
+		record.vma			= entry.address;
+		record.codeAddress	= entry.address;
+		record.codeSize		= entry.size;
+		record.codeIndex	= m_nextCodeIndex++;
+		fwrite(&record, sizeof(record), 1, m_jitDumpFile);
+		fwrite(entry.name.c_str(), entry.name.size() + 1, 1, m_jitDumpFile);
+		fwrite(entry.code.data(), entry.code.size(), 1, m_jitDumpFile);
+	}
+#endif
+}
+
+void CPerfJitWriter::WriteJitDumpHeader()
+{
+#ifdef PERFJIT_SUPPORTED
+	JITDUMP_HEADER header = {};
+	header.magic		= JITDUMP_MAGIC;
+	header.version		= JITDUMP_VERSION;
+	header.totalSize	= sizeof(header);
+#if defined(__x86_64__)
+	header.elfMachine	= ELF_MACHINE_X86_64;
+#elif defined(__i386__)
+	header.elfMachine	= ELF_MACHINE_386;
+#elif defined(__aarch64__)
+	header.elfMachine	= ELF_MACHINE_AARCH64;
+#elif defined(__arm__)
+	header.elfMachine	= ELF_MACHINE_ARM;
+#endif
+	header.pid			= getpid();
+	header.timestamp	= GetTimestamp();
+	fwrite(&header, sizeof(header), 1, m_jitDumpFile);
+	fflush(m_jitDumpFile);
+#endif
+}
+
+uint64 CPerfJitWriter::GetTimestamp()
+{
+#ifdef PERFJIT_SUPPORTED
+	//perf expects timestamps from the monotonic clock (perf record -k mono)
+	timespec time;
+	clock_gettime(CLOCK_MONOTONIC, &time);
+	return (static_cast<uint64>(time.tv_sec) * 1000000000ULL) + time.tv_nsec;
+#else
+	return 0;
+#endif
+}
+
+uint32 CPerfJitWriter::GetThreadId()
+{
+#ifdef PERFJIT_SUPPORTED
+	return static_cast<uint32>(syscall(SYS_gettid));
+#else
+	return 0;
+#endif
+}
@@ -0,0 +1,119 @@
+#include <cassert>
+#include "TieredFunction.h"
+#include "MemStream.h"
+
+using namespace Jitter;
+
+namespace
+{
+	//Puts back the jitter's settings once a tier is compiled, even if the emitter throws
+	class CCompileTierGuard
+	{
+	public:
+		CCompileTierGuard(CJitter& jitter)
+		: m_jitter(jitter)
+		, m_previousCompileTier(jitter.GetCompileTier())
+		{
+
+		}
+
+		~CCompileTierGuard()
+		{
+			m_jitter.SetStream(nullptr);
+			m_jitter.SetCompileTier(m_previousCompileTier);
+		}
+
+	private:
+		CJitter&				m_jitter;
+		CJitter::COMPILE_TIER	m_previousCompileTier;
+	};
+}
+
+CTieredFunction::CTieredFunction(const FunctionEmitter& emitter, uint32 promotionThreshold)
+: m_emitter(emitter)
+, m_promotionThreshold(promotionThreshold)
+{
+
+}
+
+void CTieredFunction::Compile(CJitter& jitter)
+{
+	assert(!m_code);
+	m_entryCount = 0;
+	Install(CompileTier(jitter, CJitter::COMPILE_TIER_BASELINE, const_cast<uint32*>(&m_entryCount)));
+}
+
+uint32 CTieredFunction::GetEntryCount() const
+{
+	return m_entryCount;
+}
+
+bool CTieredFunction::IsPromoted() const
+{
+	return m_promoted;
+}
+
+bool CTieredFunction::NeedsPromotion() const
+{
+	return !m_promoted && (m_entryCount >= m_promotionThreshold);
+}
+
+void CTieredFunction::Promote(CJitter& jitter)
+{
+	Promote(CompileTier(jitter, CJitter::COMPILE_TIER_OPTIMIZING, nullptr));
+}
+
+void CTieredFunction::Promote(CMemoryFunction&& function)
+{
+	Install(std::move(function));
+	m_promoted = true;
+}
+
+void CTieredFunction::Emit(CJitter& jitter) const
+{
+	m_emitter(jitter);
+}
+
+void CTieredFunction::ReleaseRetiredCode()
+{
+	std::lock_guard<std::mutex> codeLock(m_codeMutex);
+	m_retiredCode.clear();
+}
+
+void CTieredFunction::operator()(void* context)
+{
+	auto code = m_code.load(std::memory_order_acquire);
+	assert(code);
+	code(context);
+}
+
+void* CTieredFunction::GetCode() const
+{
+	return reinterpret_cast<void*>(m_code.load(std::memory_order_acquire));
+}
+
+void CTieredFunction::Install(CMemoryFunction&& function)
+{
+	std::lock_guard<std::mutex> codeLock(m_codeMutex);
+	m_code.store(reinterpret_cast<FunctionType>(function.GetCode()), std::memory_order_release);
+	if(!m_currentCode.IsEmpty())
+	{
+		m_retiredCode.push_back(std::move(m_currentCode));
+	}
+	m_currentCode = std::move(function);
+}
+
+CMemoryFunction CTieredFunction::CompileTier(CJitter& jitter, CJitter::COMPILE_TIER compileTier, uint32* entryCounter) const
+{
+	CCompileTierGuard compileTierGuard(jitter);
+
+	Framework::CMemStream stream;
+	jitter.SetStream(&stream);
+	jitter.SetCompileTier(compileTier);
+	jitter.SetEntryCounter(entryCounter);
+	jitter.Begin();
+	m_emitter(jitter);
+	jitter.End();
+
+	return CMemoryFunction(stream.GetBuffer(), stream.GetSize());
+}
@@ -380,7 +380,12 @@ void CX86Assembler::AndId(const CAddress& address, uint32 constant)
 
 void CX86Assembler::AndIq(const CAddress& address, uint64 constant)
 {
-	assert(0);
+	WriteEvIq(0x04, address, constant);
+}
+
+void CX86Assembler::BsfEd(REGISTER registerId, const CAddress& address)
+{
+	WriteEvGvOp0F(0xBC, false, address, registerId);
 }
 
 void CX86Assembler::BsrEd(REGISTER registerId, const CAddress& address)
@@ -388,6 +393,14 @@ void CX86Assembler::BsrEd(REGISTER registerId, const CAddress& address)
 	WriteEvGvOp0F(0xBD, false, address, registerId);
 }
 
+void CX86Assembler::Bswap(REGISTER registerId)
+{
+	CAddress Address(MakeRegisterAddress(registerId));
+	WriteRexByte(false, Address);
+	WriteByte(0x0F);
+	WriteByte(0xC8 | Address.ModRm.nRM);
+}
+
 void CX86Assembler::CallEd(const CAddress& address)
 {
 	WriteEvOp(0xFF, 0x02, false, address);
@@ -433,16 +446,32 @@ void CX86Assembler::Cdq()
 	WriteByte(0x99);
 }
 
+void CX86Assembler::Cqo()
+{
+	WriteByte(0x48);
+	WriteByte(0x99);
+}
+
 void CX86Assembler::DivEd(const CAddress& address)
 {
 	WriteEvOp(0xF7, 0x06, false, address);
 }
 
+void CX86Assembler::DivEq(const CAddress& address)
+{
+	WriteEvOp(0xF7, 0x06, true, address);
+}
+
 void CX86Assembler::IdivEd(const CAddress& address)
 {
 	WriteEvOp(0xF7, 0x07, false, address);
 }
 
+void CX86Assembler::IdivEq(const CAddress& address)
+{
+	WriteEvOp(0xF7, 0x07, true, address);
+}
+
 void CX86Assembler::ImulEw(const CAddress& address)
 {
 	WriteByte(0x66);
@@ -454,6 +483,16 @@ void CX86Assembler::ImulEd(const CAddress& address)
 	WriteEvOp(0xF7, 0x05, false, address);
 }
 
+void CX86Assembler::ImulEd(REGISTER registerId, const CAddress& address)
+{
+	WriteEvGvOp0F(0xAF, false, address, registerId);
+}
+
+void CX86Assembler::ImulEq(REGISTER registerId, const CAddress& address)
+{
+	WriteEvGvOp0F(0xAF, true, address, registerId);
+}
+
 void CX86Assembler::JbJx(LABEL label)
 {
 	CreateLabelReference(label, JMP_B);
@@ -555,6 +594,22 @@ void CX86Assembler::MovGq(const CAddress& Address, REGISTER nRegister)
 	WriteEvGvOp(0x89, true, Address, nRegister);
 }
 
+void CX86Assembler::MovGb(const CAddress& address, REGISTER registerId)
+{
+	//Only AL, CL, DL and BL can be encoded without a REX prefix
+	if(registerId > 3)
+	{
+		throw std::runtime_error("Unsupported byte register index.");
+	}
+	WriteEvGvOp(0x88, false, address, registerId);
+}
+
+void CX86Assembler::MovGw(const CAddress& address, REGISTER registerId)
+{
+	WriteByte(0x66);
+	WriteEvGvOp(0x89, false, address, registerId);
+}
+
 void CX86Assembler::MovId(REGISTER nRegister, uint32 nConstant)
 {
 	CAddress Address(MakeRegisterAddress(nRegister));
@@ -583,6 +638,30 @@ void CX86Assembler::MovId(const CX86Assembler::CAddress& address, uint32 constan
 	WriteDWord(constant);
 }
 
+void CX86Assembler::MovIb(const CAddress& address, uint8 constant)
+{
+	WriteRexByte(false, address);
+	CAddress newAddress(address);
+	newAddress.ModRm.nFnReg = 0x00;
+
+	WriteByte(0xC6);
+	newAddress.Write(&m_tmpStream);
+	WriteByte(constant);
+}
+
+void CX86Assembler::MovIw(const CAddress& address, uint16 constant)
+{
+	WriteByte(0x66);
+	WriteRexByte(false, address);
+	CAddress newAddress(address);
+	newAddress.ModRm.nFnReg = 0x00;
+
+	WriteByte(0xC7);
+	newAddress.Write(&m_tmpStream);
+	WriteByte(static_cast<uint8>(constant & 0xFF));
+	WriteByte(static_cast<uint8>(constant >> 8));
+}
+
 void CX86Assembler::MovsxEb(REGISTER registerId, const CAddress& address)
 {
 	WriteEvGvOp0F(0xBE, false, address, registerId);
@@ -598,6 +677,11 @@ void CX86Assembler::MovzxEb(REGISTER registerId, const CAddress& address)
 	WriteEvGvOp0F(0xB6, false, address, registerId);
 }
 
+void CX86Assembler::MovzxEw(REGISTER registerId, const CAddress& address)
+{
+	WriteEvGvOp0F(0xB7, false, address, registerId);
+}
+
 void CX86Assembler::MulEd(const CAddress& address)
 {
 	WriteEvOp(0xF7, 0x04, false, address);
@@ -618,16 +702,31 @@ void CX86Assembler::NotEd(const CAddress& address)
 	WriteEvOp(0xF7, 0x02, false, address);
 }
 
+void CX86Assembler::NotEq(const CAddress& address)
+{
+	WriteEvOp(0xF7, 0x02, true, address);
+}
+
 void CX86Assembler::OrEd(REGISTER registerId, const CAddress& address)
 {
 	WriteEvGvOp(0x0B, false, address, registerId);
 }
 
+void CX86Assembler::OrEq(REGISTER registerId, const CAddress& address)
+{
+	WriteEvGvOp(0x0B, true, address, registerId);
+}
+
 void CX86Assembler::OrId(const CAddress& address, uint32 constant)
 {
 	WriteEvId(0x01, address, constant);
 }
 
+void CX86Assembler::OrIq(const CAddress& address, uint64 constant)
+{
+	WriteEvIq(0x01, address, constant);
+}
+
 void CX86Assembler::Pop(REGISTER registerId)
 {
 	CAddress Address(MakeRegisterAddress(registerId));
@@ -635,6 +734,12 @@ void CX86Assembler::Pop(REGISTER registerId)
 	WriteByte(0x58 | Address.ModRm.nRM);
 }
 
+void CX86Assembler::PopcntEd(REGISTER registerId, const CAddress& address)
+{
+	WriteByte(0xF3);
+	WriteEvGvOp0F(0xB8, false, address, registerId);
+}
+
 void CX86Assembler::Push(REGISTER registerId)
 {
 	CAddress Address(MakeRegisterAddress(registerId));
@@ -670,6 +775,28 @@ void CX86Assembler::Ret()
 	WriteByte(0xC3);
 }
 
+void CX86Assembler::RorEd(const CAddress& address)
+{
+	WriteEvOp(0xD3, 0x01, false, address);
+}
+
+void CX86Assembler::RorEd(const CAddress& address, uint8 amount)
+{
+	WriteEvOp(0xC1, 0x01, false, address);
+	WriteByte(amount);
+}
+
+void CX86Assembler::RorEq(const CAddress& address)
+{
+	WriteEvOp(0xD3, 0x01, true, address);
+}
+
+void CX86Assembler::RorEq(const CAddress& address, uint8 amount)
+{
+	WriteEvOp(0xC1, 0x01, true, address);
+	WriteByte(amount);
+}
+
 void CX86Assembler::SarEd(const CAddress& address)
 {
 	WriteEvOp(0xD3, 0x07, false, address);
@@ -859,16 +986,37 @@ void CX86Assembler::TestEd(REGISTER registerId, const CAddress& address)
 	WriteEvGvOp(0x85, false, address, registerId);
 }
 
+void CX86Assembler::TestEq(REGISTER registerId, const CAddress& address)
+{
+	WriteEvGvOp(0x85, true, address, registerId);
+}
+
+void CX86Assembler::TzcntEd(REGISTER registerId, const CAddress& address)
+{
+	WriteByte(0xF3);
+	WriteEvGvOp0F(0xBC, false, address, registerId);
+}
+
 void CX86Assembler::XorEd(REGISTER registerId, const CAddress& address)
 {
 	WriteEvGvOp(0x33, false, address, registerId);
 }
 
+void CX86Assembler::XorEq(REGISTER registerId, const CAddress& address)
+{
+	WriteEvGvOp(0x33, true, address, registerId);
+}
+
 void CX86Assembler::XorId(const CAddress& address, uint32 constant)
 {
 	WriteEvId(0x06, address, constant);
 }
 
+void CX86Assembler::XorIq(const CAddress& address, uint64 constant)
+{
+	WriteEvIq(0x06, address, constant);
+}
+
 void CX86Assembler::XorGd(const CAddress& Address, REGISTER nRegister)
 {
 	WriteEvGvOp(0x31, false, Address, nRegister);
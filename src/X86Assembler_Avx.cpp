@@ -0,0 +1,170 @@
+#include "X86Assembler.h"
+
+//------------------------------------------------
+//FMA Instructions
+//------------------------------------------------
+
+void CX86Assembler::Vfmadd231ssEd(XMMREGISTER dstRegisterId, XMMREGISTER src1RegisterId, const CAddress& address)
+{
+	WriteVexEdVdOp(VEX_OPCODE_MAP_0F_38, VEX_OPCODE_PREFIX_66, 0xB9, false, false, address, dstRegisterId, src1RegisterId);
+}
+
+void CX86Assembler::Vfnmadd231ssEd(XMMREGISTER dstRegisterId, XMMREGISTER src1RegisterId, const CAddress& address)
+{
+	WriteVexEdVdOp(VEX_OPCODE_MAP_0F_38, VEX_OPCODE_PREFIX_66, 0xBD, false, false, address, dstRegisterId, src1RegisterId);
+}
+
+void CX86Assembler::Vfmadd231sdEd(XMMREGISTER dstRegisterId, XMMREGISTER src1RegisterId, const CAddress& address)
+{
+	WriteVexEdVdOp(VEX_OPCODE_MAP_0F_38, VEX_OPCODE_PREFIX_66, 0xB9, true, false, address, dstRegisterId, src1RegisterId);
+}
+
+void CX86Assembler::Vfnmadd231sdEd(XMMREGISTER dstRegisterId, XMMREGISTER src1RegisterId, const CAddress& address)
+{
+	WriteVexEdVdOp(VEX_OPCODE_MAP_0F_38, VEX_OPCODE_PREFIX_66, 0xBD, true, false, address, dstRegisterId, src1RegisterId);
+}
+
+void CX86Assembler::Vfmadd231psVo(XMMREGISTER dstRegisterId, XMMREGISTER src1RegisterId, const CAddress& address)
+{
+	WriteVexEdVdOp(VEX_OPCODE_MAP_0F_38, VEX_OPCODE_PREFIX_66, 0xB8, false, false, address, dstRegisterId, src1RegisterId);
+}
+
+void CX86Assembler::Vfnmadd231psVo(XMMREGISTER dstRegisterId, XMMREGISTER src1RegisterId, const CAddress& address)
+{
+	WriteVexEdVdOp(VEX_OPCODE_MAP_0F_38, VEX_OPCODE_PREFIX_66, 0xBC, false, false, address, dstRegisterId, src1RegisterId);
+}
+
+//------------------------------------------------
+//AVX2 Instructions
+//------------------------------------------------
+
+void CX86Assembler::VaddpsVqq(XMMREGISTER dstRegisterId, XMMREGISTER src1RegisterId, const CAddress& address)
+{
+	WriteVexEdVdOp(VEX_OPCODE_MAP_0F, VEX_OPCODE_PREFIX_NONE, 0x58, false, true, address, dstRegisterId, src1RegisterId);
+}
+
+void CX86Assembler::Vinserti128Vqq(XMMREGISTER dstRegisterId, XMMREGISTER src1RegisterId, const CAddress& address, uint8 laneIndex)
+{
+	WriteVexEdVdOp(VEX_OPCODE_MAP_0F_3A, VEX_OPCODE_PREFIX_66, 0x38, false, true, address, dstRegisterId, src1RegisterId);
+	WriteByte(laneIndex);
+}
+
+void CX86Assembler::VmovdquVqq(XMMREGISTER dstRegisterId, const CAddress& address)
+{
+	WriteVexEdVdOp(VEX_OPCODE_MAP_0F, VEX_OPCODE_PREFIX_F3, 0x6F, false, true, address, dstRegisterId, xMM0);
+}
+
+void CX86Assembler::VmovdquVqq(const CAddress& address, XMMREGISTER srcRegisterId)
+{
+	WriteVexEdVdOp(VEX_OPCODE_MAP_0F, VEX_OPCODE_PREFIX_F3, 0x7F, false, true, address, srcRegisterId, xMM0);
+}
+
+void CX86Assembler::VmulpsVqq(XMMREGISTER dstRegisterId, XMMREGISTER src1RegisterId, const CAddress& address)
+{
+	WriteVexEdVdOp(VEX_OPCODE_MAP_0F, VEX_OPCODE_PREFIX_NONE, 0x59, false, true, address, dstRegisterId, src1RegisterId);
+}
+
+void CX86Assembler::VpaddbVqq(XMMREGISTER dstRegisterId, XMMREGISTER src1RegisterId, const CAddress& address)
+{
+	WriteVexEdVdOp(VEX_OPCODE_MAP_0F, VEX_OPCODE_PREFIX_66, 0xFC, false, true, address, dstRegisterId, src1RegisterId);
+}
+
+void CX86Assembler::VpadddVqq(XMMREGISTER dstRegisterId, XMMREGISTER src1RegisterId, const CAddress& address)
+{
+	WriteVexEdVdOp(VEX_OPCODE_MAP_0F, VEX_OPCODE_PREFIX_66, 0xFE, false, true, address, dstRegisterId, src1RegisterId);
+}
+
+void CX86Assembler::VpaddwVqq(XMMREGISTER dstRegisterId, XMMREGISTER src1RegisterId, const CAddress& address)
+{
+	WriteVexEdVdOp(VEX_OPCODE_MAP_0F, VEX_OPCODE_PREFIX_66, 0xFD, false, true, address, dstRegisterId, src1RegisterId);
+}
+
+void CX86Assembler::VpalignrVo(XMMREGISTER dstRegisterId, XMMREGISTER src1RegisterId, const CAddress& address, uint8 byteCount)
+{
+	WriteVexEdVdOp(VEX_OPCODE_MAP_0F_3A, VEX_OPCODE_PREFIX_66, 0x0F, false, false, address, dstRegisterId, src1RegisterId);
+	WriteByte(byteCount);
+}
+
+void CX86Assembler::VpalignrVqq(XMMREGISTER dstRegisterId, XMMREGISTER src1RegisterId, const CAddress& address, uint8 byteCount)
+{
+	WriteVexEdVdOp(VEX_OPCODE_MAP_0F_3A, VEX_OPCODE_PREFIX_66, 0x0F, false, true, address, dstRegisterId, src1RegisterId);
+	WriteByte(byteCount);
+}
+
+void CX86Assembler::VpandVqq(XMMREGISTER dstRegisterId, XMMREGISTER src1RegisterId, const CAddress& address)
+{
+	WriteVexEdVdOp(VEX_OPCODE_MAP_0F, VEX_OPCODE_PREFIX_66, 0xDB, false, true, address, dstRegisterId, src1RegisterId);
+}
+
+void CX86Assembler::VpermqVqq(XMMREGISTER dstRegisterId, const CAddress& address, uint8 selector)
+{
+	//vvvv is unused and needs to be 1111, which is the encoding for xMM0
+	WriteVexEdVdOp(VEX_OPCODE_MAP_0F_3A, VEX_OPCODE_PREFIX_66, 0x00, true, true, address, dstRegisterId, xMM0);
+	WriteByte(selector);
+}
+
+void CX86Assembler::VporVqq(XMMREGISTER dstRegisterId, XMMREGISTER src1RegisterId, const CAddress& address)
+{
+	WriteVexEdVdOp(VEX_OPCODE_MAP_0F, VEX_OPCODE_PREFIX_66, 0xEB, false, true, address, dstRegisterId, src1RegisterId);
+}
+
+void CX86Assembler::VpsubbVqq(XMMREGISTER dstRegisterId, XMMREGISTER src1RegisterId, const CAddress& address)
+{
+	WriteVexEdVdOp(VEX_OPCODE_MAP_0F, VEX_OPCODE_PREFIX_66, 0xF8, false, true, address, dstRegisterId, src1RegisterId);
+}
+
+void CX86Assembler::VpsubdVqq(XMMREGISTER dstRegisterId, XMMREGISTER src1RegisterId, const CAddress& address)
+{
+	WriteVexEdVdOp(VEX_OPCODE_MAP_0F, VEX_OPCODE_PREFIX_66, 0xFA, false, true, address, dstRegisterId, src1RegisterId);
+}
+
+void CX86Assembler::VpsubwVqq(XMMREGISTER dstRegisterId, XMMREGISTER src1RegisterId, const CAddress& address)
+{
+	WriteVexEdVdOp(VEX_OPCODE_MAP_0F, VEX_OPCODE_PREFIX_66, 0xF9, false, true, address, dstRegisterId, src1RegisterId);
+}
+
+void CX86Assembler::VpxorVqq(XMMREGISTER dstRegisterId, XMMREGISTER src1RegisterId, const CAddress& address)
+{
+	WriteVexEdVdOp(VEX_OPCODE_MAP_0F, VEX_OPCODE_PREFIX_66, 0xEF, false, true, address, dstRegisterId, src1RegisterId);
+}
+
+void CX86Assembler::VsubpsVqq(XMMREGISTER dstRegisterId, XMMREGISTER src1RegisterId, const CAddress& address)
+{
+	WriteVexEdVdOp(VEX_OPCODE_MAP_0F, VEX_OPCODE_PREFIX_NONE, 0x5C, false, true, address, dstRegisterId, src1RegisterId);
+}
+
+void CX86Assembler::Vzeroupper()
+{
+	//2 bytes VEX form
+	WriteByte(0xC5);
+	WriteByte(0xF8);
+	WriteByte(0x77);
+}
+
+//------------------------------------------------
+//Addressing utils
+//------------------------------------------------
+
+void CX86Assembler::WriteVexEdVdOp(VEX_OPCODE_MAP map, VEX_OPCODE_PREFIX prefix, uint8 opcode, bool w, bool l,
+	const CAddress& address, XMMREGISTER dstRegisterId, XMMREGISTER src1RegisterId)
+{
+	//Always uses the 3 bytes form, R, X, B and vvvv are stored inverted
+	uint8 byte1 = static_cast<uint8>(map);
+	if(dstRegisterId < 8) byte1 |= 0x80;
+	if(!address.nIsExtendedSib) byte1 |= 0x40;
+	if(!address.nIsExtendedModRM) byte1 |= 0x20;
+
+	uint8 byte2 = static_cast<uint8>(prefix);
+	byte2 |= (~static_cast<uint8>(src1RegisterId) & 0x0F) << 3;
+	if(l) byte2 |= 0x04;
+	if(w) byte2 |= 0x80;
+
+	WriteByte(0xC4);
+	WriteByte(byte1);
+	WriteByte(byte2);
+	WriteByte(opcode);
+
+	CAddress newAddress(address);
+	newAddress.ModRm.nFnReg = dstRegisterId & 0x07;
+	newAddress.Write(&m_tmpStream);
+}
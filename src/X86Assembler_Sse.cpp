@@ -77,6 +77,95 @@ void CX86Assembler::Cvttss2siEd(REGISTER registerId, const CAddress& address)
 	WriteEvGvOp(0x2C, false, address, registerId);
 }
 
+void CX86Assembler::Cvttss2siEq(REGISTER registerId, const CAddress& address)
+{
+	WriteByte(0xF3);
+	WriteEvGvOp0F(0x2C, true, address, registerId);
+}
+
+void CX86Assembler::Cvtss2sdEd(XMMREGISTER registerId, const CAddress& address)
+{
+	WriteEdVdOp_F3_0F(0x5A, address, registerId);
+}
+
+void CX86Assembler::MovsdEd(const CAddress& address, XMMREGISTER registerId)
+{
+	WriteEdVdOp_F2_0F(0x11, address, registerId);
+}
+
+void CX86Assembler::MovsdEd(XMMREGISTER registerId, const CAddress& address)
+{
+	WriteEdVdOp_F2_0F(0x10, address, registerId);
+}
+
+void CX86Assembler::AddsdEd(XMMREGISTER registerId, const CAddress& address)
+{
+	WriteEdVdOp_F2_0F(0x58, address, registerId);
+}
+
+void CX86Assembler::SubsdEd(XMMREGISTER registerId, const CAddress& address)
+{
+	WriteEdVdOp_F2_0F(0x5C, address, registerId);
+}
+
+void CX86Assembler::MaxsdEd(XMMREGISTER registerId, const CAddress& address)
+{
+	WriteEdVdOp_F2_0F(0x5F, address, registerId);
+}
+
+void CX86Assembler::MinsdEd(XMMREGISTER registerId, const CAddress& address)
+{
+	WriteEdVdOp_F2_0F(0x5D, address, registerId);
+}
+
+void CX86Assembler::MulsdEd(XMMREGISTER registerId, const CAddress& address)
+{
+	WriteEdVdOp_F2_0F(0x59, address, registerId);
+}
+
+void CX86Assembler::DivsdEd(XMMREGISTER registerId, const CAddress& address)
+{
+	WriteEdVdOp_F2_0F(0x5E, address, registerId);
+}
+
+void CX86Assembler::SqrtsdEd(XMMREGISTER registerId, const CAddress& address)
+{
+	WriteEdVdOp_F2_0F(0x51, address, registerId);
+}
+
+void CX86Assembler::CmpsdEd(XMMREGISTER registerId, const CAddress& address, SSE_CMP_TYPE condition)
+{
+	WriteEdVdOp_F2_0F(0xC2, address, registerId);
+	WriteByte(static_cast<uint8>(condition));
+}
+
+void CX86Assembler::Cvtsi2sdEd(XMMREGISTER registerId, const CAddress& address)
+{
+	WriteEdVdOp_F2_0F(0x2A, address, registerId);
+}
+
+void CX86Assembler::Cvtsi2sdEq(XMMREGISTER registerId, const CAddress& address)
+{
+	WriteEdVdOp_F2_0F_64b(0x2A, address, registerId);
+}
+
+void CX86Assembler::Cvttsd2siEd(REGISTER registerId, const CAddress& address)
+{
+	WriteByte(0xF2);
+	WriteEvGvOp0F(0x2C, false, address, registerId);
+}
+
+void CX86Assembler::Cvttsd2siEq(REGISTER registerId, const CAddress& address)
+{
+	WriteByte(0xF2);
+	WriteEvGvOp0F(0x2C, true, address, registerId);
+}
+
+void CX86Assembler::Cvtsd2ssEd(XMMREGISTER registerId, const CAddress& address)
+{
+	WriteEdVdOp_F2_0F(0x5A, address, registerId);
+}
+
 //------------------------------------------------
 //Packed Instructions
 //------------------------------------------------
@@ -206,6 +295,11 @@ void CX86Assembler::PcmpgtdVo(XMMREGISTER registerId, const CAddress& address)
 	WriteEdVdOp_66_0F(0x66, address, registerId);
 }
 
+void CX86Assembler::PmaddwdVo(XMMREGISTER registerId, const CAddress& address)
+{
+	WriteEdVdOp_66_0F(0xF5, address, registerId);
+}
+
 void CX86Assembler::PmaxswVo(XMMREGISTER registerId, const CAddress& address)
 {
 	WriteEdVdOp_66_0F(0xEE, address, registerId);
@@ -231,6 +325,26 @@ void CX86Assembler::PmovmskbVo(REGISTER srcReg, XMMREGISTER dstReg)
 	WriteEdVdOp_66_0F(0xD7, CX86Assembler::MakeRegisterAddress(static_cast<REGISTER>(dstReg)), static_cast<XMMREGISTER>(srcReg));
 }
 
+void CX86Assembler::PmulhwVo(XMMREGISTER registerId, const CAddress& address)
+{
+	WriteEdVdOp_66_0F(0xE5, address, registerId);
+}
+
+void CX86Assembler::PmulldVo(XMMREGISTER registerId, const CAddress& address)
+{
+	WriteEdVdOp_66_0F_38(0x40, address, registerId);
+}
+
+void CX86Assembler::PmullwVo(XMMREGISTER registerId, const CAddress& address)
+{
+	WriteEdVdOp_66_0F(0xD5, address, registerId);
+}
+
+void CX86Assembler::PmuludqVo(XMMREGISTER registerId, const CAddress& address)
+{
+	WriteEdVdOp_66_0F(0xF4, address, registerId);
+}
+
 void CX86Assembler::PorVo(XMMREGISTER registerId, const CAddress& address)
 {
 	WriteEdVdOp_66_0F(0xEB, address, registerId);
@@ -259,6 +373,12 @@ void CX86Assembler::PslldVo(XMMREGISTER registerId, uint8 amount)
 	WriteByte(amount);
 }
 
+void CX86Assembler::PsllqVo(XMMREGISTER registerId, uint8 amount)
+{
+	WriteVrOp_66_0F(0x73, 0x06, registerId);
+	WriteByte(amount);
+}
+
 void CX86Assembler::PsrawVo(XMMREGISTER registerId, uint8 amount)
 {
 	WriteVrOp_66_0F(0x71, 0x04, registerId);
@@ -283,6 +403,12 @@ void CX86Assembler::PsrldVo(XMMREGISTER registerId, uint8 amount)
 	WriteByte(amount);
 }
 
+void CX86Assembler::PsrlqVo(XMMREGISTER registerId, uint8 amount)
+{
+	WriteVrOp_66_0F(0x73, 0x02, registerId);
+	WriteByte(amount);
+}
+
 void CX86Assembler::PsubbVo(XMMREGISTER registerId, const CAddress& address)
 {
 	WriteEdVdOp_66_0F(0xF8, address, registerId);
@@ -353,6 +479,12 @@ void CX86Assembler::AddpsVo(XMMREGISTER registerId, const CAddress& address)
 	WriteEdVdOp_0F(0x58, address, registerId);
 }
 
+void CX86Assembler::CmppsVo(XMMREGISTER registerId, const CAddress& address, SSE_CMP_TYPE condition)
+{
+	WriteEdVdOp_0F(0xC2, address, registerId);
+	WriteByte(static_cast<uint8>(condition));
+}
+
 void CX86Assembler::DivpsVo(XMMREGISTER registerId, const CAddress& address)
 {
 	WriteEdVdOp_0F(0x5E, address, registerId);
@@ -363,11 +495,22 @@ void CX86Assembler::Cvtdq2psVo(XMMREGISTER registerId, const CAddress& address)
 	WriteEdVdOp_0F(0x5B, address, registerId);
 }
 
+void CX86Assembler::Cvtps2dqVo(XMMREGISTER registerId, const CAddress& address)
+{
+	WriteEdVdOp_66_0F(0x5B, address, registerId);
+}
+
 void CX86Assembler::Cvttps2dqVo(XMMREGISTER registerId, const CAddress& address)
 {
 	WriteEdVdOp_F3_0F(0x5B, address, registerId);
 }
 
+void CX86Assembler::InsertpsVo(XMMREGISTER registerId, const CAddress& address, uint8 control)
+{
+	WriteEdVdOp_66_0F_3A(0x21, address, registerId);
+	WriteByte(control);
+}
+
 void CX86Assembler::MaxpsVo(XMMREGISTER registerId, const CAddress& address)
 {
 	WriteEdVdOp_0F(0x5F, address, registerId);
@@ -383,6 +526,12 @@ void CX86Assembler::MulpsVo(XMMREGISTER registerId, const CAddress& address)
 	WriteEdVdOp_0F(0x59, address, registerId);
 }
 
+void CX86Assembler::RoundpsVo(XMMREGISTER registerId, const CAddress& address, uint8 mode)
+{
+	WriteEdVdOp_66_0F_3A(0x08, address, registerId);
+	WriteByte(mode);
+}
+
 void CX86Assembler::SubpsVo(XMMREGISTER registerId, const CAddress& address)
 {
 	WriteEdVdOp_0F(0x5C, address, registerId);
@@ -458,6 +607,45 @@ void CX86Assembler::WriteEdVdOp_66_0F_38(uint8 opcode, const CAddress& address,
 	newAddress.Write(&m_tmpStream);
 }
 
+void CX86Assembler::WriteEdVdOp_66_0F_3A(uint8 opcode, const CAddress& address, XMMREGISTER xmmRegisterId)
+{
+	REGISTER registerId = static_cast<REGISTER>(xmmRegisterId);
+	WriteByte(0x66);
+	WriteRexByte(false, address, registerId);
+	WriteByte(0x0F);
+	WriteByte(0x3A);
+	CAddress newAddress(address);
+	newAddress.ModRm.nFnReg = registerId;
+	WriteByte(opcode);
+	newAddress.Write(&m_tmpStream);
+}
+
+void CX86Assembler::WriteEdVdOp_F2_0F(uint8 opcode, const CAddress& address, XMMREGISTER xmmRegisterId)
+{
+	REGISTER registerId = static_cast<REGISTER>(xmmRegisterId);
+	WriteByte(0xF2);
+	WriteRexByte(false, address, registerId);
+	WriteByte(0x0F);
+	CAddress NewAddress(address);
+	NewAddress.ModRm.nFnReg = registerId;
+	WriteByte(opcode);
+	NewAddress.Write(&m_tmpStream);
+}
+
+void CX86Assembler::WriteEdVdOp_F2_0F_64b(uint8 opcode, const CAddress& address, XMMREGISTER xmmRegisterId)
+{
+	auto registerId = static_cast<REGISTER>(xmmRegisterId);
+
+	WriteByte(0xF2);
+	WriteRexByte(true, address, registerId);
+	WriteByte(0x0F);
+
+	CAddress newAddress(address);
+	newAddress.ModRm.nFnReg = registerId;
+	WriteByte(opcode);
+	newAddress.Write(&m_tmpStream);
+}
+
 void CX86Assembler::WriteEdVdOp_F3_0F(uint8 opcode, const CAddress& address, XMMREGISTER xmmRegisterId)
 {
 	REGISTER registerId = static_cast<REGISTER>(xmmRegisterId);
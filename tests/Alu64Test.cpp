@@ -6,6 +6,8 @@
 #define CONSTANT_3 (0xFEDCBA9800000000ULL)
 #define CONSTANT_4 (0x0000000076543210ULL)
 #define CONSTANT_5 (0xFFFFFFFFFFFFFFFFULL)
+#define CONSTANT_6 (0x0000000100000003ULL)
+#define CONSTANT_7 (0xFFFFFFFFFFFFFFF9ULL)
 
 void CAlu64Test::Run()
 {
@@ -26,6 +28,14 @@ void CAlu64Test::Run()
 	TEST_VERIFY(m_context.resultSub1 == (CONSTANT_3 - CONSTANT_4));
 	TEST_VERIFY(m_context.resultSubCst0 == (CONSTANT_5 - CONSTANT_1));
 	TEST_VERIFY(m_context.resultSubCst1 == (CONSTANT_2 - CONSTANT_3));
+
+	TEST_VERIFY(m_context.resultMul == (CONSTANT_1 * CONSTANT_2));
+	TEST_VERIFY(m_context.resultMulCst == (CONSTANT_1 * CONSTANT_6));
+	TEST_VERIFY(m_context.resultDiv == (CONSTANT_1 / CONSTANT_4));
+	TEST_VERIFY(m_context.resultDivCst == (CONSTANT_6 / CONSTANT_4));
+	TEST_VERIFY(m_context.resultDivS == static_cast<uint64>(static_cast<int64>(CONSTANT_1) / static_cast<int64>(CONSTANT_4)));
+	TEST_VERIFY(m_context.resultDivSCst == static_cast<uint64>(static_cast<int64>(CONSTANT_3) / static_cast<int64>(CONSTANT_7)));
+	TEST_VERIFY(m_context.resultCstCst == ((CONSTANT_1 * CONSTANT_6) / CONSTANT_4));
 }
 
 void CAlu64Test::Compile(Jitter::CJitter& jitter)
@@ -69,6 +79,44 @@ void CAlu64Test::Compile(Jitter::CJitter& jitter)
 		jitter.PushCst64(CONSTANT_3);
 		jitter.Sub64();
 		jitter.PullRel64(offsetof(CONTEXT, resultSubCst1));
+
+		jitter.PushRel64(offsetof(CONTEXT, value0));
+		jitter.PushRel64(offsetof(CONTEXT, value1));
+		jitter.Mult64();
+		jitter.PullRel64(offsetof(CONTEXT, resultMul));
+
+		jitter.PushRel64(offsetof(CONTEXT, value0));
+		jitter.PushCst64(CONSTANT_6);
+		jitter.Mult64();
+		jitter.PullRel64(offsetof(CONTEXT, resultMulCst));
+
+		jitter.PushRel64(offsetof(CONTEXT, value0));
+		jitter.PushRel64(offsetof(CONTEXT, value3));
+		jitter.Div64();
+		jitter.PullRel64(offsetof(CONTEXT, resultDiv));
+
+		jitter.PushCst64(CONSTANT_6);
+		jitter.PushRel64(offsetof(CONTEXT, value3));
+		jitter.Div64();
+		jitter.PullRel64(offsetof(CONTEXT, resultDivCst));
+
+		jitter.PushRel64(offsetof(CONTEXT, value0));
+		jitter.PushRel64(offsetof(CONTEXT, value3));
+		jitter.DivS64();
+		jitter.PullRel64(offsetof(CONTEXT, resultDivS));
+
+		jitter.PushRel64(offsetof(CONTEXT, value2));
+		jitter.PushCst64(CONSTANT_7);
+		jitter.DivS64();
+		jitter.PullRel64(offsetof(CONTEXT, resultDivSCst));
+
+		//Should be folded into a single constant
+		jitter.PushCst64(CONSTANT_1);
+		jitter.PushCst64(CONSTANT_6);
+		jitter.Mult64();
+		jitter.PushCst64(CONSTANT_4);
+		jitter.Div64();
+		jitter.PullRel64(offsetof(CONTEXT, resultCstCst));
 	}
 	jitter.End();
 
@@ -24,6 +24,13 @@ private:
 		uint64			resultSub1;
 		uint64			resultSubCst0;
 		uint64			resultSubCst1;
+		uint64			resultMul;
+		uint64			resultMulCst;
+		uint64			resultDiv;
+		uint64			resultDivCst;
+		uint64			resultDivS;
+		uint64			resultDivSCst;
+		uint64			resultCstCst;
 	};
 
 	CONTEXT				m_context;
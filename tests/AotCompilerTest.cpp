@@ -0,0 +1,103 @@
+#include "AotCompilerTest.h"
+#include "AotCompiler.h"
+#include "ElfObjectFile.h"
+#include "Jitter_CodeGenFactory.h"
+#include "MemStream.h"
+
+#ifdef __aarch64__
+#include "Jitter_CodeGen_AArch64.h"
+#endif
+
+#define EXTERNAL_SYMBOL_NAME	"AotCompilerTest_ExternalFunction"
+
+uint32 CAotCompilerTest::ExternalFunction(uint32 value)
+{
+	return value * 3;
+}
+
+std::unique_ptr<Jitter::CObjectFile> CAotCompilerTest::CreateObjectFile()
+{
+#if defined(__x86_64__) || defined(_M_X64)
+	return std::unique_ptr<Jitter::CObjectFile>(new Jitter::CElfObjectFile64(Jitter::CObjectFile::CPU_ARCH_X64));
+#elif defined(__aarch64__) || defined(_M_ARM64)
+	return std::unique_ptr<Jitter::CObjectFile>(new Jitter::CElfObjectFile64(Jitter::CObjectFile::CPU_ARCH_ARM64));
+#elif defined(__arm__) || defined(_M_ARM)
+	return std::unique_ptr<Jitter::CObjectFile>(new Jitter::CElfObjectFile32(Jitter::CObjectFile::CPU_ARCH_ARM));
+#else
+	return std::unique_ptr<Jitter::CObjectFile>(new Jitter::CElfObjectFile32(Jitter::CObjectFile::CPU_ARCH_X86));
+#endif
+}
+
+CAotCompilerTest::ObjectFileData CAotCompilerTest::CompileObjectFile(unsigned int threadCount)
+{
+	auto objectFile = CreateObjectFile();
+	objectFile->AddExternalSymbol(EXTERNAL_SYMBOL_NAME, reinterpret_cast<uintptr_t>(&ExternalFunction));
+
+	Jitter::CAotCompiler compiler(*objectFile,
+		[] ()
+		{
+			auto codeGen = Jitter::CreateCodeGen();
+#ifdef __aarch64__
+			static_cast<Jitter::CCodeGen_AArch64*>(codeGen)->SetGenerateRelocatableCalls(true);
+#endif
+			return codeGen;
+		}
+	);
+
+	for(unsigned int i = 0; i < FUNCTION_COUNT; i++)
+	{
+		std::string name = "AotCompilerTest_" + std::to_string(i);
+		compiler.AddFunction(name,
+			[i] (Jitter::CJitter& jitter)
+			{
+				jitter.PushRel(offsetof(CONTEXT, value));
+				jitter.PushCst(i);
+				jitter.Add();
+
+				if((i % 3) == 0)
+				{
+					jitter.Call(reinterpret_cast<void*>(&ExternalFunction), 1, Jitter::CJitter::RETURN_VALUE_32);
+				}
+
+				jitter.PullRel(offsetof(CONTEXT, result));
+
+				if((i % 2) == 0)
+				{
+					jitter.PushRel(offsetof(CONTEXT, result));
+					jitter.PushCst(0x100);
+					jitter.BeginIf(Jitter::CONDITION_BL);
+					{
+						jitter.PushRel(offsetof(CONTEXT, result));
+						jitter.PushCst(i);
+						jitter.Shl(2);
+						jitter.Or();
+						jitter.PullRel(offsetof(CONTEXT, result));
+					}
+					jitter.EndIf();
+				}
+			}
+		);
+	}
+	TEST_VERIFY(compiler.GetFunctionCount() == FUNCTION_COUNT);
+
+	compiler.Compile(threadCount);
+	TEST_VERIFY(compiler.GetFunctionCount() == 0);
+
+	Framework::CMemStream stream;
+	objectFile->Write(stream);
+	return ObjectFileData(stream.GetBuffer(), stream.GetBuffer() + stream.GetSize());
+}
+
+void CAotCompilerTest::Compile(Jitter::CJitter&)
+{
+	m_serialObjectFile = CompileObjectFile(1);
+	m_parallelObjectFile = CompileObjectFile(4);
+	m_oddParallelObjectFile = CompileObjectFile(3);
+}
+
+void CAotCompilerTest::Run()
+{
+	TEST_VERIFY(!m_serialObjectFile.empty());
+	TEST_VERIFY(m_serialObjectFile == m_parallelObjectFile);
+	TEST_VERIFY(m_serialObjectFile == m_oddParallelObjectFile);
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include "Test.h"
+#include "ObjectFile.h"
+#include <memory>
+#include <vector>
+
+class CAotCompilerTest : public CTest
+{
+public:
+	void			Run() override;
+	void			Compile(Jitter::CJitter&) override;
+
+private:
+	typedef std::vector<uint8> ObjectFileData;
+
+	enum
+	{
+		FUNCTION_COUNT = 128,
+	};
+
+	struct CONTEXT
+	{
+		uint32		value;
+		uint32		result;
+	};
+
+	static uint32	ExternalFunction(uint32);
+	static std::unique_ptr<Jitter::CObjectFile>	CreateObjectFile();
+	static ObjectFileData	CompileObjectFile(unsigned int);
+
+	ObjectFileData	m_serialObjectFile;
+	ObjectFileData	m_parallelObjectFile;
+	ObjectFileData	m_oddParallelObjectFile;
+};
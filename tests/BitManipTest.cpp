@@ -0,0 +1,153 @@
+#include "BitManipTest.h"
+#include "MemStream.h"
+
+#define VALUE0		(0x1234F080)
+#define VALUE1		(0x87658321)
+#define VALUE64		(0x8000FFFF01234567ULL)
+
+static uint32 Ror32(uint32 value, uint32 amount)
+{
+	amount &= 0x1F;
+	if(amount == 0) return value;
+	return (value >> amount) | (value << (32 - amount));
+}
+
+static uint64 Ror64(uint64 value, uint32 amount)
+{
+	amount &= 0x3F;
+	if(amount == 0) return value;
+	return (value >> amount) | (value << (64 - amount));
+}
+
+CBitManipTest::CBitManipTest(uint32 shiftAmount)
+: m_shiftAmount(shiftAmount)
+{
+
+}
+
+void CBitManipTest::Compile(Jitter::CJitter& jitter)
+{
+	Framework::CMemStream codeStream;
+	jitter.SetStream(&codeStream);
+
+	jitter.Begin();
+	{
+		//Rotates
+		jitter.PushRel(offsetof(CONTEXT, value0));
+		jitter.Ror(m_shiftAmount);
+		jitter.PullRel(offsetof(CONTEXT, resultRor));
+
+		jitter.PushRel(offsetof(CONTEXT, value0));
+		jitter.PushRel(offsetof(CONTEXT, shiftAmount));
+		jitter.Ror();
+		jitter.PullRel(offsetof(CONTEXT, resultRorVar));
+
+		jitter.PushRel(offsetof(CONTEXT, value1));
+		jitter.Rol(m_shiftAmount);
+		jitter.PullRel(offsetof(CONTEXT, resultRol));
+
+		jitter.PushRel(offsetof(CONTEXT, value1));
+		jitter.PushRel(offsetof(CONTEXT, shiftAmount));
+		jitter.Rol();
+		jitter.PullRel(offsetof(CONTEXT, resultRolVar));
+
+		//Byte swap, population count and trailing zero count
+		jitter.PushRel(offsetof(CONTEXT, value1));
+		jitter.ByteSwap();
+		jitter.PullRel(offsetof(CONTEXT, resultByteSwap));
+
+		jitter.PushRel(offsetof(CONTEXT, value0));
+		jitter.PopCount();
+		jitter.PullRel(offsetof(CONTEXT, resultPopCount0));
+
+		jitter.PushRel(offsetof(CONTEXT, value1));
+		jitter.PopCount();
+		jitter.PullRel(offsetof(CONTEXT, resultPopCount1));
+
+		jitter.PushRel(offsetof(CONTEXT, value0));
+		jitter.Ctz();
+		jitter.PullRel(offsetof(CONTEXT, resultCtz0));
+
+		jitter.PushRel(offsetof(CONTEXT, value1));
+		jitter.Ctz();
+		jitter.PullRel(offsetof(CONTEXT, resultCtz1));
+
+		jitter.PushRel(offsetof(CONTEXT, zero));
+		jitter.Ctz();
+		jitter.PullRel(offsetof(CONTEXT, resultCtzZero));
+
+		//Constants
+		jitter.PushCst(VALUE1);
+		jitter.Ror(m_shiftAmount);
+		jitter.PullRel(offsetof(CONTEXT, resultCstRor));
+
+		jitter.PushCst(VALUE1);
+		jitter.ByteSwap();
+		jitter.PullRel(offsetof(CONTEXT, resultCstByteSwap));
+
+		jitter.PushCst(VALUE1);
+		jitter.PopCount();
+		jitter.PullRel(offsetof(CONTEXT, resultCstPopCount));
+
+		jitter.PushCst(VALUE0);
+		jitter.Ctz();
+		jitter.PullRel(offsetof(CONTEXT, resultCstCtz));
+
+		//64-bits
+		jitter.PushRel64(offsetof(CONTEXT, value64));
+		jitter.Ror64(m_shiftAmount);
+		jitter.PullRel64(offsetof(CONTEXT, resultRor64));
+
+		jitter.PushRel64(offsetof(CONTEXT, value64));
+		jitter.PushRel(offsetof(CONTEXT, shiftAmount));
+		jitter.Ror64();
+		jitter.PullRel64(offsetof(CONTEXT, resultRor64Var));
+
+		jitter.PushRel64(offsetof(CONTEXT, value64));
+		jitter.Rol64(m_shiftAmount);
+		jitter.PullRel64(offsetof(CONTEXT, resultRol64));
+
+		jitter.PushRel64(offsetof(CONTEXT, value64));
+		jitter.PushRel(offsetof(CONTEXT, shiftAmount));
+		jitter.Rol64();
+		jitter.PullRel64(offsetof(CONTEXT, resultRol64Var));
+	}
+	jitter.End();
+
+	m_function = CMemoryFunction(codeStream.GetBuffer(), codeStream.GetSize());
+}
+
+void CBitManipTest::Run()
+{
+	memset(&m_context, 0, sizeof(CONTEXT));
+	m_context.value0 = VALUE0;
+	m_context.value1 = VALUE1;
+	m_context.value64 = VALUE64;
+	m_context.shiftAmount = m_shiftAmount;
+
+	m_function(&m_context);
+
+	//Amounts are masked here because rotate operations are expected to mask the rotate amounts
+
+	TEST_VERIFY(m_context.resultRor == Ror32(VALUE0, m_shiftAmount));
+	TEST_VERIFY(m_context.resultRorVar == Ror32(VALUE0, m_shiftAmount));
+	TEST_VERIFY(m_context.resultRol == Ror32(VALUE1, 32 - (m_shiftAmount & 0x1F)));
+	TEST_VERIFY(m_context.resultRolVar == Ror32(VALUE1, 32 - (m_shiftAmount & 0x1F)));
+
+	TEST_VERIFY(m_context.resultByteSwap == 0x21836587);
+	TEST_VERIFY(m_context.resultPopCount0 == 10);
+	TEST_VERIFY(m_context.resultPopCount1 == 13);
+	TEST_VERIFY(m_context.resultCtz0 == 7);
+	TEST_VERIFY(m_context.resultCtz1 == 0);
+	TEST_VERIFY(m_context.resultCtzZero == 32);
+
+	TEST_VERIFY(m_context.resultCstRor == Ror32(VALUE1, m_shiftAmount));
+	TEST_VERIFY(m_context.resultCstByteSwap == 0x21836587);
+	TEST_VERIFY(m_context.resultCstPopCount == 13);
+	TEST_VERIFY(m_context.resultCstCtz == 7);
+
+	TEST_VERIFY(m_context.resultRor64 == Ror64(VALUE64, m_shiftAmount));
+	TEST_VERIFY(m_context.resultRor64Var == Ror64(VALUE64, m_shiftAmount));
+	TEST_VERIFY(m_context.resultRol64 == Ror64(VALUE64, 64 - (m_shiftAmount & 0x3F)));
+	TEST_VERIFY(m_context.resultRol64Var == Ror64(VALUE64, 64 - (m_shiftAmount & 0x3F)));
+}
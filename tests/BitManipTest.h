@@ -0,0 +1,50 @@
+#pragma once
+
+#include "Test.h"
+#include "MemoryFunction.h"
+
+class CBitManipTest : public CTest
+{
+public:
+						CBitManipTest(uint32);
+
+	void				Compile(Jitter::CJitter&) override;
+	void				Run() override;
+
+private:
+	struct CONTEXT
+	{
+		uint32			value0;
+		uint32			value1;
+		uint32			shiftAmount;
+		uint32			zero;
+
+		uint64			value64;
+
+		uint32			resultRor;
+		uint32			resultRorVar;
+		uint32			resultRol;
+		uint32			resultRolVar;
+
+		uint32			resultByteSwap;
+		uint32			resultPopCount0;
+		uint32			resultPopCount1;
+		uint32			resultCtz0;
+		uint32			resultCtz1;
+		uint32			resultCtzZero;
+
+		uint32			resultCstRor;
+		uint32			resultCstByteSwap;
+		uint32			resultCstPopCount;
+		uint32			resultCstCtz;
+
+		uint64			resultRor64;
+		uint64			resultRor64Var;
+		uint64			resultRol64;
+		uint64			resultRol64Var;
+	};
+
+	CONTEXT				m_context;
+	CMemoryFunction		m_function;
+	uint32				m_shiftAmount = 0;
+};
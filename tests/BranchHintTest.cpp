@@ -0,0 +1,109 @@
+#include "BranchHintTest.h"
+#include "MemStream.h"
+#include "offsetof_def.h"
+
+void CBranchHintTest::RunCase(uint32 input0, uint32 input1)
+{
+	memset(&m_context, 0, sizeof(m_context));
+	m_context.input0 = input0;
+	m_context.input1 = input1;
+
+	m_function(&m_context);
+
+	uint32 result0 = (input0 == 0) ? (input1 + 1 + ((static_cast<int32>(input1) > 5) ? 0x100 : 0)) : (input1 ^ 0xFF);
+	uint32 result1 = (input0 == input1) ? 1 : ((input1 == 3) ? 3 : 2);
+	uint32 result3 = (input0 == 7) ? 7 : 0;
+
+	TEST_VERIFY(m_context.result0 == result0);
+	TEST_VERIFY(m_context.result1 == result1);
+	TEST_VERIFY(m_context.result2 == input0 + input1);
+	TEST_VERIFY(m_context.result3 == result3);
+}
+
+void CBranchHintTest::Run()
+{
+	RunCase(0, 0);
+	RunCase(0, 3);
+	RunCase(0, 10);
+	RunCase(1, 1);
+	RunCase(2, 3);
+	RunCase(7, 9);
+}
+
+void CBranchHintTest::Compile(Jitter::CJitter& jitter)
+{
+	Framework::CMemStream codeStream;
+	jitter.SetStream(&codeStream);
+
+	jitter.Begin();
+	{
+		jitter.PushRel(offsetof(CONTEXT, input0));
+		jitter.PushCst(0);
+		jitter.BeginIf(Jitter::CONDITION_EQ, Jitter::CJitter::BRANCH_HINT_UNLIKELY);
+		{
+			jitter.PushRel(offsetof(CONTEXT, input1));
+			jitter.PushCst(1);
+			jitter.Add();
+			jitter.PullRel(offsetof(CONTEXT, result0));
+
+			jitter.PushRel(offsetof(CONTEXT, input1));
+			jitter.PushCst(5);
+			jitter.BeginIf(Jitter::CONDITION_GT);
+			{
+				jitter.PushRel(offsetof(CONTEXT, result0));
+				jitter.PushCst(0x100);
+				jitter.Add();
+				jitter.PullRel(offsetof(CONTEXT, result0));
+			}
+			jitter.EndIf();
+		}
+		jitter.Else();
+		{
+			jitter.PushRel(offsetof(CONTEXT, input1));
+			jitter.PushCst(0xFF);
+			jitter.Xor();
+			jitter.PullRel(offsetof(CONTEXT, result0));
+		}
+		jitter.EndIf();
+
+		jitter.PushRel(offsetof(CONTEXT, input0));
+		jitter.PushRel(offsetof(CONTEXT, input1));
+		jitter.BeginIf(Jitter::CONDITION_EQ, Jitter::CJitter::BRANCH_HINT_LIKELY);
+		{
+			jitter.PushCst(1);
+			jitter.PullRel(offsetof(CONTEXT, result1));
+		}
+		jitter.Else();
+		{
+			jitter.PushCst(2);
+			jitter.PullRel(offsetof(CONTEXT, result1));
+
+			jitter.PushRel(offsetof(CONTEXT, input1));
+			jitter.PushCst(3);
+			jitter.BeginIf(Jitter::CONDITION_EQ, Jitter::CJitter::BRANCH_HINT_UNLIKELY);
+			{
+				jitter.PushCst(3);
+				jitter.PullRel(offsetof(CONTEXT, result1));
+			}
+			jitter.EndIf();
+		}
+		jitter.EndIf();
+
+		jitter.PushRel(offsetof(CONTEXT, input0));
+		jitter.PushRel(offsetof(CONTEXT, input1));
+		jitter.Add();
+		jitter.PullRel(offsetof(CONTEXT, result2));
+
+		jitter.PushRel(offsetof(CONTEXT, input0));
+		jitter.PushCst(7);
+		jitter.BeginIf(Jitter::CONDITION_EQ, Jitter::CJitter::BRANCH_HINT_UNLIKELY);
+		{
+			jitter.PushCst(7);
+			jitter.PullRel(offsetof(CONTEXT, result3));
+		}
+		jitter.EndIf();
+	}
+	jitter.End();
+
+	m_function = CMemoryFunction(codeStream.GetBuffer(), codeStream.GetSize());
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#include "Test.h"
+#include "MemoryFunction.h"
+
+class CBranchHintTest : public CTest
+{
+public:
+	void				Run() override;
+	void				Compile(Jitter::CJitter&) override;
+
+private:
+	struct CONTEXT
+	{
+		uint32		input0;
+		uint32		input1;
+
+		uint32		result0;
+		uint32		result1;
+		uint32		result2;
+		uint32		result3;
+	};
+
+	void				RunCase(uint32, uint32);
+
+	CONTEXT				m_context;
+	CMemoryFunction		m_function;
+};
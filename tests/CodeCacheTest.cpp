@@ -0,0 +1,139 @@
+#include "CodeCacheTest.h"
+#include "CodeCache.h"
+#include "MemStream.h"
+#include <cstdio>
+#include <sstream>
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
+#define EXTERNAL_SYMBOL_NAME	"CodeCacheTest_External"
+#define CONSTANT_1				(0x1000)
+#define CONSTANT_2				(0x2000)
+#define INPUT_VALUE				(0x10)
+
+uint32 CCodeCacheTest::ExternalFunction0(uint32 value)
+{
+	return value * 2;
+}
+
+uint32 CCodeCacheTest::ExternalFunction1(uint32 value)
+{
+	return value * 3;
+}
+
+CMemoryFunction CCodeCacheTest::CompileFunction(Jitter::CJitter& jitter, ExternalFunctionType externalFunction, uint32 constant)
+{
+	Framework::CMemStream codeStream;
+	jitter.SetStream(&codeStream);
+
+	jitter.Begin();
+	{
+		jitter.PushRel(offsetof(CONTEXT, value));
+		jitter.Call(reinterpret_cast<void*>(externalFunction), 1, Jitter::CJitter::RETURN_VALUE_32);
+		jitter.PushCst(constant);
+		jitter.Add();
+		jitter.PullRel(offsetof(CONTEXT, result));
+	}
+	jitter.End();
+
+	return CMemoryFunction(codeStream.GetBuffer(), codeStream.GetSize());
+}
+
+void CCodeCacheTest::Compile(Jitter::CJitter& jitter)
+{
+	std::string cachePath;
+	{
+		std::stringstream pathStream;
+#ifdef _WIN32
+		pathStream << "CodeCacheTest.bin";
+#else
+		pathStream << "/tmp/CodeCacheTest_" << getpid() << ".bin";
+#endif
+		cachePath = pathStream.str();
+	}
+	remove(cachePath.c_str());
+
+	{
+		Jitter::CCodeCache codeCache(cachePath, "CodeCacheTest");
+		codeCache.RegisterExternalSymbol(EXTERNAL_SYMBOL_NAME, reinterpret_cast<uintptr_t>(&ExternalFunction0));
+		TEST_VERIFY(codeCache.GetEntryCount() == 0);
+
+		jitter.SetCodeCache(&codeCache);
+		m_compiledFunction = CompileFunction(jitter, &ExternalFunction0, CONSTANT_1);
+		m_cachedFunction = CompileFunction(jitter, &ExternalFunction0, CONSTANT_1);
+		jitter.SetCodeCache(nullptr);
+
+		auto stats = codeCache.GetStats();
+		TEST_VERIFY(stats.missCount >= 1);
+		m_cacheable = (stats.storeCount == 1);
+		if(m_cacheable)
+		{
+			TEST_VERIFY(stats.hitCount == 1);
+			TEST_VERIFY(m_compiledFunction.GetSize() == m_cachedFunction.GetSize());
+			TEST_VERIFY(memcmp(m_compiledFunction.GetCode(), m_cachedFunction.GetCode(), m_compiledFunction.GetSize()) == 0);
+		}
+		else
+		{
+			//Code generator doesn't produce patchable references (ie.: AArch64)
+			TEST_VERIFY(stats.uncacheableCount == 2);
+		}
+	}
+
+	{
+		//Simulate a new process where the external symbol lives somewhere else
+		Jitter::CCodeCache codeCache(cachePath, "CodeCacheTest");
+		codeCache.RegisterExternalSymbol(EXTERNAL_SYMBOL_NAME, reinterpret_cast<uintptr_t>(&ExternalFunction1));
+		TEST_VERIFY(codeCache.GetEntryCount() == (m_cacheable ? 1 : 0));
+
+		jitter.SetCodeCache(&codeCache);
+		m_reloadedFunction = CompileFunction(jitter, &ExternalFunction1, CONSTANT_1);
+		m_otherFunction = CompileFunction(jitter, &ExternalFunction1, CONSTANT_2);
+		jitter.SetCodeCache(nullptr);
+
+		auto stats = codeCache.GetStats();
+		if(m_cacheable)
+		{
+			TEST_VERIFY(stats.hitCount == 1);
+			TEST_VERIFY(stats.missCount == 1);
+			TEST_VERIFY(stats.storeCount == 1);
+		}
+		else
+		{
+			TEST_VERIFY(stats.hitCount == 0);
+		}
+	}
+
+	{
+		//Different configuration, nothing should match
+		Jitter::CCodeCache codeCache(cachePath, "CodeCacheTest_Other");
+		codeCache.RegisterExternalSymbol(EXTERNAL_SYMBOL_NAME, reinterpret_cast<uintptr_t>(&ExternalFunction0));
+
+		jitter.SetCodeCache(&codeCache);
+		CompileFunction(jitter, &ExternalFunction0, CONSTANT_1);
+		jitter.SetCodeCache(nullptr);
+
+		TEST_VERIFY(codeCache.GetStats().hitCount == 0);
+	}
+
+	remove(cachePath.c_str());
+}
+
+void CCodeCacheTest::Run()
+{
+	memset(&m_context, 0, sizeof(m_context));
+	m_context.value = INPUT_VALUE;
+
+	m_compiledFunction(&m_context);
+	TEST_VERIFY(m_context.result == ((INPUT_VALUE * 2) + CONSTANT_1));
+
+	m_cachedFunction(&m_context);
+	TEST_VERIFY(m_context.result == ((INPUT_VALUE * 2) + CONSTANT_1));
+
+	//Function loaded from cache must call the relocated symbol
+	m_reloadedFunction(&m_context);
+	TEST_VERIFY(m_context.result == ((INPUT_VALUE * 3) + CONSTANT_1));
+
+	m_otherFunction(&m_context);
+	TEST_VERIFY(m_context.result == ((INPUT_VALUE * 3) + CONSTANT_2));
+}
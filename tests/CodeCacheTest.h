@@ -0,0 +1,33 @@
+#pragma once
+
+#include "Test.h"
+#include "MemoryFunction.h"
+#include <string>
+
+class CCodeCacheTest : public CTest
+{
+public:
+	void				Run() override;
+	void				Compile(Jitter::CJitter&) override;
+
+private:
+	struct CONTEXT
+	{
+		uint32			value;
+		uint32			result;
+	};
+
+	typedef uint32 (*ExternalFunctionType)(uint32);
+
+	static uint32		ExternalFunction0(uint32);
+	static uint32		ExternalFunction1(uint32);
+
+	static CMemoryFunction	CompileFunction(Jitter::CJitter&, ExternalFunctionType, uint32);
+
+	CONTEXT				m_context;
+	bool				m_cacheable = false;
+	CMemoryFunction		m_compiledFunction;
+	CMemoryFunction		m_cachedFunction;
+	CMemoryFunction		m_reloadedFunction;
+	CMemoryFunction		m_otherFunction;
+};
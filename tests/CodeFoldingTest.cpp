@@ -0,0 +1,114 @@
+#include "CodeFoldingTest.h"
+#include "ElfObjectFile.h"
+#include "MemStream.h"
+
+#define CONSTANT_1		(0x10101010)
+#define CONSTANT_2		(0x20202020)
+#define SYMBOL_SIZE		(0x40)
+
+static CMemoryFunction CompileFunction(Jitter::CJitter& jitter, uint32 value)
+{
+	Framework::CMemStream codeStream;
+	jitter.SetStream(&codeStream);
+
+	jitter.Begin();
+	{
+		jitter.PushCst(value);
+		jitter.PullRel(0);
+	}
+	jitter.End();
+
+	return CMemoryFunction(codeStream.GetBuffer(), codeStream.GetSize());
+}
+
+void CCodeFoldingTest::Compile(Jitter::CJitter& jitter)
+{
+	size_t initialFoldedSize = CMemoryFunction::GetFoldedSize();
+
+	CMemoryFunction::SetCodeFoldingEnabled(true);
+	m_function0 = CompileFunction(jitter, CONSTANT_1);
+	m_function1 = CompileFunction(jitter, CONSTANT_1);
+	m_function2 = CompileFunction(jitter, CONSTANT_2);
+	CMemoryFunction::SetCodeFoldingEnabled(false);
+
+	TEST_VERIFY(m_function0.GetCode() == m_function1.GetCode());
+	TEST_VERIFY(m_function0.GetCode() != m_function2.GetCode());
+	TEST_VERIFY(CMemoryFunction::GetFoldedSize() != initialFoldedSize);
+}
+
+void CCodeFoldingTest::Run()
+{
+	memset(&m_context, 0, sizeof(m_context));
+	m_function1(&m_context);
+	TEST_VERIFY(m_context.result == CONSTANT_1);
+
+	//Shared code must stay alive until every function using it is released
+	size_t foldedSize = CMemoryFunction::GetFoldedSize();
+	m_function0 = CMemoryFunction();
+	TEST_VERIFY(CMemoryFunction::GetFoldedSize() < foldedSize);
+
+	memset(&m_context, 0, sizeof(m_context));
+	m_function1(&m_context);
+	TEST_VERIFY(m_context.result == CONSTANT_1);
+
+	m_function2(&m_context);
+	TEST_VERIFY(m_context.result == CONSTANT_2);
+
+	RunObjectFileTest();
+}
+
+void CCodeFoldingTest::RunObjectFileTest()
+{
+	Jitter::CElfObjectFile64 objectFile(Jitter::CObjectFile::CPU_ARCH_X64);
+	objectFile.SetCodeFoldingEnabled(true);
+	auto externalSymbol0 = objectFile.AddExternalSymbol("CodeFoldingTest_External0", 0x1000);
+	auto externalSymbol1 = objectFile.AddExternalSymbol("CodeFoldingTest_External1", 0x2000);
+
+	auto makeSymbol =
+		[] (const char* name, uint8 fill, unsigned int externalSymbolIndex)
+		{
+			Jitter::CObjectFile::SYMBOL_REFERENCE reference;
+			reference.type = Jitter::CObjectFile::SYMBOL_TYPE_EXTERNAL;
+			reference.symbolIndex = externalSymbolIndex;
+			reference.offset = 0x10;
+
+			Jitter::CObjectFile::INTERNAL_SYMBOL symbol;
+			symbol.name = name;
+			symbol.location = Jitter::CObjectFile::INTERNAL_SYMBOL_LOCATION_TEXT;
+			symbol.data = std::vector<uint8>(SYMBOL_SIZE, fill);
+			symbol.symbolReferences.push_back(reference);
+			return symbol;
+		};
+
+	objectFile.AddInternalSymbol(makeSymbol("CodeFoldingTest_0", 0xCC, externalSymbol0));
+	//Same as 0, will be folded
+	objectFile.AddInternalSymbol(makeSymbol("CodeFoldingTest_1", 0xCC, externalSymbol0));
+	//Same code, but references another symbol
+	objectFile.AddInternalSymbol(makeSymbol("CodeFoldingTest_2", 0xCC, externalSymbol1));
+	//Different code
+	objectFile.AddInternalSymbol(makeSymbol("CodeFoldingTest_3", 0x90, externalSymbol0));
+
+	{
+		Jitter::CObjectFile::INTERNAL_SYMBOL symbol;
+		symbol.name = "CodeFoldingTest_Data0";
+		symbol.location = Jitter::CObjectFile::INTERNAL_SYMBOL_LOCATION_DATA;
+		symbol.data = std::vector<uint8>(SYMBOL_SIZE, 0);
+		objectFile.AddInternalSymbol(symbol);
+		//Data symbols are never folded
+		symbol.name = "CodeFoldingTest_Data1";
+		objectFile.AddInternalSymbol(symbol);
+	}
+
+	TEST_VERIFY(objectFile.GetFoldedSize() == SYMBOL_SIZE);
+
+	Framework::CMemStream foldedStream;
+	objectFile.Write(foldedStream);
+
+	objectFile.SetCodeFoldingEnabled(false);
+	TEST_VERIFY(objectFile.GetFoldedSize() == 0);
+
+	//One symbol less in the text section, one relocation less
+	Framework::CMemStream unfoldedStream;
+	objectFile.Write(unfoldedStream);
+	TEST_VERIFY((unfoldedStream.GetSize() - foldedStream.GetSize()) == (SYMBOL_SIZE + sizeof(Elf::RELA_64)));
+}
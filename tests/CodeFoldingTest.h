@@ -0,0 +1,24 @@
+#pragma once
+
+#include "Test.h"
+#include "MemoryFunction.h"
+
+class CCodeFoldingTest : public CTest
+{
+public:
+	void				Run() override;
+	void				Compile(Jitter::CJitter&) override;
+
+private:
+	struct CONTEXT
+	{
+		uint32			result;
+	};
+
+	static void			RunObjectFileTest();
+
+	CONTEXT				m_context;
+	CMemoryFunction		m_function0;
+	CMemoryFunction		m_function1;
+	CMemoryFunction		m_function2;
+};
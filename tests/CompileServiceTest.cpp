@@ -0,0 +1,229 @@
+#include "CompileServiceTest.h"
+#include "Jitter_CodeGenFactory.h"
+#include "MemStream.h"
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+void CCompileServiceTest::EmitFunction(Jitter::CJitter& jitter, uint32 constant)
+{
+	jitter.PushRel(offsetof(CONTEXT, value));
+	jitter.PushCst(constant);
+	jitter.Add();
+	jitter.PullRel(offsetof(CONTEXT, result));
+}
+
+void CCompileServiceTest::CompileBatch()
+{
+	Jitter::CCompileService service(&Jitter::CreateCodeGen, 3);
+	TEST_VERIFY(service.GetThreadCount() == 3);
+
+	std::vector<Jitter::CCompileService::JOB_ID> cancelledJobs;
+	for(uint32 i = 0; i < FUNCTION_COUNT; i++)
+	{
+		uint32 constant = i * 0x10;
+		auto jobId = service.Submit(
+			[constant] (Jitter::CJitter& jitter)
+			{
+				EmitFunction(jitter, constant);
+			},
+			i % 4
+		);
+		TEST_VERIFY(jobId != Jitter::CCompileService::INVALID_JOB_ID);
+		m_jobConstants[jobId] = constant;
+		if((i % 8) == 7)
+		{
+			if(service.Cancel(jobId))
+			{
+				cancelledJobs.push_back(jobId);
+			}
+		}
+	}
+
+	//Captured IR
+	{
+		Framework::CMemStream irStream;
+		Framework::CMemStream codeStream;
+		Jitter::CJitter jitter(Jitter::CreateCodeGen());
+		jitter.SetIrCaptureStream(&irStream);
+		jitter.SetStream(&codeStream);
+		jitter.Begin();
+		EmitFunction(jitter, 0x1000);
+		jitter.End();
+
+		auto jobId = service.SubmitIr(Jitter::CCompileService::IrData(irStream.GetBuffer(), irStream.GetBuffer() + irStream.GetSize()));
+		m_jobConstants[jobId] = 0x1000;
+	}
+
+	auto failingJobId = service.Submit(
+		[] (Jitter::CJitter& jitter)
+		{
+			jitter.PushCst(0);
+			throw std::runtime_error("Failed.");
+		}
+	);
+
+	service.WaitIdle();
+
+	bool failingJobCompleted = false;
+	Jitter::CCompileService::COMPLETED_JOB completedJob;
+	while(service.GetCompletedJob(completedJob))
+	{
+		if(completedJob.id == failingJobId)
+		{
+			TEST_VERIFY(completedJob.exception);
+			TEST_VERIFY(completedJob.function.IsEmpty());
+			failingJobCompleted = true;
+			continue;
+		}
+		TEST_VERIFY(!completedJob.exception);
+		TEST_VERIFY(m_jobConstants.find(completedJob.id) != std::end(m_jobConstants));
+		TEST_VERIFY(m_functions.find(completedJob.id) == std::end(m_functions));
+		m_functions[completedJob.id] = std::move(completedJob.function);
+	}
+	TEST_VERIFY(failingJobCompleted);
+	TEST_VERIFY(!service.Cancel(failingJobId));
+
+	for(const auto& jobId : cancelledJobs)
+	{
+		TEST_VERIFY(m_functions.find(jobId) == std::end(m_functions));
+		m_jobConstants.erase(jobId);
+	}
+	TEST_VERIFY(m_functions.size() == m_jobConstants.size());
+
+	//Workers can be used again after a failure
+	auto jobId = service.Submit(
+		[] (Jitter::CJitter& jitter)
+		{
+			EmitFunction(jitter, 0x2000);
+		}
+	);
+	m_jobConstants[jobId] = 0x2000;
+	service.WaitIdle();
+	TEST_VERIFY(service.GetCompletedJob(completedJob));
+	TEST_VERIFY(completedJob.id == jobId);
+	TEST_VERIFY(!completedJob.exception);
+	m_functions[jobId] = std::move(completedJob.function);
+	TEST_VERIFY(!service.GetCompletedJob(completedJob));
+}
+
+void CCompileServiceTest::CompilePriorities()
+{
+	Jitter::CCompileService service(&Jitter::CreateCodeGen, 1);
+
+	//Keep the only worker busy until all other jobs are queued
+	std::atomic<bool> released(false);
+	auto blockingJobId = service.Submit(
+		[&released] (Jitter::CJitter& jitter)
+		{
+			while(!released)
+			{
+				std::this_thread::yield();
+			}
+			EmitFunction(jitter, 0);
+		},
+		100
+	);
+
+	auto lowJobId = service.Submit([] (Jitter::CJitter& jitter) { EmitFunction(jitter, 1); }, 0);
+	auto highJobId = service.Submit([] (Jitter::CJitter& jitter) { EmitFunction(jitter, 2); }, 10);
+	auto cancelledJobId = service.Submit([] (Jitter::CJitter& jitter) { EmitFunction(jitter, 3); }, 20);
+	TEST_VERIFY(service.Cancel(cancelledJobId));
+	TEST_VERIFY(!service.Cancel(cancelledJobId));
+
+	released = true;
+	service.WaitIdle();
+
+	std::vector<Jitter::CCompileService::JOB_ID> completedJobIds;
+	Jitter::CCompileService::COMPLETED_JOB completedJob;
+	while(service.GetCompletedJob(completedJob))
+	{
+		completedJobIds.push_back(completedJob.id);
+	}
+	TEST_VERIFY(completedJobIds.size() == 3);
+	TEST_VERIFY(completedJobIds[0] == blockingJobId);
+	TEST_VERIFY(completedJobIds[1] == highJobId);
+	TEST_VERIFY(completedJobIds[2] == lowJobId);
+}
+
+void CCompileServiceTest::CompileCrossQueuePriorities()
+{
+	Jitter::CCompileService service(&Jitter::CreateCodeGen, 2);
+
+	//Keep both workers busy, jobs submitted afterwards are spread over both queues
+	std::atomic<int> startedCount(0);
+	std::atomic<bool> released[2] = { { false }, { false } };
+	Jitter::CCompileService::JOB_ID blockingJobIds[2];
+	for(unsigned int i = 0; i < 2; i++)
+	{
+		blockingJobIds[i] = service.Submit(
+			[&startedCount, &released, i] (Jitter::CJitter& jitter)
+			{
+				startedCount++;
+				while(!released[i])
+				{
+					std::this_thread::yield();
+				}
+				EmitFunction(jitter, i);
+			},
+			100
+		);
+	}
+	while(startedCount != 2)
+	{
+		std::this_thread::yield();
+	}
+
+	//Whichever queue belongs to the released worker, taking its own top job first would break the order
+	auto lowJobId = service.Submit([] (Jitter::CJitter& jitter) { EmitFunction(jitter, 2); }, 0);
+	auto highJobId = service.Submit([] (Jitter::CJitter& jitter) { EmitFunction(jitter, 3); }, 10);
+	auto mediumJobId = service.Submit([] (Jitter::CJitter& jitter) { EmitFunction(jitter, 4); }, 5);
+	auto mediumLowJobId = service.Submit([] (Jitter::CJitter& jitter) { EmitFunction(jitter, 5); }, 1);
+
+	std::vector<Jitter::CCompileService::JOB_ID> completedJobIds;
+	Jitter::CCompileService::COMPLETED_JOB completedJob;
+	released[0] = true;
+	while(completedJobIds.size() != 5)
+	{
+		if(service.GetCompletedJob(completedJob))
+		{
+			completedJobIds.push_back(completedJob.id);
+		}
+		else
+		{
+			std::this_thread::yield();
+		}
+	}
+	released[1] = true;
+	service.WaitIdle();
+	while(service.GetCompletedJob(completedJob))
+	{
+		completedJobIds.push_back(completedJob.id);
+	}
+	TEST_VERIFY(completedJobIds.size() == 6);
+	TEST_VERIFY(completedJobIds[0] == blockingJobIds[0]);
+	TEST_VERIFY(completedJobIds[1] == highJobId);
+	TEST_VERIFY(completedJobIds[2] == mediumJobId);
+	TEST_VERIFY(completedJobIds[3] == mediumLowJobId);
+	TEST_VERIFY(completedJobIds[4] == lowJobId);
+	TEST_VERIFY(completedJobIds[5] == blockingJobIds[1]);
+}
+
+void CCompileServiceTest::Compile(Jitter::CJitter&)
+{
+	CompileBatch();
+	CompilePriorities();
+	CompileCrossQueuePriorities();
+}
+
+void CCompileServiceTest::Run()
+{
+	for(auto& functionPair : m_functions)
+	{
+		memset(&m_context, 0, sizeof(m_context));
+		m_context.value = 0x5;
+		functionPair.second(&m_context);
+		TEST_VERIFY(m_context.result == (m_jobConstants[functionPair.first] + 0x5));
+	}
+}
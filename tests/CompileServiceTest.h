@@ -0,0 +1,37 @@
+#pragma once
+
+#include "Test.h"
+#include "CompileService.h"
+#include <map>
+
+class CCompileServiceTest : public CTest
+{
+public:
+	void			Run() override;
+	void			Compile(Jitter::CJitter&) override;
+
+private:
+	enum
+	{
+		FUNCTION_COUNT = 64,
+	};
+
+	struct CONTEXT
+	{
+		uint32		value;
+		uint32		result;
+	};
+
+	typedef std::map<Jitter::CCompileService::JOB_ID, uint32> JobConstantMap;
+	typedef std::map<Jitter::CCompileService::JOB_ID, CMemoryFunction> JobFunctionMap;
+
+	static void		EmitFunction(Jitter::CJitter&, uint32);
+
+	void			CompileBatch();
+	void			CompilePriorities();
+	void			CompileCrossQueuePriorities();
+
+	CONTEXT			m_context;
+	JobConstantMap	m_jobConstants;
+	JobFunctionMap	m_functions;
+};
@@ -0,0 +1,89 @@
+#include "CompileStatsTest.h"
+#include "CompileTraceWriter.h"
+#include "MemStream.h"
+#include <string>
+
+void CCompileStatsTest::EmitFunction(Jitter::CJitter& jitter)
+{
+	jitter.PushRel(offsetof(CONTEXT, value0));
+	jitter.PushRel(offsetof(CONTEXT, value1));
+	jitter.Add();
+	jitter.PushRel(offsetof(CONTEXT, value0));
+	jitter.Mult();
+	jitter.ExtLow64();
+	jitter.PullRel(offsetof(CONTEXT, result));
+
+	jitter.PushRel(offsetof(CONTEXT, result));
+	jitter.PushRel(offsetof(CONTEXT, value1));
+	jitter.Sub();
+	jitter.PullRel(offsetof(CONTEXT, value1));
+}
+
+void CCompileStatsTest::Compile(Jitter::CJitter& jitter)
+{
+	jitter.ResetCompileStats();
+
+	Framework::CMemStream traceStream;
+	{
+		Jitter::CCompileTraceWriter traceWriter(traceStream);
+		jitter.SetCompileTraceWriter(&traceWriter);
+
+		Framework::CMemStream codeStream;
+		jitter.SetStream(&codeStream);
+		jitter.Begin();
+		EmitFunction(jitter);
+		jitter.End();
+
+		m_function = CMemoryFunction(codeStream.GetBuffer(), codeStream.GetSize());
+
+		const auto& stats = jitter.GetCompileStats();
+		TEST_VERIFY(stats.functionCount == 1);
+		TEST_VERIFY(stats.statementsIn != 0);
+		TEST_VERIFY(stats.statementsOut != 0);
+		TEST_VERIFY(stats.blockCount == 1);
+		TEST_VERIFY(stats.codeSize == codeStream.GetSize());
+		TEST_VERIFY(stats.maxStackSize == stats.stackSize);
+		//Relatives used more than once are loaded into registers and spilled back
+		TEST_VERIFY(stats.registerLoadCount != 0);
+		TEST_VERIFY(stats.registerSpillCount != 0);
+
+		//Second compile accumulates
+		Framework::CMemStream otherCodeStream;
+		jitter.SetStream(&otherCodeStream);
+		jitter.Begin();
+		EmitFunction(jitter);
+		jitter.End();
+
+		TEST_VERIFY(stats.functionCount == 2);
+		TEST_VERIFY(stats.codeSize == (codeStream.GetSize() + otherCodeStream.GetSize()));
+
+		jitter.SetCompileTraceWriter(nullptr);
+	}
+
+	std::string trace(reinterpret_cast<const char*>(traceStream.GetBuffer()), traceStream.GetSize());
+	TEST_VERIFY(trace.front() == '[');
+	TEST_VERIFY(trace.find_last_of(']') != std::string::npos);
+
+	//One event for the function and one per phase, for each compile
+	unsigned int eventCount = 0;
+	for(size_t position = trace.find("\"ph\":\"X\""); position != std::string::npos; position = trace.find("\"ph\":\"X\"", position + 1))
+	{
+		eventCount++;
+	}
+	TEST_VERIFY(eventCount == 2 * (Jitter::CJitter::COMPILE_PHASE_COUNT + 1));
+	TEST_VERIFY(trace.find("\"name\":\"GenerateCode\"") != std::string::npos);
+	TEST_VERIFY(trace.find("\"codeSize\":") != std::string::npos);
+
+	jitter.ResetCompileStats();
+	TEST_VERIFY(jitter.GetCompileStats().functionCount == 0);
+}
+
+void CCompileStatsTest::Run()
+{
+	CONTEXT context = {};
+	context.value0 = 3;
+	context.value1 = 4;
+	m_function(&context);
+	TEST_VERIFY(context.result == 21);
+	TEST_VERIFY(context.value1 == 17);
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include "Test.h"
+#include "MemoryFunction.h"
+
+class CCompileStatsTest : public CTest
+{
+public:
+	void				Run() override;
+	void				Compile(Jitter::CJitter&) override;
+
+private:
+	struct CONTEXT
+	{
+		uint32			value0;
+		uint32			value1;
+		uint32			result;
+	};
+
+	static void			EmitFunction(Jitter::CJitter&);
+
+	CMemoryFunction		m_function;
+};
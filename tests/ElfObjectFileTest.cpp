@@ -0,0 +1,151 @@
+#include "ElfObjectFileTest.h"
+#include "ElfObjectFile.h"
+#include "MemStream.h"
+#include <fstream>
+#include <sstream>
+
+#if defined(__linux__) && (defined(__x86_64__) || defined(__aarch64__))
+#define ELFOBJECTFILETEST_SUPPORTED
+#include <cstdio>
+#include <cstdlib>
+#include <dlfcn.h>
+#include <unistd.h>
+#endif
+
+#ifdef __aarch64__
+#include "Jitter_CodeGen_AArch64.h"
+#endif
+
+#define FUNCTION_SYMBOL_NAME	"ElfObjectFileTest_Function"
+#define TABLE_SYMBOL_NAME		"ElfObjectFileTest_Table"
+#define EXTERNAL_SYMBOL_NAME	"ElfObjectFileTest_AddValue"
+#define CONSTANT_1				(0x10203040)
+#define CONSTANT_2				(0x01020304)
+
+CElfObjectFileTest::~CElfObjectFileTest()
+{
+#ifdef ELFOBJECTFILETEST_SUPPORTED
+	if(m_library)
+	{
+		dlclose(m_library);
+	}
+	if(!m_objectPath.empty()) remove(m_objectPath.c_str());
+	if(!m_libraryPath.empty()) remove(m_libraryPath.c_str());
+#endif
+}
+
+uint32 CElfObjectFileTest::AddValue(uint32 value1, uint32 value2)
+{
+	return value1 + value2;
+}
+
+void CElfObjectFileTest::Compile(Jitter::CJitter& jitter)
+{
+#ifdef ELFOBJECTFILETEST_SUPPORTED
+#if defined(__x86_64__)
+	Jitter::CElfObjectFile64 objectFile(Jitter::CObjectFile::CPU_ARCH_X64);
+#else
+	Jitter::CElfObjectFile64 objectFile(Jitter::CObjectFile::CPU_ARCH_ARM64);
+#endif
+	objectFile.AddExternalSymbol(EXTERNAL_SYMBOL_NAME, reinterpret_cast<uintptr_t>(&AddValue));
+
+	Jitter::CObjectFile::INTERNAL_SYMBOL function;
+	function.name		= FUNCTION_SYMBOL_NAME;
+	function.location	= Jitter::CObjectFile::INTERNAL_SYMBOL_LOCATION_TEXT;
+
+	auto codeGen = jitter.GetCodeGen();
+#ifdef __aarch64__
+	static_cast<Jitter::CCodeGen_AArch64*>(codeGen)->SetGenerateRelocatableCalls(true);
+#endif
+	codeGen->SetExternalSymbolReferencedHandler(
+		[&] (uintptr_t symbol, uint32 offset)
+		{
+			Jitter::CObjectFile::SYMBOL_REFERENCE reference;
+			reference.type			= Jitter::CObjectFile::SYMBOL_TYPE_EXTERNAL;
+			reference.symbolIndex	= objectFile.GetExternalSymbolIndexByValue(symbol);
+			reference.offset		= offset;
+			function.symbolReferences.push_back(reference);
+		}
+	);
+
+	Framework::CMemStream codeStream;
+	jitter.SetStream(&codeStream);
+
+	jitter.Begin();
+	{
+		jitter.PushRel(offsetof(CONTEXT, value));
+		jitter.PushCst(CONSTANT_2);
+		jitter.Call(reinterpret_cast<void*>(&AddValue), 2, Jitter::CJitter::RETURN_VALUE_32);
+		jitter.PullRel(offsetof(CONTEXT, result));
+	}
+	jitter.End();
+
+	codeGen->SetExternalSymbolReferencedHandler(Jitter::CCodeGen::ExternalSymbolReferencedHandler());
+#ifdef __aarch64__
+	static_cast<Jitter::CCodeGen_AArch64*>(codeGen)->SetGenerateRelocatableCalls(false);
+#endif
+
+	TEST_VERIFY(!function.symbolReferences.empty());
+	function.data = std::vector<uint8>(codeStream.GetBuffer(), codeStream.GetBuffer() + codeStream.GetSize());
+	auto functionIndex = objectFile.AddInternalSymbol(function);
+
+	//Pointer table in the data section referencing the function
+	{
+		Jitter::CObjectFile::SYMBOL_REFERENCE reference;
+		reference.type			= Jitter::CObjectFile::SYMBOL_TYPE_INTERNAL;
+		reference.symbolIndex	= functionIndex;
+		reference.offset		= 0;
+
+		Jitter::CObjectFile::INTERNAL_SYMBOL table;
+		table.name		= TABLE_SYMBOL_NAME;
+		table.location	= Jitter::CObjectFile::INTERNAL_SYMBOL_LOCATION_DATA;
+		table.data		= std::vector<uint8>(sizeof(void*));
+		table.symbolReferences.push_back(reference);
+		objectFile.AddInternalSymbol(table);
+	}
+
+	Framework::CMemStream objectStream;
+	objectFile.Write(objectStream);
+
+	{
+		std::stringstream pathBase;
+		pathBase << "/tmp/ElfObjectFileTest_" << getpid();
+		m_objectPath = pathBase.str() + ".o";
+		m_libraryPath = pathBase.str() + ".so";
+	}
+
+	{
+		std::ofstream objectOutput(m_objectPath, std::ios::binary);
+		objectOutput.write(reinterpret_cast<const char*>(objectStream.GetBuffer()), objectStream.GetSize());
+		TEST_VERIFY(objectOutput.good());
+	}
+
+	//Generated code uses absolute addresses, text relocations are expected.
+	//External symbols are resolved to their address in this process.
+	std::stringstream linkCommand;
+	linkCommand << "ld -shared -z notext -o " << m_libraryPath << " " << m_objectPath
+		<< " --defsym=" << EXTERNAL_SYMBOL_NAME << "=0x" << std::hex << reinterpret_cast<uintptr_t>(&AddValue);
+	m_linked = (system(linkCommand.str().c_str()) == 0);
+#endif
+}
+
+void CElfObjectFileTest::Run()
+{
+#ifdef ELFOBJECTFILETEST_SUPPORTED
+	TEST_VERIFY(m_linked);
+
+	m_library = dlopen(m_libraryPath.c_str(), RTLD_NOW | RTLD_LOCAL);
+	TEST_VERIFY(m_library != nullptr);
+
+	auto function = reinterpret_cast<FunctionType>(dlsym(m_library, FUNCTION_SYMBOL_NAME));
+	auto table = reinterpret_cast<void* const*>(dlsym(m_library, TABLE_SYMBOL_NAME));
+	TEST_VERIFY(function != nullptr);
+	TEST_VERIFY(table != nullptr);
+	TEST_VERIFY(table[0] == reinterpret_cast<void*>(function));
+
+	memset(&m_context, 0, sizeof(m_context));
+	m_context.value = CONSTANT_1;
+	function(&m_context);
+	TEST_VERIFY(m_context.result == (CONSTANT_1 + CONSTANT_2));
+#endif
+}
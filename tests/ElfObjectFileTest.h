@@ -0,0 +1,30 @@
+#pragma once
+
+#include "Test.h"
+#include <string>
+
+class CElfObjectFileTest : public CTest
+{
+public:
+	virtual			~CElfObjectFileTest();
+
+	void			Run() override;
+	void			Compile(Jitter::CJitter&) override;
+
+private:
+	typedef void (*FunctionType)(void*);
+
+	struct CONTEXT
+	{
+		uint32		value;
+		uint32		result;
+	};
+
+	static uint32	AddValue(uint32, uint32);
+
+	CONTEXT			m_context;
+	bool			m_linked = false;
+	std::string		m_objectPath;
+	std::string		m_libraryPath;
+	void*			m_library = nullptr;
+};
@@ -0,0 +1,124 @@
+#include "ExtTest.h"
+#include "MemStream.h"
+
+#define VALUE0	(0x1234F080)
+#define VALUE1	(0x87658321)
+
+void CExtTest::Compile(Jitter::CJitter& jitter)
+{
+	Framework::CMemStream codeStream;
+	jitter.SetStream(&codeStream);
+
+	jitter.Begin();
+	{
+		jitter.PushRel(offsetof(CONTEXT, value0));
+		jitter.SignExt8();
+		jitter.PullRel(offsetof(CONTEXT, resultSext8));
+
+		jitter.PushRel(offsetof(CONTEXT, value0));
+		jitter.SignExt16();
+		jitter.PullRel(offsetof(CONTEXT, resultSext16));
+
+		jitter.PushRel(offsetof(CONTEXT, value0));
+		jitter.ZeroExt8();
+		jitter.PullRel(offsetof(CONTEXT, resultZext8));
+
+		jitter.PushRel(offsetof(CONTEXT, value0));
+		jitter.ZeroExt16();
+		jitter.PullRel(offsetof(CONTEXT, resultZext16));
+
+		//Idioms recognized as extensions
+		jitter.PushRel(offsetof(CONTEXT, value1));
+		jitter.Shl(24);
+		jitter.Sra(24);
+		jitter.PullRel(offsetof(CONTEXT, resultShiftSext8));
+
+		jitter.PushRel(offsetof(CONTEXT, value1));
+		jitter.Shl(16);
+		jitter.Sra(16);
+		jitter.PullRel(offsetof(CONTEXT, resultShiftSext16));
+
+		jitter.PushRel(offsetof(CONTEXT, value1));
+		jitter.Shl(24);
+		jitter.Srl(24);
+		jitter.PullRel(offsetof(CONTEXT, resultShiftZext8));
+
+		jitter.PushRel(offsetof(CONTEXT, value1));
+		jitter.Shl(16);
+		jitter.Srl(16);
+		jitter.PullRel(offsetof(CONTEXT, resultShiftZext16));
+
+		jitter.PushRel(offsetof(CONTEXT, value1));
+		jitter.PushCst(0xFF);
+		jitter.And();
+		jitter.PullRel(offsetof(CONTEXT, resultAndZext8));
+
+		jitter.PushCst(0xFFFF);
+		jitter.PushRel(offsetof(CONTEXT, value1));
+		jitter.And();
+		jitter.PullRel(offsetof(CONTEXT, resultAndZext16));
+
+		//Shifted value changes before the right shift
+		jitter.PushRel(offsetof(CONTEXT, value0));
+		jitter.Shl(16);
+		jitter.PushRel(offsetof(CONTEXT, value1));
+		jitter.PullRel(offsetof(CONTEXT, value0));
+		jitter.Sra(16);
+		jitter.PullRel(offsetof(CONTEXT, resultShiftModified));
+
+		//Constants
+		jitter.PushCst(0x1234F080);
+		jitter.SignExt8();
+		jitter.PullRel(offsetof(CONTEXT, resultCstSext8));
+
+		jitter.PushCst(0x1234F080);
+		jitter.ZeroExt16();
+		jitter.PullRel(offsetof(CONTEXT, resultCstZext16));
+
+		//64-bits
+		jitter.PushRel(offsetof(CONTEXT, value1));
+		jitter.SignExtTo64();
+		jitter.PullRel64(offsetof(CONTEXT, resultSextTo64));
+
+		jitter.PushRel(offsetof(CONTEXT, value1));
+		jitter.ZeroExtTo64();
+		jitter.PullRel64(offsetof(CONTEXT, resultZextTo64));
+
+		jitter.PushCst(0x80000000);
+		jitter.SignExtTo64();
+		jitter.PullRel64(offsetof(CONTEXT, resultCstSextTo64));
+	}
+	jitter.End();
+
+	m_function = CMemoryFunction(codeStream.GetBuffer(), codeStream.GetSize());
+}
+
+void CExtTest::Run()
+{
+	memset(&m_context, 0, sizeof(CONTEXT));
+	m_context.value0 = VALUE0;
+	m_context.value1 = VALUE1;
+
+	m_function(&m_context);
+
+	TEST_VERIFY(m_context.resultSext8 == 0xFFFFFF80);
+	TEST_VERIFY(m_context.resultSext16 == 0xFFFFF080);
+	TEST_VERIFY(m_context.resultZext8 == 0x80);
+	TEST_VERIFY(m_context.resultZext16 == 0xF080);
+
+	TEST_VERIFY(m_context.resultShiftSext8 == 0x21);
+	TEST_VERIFY(m_context.resultShiftSext16 == 0xFFFF8321);
+	TEST_VERIFY(m_context.resultShiftZext8 == 0x21);
+	TEST_VERIFY(m_context.resultShiftZext16 == 0x8321);
+	TEST_VERIFY(m_context.resultAndZext8 == 0x21);
+	TEST_VERIFY(m_context.resultAndZext16 == 0x8321);
+	TEST_VERIFY(m_context.resultShiftModified == 0xFFFFF080);
+	TEST_VERIFY(m_context.value0 == VALUE1);
+
+	TEST_VERIFY(m_context.resultCstSext8 == 0xFFFFFF80);
+	TEST_VERIFY(m_context.resultCstZext16 == 0xF080);
+
+	TEST_VERIFY(m_context.resultSextTo64 == 0xFFFFFFFF87658321ULL);
+	TEST_VERIFY(m_context.resultZextTo64 == 0x0000000087658321ULL);
+	TEST_VERIFY(m_context.resultCstSextTo64 == 0xFFFFFFFF80000000ULL);
+}
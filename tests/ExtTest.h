@@ -0,0 +1,41 @@
+#pragma once
+
+#include "Test.h"
+#include "MemoryFunction.h"
+
+class CExtTest : public CTest
+{
+public:
+	void				Compile(Jitter::CJitter&) override;
+	void				Run() override;
+
+private:
+	struct CONTEXT
+	{
+		uint32			value0;
+		uint32			value1;
+
+		uint32			resultSext8;
+		uint32			resultSext16;
+		uint32			resultZext8;
+		uint32			resultZext16;
+
+		uint32			resultShiftSext8;
+		uint32			resultShiftSext16;
+		uint32			resultShiftZext8;
+		uint32			resultShiftZext16;
+		uint32			resultShiftModified;
+		uint32			resultAndZext8;
+		uint32			resultAndZext16;
+
+		uint32			resultCstSext8;
+		uint32			resultCstZext16;
+
+		uint64			resultSextTo64;
+		uint64			resultZextTo64;
+		uint64			resultCstSextTo64;
+	};
+
+	CONTEXT				m_context;
+	CMemoryFunction		m_function;
+};
@@ -0,0 +1,174 @@
+#include "FpuDoubleTest.h"
+#include "MemStream.h"
+
+void CFpuDoubleTest::Compile(Jitter::CJitter& jitter)
+{
+	Framework::CMemStream codeStream;
+	jitter.SetStream(&codeStream);
+
+	jitter.Begin();
+	{
+		jitter.FP_PushDouble(offsetof(CONTEXT, number1));
+		jitter.FP_PushDouble(offsetof(CONTEXT, number2));
+		jitter.FP_Add();
+		jitter.FP_PullDouble(offsetof(CONTEXT, resAdd));
+
+		jitter.FP_PushDouble(offsetof(CONTEXT, number2));
+		jitter.FP_PushDouble(offsetof(CONTEXT, number4));
+		jitter.FP_Sub();
+		jitter.FP_PullDouble(offsetof(CONTEXT, resSub));
+
+		jitter.FP_PushDouble(offsetof(CONTEXT, number2));
+		jitter.FP_PushDouble(offsetof(CONTEXT, bigNumber));
+		jitter.FP_Mul();
+		jitter.FP_PullDouble(offsetof(CONTEXT, resMul));
+
+		jitter.FP_PushDouble(offsetof(CONTEXT, number1));
+		jitter.FP_PushDouble(offsetof(CONTEXT, number3));
+		jitter.FP_Div();
+		jitter.FP_PullDouble(offsetof(CONTEXT, resDiv));
+
+		jitter.FP_PushDouble(offsetof(CONTEXT, number3));
+		jitter.FP_Abs();
+		jitter.FP_PullDouble(offsetof(CONTEXT, resAbs));
+
+		jitter.FP_PushDouble(offsetof(CONTEXT, number3));
+		jitter.FP_Neg();
+		jitter.FP_PullDouble(offsetof(CONTEXT, resNeg));
+
+		jitter.FP_PushDouble(offsetof(CONTEXT, number4));
+		jitter.FP_Sqrt();
+		jitter.FP_PullDouble(offsetof(CONTEXT, resSqrt));
+
+		jitter.FP_PushDouble(offsetof(CONTEXT, number3));
+		jitter.FP_Rcpl();
+		jitter.FP_PullDouble(offsetof(CONTEXT, resRcpl));
+
+		jitter.FP_PushDouble(offsetof(CONTEXT, number4));
+		jitter.FP_Rsqrt();
+		jitter.FP_PullDouble(offsetof(CONTEXT, resRsqrt));
+
+		jitter.FP_PushDouble(offsetof(CONTEXT, number1));
+		jitter.FP_PushDouble(offsetof(CONTEXT, number3));
+		jitter.FP_Max();
+		jitter.FP_PullDouble(offsetof(CONTEXT, resMax));
+
+		jitter.FP_PushDouble(offsetof(CONTEXT, number1));
+		jitter.FP_PushDouble(offsetof(CONTEXT, number3));
+		jitter.FP_Min();
+		jitter.FP_PullDouble(offsetof(CONTEXT, resMin));
+
+		jitter.FP_PushDouble(offsetof(CONTEXT, number3));
+		jitter.FP_PushDouble(offsetof(CONTEXT, number1));
+		jitter.FP_Cmp(Jitter::CONDITION_BL);
+		jitter.PullRel(offsetof(CONTEXT, ltTest));
+
+		jitter.FP_PushDouble(offsetof(CONTEXT, number1));
+		jitter.FP_PushDouble(offsetof(CONTEXT, number3));
+		jitter.FP_Cmp(Jitter::CONDITION_BE);
+		jitter.PullRel(offsetof(CONTEXT, leTest));
+
+		jitter.FP_PushDouble(offsetof(CONTEXT, number2));
+		jitter.FP_PushDouble(offsetof(CONTEXT, number2));
+		jitter.FP_Cmp(Jitter::CONDITION_EQ);
+		jitter.PullRel(offsetof(CONTEXT, eqTest));
+
+		//Constants
+		jitter.FP_PushCstDouble(0.1);
+		jitter.FP_PullDouble(offsetof(CONTEXT, resCst));
+
+		//Should be folded
+		jitter.FP_PushCstDouble(1.5);
+		jitter.FP_PushCstDouble(0.25);
+		jitter.FP_Mul();
+		jitter.FP_Sqrt();
+		jitter.FP_Neg();
+		jitter.FP_PullDouble(offsetof(CONTEXT, resFolded));
+
+		jitter.FP_PushCstDouble(1.0 / 3.0);
+		jitter.FP_ToSingle();
+		jitter.FP_PullSingle(offsetof(CONTEXT, resToSingleCst));
+
+		//Conversions
+		jitter.FP_PushSingle(offsetof(CONTEXT, singleValue));
+		jitter.FP_ToDouble();
+		jitter.FP_PullDouble(offsetof(CONTEXT, resFromSingle));
+
+		jitter.FP_PushDouble(offsetof(CONTEXT, number3));
+		jitter.FP_ToSingle();
+		jitter.FP_PullSingle(offsetof(CONTEXT, resToSingle));
+
+		jitter.FP_PushWord(offsetof(CONTEXT, wordValue));
+		jitter.FP_PullDouble(offsetof(CONTEXT, resFromWord));
+
+		jitter.FP_PushDouble(offsetof(CONTEXT, number3));
+		jitter.FP_PullWordTruncate(offsetof(CONTEXT, resToWord));
+
+		jitter.PushRel64(offsetof(CONTEXT, int64Value));
+		jitter.FP_FromInt64();
+		jitter.FP_PullDouble(offsetof(CONTEXT, resFromInt64));
+
+		jitter.PushCst64(-0x123456789LL);
+		jitter.FP_FromInt64();
+		jitter.FP_PullDouble(offsetof(CONTEXT, resFromInt64Cst));
+
+		jitter.FP_PushDouble(offsetof(CONTEXT, bigNumber));
+		jitter.FP_ToInt64Truncate();
+		jitter.PullRel64(offsetof(CONTEXT, resToInt64));
+
+		jitter.FP_PushDouble(offsetof(CONTEXT, number3));
+		jitter.FP_ToInt64Truncate();
+		jitter.PullRel64(offsetof(CONTEXT, resToInt64Neg));
+
+		jitter.FP_PushSingle(offsetof(CONTEXT, singleValue));
+		jitter.FP_ToInt64Truncate();
+		jitter.PullRel64(offsetof(CONTEXT, resSingleToInt64));
+	}
+	jitter.End();
+
+	m_function = CMemoryFunction(codeStream.GetBuffer(), codeStream.GetSize());
+}
+
+void CFpuDoubleTest::Run()
+{
+	memset(&m_context, 0, sizeof(CONTEXT));
+	m_context.number1 = 1.0;
+	m_context.number2 = 0.1;
+	m_context.number3 = -3.75;
+	m_context.number4 = 1e100;
+	m_context.bigNumber = 12345678901.5;
+	m_context.int64Value = 0x20000000000001LL;
+	m_context.singleValue = 1e10f;
+	m_context.wordValue = static_cast<uint32>(-7);
+	m_function(&m_context);
+
+	//Results need to match what the host computes with double precision
+	TEST_VERIFY(m_context.resAdd == 1.0 + 0.1);
+	TEST_VERIFY(m_context.resSub == 0.1 - 1e100);
+	TEST_VERIFY(m_context.resMul == 0.1 * 12345678901.5);
+	TEST_VERIFY(m_context.resDiv == 1.0 / -3.75);
+	TEST_VERIFY(m_context.resAbs == 3.75);
+	TEST_VERIFY(m_context.resNeg == 3.75);
+	TEST_VERIFY(m_context.resSqrt == 1e50);
+	TEST_VERIFY(m_context.resRcpl == 1.0 / -3.75);
+	TEST_VERIFY(m_context.resRsqrt == 1.0 / sqrt(1e100));
+	TEST_VERIFY(m_context.resMax == 1.0);
+	TEST_VERIFY(m_context.resMin == -3.75);
+	TEST_VERIFY(m_context.ltTest != 0);
+	TEST_VERIFY(m_context.leTest == 0);
+	TEST_VERIFY(m_context.eqTest != 0);
+
+	TEST_VERIFY(m_context.resCst == 0.1);
+	TEST_VERIFY(m_context.resFolded == -sqrt(1.5 * 0.25));
+	TEST_VERIFY(m_context.resToSingleCst == static_cast<float>(1.0 / 3.0));
+
+	TEST_VERIFY(m_context.resFromSingle == 1e10);
+	TEST_VERIFY(m_context.resToSingle == -3.75f);
+	TEST_VERIFY(m_context.resFromWord == -7.0);
+	TEST_VERIFY(m_context.resToWord == static_cast<uint32>(-3));
+	TEST_VERIFY(m_context.resFromInt64 == static_cast<double>(0x20000000000001LL));
+	TEST_VERIFY(m_context.resFromInt64Cst == -static_cast<double>(0x123456789LL));
+	TEST_VERIFY(m_context.resToInt64 == 12345678901LL);
+	TEST_VERIFY(m_context.resToInt64Neg == -3);
+	TEST_VERIFY(m_context.resSingleToInt64 == 10000000000LL);
+}
@@ -0,0 +1,58 @@
+#pragma once
+
+#include "Test.h"
+#include "MemoryFunction.h"
+
+class CFpuDoubleTest : public CTest
+{
+public:
+	void				Compile(Jitter::CJitter&) override;
+	void				Run() override;
+
+private:
+	struct CONTEXT
+	{
+		double number1;
+		double number2;
+		double number3;
+		double number4;
+		double bigNumber;
+
+		double resAdd;
+		double resSub;
+		double resMul;
+		double resDiv;
+		double resAbs;
+		double resNeg;
+		double resSqrt;
+		double resRcpl;
+		double resRsqrt;
+		double resMax;
+		double resMin;
+
+		double resCst;
+		double resFolded;
+		double resFromSingle;
+		double resFromWord;
+		double resFromInt64;
+		double resFromInt64Cst;
+
+		int64 int64Value;
+		int64 resToInt64;
+		int64 resToInt64Neg;
+		int64 resSingleToInt64;
+
+		float singleValue;
+		float resToSingle;
+		float resToSingleCst;
+		uint32 wordValue;
+		uint32 resToWord;
+
+		uint32 ltTest;
+		uint32 leTest;
+		uint32 eqTest;
+	};
+
+	CONTEXT				m_context;
+	CMemoryFunction		m_function;
+};
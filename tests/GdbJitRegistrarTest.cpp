@@ -0,0 +1,128 @@
+#include "GdbJitRegistrarTest.h"
+#include "GdbJitRegistrar.h"
+#include "ElfDefs.h"
+#include "MemStream.h"
+
+static const char* g_functionNames[] =
+{
+	"GdbJitRegistrarTest_0",
+	"GdbJitRegistrarTest_1",
+	"GdbJitRegistrarTest_2",
+};
+
+//Stands in for the host's __jit_debug_descriptor, GDB itself never sees it
+static jit_descriptor g_descriptor = { 1, JIT_NOACTION, nullptr, nullptr };
+
+static void RegisterCode()
+{
+
+}
+
+void CGdbJitRegistrarTest::Compile(Jitter::CJitter& jitter)
+{
+	auto& registrar = CGdbJitRegistrar::GetInstance();
+	registrar.SetInterface(&g_descriptor, &RegisterCode);
+	registrar.SetEnabled(true);
+	registrar.SetBatchSize(2);
+
+	for(unsigned int i = 0; i < FUNCTION_COUNT; i++)
+	{
+		Framework::CMemStream codeStream;
+		jitter.SetStream(&codeStream);
+
+		jitter.Begin();
+		{
+			jitter.PushCst(i);
+			jitter.PullRel(offsetof(CONTEXT, result));
+		}
+		jitter.End();
+
+		m_functions[i] = CMemoryFunction(codeStream.GetBuffer(), codeStream.GetSize(), g_functionNames[i]);
+	}
+}
+
+unsigned int CGdbJitRegistrarTest::GetEntryCount()
+{
+	unsigned int count = 0;
+	for(auto entry = g_descriptor.first_entry; entry != nullptr; entry = entry->next_entry)
+	{
+		count++;
+	}
+	return count;
+}
+
+bool CGdbJitRegistrarTest::IsFunctionRegistered(const CMemoryFunction& function, const char* name)
+{
+#if (UINTPTR_MAX == UINT64_MAX)
+	typedef Elf::ELF_HEADER_64 HeaderType;
+	typedef Elf::SECTION_HEADER_64 SectionHeaderType;
+	typedef Elf::SYMBOL_64 SymbolType;
+#else
+	typedef Elf::ELF_HEADER_32 HeaderType;
+	typedef Elf::SECTION_HEADER_32 SectionHeaderType;
+	typedef Elf::SYMBOL_32 SymbolType;
+#endif
+	for(auto entry = g_descriptor.first_entry; entry != nullptr; entry = entry->next_entry)
+	{
+		auto image = entry->symfile_addr;
+		auto header = reinterpret_cast<const HeaderType*>(image);
+		TEST_VERIFY(memcmp(header->ident, "\x7F" "ELF", 4) == 0);
+		auto sectionHeaders = reinterpret_cast<const SectionHeaderType*>(image + header->sectionHeaderOffset);
+		for(unsigned int i = 0; i < header->sectionHeaderCount; i++)
+		{
+			const auto& symtabHeader = sectionHeaders[i];
+			if(symtabHeader.type != Elf::SHT_SYMTAB) continue;
+			const auto& strtabHeader = sectionHeaders[symtabHeader.link];
+			auto symbols = reinterpret_cast<const SymbolType*>(image + symtabHeader.offset);
+			unsigned int symbolCount = static_cast<unsigned int>(symtabHeader.size / sizeof(SymbolType));
+			for(unsigned int j = 1; j < symbolCount; j++)
+			{
+				const auto& symbol = symbols[j];
+				if(strcmp(image + strtabHeader.offset + symbol.name, name) != 0) continue;
+				const auto& textHeader = sectionHeaders[symbol.sectionIndex];
+				TEST_VERIFY(textHeader.address + symbol.value == reinterpret_cast<uintptr_t>(function.GetCode()));
+				return true;
+			}
+		}
+	}
+	return false;
+}
+
+void CGdbJitRegistrarTest::Run()
+{
+	for(unsigned int i = 0; i < FUNCTION_COUNT; i++)
+	{
+		memset(&m_context, 0, sizeof(m_context));
+		m_functions[i](&m_context);
+		TEST_VERIFY(m_context.result == i);
+	}
+
+	auto& registrar = CGdbJitRegistrar::GetInstance();
+
+	//First two functions are registered in one batch, last one is pending
+	TEST_VERIFY(GetEntryCount() == 1);
+	TEST_VERIFY(IsFunctionRegistered(m_functions[0], g_functionNames[0]));
+	TEST_VERIFY(IsFunctionRegistered(m_functions[1], g_functionNames[1]));
+	TEST_VERIFY(!IsFunctionRegistered(m_functions[2], g_functionNames[2]));
+
+	registrar.Flush();
+	TEST_VERIFY(GetEntryCount() == 2);
+	TEST_VERIFY(IsFunctionRegistered(m_functions[2], g_functionNames[2]));
+
+	//Symbol file is rebuilt without the freed function
+	m_functions[0] = CMemoryFunction();
+	TEST_VERIFY(GetEntryCount() == 2);
+	TEST_VERIFY(!IsFunctionRegistered(m_functions[0], g_functionNames[0]));
+	TEST_VERIFY(IsFunctionRegistered(m_functions[1], g_functionNames[1]));
+	TEST_VERIFY(IsFunctionRegistered(m_functions[2], g_functionNames[2]));
+
+	m_functions[1] = CMemoryFunction();
+	TEST_VERIFY(GetEntryCount() == 1);
+	TEST_VERIFY(!IsFunctionRegistered(m_functions[1], g_functionNames[1]));
+	TEST_VERIFY(IsFunctionRegistered(m_functions[2], g_functionNames[2]));
+
+	registrar.SetEnabled(false);
+	registrar.SetBatchSize(1);
+	TEST_VERIFY(GetEntryCount() == 0);
+	registrar.SetInterface(nullptr, nullptr);
+}
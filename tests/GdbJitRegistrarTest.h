@@ -0,0 +1,28 @@
+#pragma once
+
+#include "Test.h"
+#include "MemoryFunction.h"
+
+class CGdbJitRegistrarTest : public CTest
+{
+public:
+	void				Run() override;
+	void				Compile(Jitter::CJitter&) override;
+
+private:
+	enum
+	{
+		FUNCTION_COUNT = 3,
+	};
+
+	struct CONTEXT
+	{
+		uint32			result;
+	};
+
+	static unsigned int	GetEntryCount();
+	static bool			IsFunctionRegistered(const CMemoryFunction&, const char*);
+
+	CONTEXT				m_context;
+	CMemoryFunction		m_functions[FUNCTION_COUNT];
+};
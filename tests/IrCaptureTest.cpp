@@ -0,0 +1,100 @@
+#include "IrCaptureTest.h"
+#include "MemStream.h"
+
+#define CONSTANT_1	(0x1234)
+#define CONSTANT_2	(0x5678)
+
+void CIrCaptureTest::EmitFunction(Jitter::CJitter& jitter, uint32 constant)
+{
+	auto label = jitter.CreateLabel();
+
+	jitter.Begin();
+	{
+		jitter.PushRel(offsetof(CONTEXT, input));
+		jitter.PushCst(constant);
+		jitter.Add();
+		jitter.PullRel(offsetof(CONTEXT, result));
+
+		jitter.PushRel(offsetof(CONTEXT, input));
+		jitter.PushCst(0);
+		jitter.BeginIf(Jitter::CONDITION_EQ, Jitter::CJitter::BRANCH_HINT_UNLIKELY);
+		{
+			jitter.PushCst64(0x0123456789ABCDEFULL);
+			jitter.PullRel64(offsetof(CONTEXT, value64));
+			jitter.Goto(label);
+		}
+		jitter.EndIf();
+
+		jitter.FP_PushCst(2.5f);
+		jitter.FP_PullSingle(offsetof(CONTEXT, valueFloat));
+
+		jitter.MarkLabel(label);
+	}
+	jitter.End();
+}
+
+void CIrCaptureTest::Compile(Jitter::CJitter& jitter)
+{
+	Framework::CMemStream captureStream;
+	Framework::CMemStream codeStream;
+	Framework::CMemStream otherCodeStream;
+
+	jitter.SetIrCaptureStream(&captureStream);
+
+	jitter.SetStream(&codeStream);
+	EmitFunction(jitter, CONSTANT_1);
+
+	jitter.SetStream(&otherCodeStream);
+	EmitFunction(jitter, CONSTANT_2);
+
+	jitter.SetIrCaptureStream(nullptr);
+
+	//Compiling captured functions again must give the same code
+	Framework::CMemStream recaptureStream;
+	jitter.SetIrCaptureStream(&recaptureStream);
+	captureStream.Seek(0, Framework::STREAM_SEEK_SET);
+	{
+		Framework::CMemStream replayStream;
+		jitter.SetStream(&replayStream);
+		TEST_VERIFY(jitter.BeginFromIr(captureStream));
+		jitter.End();
+
+		TEST_VERIFY(replayStream.GetSize() == codeStream.GetSize());
+		TEST_VERIFY(!memcmp(replayStream.GetBuffer(), codeStream.GetBuffer(), codeStream.GetSize()));
+	}
+	{
+		Framework::CMemStream replayStream;
+		jitter.SetStream(&replayStream);
+		TEST_VERIFY(jitter.BeginFromIr(captureStream));
+		jitter.End();
+
+		TEST_VERIFY(replayStream.GetSize() == otherCodeStream.GetSize());
+		TEST_VERIFY(!memcmp(replayStream.GetBuffer(), otherCodeStream.GetBuffer(), otherCodeStream.GetSize()));
+	}
+	TEST_VERIFY(!jitter.BeginFromIr(captureStream));
+	jitter.SetIrCaptureStream(nullptr);
+
+	//Capturing a replayed function gives back the same IR
+	TEST_VERIFY(recaptureStream.GetSize() == captureStream.GetSize());
+	TEST_VERIFY(!memcmp(recaptureStream.GetBuffer(), captureStream.GetBuffer(), captureStream.GetSize()));
+
+	m_function = CMemoryFunction(codeStream.GetBuffer(), codeStream.GetSize());
+	m_otherFunction = CMemoryFunction(otherCodeStream.GetBuffer(), otherCodeStream.GetSize());
+}
+
+void CIrCaptureTest::Run()
+{
+	memset(&m_context, 0, sizeof(m_context));
+	m_context.input = 1;
+	m_function(&m_context);
+	TEST_VERIFY(m_context.result == (CONSTANT_1 + 1));
+	TEST_VERIFY(m_context.value64 == 0);
+	TEST_VERIFY(m_context.valueFloat == 2.5f);
+
+	memset(&m_context, 0, sizeof(m_context));
+	m_context.input = 0;
+	m_otherFunction(&m_context);
+	TEST_VERIFY(m_context.result == CONSTANT_2);
+	TEST_VERIFY(m_context.value64 == 0x0123456789ABCDEFULL);
+	TEST_VERIFY(m_context.valueFloat == 0);
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+#include "Test.h"
+#include "MemoryFunction.h"
+
+class CIrCaptureTest : public CTest
+{
+public:
+	void				Run() override;
+	void				Compile(Jitter::CJitter&) override;
+
+private:
+	struct CONTEXT
+	{
+		uint32			input;
+		uint32			result;
+		uint64			value64;
+		float			valueFloat;
+	};
+
+	static void			EmitFunction(Jitter::CJitter&, uint32);
+
+	CONTEXT				m_context;
+	CMemoryFunction		m_function;
+	CMemoryFunction		m_otherFunction;
+};
@@ -0,0 +1,95 @@
+#include "LazyFunctionTest.h"
+
+CLazyFunctionTest::LazyFunctionPtr CLazyFunctionTest::MakeFunction(Jitter::CJitter& jitter, uint32 factor)
+{
+	return LazyFunctionPtr(new Jitter::CLazyFunction(jitter,
+		[this, factor] (Jitter::CJitter& jitter)
+		{
+			m_compileCount++;
+			jitter.PushRel(offsetof(CONTEXT, value));
+			jitter.PushCst(factor);
+			jitter.MultS();
+			jitter.ExtLow64();
+			jitter.PullRel(offsetof(CONTEXT, result));
+		}
+	));
+}
+
+void CLazyFunctionTest::Compile(Jitter::CJitter& jitter)
+{
+	for(uint32 i = 0; i < FUNCTION_COUNT; i++)
+	{
+		m_functions.push_back(MakeFunction(jitter, i + 1));
+	}
+
+	//Patching the stub must work even if it went through code folding
+	CMemoryFunction::SetCodeFoldingEnabled(true);
+	m_foldedFunction = MakeFunction(jitter, 100);
+	CMemoryFunction::SetCodeFoldingEnabled(false);
+}
+
+uint32 CLazyFunctionTest::RunFunction(unsigned int functionIndex, uint32 value)
+{
+	typedef void (*FunctionType)(void*);
+	CONTEXT context = {};
+	context.value = value;
+	auto function = reinterpret_cast<FunctionType>(m_functions[functionIndex]->GetCode());
+	function(&context);
+	return context.result;
+}
+
+void CLazyFunctionTest::Run()
+{
+	//Nothing is compiled before being called
+	TEST_VERIFY(m_compileCount == 0);
+	for(const auto& function : m_functions)
+	{
+		TEST_VERIFY(!function->IsCompiled());
+	}
+
+	auto stubCode = m_functions[3]->GetCode();
+	TEST_VERIFY(RunFunction(3, 10) == 40);
+	TEST_VERIFY(m_compileCount == 1);
+	TEST_VERIFY(m_functions[3]->IsCompiled());
+	TEST_VERIFY(m_functions[3]->GetCode() == stubCode);
+
+	//Later calls go straight to the compiled code
+	for(uint32 i = 0; i < 8; i++)
+	{
+		TEST_VERIFY(RunFunction(3, i) == (i * 4));
+	}
+	TEST_VERIFY(m_compileCount == 1);
+
+	{
+		CONTEXT context = {};
+		context.value = 3;
+		(*m_functions[7])(&context);
+		TEST_VERIFY(context.result == 24);
+		(*m_functions[7])(&context);
+		TEST_VERIFY(context.result == 24);
+	}
+	TEST_VERIFY(m_compileCount == 2);
+
+	//Compiling ahead of time leaves the stub usable
+	m_functions[10]->Compile();
+	TEST_VERIFY(m_compileCount == 3);
+	TEST_VERIFY(RunFunction(10, 5) == 55);
+	TEST_VERIFY(m_compileCount == 3);
+
+	{
+		CONTEXT context = {};
+		context.value = 2;
+		(*m_foldedFunction)(&context);
+		TEST_VERIFY(context.result == 200);
+		(*m_foldedFunction)(&context);
+		TEST_VERIFY(context.result == 200);
+	}
+	TEST_VERIFY(m_compileCount == 4);
+
+	unsigned int compiledCount = 0;
+	for(const auto& function : m_functions)
+	{
+		if(function->IsCompiled()) compiledCount++;
+	}
+	TEST_VERIFY(compiledCount == 3);
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include "Test.h"
+#include "LazyFunction.h"
+#include <memory>
+#include <vector>
+
+class CLazyFunctionTest : public CTest
+{
+public:
+	void			Run() override;
+	void			Compile(Jitter::CJitter&) override;
+
+private:
+	enum
+	{
+		FUNCTION_COUNT = 16,
+	};
+
+	struct CONTEXT
+	{
+		uint32		value;
+		uint32		result;
+	};
+
+	typedef std::unique_ptr<Jitter::CLazyFunction> LazyFunctionPtr;
+
+	LazyFunctionPtr	MakeFunction(Jitter::CJitter&, uint32);
+	uint32			RunFunction(unsigned int, uint32);
+
+	std::vector<LazyFunctionPtr>	m_functions;
+	LazyFunctionPtr	m_foldedFunction;
+	unsigned int	m_compileCount = 0;
+};
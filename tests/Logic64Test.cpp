@@ -3,6 +3,7 @@
 
 #define CONSTANT_1 (0xEEEEEEEE55555555ULL)
 #define CONSTANT_2 (0x22222222CCCCCCCCULL)
+#define CONSTANT_3 (0x0F0F0F0FF0F0F0F0ULL)
 
 void CLogic64Test::Run()
 {
@@ -14,6 +15,13 @@ void CLogic64Test::Run()
 	m_function(&m_context);
 
 	TEST_VERIFY(m_context.resultAnd == (CONSTANT_1 & CONSTANT_2));
+	TEST_VERIFY(m_context.resultAndCst == (CONSTANT_1 & CONSTANT_3));
+	TEST_VERIFY(m_context.resultOr == (CONSTANT_1 | CONSTANT_2));
+	TEST_VERIFY(m_context.resultOrCst == (CONSTANT_3 | CONSTANT_2));
+	TEST_VERIFY(m_context.resultXor == (CONSTANT_1 ^ CONSTANT_2));
+	TEST_VERIFY(m_context.resultXorCst == (CONSTANT_1 ^ CONSTANT_3));
+	TEST_VERIFY(m_context.resultNot == ~CONSTANT_1);
+	TEST_VERIFY(m_context.resultCstCst == ((CONSTANT_1 | CONSTANT_3) ^ CONSTANT_2));
 }
 
 void CLogic64Test::Compile(Jitter::CJitter& jitter)
@@ -27,6 +35,43 @@ void CLogic64Test::Compile(Jitter::CJitter& jitter)
 		jitter.PushRel64(offsetof(CONTEXT, op2));
 		jitter.And64();
 		jitter.PullRel64(offsetof(CONTEXT, resultAnd));
+
+		jitter.PushRel64(offsetof(CONTEXT, op1));
+		jitter.PushCst64(CONSTANT_3);
+		jitter.And64();
+		jitter.PullRel64(offsetof(CONTEXT, resultAndCst));
+
+		jitter.PushRel64(offsetof(CONTEXT, op1));
+		jitter.PushRel64(offsetof(CONTEXT, op2));
+		jitter.Or64();
+		jitter.PullRel64(offsetof(CONTEXT, resultOr));
+
+		jitter.PushCst64(CONSTANT_3);
+		jitter.PushRel64(offsetof(CONTEXT, op2));
+		jitter.Or64();
+		jitter.PullRel64(offsetof(CONTEXT, resultOrCst));
+
+		jitter.PushRel64(offsetof(CONTEXT, op1));
+		jitter.PushRel64(offsetof(CONTEXT, op2));
+		jitter.Xor64();
+		jitter.PullRel64(offsetof(CONTEXT, resultXor));
+
+		jitter.PushRel64(offsetof(CONTEXT, op1));
+		jitter.PushCst64(CONSTANT_3);
+		jitter.Xor64();
+		jitter.PullRel64(offsetof(CONTEXT, resultXorCst));
+
+		jitter.PushRel64(offsetof(CONTEXT, op1));
+		jitter.Not64();
+		jitter.PullRel64(offsetof(CONTEXT, resultNot));
+
+		//Should be folded into a single constant
+		jitter.PushCst64(CONSTANT_1);
+		jitter.PushCst64(CONSTANT_3);
+		jitter.Or64();
+		jitter.PushCst64(CONSTANT_2);
+		jitter.Xor64();
+		jitter.PullRel64(offsetof(CONTEXT, resultCstCst));
 	}
 	jitter.End();
 
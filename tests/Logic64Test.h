@@ -16,6 +16,13 @@ private:
 		uint64			op2;
 
 		uint64			resultAnd;
+		uint64			resultAndCst;
+		uint64			resultOr;
+		uint64			resultOrCst;
+		uint64			resultXor;
+		uint64			resultXorCst;
+		uint64			resultNot;
+		uint64			resultCstCst;
 	};
 
 	CONTEXT				m_context;
@@ -3,6 +3,7 @@
 #include "Crc32Test.h"
 #include "MultTest.h"
 #include "DivTest.h"
+#include "ExtTest.h"
 #include "RandomAluTest.h"
 #include "RandomAluTest2.h"
 #include "RandomAluTest3.h"
@@ -19,6 +20,7 @@
 #include "MdSubTest.h"
 #include "MdCmpTest.h"
 #include "MdMinMaxTest.h"
+#include "MdMulTest.h"
 #include "MdUnpackTest.h"
 #include "MdFpTest.h"
 #include "MdFpFlagTest.h"
@@ -29,6 +31,7 @@
 #include "CompareTest.h"
 #include "RegAllocTest.h"
 #include "MemAccessTest.h"
+#include "SizedMemAccessTest.h"
 #include "HugeJumpTest.h"
 #include "Alu64Test.h"
 #include "ConditionTest.h"
@@ -39,6 +42,26 @@
 #include "Merge64Test.h"
 #include "LzcTest.h"
 #include "NestedIfTest.h"
+#include "TlbLoadTest.h"
+#include "BranchHintTest.h"
+#include "ProfileTest.h"
+#include "PerfJitWriterTest.h"
+#include "GdbJitRegistrarTest.h"
+#include "ElfObjectFileTest.h"
+#include "AotCompilerTest.h"
+#include "CodeFoldingTest.h"
+#include "CodeCacheTest.h"
+#include "IrCaptureTest.h"
+#include "CompileServiceTest.h"
+#include "TieredCompilationTest.h"
+#include "LazyFunctionTest.h"
+#include "OptimizationPipelineTest.h"
+#include "CompileStatsTest.h"
+#include "FpuDoubleTest.h"
+#include "MulAddTest.h"
+#include "BitManipTest.h"
+#include "Md256Test.h"
+#include "RoundingModeTest.h"
 
 typedef std::function<CTest* ()> TestFactoryFunction;
 
@@ -69,9 +92,36 @@ static const TestFactoryFunction s_factories[] =
 	[] () { return new CMultTest(false); },
 	[] () { return new CDivTest(true); },
 	[] () { return new CDivTest(false); },
+	[] () { return new CExtTest(); },
 	[] () { return new CMemAccessTest(); },
+	[] () { return new CSizedMemAccessTest(); },
+	[] () { return new CTlbLoadTest(); },
 	[] () { return new CHugeJumpTest(); },
 	[] () { return new CNestedIfTest(); },
+	[] () { return new CBranchHintTest(); },
+	[] () { return new CProfileTest(); },
+	[] () { return new CPerfJitWriterTest(); },
+	[] () { return new CGdbJitRegistrarTest(); },
+	[] () { return new CElfObjectFileTest(); },
+	[] () { return new CAotCompilerTest(); },
+	[] () { return new CCodeFoldingTest(); },
+	[] () { return new CCodeCacheTest(); },
+	[] () { return new CIrCaptureTest(); },
+	[] () { return new CCompileServiceTest(); },
+	[] () { return new CTieredCompilationTest(); },
+	[] () { return new CLazyFunctionTest(); },
+	[] () { return new COptimizationPipelineTest(); },
+	[] () { return new CCompileStatsTest(); },
+	[] () { return new CFpuDoubleTest(); },
+	[] () { return new CMulAddTest(); },
+	[] () { return new CBitManipTest(0); },
+	[] () { return new CBitManipTest(12); },
+	[] () { return new CBitManipTest(32); },
+	[] () { return new CBitManipTest(45); },
+	[] () { return new CBitManipTest(63); },
+	[] () { return new CBitManipTest(76); },
+	[] () { return new CMd256Test(); },
+	[] () { return new CRoundingModeTest(); },
 	[] () { return new CLzcTest(); },
 	[] () { return new CAliasTest(); },
 	[] () { return new CAliasTest2(); },
@@ -85,6 +135,7 @@ static const TestFactoryFunction s_factories[] =
 	[] () { return new CMdUnpackTest(); },
 	[] () { return new CMdCmpTest(); },
 	[] () { return new CMdMinMaxTest(); },
+	[] () { return new CMdMulTest(); },
 	[] () { return new CMdFpTest(); },
 	[] () { return new CMdFpFlagTest(); },
 	[] () { return new CMdCallTest(); },
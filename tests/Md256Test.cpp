@@ -0,0 +1,191 @@
+#include "Md256Test.h"
+#include "MemStream.h"
+#include "Jitter_CodeGenFactory.h"
+#include <stdexcept>
+
+void CMd256Test::Compile(Jitter::CJitter& jitter)
+{
+	Framework::CMemStream codeStream;
+	jitter.SetStream(&codeStream);
+
+	jitter.Begin();
+	{
+		jitter.MD_PushRel256(offsetof(CONTEXT, src0));
+		jitter.MD_PushRel256(offsetof(CONTEXT, src1));
+		jitter.MD_AddW();
+		jitter.MD_PullRel256(offsetof(CONTEXT, dstAddW));
+
+		jitter.MD_PushRel256(offsetof(CONTEXT, src0));
+		jitter.MD_PushRel256(offsetof(CONTEXT, src1));
+		jitter.MD_SubH();
+		jitter.MD_PullRel256(offsetof(CONTEXT, dstSubH));
+
+		jitter.MD_PushRel256(offsetof(CONTEXT, src0));
+		jitter.MD_PushRel256(offsetof(CONTEXT, src2));
+		jitter.MD_AddB();
+		jitter.MD_PullRel256(offsetof(CONTEXT, dstAddB));
+
+		jitter.MD_PushRel256(offsetof(CONTEXT, src1));
+		jitter.MD_PushRel256(offsetof(CONTEXT, src2));
+		jitter.MD_Xor();
+		jitter.MD_PullRel256(offsetof(CONTEXT, dstXor));
+
+		//Result of an operation used by another one
+		jitter.MD_PushRel256(offsetof(CONTEXT, src0));
+		jitter.MD_PushRel256(offsetof(CONTEXT, src1));
+		jitter.MD_AddW();
+		jitter.MD_PushRel256(offsetof(CONTEXT, src2));
+		jitter.MD_And();
+		jitter.MD_PullRel256(offsetof(CONTEXT, dstChain));
+
+		jitter.MD_PushRel256(offsetof(CONTEXT, src2));
+		jitter.MD_PullRel256(offsetof(CONTEXT, dstMov));
+
+		jitter.MD_PushRel256(offsetof(CONTEXT, srcFp0));
+		jitter.MD_PushRel256(offsetof(CONTEXT, srcFp1));
+		jitter.MD_AddS();
+		jitter.MD_PullRel256(offsetof(CONTEXT, dstAddS));
+
+		jitter.MD_PushRel256(offsetof(CONTEXT, srcFp0));
+		jitter.MD_PushRel256(offsetof(CONTEXT, srcFp1));
+		jitter.MD_MulS();
+		jitter.MD_PullRel256(offsetof(CONTEXT, dstMulS));
+
+		//Value read and written by several operations, kept in a register in between
+		jitter.MD_PushRel256(offsetof(CONTEXT, src0));
+		jitter.MD_PushRel256(offsetof(CONTEXT, src1));
+		jitter.MD_AddW();
+		jitter.MD_PullRel256(offsetof(CONTEXT, dstAcc));
+
+		jitter.MD_PushRel256(offsetof(CONTEXT, dstAcc));
+		jitter.MD_PushRel256(offsetof(CONTEXT, src2));
+		jitter.MD_Xor();
+		jitter.MD_PullRel256(offsetof(CONTEXT, dstAcc));
+
+		jitter.MD_PushRel256(offsetof(CONTEXT, dstAcc));
+		jitter.MD_PushRel256(offsetof(CONTEXT, src0));
+		jitter.MD_SubW();
+		jitter.MD_PullRel256(offsetof(CONTEXT, dstAcc));
+
+		//Words aliased by 256-bits values
+		jitter.PushRel(offsetof(CONTEXT, dstOverwrite) + 0x14);
+		jitter.PullRel(offsetof(CONTEXT, overwriteWordBefore));
+
+		jitter.MD_PushRel256(offsetof(CONTEXT, src0));
+		jitter.MD_PullRel256(offsetof(CONTEXT, dstOverwrite));
+
+		jitter.PushRel(offsetof(CONTEXT, dstOverwrite) + 0x14);
+		jitter.PullRel(offsetof(CONTEXT, overwriteWord));
+
+		//Shift of the concatenation of two 128-bits values, the last one pushed being the lower half
+		jitter.MD_PushRel(offsetof(CONTEXT, src1) + 0x10);
+		jitter.MD_PushRel(offsetof(CONTEXT, src1));
+		jitter.PushCst(120);
+		jitter.MD_Srl256();
+		jitter.MD_PullRel(offsetof(CONTEXT, dstSrl256));
+
+		jitter.MD_PushRel(offsetof(CONTEXT, src2) + 0x10);
+		jitter.MD_PushRel(offsetof(CONTEXT, src2));
+		jitter.PushCst(40);
+		jitter.MD_Srl256();
+		jitter.MD_PullRel(offsetof(CONTEXT, dstSrl256Cst));
+
+		jitter.MD_PushRel(offsetof(CONTEXT, src0) + 0x10);
+		jitter.MD_PushRel(offsetof(CONTEXT, src0));
+		jitter.PushRel(offsetof(CONTEXT, srl256Amount));
+		jitter.MD_Srl256();
+		jitter.MD_PullRel(offsetof(CONTEXT, dstSrl256Var));
+	}
+	jitter.End();
+
+	m_function = CMemoryFunction(codeStream.GetBuffer(), codeStream.GetSize());
+
+	//Operations without 256-bits support are rejected when inserted, session is left open so use another jitter
+	{
+		Jitter::CJitter failingJitter(Jitter::CreateCodeGen());
+		failingJitter.Begin();
+		failingJitter.MD_PushRel256(offsetof(CONTEXT, src0));
+		failingJitter.MD_PushRel256(offsetof(CONTEXT, src1));
+		bool failed = false;
+		try
+		{
+			failingJitter.MD_AddBUS();
+		}
+		catch(const std::runtime_error&)
+		{
+			failed = true;
+		}
+		TEST_VERIFY(failed);
+	}
+}
+
+void CMd256Test::Run()
+{
+	CONTEXT ALIGN16 context;
+	memset(&context, 0, sizeof(CONTEXT));
+
+	for(unsigned int i = 0; i < 8; i++)
+	{
+		context.src0[i] = 0x01020304 * (i + 1);
+		context.src1[i] = 0x80FF7F01 + (i * 0x11111111);
+		context.src2[i] = 0xFF00FF00 ^ (i << 4);
+		context.srcFp0[i] = static_cast<float>(i) + 0.5f;
+		context.srcFp1[i] = 2.0f - static_cast<float>(i);
+	}
+	context.dstOverwrite[5] = 0xCAFEBABE;
+	context.srl256Amount = 72;
+
+	m_function(&context);
+
+	for(unsigned int i = 0; i < 8; i++)
+	{
+		uint32 src0 = context.src0[i];
+		uint32 src1 = context.src1[i];
+		uint32 src2 = context.src2[i];
+
+		uint32 subH =
+			((((src0 & 0xFFFF) - (src1 & 0xFFFF)) & 0xFFFF)) |
+			((((src0 >> 16) - (src1 >> 16)) & 0xFFFF) << 16);
+		uint32 addB = 0;
+		for(unsigned int j = 0; j < 32; j += 8)
+		{
+			addB |= ((((src0 >> j) + (src2 >> j)) & 0xFF) << j);
+		}
+
+		TEST_VERIFY(context.dstAddW[i] == src0 + src1);
+		TEST_VERIFY(context.dstSubH[i] == subH);
+		TEST_VERIFY(context.dstAddB[i] == addB);
+		TEST_VERIFY(context.dstXor[i] == (src1 ^ src2));
+		TEST_VERIFY(context.dstChain[i] == ((src0 + src1) & src2));
+		TEST_VERIFY(context.dstMov[i] == src2);
+		TEST_VERIFY(context.dstAddS[i] == context.srcFp0[i] + context.srcFp1[i]);
+		TEST_VERIFY(context.dstMulS[i] == context.srcFp0[i] * context.srcFp1[i]);
+		TEST_VERIFY(context.dstAcc[i] == ((src0 + src1) ^ src2) - src0);
+		TEST_VERIFY(context.dstOverwrite[i] == src0);
+	}
+
+	TEST_VERIFY(context.overwriteWordBefore == 0xCAFEBABE);
+	TEST_VERIFY(context.overwriteWord == context.src0[5]);
+
+	//Shifting by 120 bits leaves the last byte of the lower half followed by the upper half
+	const uint8* srl256Src = reinterpret_cast<const uint8*>(context.src1);
+	const uint8* srl256Dst = reinterpret_cast<const uint8*>(context.dstSrl256);
+	for(unsigned int i = 0; i < 16; i++)
+	{
+		TEST_VERIFY(srl256Dst[i] == srl256Src[i + 15]);
+	}
+
+	const uint8* srl256CstSrc = reinterpret_cast<const uint8*>(context.src2);
+	const uint8* srl256CstDst = reinterpret_cast<const uint8*>(context.dstSrl256Cst);
+	for(unsigned int i = 0; i < 16; i++)
+	{
+		TEST_VERIFY(srl256CstDst[i] == srl256CstSrc[i + 5]);
+	}
+
+	const uint8* srl256VarSrc = reinterpret_cast<const uint8*>(context.src0);
+	const uint8* srl256VarDst = reinterpret_cast<const uint8*>(context.dstSrl256Var);
+	for(unsigned int i = 0; i < 16; i++)
+	{
+		TEST_VERIFY(srl256VarDst[i] == srl256VarSrc[i + 9]);
+	}
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include "Test.h"
+#include "Align16.h"
+#include "MemoryFunction.h"
+
+class CMd256Test : public CTest
+{
+public:
+	void				Compile(Jitter::CJitter&) override;
+	void				Run() override;
+
+private:
+	struct CONTEXT
+	{
+		ALIGN16
+
+		uint32			src0[8];
+		uint32			src1[8];
+		uint32			src2[8];
+		float			srcFp0[8];
+		float			srcFp1[8];
+
+		uint32			dstAddW[8];
+		uint32			dstSubH[8];
+		uint32			dstAddB[8];
+		uint32			dstXor[8];
+		uint32			dstChain[8];
+		uint32			dstMov[8];
+		uint32			dstAcc[8];
+		float			dstAddS[8];
+		float			dstMulS[8];
+
+		uint32			dstOverwrite[8];
+		uint32			dstSrl256[4];
+		uint32			dstSrl256Cst[4];
+		uint32			dstSrl256Var[4];
+
+		uint32			srl256Amount;
+
+		uint32			overwriteWord;
+		uint32			overwriteWordBefore;
+	};
+
+	CMemoryFunction		m_function;
+};
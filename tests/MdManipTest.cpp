@@ -29,6 +29,47 @@ void CMdManipTest::Compile(Jitter::CJitter& jitter)
 		//Push Cst Expand
 		jitter.MD_PushCstExpand(31415.f);
 		jitter.MD_PullRel(offsetof(CONTEXT, dstExpandCst));
+
+		//Shuffle (3, 0, 2, 1)
+		jitter.MD_PushRel(offsetof(CONTEXT, src0));
+		jitter.MD_ShuffleW(0xC9);
+		jitter.MD_PullRel(offsetof(CONTEXT, dstShuffle));
+
+		//Shuffle (2, 2, 2, 2)
+		jitter.MD_PushRel(offsetof(CONTEXT, src0));
+		jitter.MD_ShuffleW(0xAA);
+		jitter.MD_PullRel(offsetof(CONTEXT, dstShuffleBroadcast));
+
+		//Shuffle (0, 3, 2, 1)
+		jitter.MD_PushRel(offsetof(CONTEXT, src1));
+		jitter.MD_ShuffleW(0x39);
+		jitter.MD_PullRel(offsetof(CONTEXT, dstShuffleRotate));
+
+		//Shuffle (3, 2, 1, 0)
+		jitter.MD_PushRel(offsetof(CONTEXT, src1));
+		jitter.MD_ShuffleW(0xE4);
+		jitter.MD_PullRel(offsetof(CONTEXT, dstShuffleIdentity));
+
+		//Insert src2[3] in src0[1]
+		jitter.MD_PushRel(offsetof(CONTEXT, src0));
+		jitter.MD_PushRel(offsetof(CONTEXT, src2));
+		jitter.MD_InsertW(1, 3);
+		jitter.MD_PullRel(offsetof(CONTEXT, dstInsert));
+
+		//Insert src2[0] in src2[0]
+		jitter.MD_PushRel(offsetof(CONTEXT, src2));
+		jitter.MD_PushRel(offsetof(CONTEXT, src2));
+		jitter.MD_InsertW(0, 0);
+		jitter.MD_PullRel(offsetof(CONTEXT, dstInsertSelf));
+
+		//Extract
+		jitter.MD_PushRel(offsetof(CONTEXT, src1));
+		jitter.MD_ExtractW(0);
+		jitter.PullRel(offsetof(CONTEXT, dstExtract0));
+
+		jitter.MD_PushRel(offsetof(CONTEXT, src1));
+		jitter.MD_ExtractW(3);
+		jitter.PullRel(offsetof(CONTEXT, dstExtract3));
 	}
 	jitter.End();
 
@@ -76,4 +117,37 @@ void CMdManipTest::Run()
 	TEST_VERIFY(context.dstExpandCst[1] == 31415.0f);
 	TEST_VERIFY(context.dstExpandCst[2] == 31415.0f);
 	TEST_VERIFY(context.dstExpandCst[3] == 31415.0f);
+
+	TEST_VERIFY(context.dstShuffle[0] ==   50.0f);
+	TEST_VERIFY(context.dstShuffle[1] ==  500.0f);
+	TEST_VERIFY(context.dstShuffle[2] ==    5.0f);
+	TEST_VERIFY(context.dstShuffle[3] == 5000.0f);
+
+	TEST_VERIFY(context.dstShuffleBroadcast[0] == 500.0f);
+	TEST_VERIFY(context.dstShuffleBroadcast[1] == 500.0f);
+	TEST_VERIFY(context.dstShuffleBroadcast[2] == 500.0f);
+	TEST_VERIFY(context.dstShuffleBroadcast[3] == 500.0f);
+
+	TEST_VERIFY(context.dstShuffleRotate[0] ==  600.0f);
+	TEST_VERIFY(context.dstShuffleRotate[1] ==   60.0f);
+	TEST_VERIFY(context.dstShuffleRotate[2] ==    6.0f);
+	TEST_VERIFY(context.dstShuffleRotate[3] == 6000.0f);
+
+	TEST_VERIFY(context.dstShuffleIdentity[0] == 6000.0f);
+	TEST_VERIFY(context.dstShuffleIdentity[1] ==  600.0f);
+	TEST_VERIFY(context.dstShuffleIdentity[2] ==   60.0f);
+	TEST_VERIFY(context.dstShuffleIdentity[3] ==    6.0f);
+
+	TEST_VERIFY(context.dstInsert[0] ==    5.0f);
+	TEST_VERIFY(context.dstInsert[1] ==    8.5f);
+	TEST_VERIFY(context.dstInsert[2] ==  500.0f);
+	TEST_VERIFY(context.dstInsert[3] == 5000.0f);
+
+	TEST_VERIFY(context.dstInsertSelf[0] == 5.5f);
+	TEST_VERIFY(context.dstInsertSelf[1] == 6.5f);
+	TEST_VERIFY(context.dstInsertSelf[2] == 7.5f);
+	TEST_VERIFY(context.dstInsertSelf[3] == 8.5f);
+
+	TEST_VERIFY(context.dstExtract0 == 6000.0f);
+	TEST_VERIFY(context.dstExtract3 ==    6.0f);
 }
@@ -26,6 +26,17 @@ private:
 
 		float			dstExpandRel[4];
 		float			dstExpandCst[4];
+
+		float			dstShuffle[4];
+		float			dstShuffleBroadcast[4];
+		float			dstShuffleRotate[4];
+		float			dstShuffleIdentity[4];
+
+		float			dstInsert[4];
+		float			dstInsertSelf[4];
+
+		float			dstExtract0;
+		float			dstExtract3;
 	};
 
 	CMemoryFunction		m_function;
@@ -0,0 +1,79 @@
+#include "MdMulTest.h"
+#include "MemStream.h"
+
+void CMdMulTest::Compile(Jitter::CJitter& jitter)
+{
+	Framework::CMemStream codeStream;
+	jitter.SetStream(&codeStream);
+
+	jitter.Begin();
+	{
+		jitter.MD_PushRel(offsetof(CONTEXT, srcH0));
+		jitter.MD_PushRel(offsetof(CONTEXT, srcH1));
+		jitter.MD_MulH();
+		jitter.MD_PullRel(offsetof(CONTEXT, dstMulH));
+
+		jitter.MD_PushRel(offsetof(CONTEXT, srcH0));
+		jitter.MD_PushRel(offsetof(CONTEXT, srcH1));
+		jitter.MD_MulHiH();
+		jitter.MD_PullRel(offsetof(CONTEXT, dstMulHiH));
+
+		jitter.MD_PushRel(offsetof(CONTEXT, srcW0));
+		jitter.MD_PushRel(offsetof(CONTEXT, srcW1));
+		jitter.MD_MulW();
+		jitter.MD_PullRel(offsetof(CONTEXT, dstMulW));
+
+		jitter.MD_PushRel(offsetof(CONTEXT, srcW0));
+		jitter.MD_PushRel(offsetof(CONTEXT, srcW1));
+		jitter.MD_MulEvenUWD();
+		jitter.MD_PullRel(offsetof(CONTEXT, dstMulEvenUWD));
+
+		jitter.MD_PushRel(offsetof(CONTEXT, srcH0));
+		jitter.MD_PushRel(offsetof(CONTEXT, srcH1));
+		jitter.MD_MulAddPairsHW();
+		jitter.MD_PullRel(offsetof(CONTEXT, dstMulAddPairsHW));
+	}
+	jitter.End();
+
+	m_function = CMemoryFunction(codeStream.GetBuffer(), codeStream.GetSize());
+}
+
+void CMdMulTest::Run()
+{
+	CONTEXT ALIGN16 context;
+	memset(&context, 0, sizeof(CONTEXT));
+
+	static const int16 srcH0[8] = { 3, -7, 0x7FFF, -0x8000, 1234, -1, 0x4000, -300 };
+	static const int16 srcH1[8] = { 5, 9, 0x7FFF, -0x8000, -4321, -1, 4, 0x7FFF };
+	static const uint32 srcW0[4] = { 3, 0xFFFFFFFF, 0x12345678, 0x80000000 };
+	static const uint32 srcW1[4] = { 0xFFFFFFFE, 7, 0x9ABCDEF0, 2 };
+
+	memcpy(context.srcH0, srcH0, sizeof(srcH0));
+	memcpy(context.srcH1, srcH1, sizeof(srcH1));
+	memcpy(context.srcW0, srcW0, sizeof(srcW0));
+	memcpy(context.srcW1, srcW1, sizeof(srcW1));
+
+	m_function(&context);
+
+	for(unsigned int i = 0; i < 8; i++)
+	{
+		int32 product = static_cast<int32>(srcH0[i]) * static_cast<int32>(srcH1[i]);
+		TEST_VERIFY(context.dstMulH[i] == static_cast<int16>(product));
+		TEST_VERIFY(context.dstMulHiH[i] == static_cast<int16>(product >> 16));
+	}
+
+	for(unsigned int i = 0; i < 4; i++)
+	{
+		TEST_VERIFY(context.dstMulW[i] == srcW0[i] * srcW1[i]);
+	}
+
+	TEST_VERIFY(context.dstMulEvenUWD[0] == static_cast<uint64>(srcW0[0]) * static_cast<uint64>(srcW1[0]));
+	TEST_VERIFY(context.dstMulEvenUWD[1] == static_cast<uint64>(srcW0[2]) * static_cast<uint64>(srcW1[2]));
+
+	for(unsigned int i = 0; i < 4; i++)
+	{
+		int32 product0 = static_cast<int32>(srcH0[i * 2 + 0]) * static_cast<int32>(srcH1[i * 2 + 0]);
+		int32 product1 = static_cast<int32>(srcH0[i * 2 + 1]) * static_cast<int32>(srcH1[i * 2 + 1]);
+		TEST_VERIFY(context.dstMulAddPairsHW[i] == static_cast<int32>(static_cast<uint32>(product0) + static_cast<uint32>(product1)));
+	}
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+#include "Test.h"
+#include "Align16.h"
+#include "MemoryFunction.h"
+
+class CMdMulTest : public CTest
+{
+public:
+	void				Compile(Jitter::CJitter&) override;
+	void				Run() override;
+
+private:
+	struct CONTEXT
+	{
+		ALIGN16
+
+		int16			srcH0[8];
+		int16			srcH1[8];
+		uint32			srcW0[4];
+		uint32			srcW1[4];
+
+		int16			dstMulH[8];
+		int16			dstMulHiH[8];
+		uint32			dstMulW[4];
+		uint64			dstMulEvenUWD[2];
+		int32			dstMulAddPairsHW[4];
+	};
+
+	CMemoryFunction		m_function;
+};
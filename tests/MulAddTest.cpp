@@ -0,0 +1,198 @@
+#include "MulAddTest.h"
+#include "MemStream.h"
+
+void CMulAddTest::Compile(Jitter::CJitter& jitter)
+{
+	Framework::CMemStream codeStream;
+	jitter.SetStream(&codeStream);
+
+	jitter.ResetPassStats();
+	jitter.SetPassStatsEnabled(true);
+
+	jitter.Begin();
+	{
+		//Single
+		jitter.FP_PushSingle(offsetof(CONTEXT, singleAcc));
+		jitter.FP_PushSingle(offsetof(CONTEXT, singleSrc1));
+		jitter.FP_PushSingle(offsetof(CONTEXT, singleSrc2));
+		jitter.FP_MulAdd();
+		jitter.FP_PullSingle(offsetof(CONTEXT, singleResMulAdd));
+
+		jitter.FP_PushSingle(offsetof(CONTEXT, singleAcc));
+		jitter.FP_PushSingle(offsetof(CONTEXT, singleSrc1));
+		jitter.FP_PushSingle(offsetof(CONTEXT, singleSrc2));
+		jitter.FP_MulSub();
+		jitter.FP_PullSingle(offsetof(CONTEXT, singleResMulSub));
+
+		jitter.FP_PushSingle(offsetof(CONTEXT, singleAcc));
+		jitter.FP_PushSingle(offsetof(CONTEXT, singleSrc1));
+		jitter.FP_PushSingle(offsetof(CONTEXT, singleSrc2));
+		jitter.FP_FusedMulAdd();
+		jitter.FP_PullSingle(offsetof(CONTEXT, singleResFusedMulAdd));
+
+		jitter.FP_PushSingle(offsetof(CONTEXT, singleAcc));
+		jitter.FP_PushSingle(offsetof(CONTEXT, singleSrc1));
+		jitter.FP_PushSingle(offsetof(CONTEXT, singleSrc2));
+		jitter.FP_FusedMulSub();
+		jitter.FP_PullSingle(offsetof(CONTEXT, singleResFusedMulSub));
+
+		//Product is rounded before being added
+		jitter.FP_PushSingle(offsetof(CONTEXT, singleInexact));
+		jitter.FP_Neg();
+		jitter.FP_PushSingle(offsetof(CONTEXT, singleInexact));
+		jitter.FP_PushSingle(offsetof(CONTEXT, singleInexact));
+		jitter.FP_MulAdd();
+		jitter.FP_PullSingle(offsetof(CONTEXT, singleResInexact));
+
+		jitter.FP_PushSingle(offsetof(CONTEXT, singleInexact));
+		jitter.FP_Neg();
+		jitter.FP_PushSingle(offsetof(CONTEXT, singleInexact));
+		jitter.FP_PushSingle(offsetof(CONTEXT, singleInexact));
+		jitter.FP_FusedMulAdd();
+		jitter.FP_PullSingle(offsetof(CONTEXT, singleResFusedInexact));
+
+		//Should be turned into a multiply-add
+		jitter.FP_PushSingle(offsetof(CONTEXT, singleAcc));
+		jitter.FP_PushSingle(offsetof(CONTEXT, singleSrc1));
+		jitter.FP_PushSingle(offsetof(CONTEXT, singleSrc2));
+		jitter.FP_Mul();
+		jitter.FP_Sub();
+		jitter.FP_PullSingle(offsetof(CONTEXT, singleResFolded));
+
+		//Product is the first operand of the subtraction, can't be fused
+		jitter.FP_PushSingle(offsetof(CONTEXT, singleSrc1));
+		jitter.FP_PushSingle(offsetof(CONTEXT, singleSrc2));
+		jitter.FP_Mul();
+		jitter.FP_PushSingle(offsetof(CONTEXT, singleAcc));
+		jitter.FP_Sub();
+		jitter.FP_PullSingle(offsetof(CONTEXT, singleResNotFolded));
+
+		//Double
+		jitter.FP_PushDouble(offsetof(CONTEXT, doubleAcc));
+		jitter.FP_PushDouble(offsetof(CONTEXT, doubleSrc1));
+		jitter.FP_PushDouble(offsetof(CONTEXT, doubleSrc2));
+		jitter.FP_MulAdd();
+		jitter.FP_PullDouble(offsetof(CONTEXT, doubleResMulAdd));
+
+		jitter.FP_PushDouble(offsetof(CONTEXT, doubleAcc));
+		jitter.FP_PushDouble(offsetof(CONTEXT, doubleSrc1));
+		jitter.FP_PushDouble(offsetof(CONTEXT, doubleSrc2));
+		jitter.FP_MulSub();
+		jitter.FP_PullDouble(offsetof(CONTEXT, doubleResMulSub));
+
+		jitter.FP_PushDouble(offsetof(CONTEXT, doubleAcc));
+		jitter.FP_PushDouble(offsetof(CONTEXT, doubleSrc1));
+		jitter.FP_PushDouble(offsetof(CONTEXT, doubleSrc2));
+		jitter.FP_FusedMulAdd();
+		jitter.FP_PullDouble(offsetof(CONTEXT, doubleResFusedMulAdd));
+
+		jitter.FP_PushDouble(offsetof(CONTEXT, doubleAcc));
+		jitter.FP_PushDouble(offsetof(CONTEXT, doubleSrc1));
+		jitter.FP_PushDouble(offsetof(CONTEXT, doubleSrc2));
+		jitter.FP_FusedMulSub();
+		jitter.FP_PullDouble(offsetof(CONTEXT, doubleResFusedMulSub));
+
+		jitter.FP_PushDouble(offsetof(CONTEXT, doubleSrc1));
+		jitter.FP_PushDouble(offsetof(CONTEXT, doubleSrc2));
+		jitter.FP_Mul();
+		jitter.FP_PushDouble(offsetof(CONTEXT, doubleAcc));
+		jitter.FP_Add();
+		jitter.FP_PullDouble(offsetof(CONTEXT, doubleResFolded));
+
+		//SIMD
+		jitter.MD_PushRel(offsetof(CONTEXT, mdAcc));
+		jitter.MD_PushRel(offsetof(CONTEXT, mdSrc1));
+		jitter.MD_PushRel(offsetof(CONTEXT, mdSrc2));
+		jitter.MD_MulAddS();
+		jitter.MD_PullRel(offsetof(CONTEXT, mdResMulAdd));
+
+		jitter.MD_PushRel(offsetof(CONTEXT, mdAcc));
+		jitter.MD_PushRel(offsetof(CONTEXT, mdSrc1));
+		jitter.MD_PushRel(offsetof(CONTEXT, mdSrc2));
+		jitter.MD_MulSubS();
+		jitter.MD_PullRel(offsetof(CONTEXT, mdResMulSub));
+
+		jitter.MD_PushRel(offsetof(CONTEXT, mdAcc));
+		jitter.MD_PushRel(offsetof(CONTEXT, mdSrc1));
+		jitter.MD_PushRel(offsetof(CONTEXT, mdSrc2));
+		jitter.MD_FusedMulAddS();
+		jitter.MD_PullRel(offsetof(CONTEXT, mdResFusedMulAdd));
+
+		jitter.MD_PushRel(offsetof(CONTEXT, mdAcc));
+		jitter.MD_PushRel(offsetof(CONTEXT, mdSrc1));
+		jitter.MD_PushRel(offsetof(CONTEXT, mdSrc2));
+		jitter.MD_FusedMulSubS();
+		jitter.MD_PullRel(offsetof(CONTEXT, mdResFusedMulSub));
+
+		jitter.MD_PushRel(offsetof(CONTEXT, mdAcc));
+		jitter.MD_PushRel(offsetof(CONTEXT, mdSrc1));
+		jitter.MD_PushRel(offsetof(CONTEXT, mdSrc2));
+		jitter.MD_MulS();
+		jitter.MD_AddS();
+		jitter.MD_PullRel(offsetof(CONTEXT, mdResFolded));
+	}
+	jitter.End();
+
+	{
+		const auto& stats = jitter.GetPassStats();
+		TEST_VERIFY(stats[Jitter::CJitter::OPTIMIZATION_PASS_FUSE_MULTIPLY_ADD].statementsRemoved == 3);
+	}
+	jitter.SetPassStatsEnabled(false);
+
+	m_function = CMemoryFunction(codeStream.GetBuffer(), codeStream.GetSize());
+}
+
+void CMulAddTest::Run()
+{
+	memset(&m_context, 0, sizeof(CONTEXT));
+
+	m_context.singleAcc = 2.5f;
+	m_context.singleSrc1 = 1.5f;
+	m_context.singleSrc2 = -4.0f;
+	m_context.singleInexact = 1.0f + ldexpf(1.0f, -12);
+
+	m_context.doubleAcc = 10.0;
+	m_context.doubleSrc1 = 0.5;
+	m_context.doubleSrc2 = 3.0;
+
+	static const float mdAcc[4] = { 1.0f, 2.0f, 3.0f, 4.0f };
+	static const float mdSrc1[4] = { 0.5f, -1.0f, 2.0f, 4.0f };
+	static const float mdSrc2[4] = { 2.0f, 3.0f, -0.25f, 0.5f };
+	memcpy(m_context.mdAcc, mdAcc, sizeof(mdAcc));
+	memcpy(m_context.mdSrc1, mdSrc1, sizeof(mdSrc1));
+	memcpy(m_context.mdSrc2, mdSrc2, sizeof(mdSrc2));
+
+	m_function(&m_context);
+
+	TEST_VERIFY(m_context.singleResMulAdd == -3.5f);
+	TEST_VERIFY(m_context.singleResMulSub == 8.5f);
+	TEST_VERIFY(m_context.singleResFusedMulAdd == -3.5f);
+	TEST_VERIFY(m_context.singleResFusedMulSub == 8.5f);
+	TEST_VERIFY(m_context.singleResFolded == 8.5f);
+	TEST_VERIFY(m_context.singleResNotFolded == -8.5f);
+
+	//(1 + 2^-12)^2 = 1 + 2^-11 + 2^-24, the last term is lost when the product is rounded
+	TEST_VERIFY(m_context.singleResInexact == ldexpf(1.0f, -11) - ldexpf(1.0f, -12));
+	{
+		float exactResult = ldexpf(1.0f, -11) - ldexpf(1.0f, -12) + ldexpf(1.0f, -24);
+		//Depends on FMA support
+		TEST_VERIFY((m_context.singleResFusedInexact == exactResult) || (m_context.singleResFusedInexact == m_context.singleResInexact));
+	}
+
+	TEST_VERIFY(m_context.doubleResMulAdd == 11.5);
+	TEST_VERIFY(m_context.doubleResMulSub == 8.5);
+	TEST_VERIFY(m_context.doubleResFusedMulAdd == 11.5);
+	TEST_VERIFY(m_context.doubleResFusedMulSub == 8.5);
+	TEST_VERIFY(m_context.doubleResFolded == 11.5);
+
+	static const float mdResMulAdd[4] = { 2.0f, -1.0f, 2.5f, 6.0f };
+	static const float mdResMulSub[4] = { 0.0f, 5.0f, 3.5f, 2.0f };
+	for(unsigned int i = 0; i < 4; i++)
+	{
+		TEST_VERIFY(m_context.mdResMulAdd[i] == mdResMulAdd[i]);
+		TEST_VERIFY(m_context.mdResMulSub[i] == mdResMulSub[i]);
+		TEST_VERIFY(m_context.mdResFusedMulAdd[i] == mdResMulAdd[i]);
+		TEST_VERIFY(m_context.mdResFusedMulSub[i] == mdResMulSub[i]);
+		TEST_VERIFY(m_context.mdResFolded[i] == mdResMulAdd[i]);
+	}
+}
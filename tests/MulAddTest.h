@@ -0,0 +1,55 @@
+#pragma once
+
+#include "Test.h"
+#include "Align16.h"
+#include "MemoryFunction.h"
+
+class CMulAddTest : public CTest
+{
+public:
+	void				Compile(Jitter::CJitter&) override;
+	void				Run() override;
+
+private:
+	struct CONTEXT
+	{
+		ALIGN16
+
+		float			mdAcc[4];
+		float			mdSrc1[4];
+		float			mdSrc2[4];
+
+		float			mdResMulAdd[4];
+		float			mdResMulSub[4];
+		float			mdResFusedMulAdd[4];
+		float			mdResFusedMulSub[4];
+		float			mdResFolded[4];
+
+		double			doubleAcc;
+		double			doubleSrc1;
+		double			doubleSrc2;
+
+		double			doubleResMulAdd;
+		double			doubleResMulSub;
+		double			doubleResFusedMulAdd;
+		double			doubleResFusedMulSub;
+		double			doubleResFolded;
+
+		float			singleAcc;
+		float			singleSrc1;
+		float			singleSrc2;
+		float			singleInexact;
+
+		float			singleResMulAdd;
+		float			singleResMulSub;
+		float			singleResFusedMulAdd;
+		float			singleResFusedMulSub;
+		float			singleResFolded;
+		float			singleResNotFolded;
+		float			singleResInexact;
+		float			singleResFusedInexact;
+	};
+
+	CONTEXT				m_context;
+	CMemoryFunction		m_function;
+};
@@ -0,0 +1,168 @@
+#include "OptimizationPipelineTest.h"
+#include "MemStream.h"
+#include <stdexcept>
+
+CMemoryFunction COptimizationPipelineTest::CompileFunction(Jitter::CJitter& jitter)
+{
+	Framework::CMemStream codeStream;
+	jitter.SetStream(&codeStream);
+
+	jitter.Begin();
+	{
+		//Gives every pass something to do: constants to fold and propagate, copies, dead stores and blocks to merge
+		jitter.PushCst(4);
+		jitter.PushCst(6);
+		jitter.Add();
+		jitter.PullRel(offsetof(CONTEXT, result));
+
+		jitter.PushRel(offsetof(CONTEXT, result));
+		jitter.PushRel(offsetof(CONTEXT, value));
+		jitter.Add();
+		jitter.PullRel(offsetof(CONTEXT, result));
+
+		jitter.PushRel(offsetof(CONTEXT, value));
+		jitter.PullRel(offsetof(CONTEXT, total));
+
+		jitter.PushRel(offsetof(CONTEXT, value));
+		jitter.PushCst(0x100);
+		jitter.BeginIf(Jitter::CONDITION_BL);
+		{
+			jitter.PushRel(offsetof(CONTEXT, result));
+			jitter.Shl(2);
+			jitter.PullRel(offsetof(CONTEXT, result));
+		}
+		jitter.EndIf();
+
+		jitter.PushCst(1);
+		jitter.PushCst(0);
+		jitter.BeginIf(Jitter::CONDITION_EQ);
+		{
+			jitter.PushCst(0xDEAD);
+			jitter.PullRel(offsetof(CONTEXT, result));
+		}
+		jitter.EndIf();
+
+		jitter.PushRel(offsetof(CONTEXT, total));
+		jitter.PushRel(offsetof(CONTEXT, result));
+		jitter.Add();
+		jitter.PushCst(3);
+		jitter.Sub();
+		jitter.PullRel(offsetof(CONTEXT, total));
+	}
+	jitter.End();
+
+	return CMemoryFunction(codeStream.GetBuffer(), codeStream.GetSize());
+}
+
+uint32 COptimizationPipelineTest::ComputeResult(uint32 value)
+{
+	uint32 result = value + 10;
+	if(value < 0x100) result <<= 2;
+	return result;
+}
+
+uint32 COptimizationPipelineTest::ComputeTotal(uint32 value)
+{
+	return value + ComputeResult(value) - 3;
+}
+
+void COptimizationPipelineTest::Compile(Jitter::CJitter& jitter)
+{
+	jitter.ResetPassStats();
+	jitter.SetPassStatsEnabled(true);
+
+	jitter.SetOptimizationLevel(Jitter::CJitter::OPTIMIZATION_LEVEL_NONE);
+	m_functions[0] = CompileFunction(jitter);
+	{
+		const auto& stats = jitter.GetPassStats();
+		TEST_VERIFY(stats[Jitter::CJitter::OPTIMIZATION_PASS_CONSTANT_FOLDING].runCount != 0);
+		TEST_VERIFY(stats[Jitter::CJitter::OPTIMIZATION_PASS_PRUNE_BLOCKS].runCount == 0);
+		TEST_VERIFY(stats[Jitter::CJitter::OPTIMIZATION_PASS_ALLOCATE_REGISTERS].runCount == 0);
+	}
+
+	jitter.ResetPassStats();
+	jitter.SetOptimizationLevel(Jitter::CJitter::OPTIMIZATION_LEVEL_FAST);
+	m_functions[1] = CompileFunction(jitter);
+	{
+		const auto& stats = jitter.GetPassStats();
+		TEST_VERIFY(stats[Jitter::CJitter::OPTIMIZATION_PASS_PRUNE_BLOCKS].runCount == 1);
+		TEST_VERIFY(stats[Jitter::CJitter::OPTIMIZATION_PASS_MERGE_BLOCKS].runCount == 1);
+		TEST_VERIFY(stats[Jitter::CJitter::OPTIMIZATION_PASS_COALESCE_TEMPORARIES].runCount == 0);
+		TEST_VERIFY(stats[Jitter::CJitter::OPTIMIZATION_PASS_ALLOCATE_REGISTERS].runCount != 0);
+	}
+
+	jitter.ResetPassStats();
+	jitter.SetOptimizationLevel(Jitter::CJitter::OPTIMIZATION_LEVEL_FULL);
+	m_functions[2] = CompileFunction(jitter);
+	{
+		const auto& stats = jitter.GetPassStats();
+		for(unsigned int i = 0; i < Jitter::CJitter::OPTIMIZATION_PASS_COUNT; i++)
+		{
+			TEST_VERIFY(stats[i].runCount != 0);
+		}
+		TEST_VERIFY(stats[Jitter::CJitter::OPTIMIZATION_PASS_DEADCODE_ELIMINATION].statementsRemoved > 0);
+		TEST_VERIFY(stats[Jitter::CJitter::OPTIMIZATION_PASS_PRUNE_BLOCKS].statementsRemoved > 0);
+	}
+
+	//Custom pipeline merging blocks without pruning them first
+	{
+		Jitter::CJitter::PASS_PIPELINE pipeline;
+		pipeline.blockPasses = { Jitter::CJitter::OPTIMIZATION_PASS_CONSTANT_FOLDING, Jitter::CJitter::OPTIMIZATION_PASS_DEADCODE_ELIMINATION };
+		pipeline.maxBlockIterations = 3;
+		pipeline.flowPasses = { Jitter::CJitter::OPTIMIZATION_PASS_MERGE_BLOCKS };
+		pipeline.allocateRegisters = true;
+		jitter.SetPassPipeline(pipeline);
+		m_functions[3] = CompileFunction(jitter);
+		TEST_VERIFY(jitter.GetPassPipeline().maxBlockIterations == 3);
+	}
+
+	{
+		bool thrown = false;
+		try
+		{
+			Jitter::CJitter::PASS_PIPELINE pipeline;
+			pipeline.blockPasses = { Jitter::CJitter::OPTIMIZATION_PASS_COPY_PROPAGATION };
+			jitter.SetPassPipeline(pipeline);
+		}
+		catch(const std::runtime_error&)
+		{
+			thrown = true;
+		}
+		TEST_VERIFY(thrown);
+	}
+
+	{
+		bool thrown = false;
+		try
+		{
+			Jitter::CJitter::PASS_PIPELINE pipeline;
+			pipeline.blockPasses = { Jitter::CJitter::OPTIMIZATION_PASS_CONSTANT_FOLDING, Jitter::CJitter::OPTIMIZATION_PASS_MERGE_BLOCKS };
+			jitter.SetPassPipeline(pipeline);
+		}
+		catch(const std::runtime_error&)
+		{
+			thrown = true;
+		}
+		TEST_VERIFY(thrown);
+	}
+
+	jitter.SetOptimizationLevel(Jitter::CJitter::OPTIMIZATION_LEVEL_FULL);
+	jitter.SetPassStatsEnabled(false);
+	jitter.ResetPassStats();
+}
+
+void COptimizationPipelineTest::Run()
+{
+	static const uint32 values[] = { 0, 5, 0xFF, 0x100, 0x12345 };
+	for(auto& function : m_functions)
+	{
+		for(auto value : values)
+		{
+			CONTEXT context = {};
+			context.value = value;
+			function(&context);
+			TEST_VERIFY(context.result == ComputeResult(value));
+			TEST_VERIFY(context.total == ComputeTotal(value));
+		}
+	}
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+#include "Test.h"
+#include "MemoryFunction.h"
+
+class COptimizationPipelineTest : public CTest
+{
+public:
+	void				Run() override;
+	void				Compile(Jitter::CJitter&) override;
+
+private:
+	enum
+	{
+		FUNCTION_COUNT = 4,
+	};
+
+	struct CONTEXT
+	{
+		uint32			value;
+		uint32			result;
+		uint32			total;
+	};
+
+	static CMemoryFunction	CompileFunction(Jitter::CJitter&);
+	static uint32		ComputeResult(uint32);
+	static uint32		ComputeTotal(uint32);
+
+	CMemoryFunction		m_functions[FUNCTION_COUNT];
+};
@@ -0,0 +1,71 @@
+#include "PerfJitWriterTest.h"
+#include "PerfJitWriter.h"
+#include "MemStream.h"
+#include <fstream>
+#include <sstream>
+#include <iterator>
+
+#define FUNCTION_NAME	"PerfJitWriterTest_0x1234"
+#define CONSTANT_1		(0x76543210)
+
+void CPerfJitWriterTest::Compile(Jitter::CJitter& jitter)
+{
+	Framework::CMemStream codeStream;
+	jitter.SetStream(&codeStream);
+
+	jitter.Begin();
+	{
+		jitter.PushCst(CONSTANT_1);
+		jitter.PullRel(offsetof(CONTEXT, result));
+	}
+	jitter.End();
+
+	auto& perfJitWriter = CPerfJitWriter::GetInstance();
+	perfJitWriter.Enable(CPerfJitWriter::FLAG_PERF_MAP | CPerfJitWriter::FLAG_JITDUMP);
+	m_function = CMemoryFunction(codeStream.GetBuffer(), codeStream.GetSize(), FUNCTION_NAME);
+}
+
+void CPerfJitWriterTest::Run()
+{
+	memset(&m_context, 0, sizeof(m_context));
+	m_function(&m_context);
+	TEST_VERIFY(m_context.result == CONSTANT_1);
+
+	auto& perfJitWriter = CPerfJitWriter::GetInstance();
+	if(!perfJitWriter.IsEnabled())
+	{
+		//Not supported on this platform
+		return;
+	}
+
+	perfJitWriter.Flush();
+
+	auto perfMapPath = perfJitWriter.GetPerfMapPath();
+	auto jitDumpPath = perfJitWriter.GetJitDumpPath();
+
+	{
+		std::ifstream perfMapStream(perfMapPath);
+		std::string perfMapLine;
+		std::getline(perfMapStream, perfMapLine);
+
+		std::stringstream expectedLine;
+		expectedLine << std::hex << reinterpret_cast<uintptr_t>(m_function.GetCode()) << " " << m_function.GetSize() << " " << FUNCTION_NAME;
+		TEST_VERIFY(perfMapLine == expectedLine.str());
+	}
+
+	{
+		std::ifstream jitDumpStream(jitDumpPath, std::ios::binary);
+		std::vector<uint8> jitDump((std::istreambuf_iterator<char>(jitDumpStream)), std::istreambuf_iterator<char>());
+
+		//Header (0x28 bytes) followed by a code load record (0x38 bytes), name and code
+		size_t nameSize = strlen(FUNCTION_NAME) + 1;
+		TEST_VERIFY(jitDump.size() == 0x28 + 0x38 + nameSize + m_function.GetSize());
+		TEST_VERIFY(*reinterpret_cast<const uint32*>(jitDump.data()) == 0x4A695444);
+		TEST_VERIFY(memcmp(jitDump.data() + 0x28 + 0x38, FUNCTION_NAME, nameSize) == 0);
+		TEST_VERIFY(memcmp(jitDump.data() + 0x28 + 0x38 + nameSize, m_function.GetCode(), m_function.GetSize()) == 0);
+	}
+
+	perfJitWriter.Disable();
+	remove(perfMapPath.c_str());
+	remove(jitDumpPath.c_str());
+}
@@ -0,0 +1,20 @@
+#pragma once
+
+#include "Test.h"
+#include "MemoryFunction.h"
+
+class CPerfJitWriterTest : public CTest
+{
+public:
+	void				Run() override;
+	void				Compile(Jitter::CJitter&) override;
+
+private:
+	struct CONTEXT
+	{
+		uint32			result;
+	};
+
+	CONTEXT				m_context;
+	CMemoryFunction		m_function;
+};
@@ -0,0 +1,135 @@
+#include "ProfileTest.h"
+#include "MemStream.h"
+#include "offsetof_def.h"
+#include <algorithm>
+
+#define THEN_RUN_COUNT	(10)
+
+uint32 CProfileTest::ComputeResult(uint32 input)
+{
+	return (input < THEN_RUN_COUNT) ? (input + 0x100) : (input ^ 0xFF00);
+}
+
+void CProfileTest::Run()
+{
+	memset(&m_counters, 0, sizeof(m_counters));
+
+	for(uint32 i = 0; i < PROFILE_RUN_COUNT; i++)
+	{
+		memset(&m_context, 0, sizeof(m_context));
+		m_context.input = i;
+		m_profiledFunction(&m_context);
+		TEST_VERIFY(m_context.result == ComputeResult(i));
+	}
+
+	//Entry block is executed on every run
+	TEST_VERIFY(!m_profileCounters.empty());
+	TEST_VERIFY(m_profileCounters.size() <= MAX_COUNTERS);
+	TEST_VERIFY(m_profileCounters[0].targetBlockId == 0);
+	TEST_VERIFY(m_counters[0] == PROFILE_RUN_COUNT);
+
+	//Fall through edge of the if goes in the "then" block
+	uint32 thenBlockId = 0;
+	for(size_t i = 0; i < m_profileCounters.size(); i++)
+	{
+		const auto& counterInfo(m_profileCounters[i]);
+		if(counterInfo.targetBlockId == 0) continue;
+		TEST_VERIFY(m_counters[i] == THEN_RUN_COUNT);
+		thenBlockId = counterInfo.targetBlockId;
+	}
+	TEST_VERIFY(thenBlockId != 0);
+
+	auto blockFrequencies = Jitter::CJitter::MakeBlockFrequencies(m_profileCounters, m_counters);
+	uint64 entryFrequency = blockFrequencies[m_profileCounters[0].blockId];
+	TEST_VERIFY(entryFrequency == PROFILE_RUN_COUNT);
+
+	//Rarely executed "then" block must have been moved after every block of the hot path
+	auto thenBlockIterator = std::find(m_blockLayout.begin(), m_blockLayout.end(), thenBlockId);
+	TEST_VERIFY(thenBlockIterator != m_blockLayout.end());
+	TEST_VERIFY(thenBlockIterator != m_blockLayout.begin() + 1);
+	for(auto blockIterator = thenBlockIterator; blockIterator != m_blockLayout.end(); blockIterator++)
+	{
+		auto blockFrequencyIterator = blockFrequencies.find(*blockIterator);
+		if(blockFrequencyIterator == blockFrequencies.end()) continue;
+		bool hot = (blockFrequencyIterator->second * 2) > entryFrequency;
+		TEST_VERIFY(!hot);
+	}
+
+	//Function compiled with the profile must not be instrumented
+	uint32 counters[MAX_COUNTERS];
+	memcpy(counters, m_counters, sizeof(counters));
+
+	for(uint32 i = 0; i < 20; i++)
+	{
+		memset(&m_context, 0, sizeof(m_context));
+		m_context.input = i;
+		m_function(&m_context);
+		TEST_VERIFY(m_context.result == ComputeResult(i));
+	}
+
+	TEST_VERIFY(memcmp(counters, m_counters, sizeof(counters)) == 0);
+}
+
+void CProfileTest::CompileFunction(Jitter::CJitter& jitter, CMemoryFunction& function)
+{
+	Framework::CMemStream codeStream;
+	jitter.SetStream(&codeStream);
+
+	jitter.Begin();
+	{
+		jitter.PushRel(offsetof(CONTEXT, input));
+		jitter.PushCst(THEN_RUN_COUNT);
+		jitter.BeginIf(Jitter::CONDITION_BL);
+		{
+			jitter.PushRel(offsetof(CONTEXT, input));
+			jitter.PushCst(0x100);
+			jitter.Add();
+			jitter.PullRel(offsetof(CONTEXT, result));
+		}
+		jitter.Else();
+		{
+			jitter.PushRel(offsetof(CONTEXT, input));
+			jitter.PushCst(0xFF00);
+			jitter.Xor();
+			jitter.PullRel(offsetof(CONTEXT, result));
+		}
+		jitter.EndIf();
+	}
+	jitter.End();
+
+	function = CMemoryFunction(codeStream.GetBuffer(), codeStream.GetSize());
+}
+
+void CProfileTest::Compile(Jitter::CJitter& jitter)
+{
+	memset(&m_counters, 0, sizeof(m_counters));
+
+	jitter.EnableProfiling(m_counters, MAX_COUNTERS);
+	CompileFunction(jitter, m_profiledFunction);
+	m_profileCounters = jitter.GetProfileCounters();
+
+	//Gather a profile and use it to compile the final version
+	for(uint32 i = 0; i < PROFILE_RUN_COUNT; i++)
+	{
+		m_context.input = i;
+		m_profiledFunction(&m_context);
+	}
+
+	jitter.SetBlockFrequencies(Jitter::CJitter::MakeBlockFrequencies(m_profileCounters, m_counters));
+	CompileFunction(jitter, m_function);
+	m_blockLayout = jitter.GetBlockLayout();
+
+	//Too few counters, function must not be partially instrumented
+	{
+		uint32 counter = 0;
+		CMemoryFunction function;
+		jitter.EnableProfiling(&counter, 1);
+		CompileFunction(jitter, function);
+		TEST_VERIFY(jitter.GetProfileCounters().empty());
+		TEST_VERIFY(jitter.GetRequiredProfileCounterCount() == m_profileCounters.size());
+
+		m_context.input = 0;
+		function(&m_context);
+		TEST_VERIFY(counter == 0);
+	}
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include "Test.h"
+#include "MemoryFunction.h"
+
+class CProfileTest : public CTest
+{
+public:
+	void				Run() override;
+	void				Compile(Jitter::CJitter&) override;
+
+private:
+	enum
+	{
+		MAX_COUNTERS = 0x10,
+		PROFILE_RUN_COUNT = 1000,
+	};
+
+	struct CONTEXT
+	{
+		uint32		input;
+		uint32		result;
+	};
+
+	static uint32				ComputeResult(uint32);
+	void						CompileFunction(Jitter::CJitter&, CMemoryFunction&);
+
+	CONTEXT						m_context;
+	uint32						m_counters[MAX_COUNTERS];
+	Jitter::CJitter::ProfileCounterArray	m_profileCounters;
+	Jitter::CJitter::BlockIdArray	m_blockLayout;
+	CMemoryFunction				m_profiledFunction;
+	CMemoryFunction				m_function;
+};
@@ -0,0 +1,153 @@
+#include "RoundingModeTest.h"
+#include "MemStream.h"
+#include <limits>
+
+static const Jitter::ROUNDMODE g_roundModes[] =
+{
+	Jitter::ROUND_NEAREST,
+	Jitter::ROUND_PLUSINFINITY,
+	Jitter::ROUND_MINUSINFINITY,
+	Jitter::ROUND_TRUNCATE,
+};
+
+//Code written against CJitter's former nested enum must still compile
+static_assert(Jitter::CJitter::ROUND_NEAREST == Jitter::ROUND_NEAREST, "Rounding mode alias mismatch.");
+static_assert(Jitter::CJitter::ROUND_TRUNCATE == Jitter::ROUND_TRUNCATE, "Rounding mode alias mismatch.");
+
+static double RoundValue(double value, Jitter::ROUNDMODE roundMode)
+{
+	switch(roundMode)
+	{
+	case Jitter::ROUND_NEAREST:
+		//Default floating point environment rounds half to even
+		return nearbyint(value);
+	case Jitter::ROUND_PLUSINFINITY:
+		return ceil(value);
+	case Jitter::ROUND_MINUSINFINITY:
+		return floor(value);
+	default:
+		return trunc(value);
+	}
+}
+
+static int32 SaturateToWord(float value, Jitter::ROUNDMODE roundMode)
+{
+	if(isnan(value)) return 0;
+	double result = RoundValue(value, roundMode);
+	if(result >= 2147483648.0) return std::numeric_limits<int32>::max();
+	if(result <= -2147483648.0) return std::numeric_limits<int32>::min();
+	return static_cast<int32>(result);
+}
+
+static bool IsSameRoundedValue(float result, float value, Jitter::ROUNDMODE roundMode)
+{
+	if(isnan(value)) return isnan(result);
+	float expected = static_cast<float>(RoundValue(value, roundMode));
+	//Also checks the sign of zeros
+	return memcmp(&result, &expected, sizeof(float)) == 0;
+}
+
+void CRoundingModeTest::Compile(Jitter::CJitter& jitter)
+{
+	Framework::CMemStream codeStream;
+	jitter.SetStream(&codeStream);
+
+	jitter.Begin();
+	{
+		for(unsigned int mode = 0; mode < MODE_COUNT; mode++)
+		{
+			auto roundMode = g_roundModes[mode];
+			for(unsigned int i = 0; i < VALUE_COUNT; i++)
+			{
+				size_t valueOffset = i * sizeof(float);
+				size_t resultOffset = ((mode * VALUE_COUNT) + i) * sizeof(float);
+
+				jitter.FP_PushSingle(offsetof(CONTEXT, values) + valueOffset);
+				jitter.FP_PullWord(offsetof(CONTEXT, toWord) + resultOffset, roundMode);
+
+				jitter.FP_PushSingle(offsetof(CONTEXT, satValues) + valueOffset);
+				jitter.FP_PullWordSaturate(offsetof(CONTEXT, toWordSat) + resultOffset, roundMode);
+
+				jitter.FP_PushSingle(offsetof(CONTEXT, values) + valueOffset);
+				jitter.FP_Round(roundMode);
+				jitter.FP_PullSingle(offsetof(CONTEXT, round) + resultOffset);
+
+				jitter.FP_PushSingle(offsetof(CONTEXT, roundValues) + valueOffset);
+				jitter.FP_Round(roundMode);
+				jitter.FP_PullSingle(offsetof(CONTEXT, roundBig) + resultOffset);
+			}
+
+			for(unsigned int i = 0; i < VALUE_COUNT; i += 4)
+			{
+				size_t valueOffset = i * sizeof(float);
+				size_t resultOffset = ((mode * VALUE_COUNT) + i) * sizeof(float);
+
+				jitter.MD_PushRel(offsetof(CONTEXT, values) + valueOffset);
+				jitter.MD_ToWord(roundMode);
+				jitter.MD_PullRel(offsetof(CONTEXT, mdToWord) + resultOffset);
+
+				jitter.MD_PushRel(offsetof(CONTEXT, satValues) + valueOffset);
+				jitter.MD_ToWordSaturate(roundMode);
+				jitter.MD_PullRel(offsetof(CONTEXT, mdToWordSat) + resultOffset);
+
+				jitter.MD_PushRel(offsetof(CONTEXT, values) + valueOffset);
+				jitter.MD_Round(roundMode);
+				jitter.MD_PullRel(offsetof(CONTEXT, mdRound) + resultOffset);
+
+				jitter.MD_PushRel(offsetof(CONTEXT, roundValues) + valueOffset);
+				jitter.MD_Round(roundMode);
+				jitter.MD_PullRel(offsetof(CONTEXT, mdRoundBig) + resultOffset);
+			}
+		}
+	}
+	jitter.End();
+
+	m_function = CMemoryFunction(codeStream.GetBuffer(), codeStream.GetSize());
+}
+
+void CRoundingModeTest::Run()
+{
+	static const float values[VALUE_COUNT] =
+	{
+		1.5f, -1.5f, 2.5f, -2.5f, 0.3f, -0.3f, 1000000.7f, -7.0f
+	};
+
+	static const float satValues[VALUE_COUNT] =
+	{
+		3.0e9f, -3.0e9f, std::numeric_limits<float>::quiet_NaN(), 2147483520.0f,
+		-2147483648.0f, 1.0e20f, -0.7f, -2147483904.0f
+	};
+
+	static const float roundValues[VALUE_COUNT] =
+	{
+		8388609.0f, -8388609.0f, 3.0e9f, -1.0e20f,
+		std::numeric_limits<float>::quiet_NaN(), -0.0f, 8388607.5f, -8388607.5f
+	};
+
+	CONTEXT ALIGN16 context;
+	memset(&context, 0, sizeof(CONTEXT));
+	memcpy(context.values, values, sizeof(values));
+	memcpy(context.satValues, satValues, sizeof(satValues));
+	memcpy(context.roundValues, roundValues, sizeof(roundValues));
+
+	m_function(&context);
+
+	for(unsigned int mode = 0; mode < MODE_COUNT; mode++)
+	{
+		auto roundMode = g_roundModes[mode];
+		for(unsigned int i = 0; i < VALUE_COUNT; i++)
+		{
+			int32 toWord = static_cast<int32>(RoundValue(values[i], roundMode));
+			int32 toWordSat = SaturateToWord(satValues[i], roundMode);
+
+			TEST_VERIFY(context.toWord[mode][i] == toWord);
+			TEST_VERIFY(context.mdToWord[mode][i] == toWord);
+			TEST_VERIFY(context.toWordSat[mode][i] == toWordSat);
+			TEST_VERIFY(context.mdToWordSat[mode][i] == toWordSat);
+			TEST_VERIFY(IsSameRoundedValue(context.round[mode][i], values[i], roundMode));
+			TEST_VERIFY(IsSameRoundedValue(context.mdRound[mode][i], values[i], roundMode));
+			TEST_VERIFY(IsSameRoundedValue(context.roundBig[mode][i], roundValues[i], roundMode));
+			TEST_VERIFY(IsSameRoundedValue(context.mdRoundBig[mode][i], roundValues[i], roundMode));
+		}
+	}
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include "Test.h"
+#include "Align16.h"
+#include "MemoryFunction.h"
+
+class CRoundingModeTest : public CTest
+{
+public:
+	void				Compile(Jitter::CJitter&) override;
+	void				Run() override;
+
+private:
+	enum
+	{
+		VALUE_COUNT = 8,
+		MODE_COUNT = 4,
+	};
+
+	struct CONTEXT
+	{
+		ALIGN16
+
+		//Values that fit in a word
+		float			values[VALUE_COUNT];
+		//Values that need saturation
+		float			satValues[VALUE_COUNT];
+		//Values around 2^23 and above, NaNs and negative zeros
+		float			roundValues[VALUE_COUNT];
+
+		int32			toWord[MODE_COUNT][VALUE_COUNT];
+		int32			toWordSat[MODE_COUNT][VALUE_COUNT];
+		float			round[MODE_COUNT][VALUE_COUNT];
+		float			roundBig[MODE_COUNT][VALUE_COUNT];
+
+		int32			mdToWord[MODE_COUNT][VALUE_COUNT];
+		int32			mdToWordSat[MODE_COUNT][VALUE_COUNT];
+		float			mdRound[MODE_COUNT][VALUE_COUNT];
+		float			mdRoundBig[MODE_COUNT][VALUE_COUNT];
+	};
+
+	CMemoryFunction		m_function;
+};
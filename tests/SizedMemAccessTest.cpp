@@ -0,0 +1,140 @@
+#include "SizedMemAccessTest.h"
+#include "MemStream.h"
+
+#define CONSTANT_64	(0x0123456789ABCDEFULL)
+
+void CSizedMemAccessTest::Run()
+{
+	memset(&m_context, 0, sizeof(m_context));
+	memset(&m_memory, 0x55, sizeof(m_memory));
+
+	m_memory[0x01] = 0xF0;
+	m_memory[0x02] = 0x34;
+	m_memory[0x03] = 0x92;
+	for(unsigned int i = 0; i < 8; i++)
+	{
+		m_memory[0x18 + i] = static_cast<uint8>(0xA0 + i);
+	}
+
+	m_context.memory = m_memory;
+	m_context.value = 0xCAFEBABE;
+	m_context.value64 = 0xFEDCBA9876543210ULL;
+
+	m_function(&m_context);
+
+	TEST_VERIFY(m_context.load8 == 0xF0);
+	TEST_VERIFY(m_context.load8S == 0xFFFFFFF0);
+	TEST_VERIFY(m_context.load16 == 0x9234);
+	TEST_VERIFY(m_context.load16S == 0xFFFF9234);
+	TEST_VERIFY(m_context.load64 == 0xA7A6A5A4A3A2A1A0ULL);
+
+	//Stores must not touch neighbouring bytes
+	TEST_VERIFY(m_memory[0x07] == 0x55);
+	TEST_VERIFY(m_memory[0x08] == 0xBE);
+	TEST_VERIFY(m_memory[0x09] == 0x55);
+	TEST_VERIFY(m_memory[0x0A] == 0x7F);
+	TEST_VERIFY(m_memory[0x0B] == 0x55);
+	TEST_VERIFY(m_memory[0x0C] == 0xBE);
+	TEST_VERIFY(m_memory[0x0D] == 0xBA);
+	TEST_VERIFY(m_memory[0x0E] == 0x55);
+	TEST_VERIFY(m_memory[0x0F] == 0x34);
+	TEST_VERIFY(m_memory[0x10] == 0x12);
+	TEST_VERIFY(m_memory[0x11] == 0x55);
+	TEST_VERIFY(m_memory[0x12] == 0xF0);
+	TEST_VERIFY(m_memory[0x13] == 0xFF);
+	TEST_VERIFY(m_memory[0x14] == 0x55);
+
+	uint64 store64 = 0;
+	memcpy(&store64, m_memory + 0x20, sizeof(uint64));
+	TEST_VERIFY(store64 == 0xFEDCBA9876543210ULL);
+	memcpy(&store64, m_memory + 0x28, sizeof(uint64));
+	TEST_VERIFY(store64 == CONSTANT_64);
+	TEST_VERIFY(m_memory[0x30] == 0x55);
+}
+
+void CSizedMemAccessTest::Compile(Jitter::CJitter& jitter)
+{
+	Framework::CMemStream codeStream;
+	jitter.SetStream(&codeStream);
+
+	jitter.Begin();
+	{
+		//Loads
+		jitter.PushRelRef(offsetof(CONTEXT, memory));
+		jitter.PushCst(0x01);
+		jitter.AddRef();
+		jitter.Load8FromRef();
+		jitter.PullRel(offsetof(CONTEXT, load8));
+
+		jitter.PushRelRef(offsetof(CONTEXT, memory));
+		jitter.PushCst(0x01);
+		jitter.AddRef();
+		jitter.Load8SFromRef();
+		jitter.PullRel(offsetof(CONTEXT, load8S));
+
+		jitter.PushRelRef(offsetof(CONTEXT, memory));
+		jitter.PushCst(0x02);
+		jitter.AddRef();
+		jitter.Load16FromRef();
+		jitter.PullRel(offsetof(CONTEXT, load16));
+
+		jitter.PushRelRef(offsetof(CONTEXT, memory));
+		jitter.PushCst(0x02);
+		jitter.AddRef();
+		jitter.Load16SFromRef();
+		jitter.PullRel(offsetof(CONTEXT, load16S));
+
+		jitter.PushRelRef(offsetof(CONTEXT, memory));
+		jitter.PushCst(0x18);
+		jitter.AddRef();
+		jitter.Load64FromRef();
+		jitter.PullRel64(offsetof(CONTEXT, load64));
+
+		//Stores
+		jitter.PushRelRef(offsetof(CONTEXT, memory));
+		jitter.PushCst(0x08);
+		jitter.AddRef();
+		jitter.PushRel(offsetof(CONTEXT, value));
+		jitter.Store8AtRef();
+
+		jitter.PushRelRef(offsetof(CONTEXT, memory));
+		jitter.PushCst(0x0A);
+		jitter.AddRef();
+		jitter.PushCst(0x1234567F);
+		jitter.Store8AtRef();
+
+		jitter.PushRelRef(offsetof(CONTEXT, memory));
+		jitter.PushCst(0x0C);
+		jitter.AddRef();
+		jitter.PushRel(offsetof(CONTEXT, value));
+		jitter.Store16AtRef();
+
+		jitter.PushRelRef(offsetof(CONTEXT, memory));
+		jitter.PushCst(0x0F);
+		jitter.AddRef();
+		jitter.PushCst(0xABCD1234);
+		jitter.Store16AtRef();
+
+		//Value previously loaded by this block
+		jitter.PushRelRef(offsetof(CONTEXT, memory));
+		jitter.PushCst(0x12);
+		jitter.AddRef();
+		jitter.PushRel(offsetof(CONTEXT, load8S));
+		jitter.Store16AtRef();
+
+		jitter.PushRelRef(offsetof(CONTEXT, memory));
+		jitter.PushCst(0x20);
+		jitter.AddRef();
+		jitter.PushRel64(offsetof(CONTEXT, value64));
+		jitter.Store64AtRef();
+
+		jitter.PushRelRef(offsetof(CONTEXT, memory));
+		jitter.PushCst(0x28);
+		jitter.AddRef();
+		jitter.PushCst64(CONSTANT_64);
+		jitter.Store64AtRef();
+	}
+	jitter.End();
+
+	m_function = CMemoryFunction(codeStream.GetBuffer(), codeStream.GetSize());
+}
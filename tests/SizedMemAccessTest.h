@@ -0,0 +1,28 @@
+#pragma once
+
+#include "Test.h"
+#include "MemoryFunction.h"
+
+class CSizedMemAccessTest : public CTest
+{
+public:
+	void				Run() override;
+	void				Compile(Jitter::CJitter&) override;
+
+private:
+	struct CONTEXT
+	{
+		uint8*			memory;
+		uint32			value;
+		uint32			load8;
+		uint32			load8S;
+		uint32			load16;
+		uint32			load16S;
+		uint64			value64;
+		uint64			load64;
+	};
+
+	CONTEXT				m_context;
+	uint8				m_memory[0x40];
+	CMemoryFunction		m_function;
+};
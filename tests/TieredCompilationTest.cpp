@@ -0,0 +1,110 @@
+#include "TieredCompilationTest.h"
+#include "Jitter_CodeGenFactory.h"
+#include <stdexcept>
+
+void CTieredCompilationTest::EmitFunction(Jitter::CJitter& jitter)
+{
+	jitter.PushRel(offsetof(CONTEXT, value));
+	jitter.PushCst(3);
+	jitter.PushCst(4);
+	jitter.Add();
+	jitter.Mult();
+	jitter.ExtLow64();
+	jitter.PullRel(offsetof(CONTEXT, result));
+
+	jitter.PushRel(offsetof(CONTEXT, value));
+	jitter.PushCst(0x10);
+	jitter.BeginIf(Jitter::CONDITION_BL);
+	{
+		jitter.PushCst64(0x0000000100000000ULL);
+		jitter.PushRel64(offsetof(CONTEXT, value64));
+		jitter.Add64();
+		jitter.Shl64(4);
+		jitter.PullRel64(offsetof(CONTEXT, result64));
+	}
+	jitter.Else();
+	{
+		jitter.PushCst64(0x1234);
+		jitter.PullRel64(offsetof(CONTEXT, result64));
+	}
+	jitter.EndIf();
+}
+
+void CTieredCompilationTest::Compile(Jitter::CJitter& jitter)
+{
+	m_jitter = &jitter;
+	m_function.reset(new Jitter::CTieredFunction(&EmitFunction, PROMOTION_THRESHOLD));
+	m_function->Compile(jitter);
+	TEST_VERIFY(jitter.GetCompileTier() == Jitter::CJitter::COMPILE_TIER_OPTIMIZING);
+
+	//Compile tier must be restored if the emitter fails, session is left open so use another jitter
+	{
+		Jitter::CJitter failingJitter(Jitter::CreateCodeGen());
+		Jitter::CTieredFunction failingFunction(
+			[] (Jitter::CJitter&)
+			{
+				throw std::runtime_error("Emitter failed.");
+			},
+			PROMOTION_THRESHOLD
+		);
+		bool failed = false;
+		try
+		{
+			failingFunction.Compile(failingJitter);
+		}
+		catch(const std::runtime_error&)
+		{
+			failed = true;
+		}
+		TEST_VERIFY(failed);
+		TEST_VERIFY(failingJitter.GetCompileTier() == Jitter::CJitter::COMPILE_TIER_OPTIMIZING);
+	}
+}
+
+void CTieredCompilationTest::RunFunction(uint32 value)
+{
+	memset(&m_context, 0, sizeof(m_context));
+	m_context.value = value;
+	m_context.value64 = 0x5;
+	(*m_function)(&m_context);
+	TEST_VERIFY(m_context.result == (value * 7));
+	if(value < 0x10)
+	{
+		TEST_VERIFY(m_context.result64 == 0x0000001000000050ULL);
+	}
+	else
+	{
+		TEST_VERIFY(m_context.result64 == 0x1234);
+	}
+}
+
+void CTieredCompilationTest::Run()
+{
+	TEST_VERIFY(m_function->GetEntryCount() == 0);
+	TEST_VERIFY(!m_function->NeedsPromotion());
+
+	for(uint32 i = 0; i < PROMOTION_THRESHOLD; i++)
+	{
+		TEST_VERIFY(!m_function->NeedsPromotion());
+		RunFunction(i * 3);
+	}
+	TEST_VERIFY(m_function->GetEntryCount() == PROMOTION_THRESHOLD);
+	TEST_VERIFY(m_function->NeedsPromotion());
+	TEST_VERIFY(!m_function->IsPromoted());
+
+	auto baselineCode = m_function->GetCode();
+	m_function->Promote(*m_jitter);
+	TEST_VERIFY(m_function->IsPromoted());
+	TEST_VERIFY(!m_function->NeedsPromotion());
+	TEST_VERIFY(m_function->GetCode() != baselineCode);
+
+	//Optimized code is not instrumented
+	for(uint32 i = 0; i < 4; i++)
+	{
+		RunFunction(i * 7);
+	}
+	TEST_VERIFY(m_function->GetEntryCount() == PROMOTION_THRESHOLD);
+
+	m_function->ReleaseRetiredCode();
+	RunFunction(0x20);
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+#include "Test.h"
+#include "TieredFunction.h"
+#include <memory>
+
+class CTieredCompilationTest : public CTest
+{
+public:
+	void			Run() override;
+	void			Compile(Jitter::CJitter&) override;
+
+private:
+	enum
+	{
+		PROMOTION_THRESHOLD = 10,
+	};
+
+	struct CONTEXT
+	{
+		uint32		value;
+		uint32		result;
+		uint64		value64;
+		uint64		result64;
+	};
+
+	static void		EmitFunction(Jitter::CJitter&);
+	void			RunFunction(uint32);
+
+	CONTEXT			m_context;
+	std::unique_ptr<Jitter::CTieredFunction>	m_function;
+	Jitter::CJitter*	m_jitter = nullptr;
+};
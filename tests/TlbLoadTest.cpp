@@ -0,0 +1,92 @@
+#include "TlbLoadTest.h"
+#include "MemStream.h"
+
+#define MAPPED_PAGE		(1)
+#define MISS_VALUE		(0x5A5A0000)
+#define INPUT_VALUE		(0x00001000)
+
+uint32 CTlbLoadTest::MissHandler(CONTEXT* context, uint32 address)
+{
+	//Only modify values that aren't accessed by the compiled code
+	context->missCount++;
+	return MISS_VALUE | (address & 0xFFFF);
+}
+
+void CTlbLoadTest::Run()
+{
+	memset(&m_context, 0, sizeof(m_context));
+	memset(&m_table, 0, sizeof(m_table));
+
+	for(unsigned int i = 0; i < (PAGE_SIZE / 4); i++)
+	{
+		m_page[i] = 0x10000000 | i;
+	}
+	m_table[MAPPED_PAGE] = m_page;
+
+	m_context.table = m_table;
+	m_context.address0 = (MAPPED_PAGE * PAGE_SIZE) + 0x08;
+	m_context.address1 = (2 * PAGE_SIZE) + 0x34;
+	m_context.input = INPUT_VALUE;
+	for(unsigned int i = 0; i < 4; i++)
+	{
+		m_context.mdInput[i] = 0x01010101 * (i + 1);
+	}
+
+	m_function(&m_context);
+
+	TEST_VERIFY(m_context.result0 == (0x10000000 | 0x02));
+	TEST_VERIFY(m_context.result1 == (0x10000000 | 0x3F));
+	TEST_VERIFY(m_context.result2 == (MISS_VALUE | 0x234));
+	TEST_VERIFY(m_context.result3 == (MISS_VALUE | 0x234) + (INPUT_VALUE * 2));
+	TEST_VERIFY(m_context.missCount == 1);
+	for(unsigned int i = 0; i < 4; i++)
+	{
+		TEST_VERIFY(m_context.mdResult[i] == 0x02020202 * (i + 1));
+	}
+}
+
+void CTlbLoadTest::Compile(Jitter::CJitter& jitter)
+{
+	Framework::CMemStream codeStream;
+	jitter.SetStream(&codeStream);
+
+	jitter.Begin();
+	{
+		//Values live across the miss path
+		jitter.PushRel(offsetof(CONTEXT, input));
+		jitter.PushRel(offsetof(CONTEXT, input));
+		jitter.Add();
+		jitter.PullRel(offsetof(CONTEXT, input));
+
+		jitter.MD_PushRel(offsetof(CONTEXT, mdInput));
+		jitter.MD_PushRel(offsetof(CONTEXT, mdInput));
+		jitter.MD_AddW();
+		jitter.MD_PullRel(offsetof(CONTEXT, mdInput));
+
+		//Hit, variable address
+		jitter.PushRel(offsetof(CONTEXT, address0));
+		jitter.LoadFromTlb(offsetof(CONTEXT, table), PAGE_SHIFT, reinterpret_cast<void*>(&MissHandler));
+		jitter.PullRel(offsetof(CONTEXT, result0));
+
+		//Hit, constant address
+		jitter.PushCst((MAPPED_PAGE * PAGE_SIZE) + 0xFC);
+		jitter.LoadFromTlb(offsetof(CONTEXT, table), PAGE_SHIFT, reinterpret_cast<void*>(&MissHandler));
+		jitter.PullRel(offsetof(CONTEXT, result1));
+
+		//Miss
+		jitter.PushRel(offsetof(CONTEXT, address1));
+		jitter.LoadFromTlb(offsetof(CONTEXT, table), PAGE_SHIFT, reinterpret_cast<void*>(&MissHandler));
+		jitter.PullRel(offsetof(CONTEXT, result2));
+
+		jitter.PushRel(offsetof(CONTEXT, result2));
+		jitter.PushRel(offsetof(CONTEXT, input));
+		jitter.Add();
+		jitter.PullRel(offsetof(CONTEXT, result3));
+
+		jitter.MD_PushRel(offsetof(CONTEXT, mdInput));
+		jitter.MD_PullRel(offsetof(CONTEXT, mdResult));
+	}
+	jitter.End();
+
+	m_function = CMemoryFunction(codeStream.GetBuffer(), codeStream.GetSize());
+}
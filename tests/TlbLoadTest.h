@@ -0,0 +1,48 @@
+#pragma once
+
+#include "Test.h"
+#include "Align16.h"
+#include "MemoryFunction.h"
+
+class CTlbLoadTest : public CTest
+{
+public:
+	void				Run() override;
+	void				Compile(Jitter::CJitter&) override;
+
+private:
+	enum
+	{
+		PAGE_SHIFT = 8,
+		PAGE_SIZE = (1 << PAGE_SHIFT),
+		PAGE_COUNT = 4,
+	};
+
+	struct CONTEXT
+	{
+		ALIGN16
+
+		uint32			mdInput[4];
+		uint32			mdResult[4];
+
+		void**			table;
+
+		uint32			address0;
+		uint32			address1;
+		uint32			input;
+
+		uint32			result0;
+		uint32			result1;
+		uint32			result2;
+		uint32			result3;
+
+		uint32			missCount;
+	};
+
+	static uint32		MissHandler(CONTEXT*, uint32);
+
+	CONTEXT				m_context;
+	void*				m_table[PAGE_COUNT];
+	uint32				m_page[PAGE_SIZE / 4];
+	CMemoryFunction		m_function;
+};
@@ -0,0 +1,112 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include "CompileService.h"
+#include "Jitter_CodeGenFactory.h"
+#include "MemStream.h"
+
+//Compares the time the main thread is stalled when compiling a burst of functions
+//synchronously with the time it spends submitting them to CCompileService and collecting results.
+//Usage: CompileServiceBenchmark [-n functionCount] [-s functionSize] [-t threadCount]
+
+typedef std::chrono::steady_clock Clock;
+
+static double ToMs(Clock::duration duration)
+{
+	return std::chrono::duration<double, std::milli>(duration).count();
+}
+
+static void EmitFunction(Jitter::CJitter& jitter, unsigned int seed, unsigned int size)
+{
+	for(unsigned int i = 0; i < size; i++)
+	{
+		uint32 value = (seed * 0x9E3779B9) ^ (i * 0x85EBCA6B);
+		jitter.PushRel((i % 32) * 4);
+		jitter.PushCst(value);
+		if(value & 1)
+		{
+			jitter.Add();
+		}
+		else
+		{
+			jitter.Xor();
+		}
+		jitter.PushRel(((i + 7) % 32) * 4);
+		jitter.Or();
+		jitter.PullRel(((i + 3) % 32) * 4);
+	}
+}
+
+int main(int argc, const char** argv)
+{
+	unsigned int functionCount = 256;
+	unsigned int functionSize = 64;
+	unsigned int threadCount = 0;
+	for(int i = 1; (i + 1) < argc; i += 2)
+	{
+		if(!strcmp(argv[i], "-n")) functionCount = atoi(argv[i + 1]);
+		else if(!strcmp(argv[i], "-s")) functionSize = atoi(argv[i + 1]);
+		else if(!strcmp(argv[i], "-t")) threadCount = atoi(argv[i + 1]);
+	}
+
+	//Synchronous, main thread does all the work
+	Clock::duration syncStall = Clock::duration::zero();
+	{
+		Jitter::CJitter jitter(Jitter::CreateCodeGen());
+		for(unsigned int i = 0; i < functionCount; i++)
+		{
+			auto startTime = Clock::now();
+			Framework::CMemStream stream;
+			jitter.SetStream(&stream);
+			jitter.Begin();
+			EmitFunction(jitter, i, functionSize);
+			jitter.End();
+			CMemoryFunction function(stream.GetBuffer(), stream.GetSize());
+			syncStall += Clock::now() - startTime;
+		}
+	}
+
+	//Background, main thread only submits jobs and collects results
+	Clock::duration asyncStall = Clock::duration::zero();
+	Clock::duration asyncLatency = Clock::duration::zero();
+	unsigned int serviceThreadCount = 0;
+	{
+		Jitter::CCompileService service(&Jitter::CreateCodeGen, threadCount);
+		serviceThreadCount = service.GetThreadCount();
+
+		auto startTime = Clock::now();
+		for(unsigned int i = 0; i < functionCount; i++)
+		{
+			service.Submit(
+				[i, functionSize] (Jitter::CJitter& jitter)
+				{
+					EmitFunction(jitter, i, functionSize);
+				},
+				i % 4
+			);
+		}
+		asyncStall += Clock::now() - startTime;
+
+		unsigned int completedCount = 0;
+		Jitter::CCompileService::COMPLETED_JOB completedJob;
+		while(completedCount != functionCount)
+		{
+			auto pollStartTime = Clock::now();
+			while(service.GetCompletedJob(completedJob))
+			{
+				completedCount++;
+			}
+			asyncStall += Clock::now() - pollStartTime;
+			std::this_thread::yield();
+		}
+		asyncLatency = Clock::now() - startTime;
+	}
+
+	printf("Functions: %u, size: %u\n", functionCount, functionSize);
+	printf("Synchronous: main thread stall %.3f ms\n", ToMs(syncStall));
+	printf("Background (%u threads): main thread stall %.3f ms, all functions ready after %.3f ms\n",
+		serviceThreadCount, ToMs(asyncStall), ToMs(asyncLatency));
+
+	return 0;
+}
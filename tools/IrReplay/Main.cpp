@@ -0,0 +1,188 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <vector>
+#include "Jitter.h"
+#include "Jitter_CodeGenFactory.h"
+#include "MemStream.h"
+
+//Compiles functions captured with CJitter::SetIrCaptureStream and reports how long compilation took.
+//Usage: IrReplay [-r repeatCount] [-O level] [-s] [-t traceFile] file...
+//-O selects the optimization level (0: none, 1: fast, 2: full), -s prints time spent in each optimization pass
+//and compile phase, -t writes a Chrome trace of every compile.
+
+struct REPLAY_RESULT
+{
+	uint32		functionCount = 0;
+	uint64		codeSize = 0;
+	double		compileTimeMs = 0;
+};
+
+static bool ReadFile(const char* path, Framework::CMemStream& stream)
+{
+	std::ifstream file(path, std::ios::binary);
+	if(!file) return false;
+	std::vector<char> contents((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+	stream.Write(contents.data(), contents.size());
+	stream.Seek(0, Framework::STREAM_SEEK_SET);
+	return true;
+}
+
+static REPLAY_RESULT ReplayFile(Jitter::CJitter& jitter, Framework::CMemStream& irStream, unsigned int repeatCount)
+{
+	REPLAY_RESULT result;
+	for(unsigned int i = 0; i < repeatCount; i++)
+	{
+		irStream.Seek(0, Framework::STREAM_SEEK_SET);
+		while(jitter.BeginFromIr(irStream))
+		{
+			Framework::CMemStream codeStream;
+			jitter.SetStream(&codeStream);
+
+			auto startTime = std::chrono::steady_clock::now();
+			jitter.End();
+			auto endTime = std::chrono::steady_clock::now();
+
+			result.compileTimeMs += std::chrono::duration<double, std::milli>(endTime - startTime).count();
+			if(i == 0)
+			{
+				result.functionCount++;
+				result.codeSize += codeStream.GetSize();
+			}
+		}
+	}
+	result.compileTimeMs /= repeatCount;
+	return result;
+}
+
+int main(int argc, const char** argv)
+{
+	unsigned int repeatCount = 1;
+	auto optimizationLevel = Jitter::CJitter::OPTIMIZATION_LEVEL_FULL;
+	bool printPassStats = false;
+	const char* tracePath = nullptr;
+	std::vector<const char*> paths;
+	for(int i = 1; i < argc; i++)
+	{
+		if(!strcmp(argv[i], "-r") && ((i + 1) < argc))
+		{
+			repeatCount = std::max(atoi(argv[++i]), 1);
+		}
+		else if(!strcmp(argv[i], "-O") && ((i + 1) < argc))
+		{
+			auto level = std::min(std::max(atoi(argv[++i]), 0), static_cast<int>(Jitter::CJitter::OPTIMIZATION_LEVEL_FULL));
+			optimizationLevel = static_cast<Jitter::CJitter::OPTIMIZATION_LEVEL>(level);
+		}
+		else if(!strcmp(argv[i], "-s"))
+		{
+			printPassStats = true;
+		}
+		else if(!strcmp(argv[i], "-t") && ((i + 1) < argc))
+		{
+			tracePath = argv[++i];
+		}
+		else
+		{
+			paths.push_back(argv[i]);
+		}
+	}
+
+	if(paths.empty())
+	{
+		printf("Usage: %s [-r repeatCount] [-O level] [-s] [-t traceFile] file...\n", argv[0]);
+		return 1;
+	}
+
+	Jitter::CJitter jitter(Jitter::CreateCodeGen());
+	jitter.SetOptimizationLevel(optimizationLevel);
+	jitter.SetPassStatsEnabled(printPassStats);
+
+	Framework::CMemStream traceStream;
+	std::unique_ptr<Jitter::CCompileTraceWriter> traceWriter;
+	if(tracePath)
+	{
+		traceWriter.reset(new Jitter::CCompileTraceWriter(traceStream));
+		jitter.SetCompileTraceWriter(traceWriter.get());
+	}
+
+	REPLAY_RESULT total;
+	int returnCode = 0;
+	for(const auto& path : paths)
+	{
+		Framework::CMemStream irStream;
+		if(!ReadFile(path, irStream))
+		{
+			fprintf(stderr, "%s: failed to open file.\n", path);
+			returnCode = 1;
+			continue;
+		}
+
+		try
+		{
+			auto result = ReplayFile(jitter, irStream, repeatCount);
+			printf("%s: %u functions, %llu bytes, %.3f ms\n", path, result.functionCount,
+				static_cast<unsigned long long>(result.codeSize), result.compileTimeMs);
+			total.functionCount += result.functionCount;
+			total.codeSize += result.codeSize;
+			total.compileTimeMs += result.compileTimeMs;
+		}
+		catch(const std::exception& exception)
+		{
+			fprintf(stderr, "%s: %s\n", path, exception.what());
+			returnCode = 1;
+		}
+	}
+
+	printf("Total: %u functions, %llu bytes, %.3f ms", total.functionCount,
+		static_cast<unsigned long long>(total.codeSize), total.compileTimeMs);
+	if(total.functionCount != 0)
+	{
+		printf(" (%.3f us per function)", (total.compileTimeMs * 1000.0) / total.functionCount);
+	}
+	printf("\n");
+
+	if(tracePath)
+	{
+		jitter.SetCompileTraceWriter(nullptr);
+		traceWriter.reset();
+		std::ofstream traceFile(tracePath, std::ios::binary);
+		traceFile.write(reinterpret_cast<const char*>(traceStream.GetBuffer()), traceStream.GetSize());
+		if(!traceFile)
+		{
+			fprintf(stderr, "%s: failed to write trace.\n", tracePath);
+			returnCode = 1;
+		}
+	}
+
+	if(printPassStats)
+	{
+		const auto& compileStats = jitter.GetCompileStats();
+		printf("Compile phases (over %u repeats):\n", repeatCount);
+		for(unsigned int i = 0; i < Jitter::CJitter::COMPILE_PHASE_COUNT; i++)
+		{
+			printf("%-20s %10.3f ms\n", Jitter::CJitter::GetCompilePhaseName(static_cast<Jitter::CJitter::COMPILE_PHASE>(i)),
+				static_cast<double>(compileStats.phaseTimes[i]) / (1000.0 * 1000.0));
+		}
+		printf("%llu statements in, %llu out, %llu register loads, %llu spills, %u bytes max stack\n",
+			static_cast<unsigned long long>(compileStats.statementsIn), static_cast<unsigned long long>(compileStats.statementsOut),
+			static_cast<unsigned long long>(compileStats.registerLoadCount), static_cast<unsigned long long>(compileStats.registerSpillCount),
+			compileStats.maxStackSize);
+
+		const auto& passStats = jitter.GetPassStats();
+		printf("Optimization passes (over %u repeats):\n", repeatCount);
+		for(unsigned int i = 0; i < Jitter::CJitter::OPTIMIZATION_PASS_COUNT; i++)
+		{
+			const auto& stats = passStats[i];
+			printf("%-20s %8u runs, %10.3f ms, %8lld statements removed\n",
+				Jitter::CJitter::GetPassName(static_cast<Jitter::CJitter::OPTIMIZATION_PASS>(i)), stats.runCount,
+				static_cast<double>(stats.time) / (1000.0 * 1000.0), static_cast<long long>(stats.statementsRemoved));
+		}
+	}
+
+	return returnCode;
+}
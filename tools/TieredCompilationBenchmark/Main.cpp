@@ -0,0 +1,113 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include "Jitter.h"
+#include "Jitter_CodeGenFactory.h"
+#include "MemStream.h"
+#include "MemoryFunction.h"
+
+//Compares both compile tiers: time to first execution (compile and first call) and steady state
+//throughput of the generated code.
+//Usage: TieredCompilationBenchmark [-n functionCount] [-s functionSize] [-c callCount]
+
+typedef std::chrono::steady_clock Clock;
+
+struct CONTEXT
+{
+	uint32		values[32];
+};
+
+struct TIER_RESULT
+{
+	double		firstExecutionMs = 0;
+	double		steadyStateMs = 0;
+	size_t		codeSize = 0;
+};
+
+static double ToMs(Clock::duration duration)
+{
+	return std::chrono::duration<double, std::milli>(duration).count();
+}
+
+static void EmitFunction(Jitter::CJitter& jitter, unsigned int seed, unsigned int size)
+{
+	for(unsigned int i = 0; i < size; i++)
+	{
+		uint32 value = (seed * 0x9E3779B9) ^ (i * 0x85EBCA6B);
+		jitter.PushRel((i % 32) * 4);
+		jitter.PushCst(value);
+		if(value & 1)
+		{
+			jitter.Add();
+		}
+		else
+		{
+			jitter.Xor();
+		}
+		jitter.PushRel(((i + 7) % 32) * 4);
+		jitter.Or();
+		jitter.PullRel(((i + 3) % 32) * 4);
+	}
+}
+
+static TIER_RESULT MeasureTier(Jitter::CJitter::COMPILE_TIER tier, unsigned int functionCount, unsigned int functionSize, unsigned int callCount)
+{
+	TIER_RESULT result;
+	CONTEXT context;
+	memset(&context, 0, sizeof(context));
+
+	Jitter::CJitter jitter(Jitter::CreateCodeGen());
+	jitter.SetCompileTier(tier);
+
+	std::vector<CMemoryFunction> functions;
+	auto startTime = Clock::now();
+	for(unsigned int i = 0; i < functionCount; i++)
+	{
+		Framework::CMemStream stream;
+		jitter.SetStream(&stream);
+		jitter.Begin();
+		EmitFunction(jitter, i, functionSize);
+		jitter.End();
+		functions.push_back(CMemoryFunction(stream.GetBuffer(), stream.GetSize()));
+		functions.back()(&context);
+		result.codeSize += stream.GetSize();
+	}
+	result.firstExecutionMs = ToMs(Clock::now() - startTime);
+
+	startTime = Clock::now();
+	for(unsigned int call = 0; call < callCount; call++)
+	{
+		for(auto& function : functions)
+		{
+			function(&context);
+		}
+	}
+	result.steadyStateMs = ToMs(Clock::now() - startTime);
+
+	return result;
+}
+
+int main(int argc, const char** argv)
+{
+	unsigned int functionCount = 64;
+	unsigned int functionSize = 64;
+	unsigned int callCount = 100000;
+	for(int i = 1; (i + 1) < argc; i += 2)
+	{
+		if(!strcmp(argv[i], "-n")) functionCount = atoi(argv[i + 1]);
+		else if(!strcmp(argv[i], "-s")) functionSize = atoi(argv[i + 1]);
+		else if(!strcmp(argv[i], "-c")) callCount = atoi(argv[i + 1]);
+	}
+
+	auto baseline = MeasureTier(Jitter::CJitter::COMPILE_TIER_BASELINE, functionCount, functionSize, callCount);
+	auto optimizing = MeasureTier(Jitter::CJitter::COMPILE_TIER_OPTIMIZING, functionCount, functionSize, callCount);
+
+	printf("Functions: %u, size: %u, calls: %u\n", functionCount, functionSize, callCount);
+	printf("%-12s %20s %20s %12s\n", "Tier", "First execution (ms)", "Steady state (ms)", "Code size");
+	printf("%-12s %20.3f %20.3f %12zu\n", "Baseline", baseline.firstExecutionMs, baseline.steadyStateMs, baseline.codeSize);
+	printf("%-12s %20.3f %20.3f %12zu\n", "Optimizing", optimizing.firstExecutionMs, optimizing.steadyStateMs, optimizing.codeSize);
+
+	return 0;
+}